@@ -123,6 +123,18 @@ class CCDBManagerInstance
 
   bool isHostReachable() const { return mCCDBAccessor.isHostReachable(); }
 
+  /// prefetch all listed paths for the current timestamp in one parallel batch,
+  /// populating the local snapshot cache; returns the number of objects retrieved
+  size_t prefetch(std::vector<std::string> const& paths)
+  {
+    std::vector<CcdbApi::PrefetchEntry> manifest;
+    manifest.reserve(paths.size());
+    for (auto& path : paths) {
+      manifest.push_back({path, mTimestamp, mMetaData});
+    }
+    return mCCDBAccessor.prefetch(manifest);
+  }
+
   /// clear all entries in the cache
   void clearCache() { mCache.clear(); }
 
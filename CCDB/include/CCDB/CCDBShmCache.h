@@ -0,0 +1,76 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+#ifndef O2_CCDB_CCDBSHMCACHE_H
+#define O2_CCDB_CCDBSHMCACHE_H
+
+#include <map>
+#include <memory>
+#include <string>
+
+namespace boost::interprocess
+{
+class mapped_region;
+}
+
+namespace o2::ccdb
+{
+
+/// A node-local cache of immutable CCDB payload blobs kept in POSIX shared
+/// memory. All processes on the same node which fetch the same object share
+/// a single physical copy of the downloaded blob instead of each holding its
+/// own, and only the first process pays the network round-trip. The cache is
+/// enabled by setting ALICEO2_CCDB_SHMCACHE in the environment and follows
+/// snapshot semantics: a blob, once published, is served as-is without
+/// re-validation against the server.
+///
+/// Flat objects (e.g. the GPU TPC correction maps) can be consumed directly
+/// from the read-only mapping returned by lookup(), in which case the memory
+/// is genuinely shared between all consumers; non-flat ROOT objects still
+/// need a private deserialized copy, but share the serialized blob.
+class CCDBShmCache
+{
+ public:
+  /// A read-only view of a cached blob; keeps the underlying shared memory
+  /// mapped for its own lifetime.
+  struct Blob {
+    const char* data = nullptr;
+    size_t size = 0;
+    std::map<std::string, std::string> headers;
+
+    explicit operator bool() const { return data != nullptr; }
+
+   private:
+    std::shared_ptr<boost::interprocess::mapped_region> mRegion;
+    friend class CCDBShmCache;
+  };
+
+  /// whether the cache was requested via ALICEO2_CCDB_SHMCACHE
+  static bool enabled();
+
+  /// look up the blob cached for a CCDB path; returns an empty Blob on miss
+  static Blob lookup(std::string const& path);
+
+  /// publish a downloaded blob and its response headers for a CCDB path;
+  /// no-op if an entry for the path already exists
+  static void publish(std::string const& path, const char* data, size_t size,
+                      std::map<std::string, std::string> const& headers);
+
+  /// remove the cache entry of a path (all entries if path is empty)
+  static void remove(std::string const& path = "");
+
+  /// the name of the shared memory segment used for a given CCDB path
+  static std::string segmentName(std::string const& path);
+};
+
+} // namespace o2::ccdb
+
+#endif // O2_CCDB_CCDBSHMCACHE_H
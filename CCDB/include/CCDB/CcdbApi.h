@@ -421,6 +421,26 @@ class CcdbApi //: public DatabaseInterface
    * @param requestContext Structure giving details about the transfer.
    */
   void vectoredLoadFileToMemory(std::vector<RequestContext>& requestContext) const;
+
+  /// An entry of a prefetch manifest: the object path and the timestamp for
+  /// which it must be valid (negative means "now"), plus optional metadata.
+  struct PrefetchEntry {
+    std::string path;
+    long timestamp = -1;
+    std::map<std::string, std::string> metadata = {};
+  };
+
+  /**
+   * Fetch all the objects of the manifest in parallel over the pooled
+   * multi-handle downloader, populating the local snapshot cache (when one
+   * is configured) so that the subsequent per-object retrieves are served
+   * locally. Meant to hide the WAN latency when cold-starting a workflow
+   * which needs O(100) calibration objects.
+   *
+   * @param manifest the (path, timestamp) pairs to fetch.
+   * @return the number of objects successfully retrieved.
+   */
+  size_t prefetch(std::vector<PrefetchEntry> const& manifest) const;
 #endif
 
  private:
@@ -610,6 +630,17 @@ class CcdbApi //: public DatabaseInterface
     return getSnapshotDir(topdir, path) + '/' + sfile;
   }
 
+  /**
+   * Rewrite a local snapshot file with zstd compression. The snapshot stays a regular
+   * self-describing ROOT file, so readers need no change, but decompression on subsequent
+   * loads is considerably faster than with the server-side default compression.
+   * Best effort: on any failure the original file is left untouched.
+   * @param filename path of the snapshot file to recompress in place
+   * @param level zstd compression level
+   * @return true if the file was recompressed
+   */
+  bool recompressLocalSnapshot(std::string const& filename, int level) const;
+
   // tmp helper and single point of entry for a CURL perform call
   // helps to switch between easy handle perform and multi handles in a single place
   CURLcode CURL_perform(CURL* handle) const;
@@ -623,6 +654,7 @@ class CcdbApi //: public DatabaseInterface
   std::string mSnapshotTopPath{};    // root of the snaphot in the snapshot backend mode, i.e. with init("file://<dir>) call
   std::string mSnapshotCachePath{};  // root of the local snapshot (to fill or impose, even if not in the snapshot backend mode)
   bool mPreferSnapshotCache = false; // if snapshot is available, don't try to query its validity even in non-snapshot backend mode
+  int mSnapshotZstdLevel = 0;        // if > 0, recompress created snapshots with zstd at this level, configured via ALICEO2_CCDB_SNAPSHOT_ZSTD
   bool mInSnapshotMode = false;
   mutable TGrid* mAlienInstance = nullptr;                       // a cached connection to TGrid (needed for Alien locations)
   bool mNeedAlienToken = true;                                   // On EPN and FLP we use a local cache and don't need the alien token
@@ -0,0 +1,136 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+#include "CCDB/CCDBShmCache.h"
+#include <fairlogger/Logger.h>
+#include <boost/interprocess/shared_memory_object.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <functional>
+#include <sstream>
+
+namespace o2::ccdb
+{
+
+namespace
+{
+constexpr char SegmentPrefix[] = "aliceccdbshm";
+// The magic is written only after payload and headers are completely copied,
+// so a reader racing with the publisher sees an incomplete entry as a miss.
+constexpr uint64_t SegmentMagic = 0x4343444253484d31; // "CCDBSHM1"
+
+struct SegmentHeader {
+  uint64_t magic = 0;
+  uint64_t payloadSize = 0;
+  uint64_t headersSize = 0;
+};
+} // namespace
+
+bool CCDBShmCache::enabled()
+{
+  static bool on = getenv("ALICEO2_CCDB_SHMCACHE") != nullptr;
+  return on;
+}
+
+std::string CCDBShmCache::segmentName(std::string const& path)
+{
+  std::hash<std::string> hasher;
+  return SegmentPrefix + std::to_string(hasher(path)).substr(0, 16);
+}
+
+CCDBShmCache::Blob CCDBShmCache::lookup(std::string const& path)
+{
+  using namespace boost::interprocess;
+  Blob blob;
+  try {
+    shared_memory_object shm(open_only, segmentName(path).c_str(), read_only);
+    auto region = std::make_shared<mapped_region>(shm, read_only);
+    if (region->get_size() < sizeof(SegmentHeader)) {
+      return blob;
+    }
+    auto const* header = static_cast<SegmentHeader const*>(region->get_address());
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (header->magic != SegmentMagic ||
+        sizeof(SegmentHeader) + header->payloadSize + header->headersSize > region->get_size()) {
+      return blob;
+    }
+    auto const* payload = static_cast<char const*>(region->get_address()) + sizeof(SegmentHeader);
+    std::istringstream headerStream(std::string(payload + header->payloadSize, header->headersSize));
+    std::string key, value;
+    while (std::getline(headerStream, key) && std::getline(headerStream, value)) {
+      blob.headers[key] = value;
+    }
+    blob.data = payload;
+    blob.size = header->payloadSize;
+    blob.mRegion = std::move(region);
+  } catch (std::exception const&) {
+    // no entry under this name, report a miss
+  }
+  return blob;
+}
+
+void CCDBShmCache::publish(std::string const& path, const char* data, size_t size,
+                           std::map<std::string, std::string> const& headers)
+{
+  using namespace boost::interprocess;
+  std::ostringstream headerStream;
+  for (auto& [key, value] : headers) {
+    if (key.find('\n') == std::string::npos && value.find('\n') == std::string::npos) {
+      headerStream << key << '\n' << value << '\n';
+    }
+  }
+  auto headerBlob = headerStream.str();
+  auto name = segmentName(path);
+  try {
+    // create_only makes concurrent publishers of the same path race benignly:
+    // the losers get an exception and keep the winner's (identical) blob
+    shared_memory_object shm(create_only, name.c_str(), read_write);
+    shm.truncate(sizeof(SegmentHeader) + size + headerBlob.size());
+    mapped_region region(shm, read_write);
+    auto* header = static_cast<SegmentHeader*>(region.get_address());
+    auto* payload = static_cast<char*>(region.get_address()) + sizeof(SegmentHeader);
+    std::memcpy(payload, data, size);
+    std::memcpy(payload + size, headerBlob.data(), headerBlob.size());
+    header->payloadSize = size;
+    header->headersSize = headerBlob.size();
+    std::atomic_thread_fence(std::memory_order_release);
+    header->magic = SegmentMagic;
+    LOGP(debug, "published {} bytes for {} to shared memory segment {}", size, path, name);
+  } catch (interprocess_exception const&) {
+    // already published by somebody else
+  } catch (std::exception const& e) {
+    LOGP(warn, "failed to publish {} to shared memory cache: {}", path, e.what());
+    shared_memory_object::remove(name.c_str());
+  }
+}
+
+void CCDBShmCache::remove(std::string const& path)
+{
+  using namespace boost::interprocess;
+  if (!path.empty()) {
+    shared_memory_object::remove(segmentName(path).c_str());
+    return;
+  }
+  // boost puts named segments into /dev/shm on Linux; drop everything
+  // carrying our prefix
+  std::error_code ec;
+  for (auto& entry : std::filesystem::directory_iterator("/dev/shm", ec)) {
+    auto name = entry.path().filename().string();
+    if (name.rfind(SegmentPrefix, 0) == 0) {
+      shared_memory_object::remove(name.c_str());
+    }
+  }
+}
+
+} // namespace o2::ccdb
@@ -16,6 +16,7 @@
 
 #include "CCDB/CcdbApi.h"
 #include "CCDB/CCDBQuery.h"
+#include "CCDB/CCDBShmCache.h"
 
 #include "CommonUtils/StringUtils.h"
 #include "CommonUtils/FileSystemUtils.h"
@@ -23,6 +24,7 @@
 #include "Framework/DefaultsHelpers.h"
 #include "Framework/DataTakingContext.h"
 #include <chrono>
+#include <deque>
 #include <memory>
 #include <sstream>
 #include <TFile.h>
@@ -35,6 +37,8 @@
 #include <fairlogger/Logger.h>
 #include <TError.h>
 #include <TClass.h>
+#include <TKey.h>
+#include <Compression.h>
 #include <CCDB/CCDBTimeStampUtils.h>
 #include <algorithm>
 #include <filesystem>
@@ -210,6 +214,12 @@ void CcdbApi::init(std::string const& host)
     }
     snapshotReport += ", prefer if available";
   }
+  if (getenv("ALICEO2_CCDB_SNAPSHOT_ZSTD")) {
+    mSnapshotZstdLevel = atoi(getenv("ALICEO2_CCDB_SNAPSHOT_ZSTD"));
+    if (mSnapshotZstdLevel > 0 && !snapshotReport.empty()) {
+      snapshotReport += fmt::format(", recompress with zstd level {}", mSnapshotZstdLevel);
+    }
+  }
   if (!snapshotReport.empty()) {
     snapshotReport += ')';
   }
@@ -939,6 +949,58 @@ void* CcdbApi::extractFromLocalFile(std::string const& filename, std::type_info
   return extractFromTFile(f, tcl);
 }
 
+bool CcdbApi::recompressLocalSnapshot(std::string const& filename, int level) const
+{
+  std::string tmpname = filename + ".zstd-tmp";
+  {
+    std::lock_guard<std::mutex> guard(gIOMutex);
+    TFile src(filename.c_str(), "READ");
+    if (src.IsZombie()) {
+      return false;
+    }
+    TFile dst(tmpname.c_str(), "RECREATE", "", ROOT::CompressionSettings(ROOT::kZSTD, level));
+    if (dst.IsZombie()) {
+      std::filesystem::remove(tmpname);
+      return false;
+    }
+    for (auto keyAsObj : *src.GetListOfKeys()) {
+      auto key = static_cast<TKey*>(keyAsObj);
+      auto cl = TClass::GetClass(key->GetClassName());
+      // trees cannot be cloned generically into another file and classes without
+      // dictionary cannot be rewritten; keep the original file in these cases
+      if (!cl || cl->InheritsFrom("TTree")) {
+        dst.Close();
+        std::filesystem::remove(tmpname);
+        return false;
+      }
+      void* obj = key->ReadObjectAny(cl);
+      if (!obj) {
+        dst.Close();
+        std::filesystem::remove(tmpname);
+        return false;
+      }
+      dst.WriteObjectAny(obj, cl, key->GetName());
+      if (cl->InheritsFrom("TObject")) {
+        delete static_cast<TObject*>(obj);
+      } else {
+        cl->Destructor(obj);
+      }
+    }
+    dst.Write();
+    dst.Close();
+    src.Close();
+  }
+  std::error_code ec;
+  std::filesystem::rename(tmpname, filename, ec);
+  if (ec) {
+    LOGP(warn, "Could not replace snapshot {} by its recompressed version: {}", filename, ec.message());
+    std::filesystem::remove(tmpname, ec);
+    return false;
+  }
+  LOGP(debug, "Recompressed local snapshot {} with zstd level {}", filename, level);
+  return true;
+}
+
 bool CcdbApi::initTGrid() const
 {
   if (mNeedAlienToken && !mAlienInstance) {
@@ -1131,6 +1193,8 @@ void* CcdbApi::retrieveFromTFile(std::type_info const& tinfo, std::string const&
       // if file not already here and valid --> snapshot it
       if (!retrieveBlob(path, mSnapshotCachePath, metadata, timestamp)) {
         out << "CCDB-access[" << getpid() << "] ... " << mUniqueAgentID << " failed to create directory for " << snapshotfile << "\n";
+      } else if (mSnapshotZstdLevel > 0) {
+        recompressLocalSnapshot(snapshotfile, mSnapshotZstdLevel);
       }
     } else {
       out << "CCDB-access[" << getpid() << "]  ... " << mUniqueAgentID << "serving from local snapshot " << snapshotfile << "\n";
@@ -1861,6 +1925,9 @@ void CcdbApi::saveSnapshot(RequestContext& requestContext) const
         std::ofstream objFile(snapshotpath, std::ios::out | std::ofstream::binary);
         std::copy(requestContext.dest.begin(), requestContext.dest.end(), std::ostreambuf_iterator<char>(objFile));
       }
+      if (mSnapshotZstdLevel > 0) {
+        recompressLocalSnapshot(snapshotpath, mSnapshotZstdLevel);
+      }
       // now open the same file as root file and store metadata
       updateMetaInformationInLocalFile(snapshotpath, &requestContext.headers, &querysummary);
     }
@@ -1896,6 +1963,16 @@ void CcdbApi::navigateSourcesAndLoadFile(RequestContext& requestContext, int& fr
     // if we are in snapshot mode we can simply open the file, unless the etag is non-empty:
     // this would mean that the object was is already fetched and in this mode we don't to validity checks!
     getFromSnapshot(createSnapshot, requestContext.path, requestContext.timestamp, requestContext.headers, snapshotpath, requestContext.dest, fromSnapshot, requestContext.etag);
+  } else if (CCDBShmCache::enabled() && requestContext.etag.empty()) {
+    // another process on this node may have published the blob already
+    if (auto blob = CCDBShmCache::lookup(requestContext.path)) {
+      requestContext.dest.resize(blob.size);
+      std::memcpy(requestContext.dest.data(), blob.data, blob.size);
+      requestContext.headers = blob.headers;
+      fromSnapshot = 2;
+    } else {
+      scheduleDownload(requestContext, requestCounter);
+    }
   } else { // look on the server
     scheduleDownload(requestContext, requestCounter);
   }
@@ -1927,8 +2004,40 @@ void CcdbApi::vectoredLoadFileToMemory(std::vector<RequestContext>& requestConte
       if (requestContext.considerSnapshot && fromSnapshots.at(i) != 2) {
         saveSnapshot(requestContext);
       }
+      if (CCDBShmCache::enabled() && fromSnapshots.at(i) == 0) {
+        // share the freshly downloaded blob with the other processes on this node
+        CCDBShmCache::publish(requestContext.path, requestContext.dest.data(), requestContext.dest.size(), requestContext.headers);
+      }
+    }
+  }
+}
+
+size_t CcdbApi::prefetch(std::vector<PrefetchEntry> const& manifest) const
+{
+  // RequestContext stores references to its buffers, so keep them in deques
+  // to guarantee address stability while we fill the context vector.
+  std::deque<o2::pmr::vector<char>> buffers(manifest.size());
+  std::deque<std::map<std::string, std::string>> headers(manifest.size());
+  std::vector<RequestContext> contexts;
+  contexts.reserve(manifest.size());
+  for (size_t i = 0; i < manifest.size(); i++) {
+    auto& entry = manifest[i];
+    RequestContext context(buffers[i], entry.metadata, headers[i]);
+    context.path = entry.path;
+    context.timestamp = entry.timestamp;
+    context.considerSnapshot = true;
+    contexts.push_back(context);
+  }
+  vectoredLoadFileToMemory(contexts);
+  size_t retrieved = 0;
+  for (size_t i = 0; i < contexts.size(); i++) {
+    if (!contexts[i].dest.empty()) {
+      retrieved++;
+    } else {
+      LOGP(alarm, "prefetch of {} for timestamp {} failed", manifest[i].path, manifest[i].timestamp);
     }
   }
+  return retrieved;
 }
 
 bool CcdbApi::loadLocalContentToMemory(o2::pmr::vector<char>& dest, std::string& url) const
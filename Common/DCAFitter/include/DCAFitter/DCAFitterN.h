@@ -21,6 +21,9 @@
 #include "ReconstructionDataFormats/Track.h"
 #include "DCAFitter/HelixHelper.h"
 #include "DetectorsBase/Propagator.h"
+#ifndef GPUCA_GPUCODE
+#include <gsl/span>
+#endif
 
 namespace o2
 {
@@ -217,6 +220,36 @@ class DCAFitterN
 
   template <class... Tr>
   GPUd() int process(const Tr&... args);
+
+  ///< same with the aux info (circle params, alpha sin/cos) of the tracks precomputed by the
+  ///< caller, to be reused when the same track is fitted against many partners
+  template <class... Tr>
+  GPUd() int process(const o2::gpu::gpustd::array<TrackAuxPar, N>& aux, const Tr&... args);
+
+#ifndef GPUCA_GPUCODE
+  ///< fit a common track against a batch of partner tracks (2-prong fits only), computing the aux
+  ///< info of the common track only once. For every pair producing at least one candidate the
+  ///< handler(iPartner, nCandidates) is invoked; the fitter state refers to the current pair only,
+  ///< so the handler must query the results it needs before returning. Returns the number of pairs
+  ///< with candidates.
+  template <typename Tr, typename H>
+  int processMany(const Tr& trcCommon, gsl::span<const Tr> partners, H&& handler)
+  {
+    static_assert(N == 2, "processMany is implemented for 2-prong fits");
+    const TrackAuxPar auxCommon(trcCommon, mBz);
+    int nFitted = 0;
+    for (size_t i = 0; i < partners.size(); i++) {
+      o2::gpu::gpustd::array<TrackAuxPar, N> aux{auxCommon, TrackAuxPar(partners[i], mBz)};
+      int nCand = process(aux, trcCommon, partners[i]);
+      if (nCand) {
+        nFitted++;
+        handler(int(i), nCand);
+      }
+    }
+    return nFitted;
+  }
+#endif
+
   GPUd() void print() const;
 
   GPUdi() int getFitterID() const { return mFitterID; }
@@ -224,6 +257,7 @@ class DCAFitterN
   GPUdi() size_t getCallID() const { return mCallID; }
 
  protected:
+  GPUd() int processImpl();
   GPUd() bool calcPCACoefs();
   GPUd() bool calcInverseWeight();
   GPUd() void calcResidDerivatives();
@@ -361,10 +395,31 @@ GPUd() int DCAFitterN<N, Args...>::process(const Tr&... args)
   mCallID++;
   static_assert(sizeof...(args) == N, "incorrect number of input tracks");
   assign(0, args...);
-  clear();
   for (int i = 0; i < N; i++) {
     mTrAux[i].set(*mOrigTrPtr[i], mBz);
   }
+  return processImpl();
+}
+
+///_________________________________________________________________________
+template <int N, typename... Args>
+template <class... Tr>
+GPUd() int DCAFitterN<N, Args...>::process(const o2::gpu::gpustd::array<TrackAuxPar, N>& aux, const Tr&... args)
+{
+  // entry point with the aux track info precomputed by the caller
+  mCallID++;
+  static_assert(sizeof...(args) == N, "incorrect number of input tracks");
+  assign(0, args...);
+  mTrAux = aux;
+  return processImpl();
+}
+
+///_________________________________________________________________________
+template <int N, typename... Args>
+GPUd() int DCAFitterN<N, Args...>::processImpl()
+{
+  // fit PCA of the assigned N tracks with already filled aux info
+  clear();
   if (!mCrossings.set(mTrAux[0], *mOrigTrPtr[0], mTrAux[1], *mOrigTrPtr[1], mMaxDXYIni, mIsCollinear)) { // even for N>2 it should be enough to test just 1 loop
     return 0;                                                                                            // no crossing
   }
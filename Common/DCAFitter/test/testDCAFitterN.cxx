@@ -552,5 +552,75 @@ BOOST_AUTO_TEST_CASE(DCAFitterNProngs)
   outStream.Close();
 }
 
+BOOST_AUTO_TEST_CASE(DCAFitterCachedAux)
+{
+  // check that the fit with caller-precomputed aux info and the batched interface reproduce
+  // the plain per-pair processing, and compare their timing
+  constexpr int NTest = 10000;
+  TGenPhaseSpace genPHS;
+  constexpr double pion = 0.13957;
+  constexpr double k0 = 0.49761;
+  std::vector<double> k0dec = {pion, pion};
+  std::vector<int> forceQ{1, 1};
+  std::vector<o2::track::TrackParCov> vctracks;
+  Vec3D vtxGen;
+  double bz = 5.0;
+
+  o2::vertexing::DCAFitterN<2> ft;
+  ft.setBz(bz);
+  ft.setPropagateToPCA(true);
+  ft.setMaxR(200);
+  ft.setMaxDZIni(4);
+  ft.setMaxDXYIni(4);
+  ft.setMinParamChange(1e-3);
+  ft.setMinRelChi2Change(0.9);
+  ft.setUseAbsDCA(true);
+
+  std::vector<o2::track::TrackParCov> prongsP, prongsN;
+  for (int iev = 0; iev < NTest; iev++) {
+    generate(vtxGen, vctracks, bz, genPHS, k0, k0dec, forceQ);
+    prongsP.push_back(vctracks[0]);
+    prongsN.push_back(vctracks[1]);
+  }
+
+  TStopwatch swPlain, swAux;
+  swPlain.Stop();
+  swAux.Stop();
+  int nfoundPlain = 0, nfoundAux = 0;
+  for (int iev = 0; iev < NTest; iev++) {
+    swPlain.Start(false);
+    int ncP = ft.process(prongsP[iev], prongsN[iev]);
+    swPlain.Stop();
+    auto pcaP = ncP ? ft.getPCACandidatePos() : o2::gpu::gpustd::array<float, 3>{};
+    nfoundPlain += ncP > 0;
+
+    o2::track::TrackAuxPar auxP(prongsP[iev], bz), auxN(prongsN[iev], bz);
+    swAux.Start(false);
+    int ncA = ft.process({auxP, auxN}, prongsP[iev], prongsN[iev]);
+    swAux.Stop();
+    nfoundAux += ncA > 0;
+    BOOST_CHECK(ncA == ncP);
+    if (ncP && ncA) {
+      auto pcaA = ft.getPCACandidatePos();
+      BOOST_CHECK_SMALL(pcaA[0] - pcaP[0], 1e-6f);
+      BOOST_CHECK_SMALL(pcaA[1] - pcaP[1], 1e-6f);
+      BOOST_CHECK_SMALL(pcaA[2] - pcaP[2], 1e-6f);
+    }
+  }
+  BOOST_CHECK(nfoundAux == nfoundPlain);
+  LOG(info) << "Processed " << NTest << " pairs: plain CPU time: " << swPlain.CpuTime()
+            << " cached-aux CPU time: " << swAux.CpuTime();
+
+  // batched interface: each positive prong against a small batch of negatives
+  constexpr int NBatch = 16;
+  int nfoundMany = 0;
+  for (int iev = 0; iev + NBatch <= NTest; iev += NBatch) {
+    gsl::span<const o2::track::TrackParCov> partners(&prongsN[iev], NBatch);
+    nfoundMany += ft.processMany(prongsP[iev], partners, [](int, int nCand) { BOOST_CHECK(nCand > 0); });
+  }
+  BOOST_CHECK(nfoundMany >= (NTest / NBatch)); // at least the true partner of each batch must fit
+  LOG(info) << "Batched processing found " << nfoundMany << " candidate pairs";
+}
+
 } // namespace vertexing
 } // namespace o2
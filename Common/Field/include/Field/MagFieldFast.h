@@ -53,6 +53,7 @@ class MagFieldFast
 
   bool Field(const double xyz[3], double bxyz[3]) const;
   bool Field(const float xyz[3], float bxyz[3]) const;
+  bool Field(int npoints, const float* xyz, float* bxyz) const;
   bool Field(const math_utils::Point3D<float> xyz, float bxyz[3]) const;
   bool Field(const math_utils::Point3D<double> xyz, double bxyz[3]) const;
   bool GetBcomp(EDim comp, const double xyz[3], double& b) const;
@@ -202,6 +202,38 @@ bool MagFieldFast::Field(const float xyz[3], float bxyz[3]) const
   return true;
 }
 
+//_______________________________________________________________________
+bool MagFieldFast::Field(int npoints, const float* xyz, float* bxyz) const
+{
+  // batch version for npoints consecutive xyz triplets: the monomial table is
+  // built once per point and shared by the 3 components, so that the inner
+  // coefficient loops reduce to plain dot products which the compiler can
+  // vectorize. Points outside of the parametrization range get a zero field.
+  bool ok = true;
+  for (int i = 0; i < npoints; i++) {
+    const float x = xyz[3 * i + kX], y = xyz[3 * i + kY], z = xyz[3 * i + kZ];
+    int zSeg, rSeg, quadrant;
+    if (!GetSegment(x, y, z, zSeg, rSeg, quadrant)) {
+      bxyz[3 * i + kX] = bxyz[3 * i + kY] = bxyz[3 * i + kZ] = 0.f;
+      ok = false;
+      continue;
+    }
+    const SolParam* par = &mSolPar[rSeg][zSeg][quadrant];
+    const float mono[kNPolCoefs] = {1.f, x, y, z, x * x, x * y, x * z, y * y, y * z, z * z,
+                                    x * x * x, x * x * y, x * x * z, x * y * y, x * y * z,
+                                    x * z * z, y * y * y, y * y * z, y * z * z, z * z * z};
+    for (int dim = 0; dim < kNDim; dim++) {
+      const float* cf = par->parBxyz[dim];
+      float val = 0.f;
+      for (int k = 0; k < kNPolCoefs; k++) {
+        val += cf[k] * mono[k];
+      }
+      bxyz[3 * i + dim] = val * mFactorSol;
+    }
+  }
+  return ok;
+}
+
 //_______________________________________________________________________
 bool MagFieldFast::Field(const math_utils::Point3D<float> xyz, float bxyz[3]) const
 {
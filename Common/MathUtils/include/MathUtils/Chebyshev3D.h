@@ -130,6 +130,12 @@ class Chebyshev3D : public TNamed
 
   void Eval(const Float_t* par, Float_t* res);
 
+  /// Evaluates the parameterization for npoints 3D points at once, with par holding
+  /// npoints consecutive (x,y,z) triplets and res receiving DimOut values per point
+  /// (point-major). Points are processed in SIMD blocks, so for arrays of queries
+  /// this is considerably faster than calling the single point Eval in a loop.
+  void Eval(int npoints, const Float_t* par, Float_t* res);
+
   Float_t Eval(const Float_t* par, int idim);
 
   void Eval(const Double_t* par, Double_t* res);
@@ -21,7 +21,9 @@
 #include <TRandom.h>                   // for TRandom, gRandom
 #include <TString.h>                   // for TString
 #include <TSystem.h>                   // for TSystem, gSystem
+#include <Vc/Vc>                       // for float_v
 #include <cstdio>                      // for printf, fprintf, FILE, fclose, fflush, etc
+#include <vector>                      // for vector
 #include "MathUtils/Chebyshev3DCalc.h" // for Chebyshev3DCalc, etc
 #include "TMathBase.h"                 // for Max, Abs
 #include "TNamed.h"                    // for TNamed
@@ -340,6 +342,76 @@ void Chebyshev3D::prepareBoundaries(const Float_t* bmin, const Float_t* bmax)
   }
 }
 
+namespace
+{
+// Clenshaw summation for a SIMD block of arguments sharing the same coefficient
+// array (the boundary structure of the parameterization does not depend on the
+// query point). The array may hold scalar or SIMD-vector coefficients.
+template <typename T>
+inline Vc::float_v chebyshevEvaluation1D(Vc::float_v x, const T* array, int ncf)
+{
+  if (ncf <= 0) {
+    return Vc::float_v(0.f);
+  }
+  Vc::float_v b0 = array[--ncf], b1 = 0.f, b2 = 0.f, x2 = x + x;
+  for (int i = ncf; i--;) {
+    b2 = b1;
+    b1 = b0;
+    b0 = array[i] + x2 * b1 - b2;
+  }
+  return b0 - x * b1;
+}
+} // namespace
+
+void Chebyshev3D::Eval(int npoints, const Float_t* par, Float_t* res)
+{
+  // batched evaluation: full SIMD lanes are processed in parallel through the
+  // Clenshaw recurrences, the remainder goes through the single point Eval
+  constexpr int kVecSize = Vc::float_v::Size;
+  int maxCols = 0, maxRows = 0;
+  for (int idim = mOutputArrayDimension; idim--;) {
+    const auto* calc = getChebyshevCalc(idim);
+    maxCols = TMath::Max(maxCols, calc->getNumberOfColumns());
+    maxRows = TMath::Max(maxRows, calc->getNumberOfRows());
+  }
+  // per-lane temporaries replacing the internal buffers of the scalar calculators
+  std::vector<Vc::float_v> tmp2D(maxCols), tmp1D(maxRows);
+  int ip = 0;
+  for (; ip + kVecSize <= npoints; ip += kVecSize) {
+    Vc::float_v mapped[3];
+    for (int i = 3; i--;) {
+      for (int lane = kVecSize; lane--;) {
+        mapped[i][lane] = mapToInternal(par[3 * (ip + lane) + i], i);
+      }
+    }
+    for (int idim = mOutputArrayDimension; idim--;) {
+      const auto* calc = getChebyshevCalc(idim);
+      const auto* nColsAtRow = calc->getNumberOfColumnsAtRow();
+      const auto* colAtRowBg = calc->getColAtRowBg();
+      const auto* coefBound0 = calc->getCoefficientBound2D0();
+      const auto* coefBound1 = calc->getCoefficientBound2D1();
+      const auto* coefs = calc->getCoefficients();
+      const int nRows = calc->getNumberOfRows();
+      for (int id0 = nRows; id0--;) {
+        int nCLoc = nColsAtRow[id0]; // number of significant coefs on this row
+        int col0 = colAtRowBg[id0];  // beginning of local column in the 2D boundary matrix
+        for (int id1 = nCLoc; id1--;) {
+          int idc = id1 + col0;
+          tmp2D[id1] = chebyshevEvaluation1D(mapped[2], coefs + coefBound1[idc], coefBound0[idc]);
+        }
+        tmp1D[id0] = chebyshevEvaluation1D(mapped[1], tmp2D.data(), nCLoc);
+      }
+      const auto out = chebyshevEvaluation1D(mapped[0], tmp1D.data(), nRows);
+      for (int lane = kVecSize; lane--;) {
+        res[(ip + lane) * mOutputArrayDimension + idim] = out[lane];
+      }
+    }
+  }
+  for (; ip < npoints; ip++) {
+    Eval(par + 3 * ip, res + ip * mOutputArrayDimension);
+  }
+}
+
 #ifdef _INC_CREATION_Chebyshev3D_
 
 // Pointer on user function (faster altrnative to TMethodCall)
@@ -427,21 +499,34 @@ Int_t Chebyshev3D::calculateChebyshevCoefficients(const Float_t* funval, int np,
 {
   // Calculate Chebyshev coeffs using precomputed function values at np roots.
   // If prec>0, estimate the highest coeff number providing the needed precision
-  double sm;                        // do summations in double to minimize the roundoff error
-  for (int ic = 0; ic < np; ic++) { // compute coeffs
-    sm = 0;
-    for (int ir = 0; ir < np; ir++) {
-      float rt = TMath::Cos(ic * (ir + 0.5) * TMath::Pi() / np);
-      sm += funval[ir] * rt;
+  // do summations in double to minimize the roundoff error; the cos(ic*theta)
+  // weights obey the Chebyshev recurrence in ic, so only one cosine per root is
+  // evaluated and the inner loop reduces to multiply-adds
+  std::vector<double> sums(np, 0.);
+  for (int ir = 0; ir < np; ir++) {
+    const double c1 = TMath::Cos((ir + 0.5) * TMath::Pi() / np);
+    const double fv = funval[ir];
+    double cPrv = c1, cPrv2 = 1.; // cos(1*theta), cos(0*theta)
+    sums[0] += fv;
+    if (np > 1) {
+      sums[1] += fv * c1;
+    }
+    for (int ic = 2; ic < np; ic++) {
+      const double c = 2. * c1 * cPrv - cPrv2;
+      cPrv2 = cPrv;
+      cPrv = c;
+      sums[ic] += fv * c;
     }
-    outCoefs[ic] = Float_t(sm * ((ic == 0) ? 1. / np : 2. / np));
+  }
+  for (int ic = 0; ic < np; ic++) { // compute coeffs
+    outCoefs[ic] = Float_t(sums[ic] * ((ic == 0) ? 1. / np : 2. / np));
   }
 
   if (prec <= 0) {
     return np;
   }
 
-  sm = 0;
+  double sm = 0;
   int cfMax = 0;
   for (cfMax = np; cfMax--;) {
     sm += TMath::Abs(outCoefs[cfMax]);
@@ -0,0 +1,85 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+/// \file benchChebyshev3D.cxx
+/// \brief Benchmark comparing single point and batched Chebyshev3D evaluation
+
+#include "MathUtils/Chebyshev3D.h"
+#include <benchmark/benchmark.h>
+#include <TRandom.h>
+#include <cmath>
+#include <vector>
+
+namespace
+{
+constexpr float kBMin[3] = {-80.f, -80.f, -250.f};
+constexpr float kBMax[3] = {80.f, 80.f, 250.f};
+
+// smooth 3D->3 function standing in for a field-like parameterization
+void testFunction(float* par, float* res)
+{
+  res[0] = std::sin(par[0] / 40.f) * std::cos(par[1] / 60.f) + 0.1f * par[2] / 250.f;
+  res[1] = std::cos(par[0] / 60.f) * std::sin(par[2] / 100.f) - 0.2f * par[1] / 80.f;
+  res[2] = std::exp(-0.5f * (par[0] * par[0] + par[1] * par[1]) / (60.f * 60.f)) * par[2] / 250.f;
+}
+
+o2::math_utils::Chebyshev3D& getParameterization()
+{
+  static const int npoints[3] = {15, 15, 15};
+  static o2::math_utils::Chebyshev3D cheb(testFunction, 3, kBMin, kBMax, npoints, 1e-5f);
+  return cheb;
+}
+
+std::vector<float> makeQueryPoints(size_t n)
+{
+  std::vector<float> points(3 * n);
+  gRandom->SetSeed(12345);
+  for (size_t i = 0; i < n; i++) {
+    for (int j = 0; j < 3; j++) {
+      points[3 * i + j] = gRandom->Uniform(kBMin[j], kBMax[j]);
+    }
+  }
+  return points;
+}
+} // namespace
+
+static void BM_Chebyshev3DEvalScalar(benchmark::State& state)
+{
+  auto& cheb = getParameterization();
+  const size_t n = state.range(0);
+  auto points = makeQueryPoints(n);
+  std::vector<float> res(3 * n);
+  for (auto _ : state) {
+    for (size_t i = 0; i < n; i++) {
+      cheb.Eval(&points[3 * i], &res[3 * i]);
+    }
+    benchmark::DoNotOptimize(res.data());
+    benchmark::ClobberMemory();
+  }
+}
+
+static void BM_Chebyshev3DEvalBatch(benchmark::State& state)
+{
+  auto& cheb = getParameterization();
+  const size_t n = state.range(0);
+  auto points = makeQueryPoints(n);
+  std::vector<float> res(3 * n);
+  for (auto _ : state) {
+    cheb.Eval(n, points.data(), res.data());
+    benchmark::DoNotOptimize(res.data());
+    benchmark::ClobberMemory();
+  }
+}
+
+BENCHMARK(BM_Chebyshev3DEvalScalar)->Arg(100)->Arg(1000)->Arg(10000);
+BENCHMARK(BM_Chebyshev3DEvalBatch)->Arg(100)->Arg(1000)->Arg(10000);
+
+BENCHMARK_MAIN();
@@ -16,6 +16,7 @@
 
 #include <vector>
 #include <cassert>
+#include <cstdint>
 #include <map>
 #include <unordered_map>
 #include <boost/property_tree/ptree_fwd.hpp>
@@ -136,6 +137,9 @@ class EnumRegistry
   std::unordered_map<std::string, EnumLegalValues> entries;
 };
 
+template <typename T>
+class ConfigurableParamAccessor;
+
 class ConfigurableParam
 {
  public:
@@ -188,9 +192,17 @@ class ConfigurableParam
   static void writeINI(std::string const& filename, std::string const& keyOnly = "");
 
   // can be used instead of using API on concrete child classes
+  // NOTE: this traverses the string-keyed property tree on each call; for
+  // lookups in hot code use a ConfigurableParamAccessor which resolves the
+  // key only once
   template <typename T>
   static T getValueAs(std::string key)
   {
+    if (sCountAccesses) {
+      if (auto* counter = accessCounter(key)) {
+        ++(*counter);
+      }
+    }
     return [](auto* tree, const std::string& key) -> T {
       if (!sIsFullyInitialized) {
         initialize();
@@ -199,6 +211,10 @@ class ConfigurableParam
     }(sPtree, key);
   }
 
+  // print how often each parameter key was accessed (sorted by frequency);
+  // counting is enabled by setting the ALICEO2_PARAM_ACCESS_COUNTS environment variable
+  static void printAccessCounts(bool useLogger = false);
+
   template <typename T>
   static void setValue(std::string const& mainkey, std::string const& subkey, T x)
   {
@@ -307,6 +323,24 @@ class ConfigurableParam
   void setRegisterMode(bool b) { sRegisterMode = b; }
   bool isInitialized() const { return sIsFullyInitialized; }
 
+  // resolve the storage location of a plain member key, checking that the
+  // stored type matches @a tinfo; returns nullptr if the key does not refer
+  // to a plain member (e.g. an array element) or the type does not match
+  static void const* retrieveStorage(std::string const& key, std::type_info const& tinfo);
+
+  // return a stable pointer to the access counter of @a key, or nullptr if
+  // access counting is disabled
+  static uint64_t* accessCounter(std::string const& key);
+
+  // per-key access frequencies (lazily created, only when counting is enabled)
+  static std::map<std::string, uint64_t>* sAccessCountMap;
+
+  // whether per-key access counting is enabled (ALICEO2_PARAM_ACCESS_COUNTS)
+  static bool sCountAccesses;
+
+  template <typename T>
+  friend class ConfigurableParamAccessor;
+
   // friend class o2::ccdb::CcdbApi;
  private:
   // static registry for implementations of this type
@@ -317,6 +351,49 @@ class ConfigurableParam
   static bool sRegisterMode;                  //! (flag to enable/disable autoregistering of child classes)
 };
 
+// A cached typed accessor to a single value of the parameter registry.
+// The string lookup is performed only once, on the first get(); afterwards
+// the value is read directly from the memory of the parameter singleton,
+// which the registry keeps in sync on updates (command line, CCDB, ...).
+// Example:
+//   static ConfigurableParamAccessor<double> gasDensity{"TPCGas.mGasDensity"};
+//   auto rho = gasDensity.get();
+// Keys which do not map to a plain member (e.g. single array elements) fall
+// back to the property tree lookup of getValueAs.
+template <typename T>
+class ConfigurableParamAccessor
+{
+ public:
+  ConfigurableParamAccessor(std::string key) : mKey{std::move(key)} {}
+  ConfigurableParamAccessor(std::string const& mainkey, std::string const& subkey) : mKey{mainkey + "." + subkey} {}
+
+  T get()
+  {
+    if (!mResolved) {
+      mStorage = ConfigurableParam::retrieveStorage(mKey, typeid(T));
+      mCounter = ConfigurableParam::accessCounter(mKey);
+      mResolved = true;
+    }
+    if (mStorage != nullptr) {
+      if (mCounter != nullptr) {
+        ++(*mCounter);
+      }
+      return *static_cast<T const*>(mStorage);
+    }
+    // not a plain member of a parameter singleton, go through the property
+    // tree (which also does the access counting)
+    return ConfigurableParam::getValueAs<T>(mKey);
+  }
+
+  std::string const& key() const { return mKey; }
+
+ private:
+  std::string mKey;
+  void const* mStorage = nullptr;
+  uint64_t* mCounter = nullptr;
+  bool mResolved = false;
+};
+
 } // end namespace conf
 } // end namespace o2
 
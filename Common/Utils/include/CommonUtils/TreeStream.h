@@ -29,6 +29,8 @@ namespace o2
 {
 namespace utils
 {
+class TreeStreamRedirector;
+
 /// The TreeStream class allows creating a root tree of any objects having root
 /// dictionary, using operator<< interface, and w/o prior tree declaration.
 /// The format is:
@@ -63,6 +65,20 @@ class TreeStream
   const char* getName() const { return mTree.GetName(); }
   void setID(int id) { mID = id; }
   int getID() const { return mID; }
+
+  /// if set, Endl defers the fill of elementary typed rows to the redirector's
+  /// background thread (see TreeStreamRedirector::enableAsyncFill)
+  void setAsyncRedirector(TreeStreamRedirector* red) { mAsyncRedirector = red; }
+  /// true if the current row consists of elementary typed elements only: objects
+  /// are attached via user owned pointers whose content cannot be captured by value
+  bool canFillAsync() const;
+  /// serialize the values of the current row into a flat buffer, to be consumed by fillCapturedRow
+  std::vector<char> captureRow() const;
+  /// restore a row captured by captureRow and fill the tree with it; invoked
+  /// from the background thread of the owning TreeStreamRedirector
+  void fillCapturedRow(const char* data, size_t size);
+  /// size in bytes of an elementary element of given type code
+  static int getTypeSize(char type);
   TreeStream& operator<<(const Bool_t& b)
   {
     CheckIn('B', &b);
@@ -170,6 +186,8 @@ class TreeStream
   int mNextNameCounter = 0;        ///< next name counter
   int mStatus = 0;                 ///< status of the layout
   TString mNextName;               ///< name for next entry
+  TreeStreamRedirector* mAsyncRedirector = nullptr; //!< owner of the background fill thread, if any
+  std::vector<ULong64_t> mRowScratch;               //!< aligned value storage used by fillCapturedRow
 
   ClassDefNV(TreeStream, 0);
 };
@@ -18,6 +18,12 @@
 
 #include <Rtypes.h>
 #include <TDirectory.h>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
 #include "CommonUtils/TreeStream.h"
 
 namespace o2
@@ -36,6 +42,11 @@ namespace utils
 /// The flushing of trees to the file happens on TreeStreamRedirector::Close() call
 /// or at its desctruction.
 ///
+/// After enableAsyncFill() rows consisting of elementary types only are captured
+/// by value and the (compressing) TTree::Fill runs in a background thread, so
+/// that enabled debug streams cost the caller little more than a copy of the row.
+/// Rows containing objects are still filled synchronously.
+///
 /// See testTreeStream.cxx for functional example
 ///
 class TreeStreamRedirector
@@ -52,14 +63,33 @@ class TreeStreamRedirector
   void SetFile(TFile* sfile);
   static void FixLeafNameBug(TTree* tree);
 
+  /// spawn the background thread filling captured rows, see class description
+  void enableAsyncFill();
+  /// block until all rows enqueued so far are filled
+  void drainAsyncFill();
+
  private:
   TreeStreamRedirector(const TreeStreamRedirector& tsr);
   TreeStreamRedirector& operator=(const TreeStreamRedirector& tsr);
 
+  void enqueueAsyncFill(TreeStream* layout, std::vector<char>&& row);
+  void asyncFillLoop();
+  friend class TreeStream; // for enqueueAsyncFill / drainAsyncFill
+
+  static constexpr size_t MaxQueuedRows = 0x1 << 16; // backpressure threshold for the fill queue
+
   std::unique_ptr<TDirectory> mOwnDirectory;             // own directory of the redirector
   TDirectory* mDirectory = nullptr;                      // output directory
   std::vector<std::unique_ptr<TreeStream>> mDataLayouts; // array of data layouts
 
+  std::deque<std::pair<TreeStream*, std::vector<char>>> mAsyncRows; //!< captured rows pending fill
+  std::mutex mAsyncMutex;                                           //!< protects the row queue
+  std::condition_variable mAsyncCV;                                 //!< signals new rows or stop to the worker
+  std::condition_variable mAsyncDoneCV;                             //!< signals processed rows to waiters
+  std::thread mAsyncThread;                                         //!< background fill thread
+  bool mAsyncStop = false;                                          //!< request the worker to terminate
+  bool mAsyncBusy = false;                                          //!< worker is filling a row
+
   ClassDefNV(TreeStreamRedirector, 0);
 };
 } // namespace utils
@@ -53,6 +53,8 @@ EnumRegistry* ConfigurableParam::sEnumRegistry = nullptr;
 
 bool ConfigurableParam::sIsFullyInitialized = false;
 bool ConfigurableParam::sRegisterMode = true;
+std::map<std::string, uint64_t>* ConfigurableParam::sAccessCountMap = nullptr;
+bool ConfigurableParam::sCountAccesses = getenv("ALICEO2_PARAM_ACCESS_COUNTS") != nullptr;
 
 // ------------------------------------------------------------------
 
@@ -266,6 +268,57 @@ void ConfigurableParam::printAllKeyValuePairs(bool useLogger)
 
 // ------------------------------------------------------------------
 
+void const* ConfigurableParam::retrieveStorage(std::string const& key, std::type_info const& tinfo)
+{
+  if (!sIsFullyInitialized) {
+    initialize();
+  }
+  auto iter = sKeyToStorageMap->find(key);
+  if (iter == sKeyToStorageMap->end() || iter->second.first != tinfo) {
+    return nullptr;
+  }
+  return iter->second.second;
+}
+
+// ------------------------------------------------------------------
+
+uint64_t* ConfigurableParam::accessCounter(std::string const& key)
+{
+  if (!sCountAccesses) {
+    return nullptr;
+  }
+  if (sAccessCountMap == nullptr) {
+    sAccessCountMap = new std::map<std::string, uint64_t>;
+  }
+  // std::map guarantees stable addresses, so the counter can be cached
+  return &(*sAccessCountMap)[key];
+}
+
+// ------------------------------------------------------------------
+
+void ConfigurableParam::printAccessCounts(bool useLogger)
+{
+  if (sAccessCountMap == nullptr || sAccessCountMap->empty()) {
+    if (useLogger) {
+      LOG(info) << "No parameter access counts recorded (set ALICEO2_PARAM_ACCESS_COUNTS to enable counting)";
+    } else {
+      std::cout << "No parameter access counts recorded (set ALICEO2_PARAM_ACCESS_COUNTS to enable counting)\n";
+    }
+    return;
+  }
+  std::vector<std::pair<std::string, uint64_t>> entries(sAccessCountMap->begin(), sAccessCountMap->end());
+  std::sort(entries.begin(), entries.end(), [](auto const& a, auto const& b) { return a.second > b.second; });
+  for (auto const& [key, count] : entries) {
+    if (useLogger) {
+      LOG(info) << "Param access count: " << key << " : " << count;
+    } else {
+      std::cout << "Param access count: " << key << " : " << count << "\n";
+    }
+  }
+}
+
+// ------------------------------------------------------------------
+
 ConfigurableParam::EParamProvenance ConfigurableParam::getProvenance(const std::string& key)
 {
   if (!sIsFullyInitialized) {
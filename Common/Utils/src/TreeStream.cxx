@@ -12,7 +12,9 @@
 //  For the functionality of TreeStream see the testTreeStream.cxx
 
 #include "CommonUtils/TreeStream.h"
+#include "CommonUtils/TreeStreamRedirector.h"
 #include <TBranch.h>
+#include <cstring>
 
 using namespace o2::utils;
 
@@ -135,15 +137,110 @@ TreeStream& TreeStream::Endl()
 {
   // Perform pseudo endl operation
 
-  if (mTree.GetNbranches() == 0) {
-    BuildTree();
+  if (mAsyncRedirector && !mStatus && canFillAsync()) {
+    if (mTree.GetNbranches() < static_cast<int>(mElements.size())) {
+      // branch creation (and eventual back-filling) must not race with rows
+      // still being processed by the background thread
+      mAsyncRedirector->drainAsyncFill();
+      BuildTree();
+    }
+    mAsyncRedirector->enqueueAsyncFill(this, captureRow());
+  } else {
+    if (mAsyncRedirector) {
+      // rows with object elements are filled synchronously from the caller
+      mAsyncRedirector->drainAsyncFill();
+    }
+    if (mTree.GetNbranches() == 0) {
+      BuildTree();
+    }
+    Fill();
   }
-  Fill();
   mStatus = 0;
   mCurrentIndex = 0;
   return *this;
 }
 
+//_________________________________________________
+int TreeStream::getTypeSize(char type)
+{
+  // size in bytes of the value of an elementary element (see CheckIn type codes)
+  switch (type) {
+    case 'B':
+    case 'b':
+      return 1;
+    case 'S':
+    case 's':
+      return 2;
+    case 'I':
+    case 'i':
+    case 'F':
+      return 4;
+    case 'L':
+    case 'l':
+    case 'D':
+      return 8;
+    default:
+      return 0;
+  }
+}
+
+//_________________________________________________
+bool TreeStream::canFillAsync() const
+{
+  // only rows made entirely of elementary typed elements can be captured by value
+  for (const auto& element : mElements) {
+    if (!element.type || !element.ptr) {
+      return false;
+    }
+  }
+  return !mElements.empty();
+}
+
+//_________________________________________________
+std::vector<char> TreeStream::captureRow() const
+{
+  // serialize the current row: element count followed by (type code, value) pairs.
+  // The layout is self-describing so that the background thread does not need to
+  // access mElements, which the caller keeps modifying for subsequent rows
+  const int nelem = static_cast<int>(mElements.size());
+  std::vector<char> buf;
+  buf.reserve(sizeof(int) + nelem * (1 + sizeof(ULong64_t)));
+  buf.resize(sizeof(int));
+  std::memcpy(buf.data(), &nelem, sizeof(int));
+  for (const auto& element : mElements) {
+    buf.push_back(element.type);
+    const int sz = getTypeSize(element.type);
+    const size_t pos = buf.size();
+    buf.resize(pos + sz);
+    std::memcpy(buf.data() + pos, element.ptr, sz);
+  }
+  return buf;
+}
+
+//_________________________________________________
+void TreeStream::fillCapturedRow(const char* data, size_t size)
+{
+  // restore the values captured by captureRow and fill the tree; runs in the
+  // background thread of the owning redirector, which is the only one touching
+  // the tree while asynchronous filling is active
+  int nelem = 0;
+  std::memcpy(&nelem, data, sizeof(int));
+  const char* ptr = data + sizeof(int);
+  if (mRowScratch.size() < static_cast<size_t>(nelem)) {
+    mRowScratch.resize(nelem);
+  }
+  for (int i = 0; i < nelem; i++) {
+    const char type = *ptr++;
+    const int sz = getTypeSize(type);
+    std::memcpy(&mRowScratch[i], ptr, sz);
+    ptr += sz;
+    if (i < static_cast<int>(mBranches.size()) && mBranches[i]) {
+      mBranches[i]->SetAddress(&mRowScratch[i]);
+    }
+  }
+  mTree.Fill();
+}
+
 //_________________________________________________
 TreeStream& TreeStream::operator<<(const Char_t* name)
 {
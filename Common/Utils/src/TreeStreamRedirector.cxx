@@ -77,6 +77,9 @@ TreeStream& TreeStreamRedirector::operator<<(Int_t id)
   mDataLayouts.emplace_back(std::unique_ptr<TreeStream>(new TreeStream(Form("Tree%d", id))));
   auto layout = mDataLayouts.back().get();
   layout->setID(id);
+  if (mAsyncThread.joinable()) {
+    layout->setAsyncRedirector(this);
+  }
   if (backup) {
     backup->cd();
   }
@@ -101,16 +104,88 @@ TreeStream& TreeStreamRedirector::operator<<(const char* name)
   mDataLayouts.emplace_back(std::unique_ptr<TreeStream>(new TreeStream(name)));
   auto layout = mDataLayouts.back().get();
   layout->setID(-1);
+  if (mAsyncThread.joinable()) {
+    layout->setAsyncRedirector(this);
+  }
   if (backup) {
     backup->cd();
   }
   return *layout;
 }
 
+//_________________________________________________
+void TreeStreamRedirector::enableAsyncFill()
+{
+  // spawn the background thread: from now on rows consisting of elementary
+  // types only are captured by value in Endl and the (compressing) TTree::Fill
+  // runs asynchronously in the worker
+  if (mAsyncThread.joinable()) {
+    return; // already enabled
+  }
+  for (auto& layout : mDataLayouts) {
+    layout->setAsyncRedirector(this);
+  }
+  mAsyncStop = false;
+  mAsyncThread = std::thread(&TreeStreamRedirector::asyncFillLoop, this);
+}
+
+//_________________________________________________
+void TreeStreamRedirector::enqueueAsyncFill(TreeStream* layout, std::vector<char>&& row)
+{
+  // hand a captured row over to the background thread, applying backpressure
+  // if the writer cannot keep up
+  {
+    std::unique_lock<std::mutex> lock(mAsyncMutex);
+    mAsyncDoneCV.wait(lock, [this]() { return mAsyncRows.size() < MaxQueuedRows; });
+    mAsyncRows.emplace_back(layout, std::move(row));
+  }
+  mAsyncCV.notify_one();
+}
+
+//_________________________________________________
+void TreeStreamRedirector::drainAsyncFill()
+{
+  // block until all rows enqueued so far are filled
+  if (!mAsyncThread.joinable()) {
+    return;
+  }
+  std::unique_lock<std::mutex> lock(mAsyncMutex);
+  mAsyncDoneCV.wait(lock, [this]() { return mAsyncRows.empty() && !mAsyncBusy; });
+}
+
+//_________________________________________________
+void TreeStreamRedirector::asyncFillLoop()
+{
+  // worker loop: fill captured rows until stop is requested and the queue is drained
+  std::unique_lock<std::mutex> lock(mAsyncMutex);
+  while (true) {
+    mAsyncCV.wait(lock, [this]() { return !mAsyncRows.empty() || mAsyncStop; });
+    if (mAsyncRows.empty()) {
+      break; // can be empty only on stop request
+    }
+    auto item = std::move(mAsyncRows.front());
+    mAsyncRows.pop_front();
+    mAsyncBusy = true;
+    lock.unlock();
+    item.first->fillCapturedRow(item.second.data(), item.second.size());
+    lock.lock();
+    mAsyncBusy = false;
+    mAsyncDoneCV.notify_all();
+  }
+}
+
 //_________________________________________________
 void TreeStreamRedirector::Close()
 {
   // flush and close
+  if (mAsyncThread.joinable()) {
+    {
+      std::lock_guard<std::mutex> lock(mAsyncMutex);
+      mAsyncStop = true;
+    }
+    mAsyncCV.notify_all();
+    mAsyncThread.join();
+  }
   if (!mDirectory) {
     return;
   }
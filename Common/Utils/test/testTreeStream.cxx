@@ -107,6 +107,44 @@ BOOST_AUTO_TEST_CASE(TreeStream_test)
   //
 }
 
+BOOST_AUTO_TEST_CASE(TreeStreamAsync_test)
+{
+  // check that rows filled through the background thread match synchronous filling
+  LOG(info) << "Testing asynchronous filling of the TreeStreamRedirector";
+  std::string outFName("testTreeStreamAsync.root");
+  int nit = 1000;
+  {
+    TreeStreamRedirector tstStream(outFName.data(), "recreate");
+    tstStream.enableAsyncFill();
+    for (int i = 0; i < nit; i++) {
+      float x = 2.f * i;
+      double y = 0.5 * i;
+      tstStream << "PODTree"
+                << "id=" << i << "x=" << x << "y=" << y << "\n";
+    }
+    tstStream.Close();
+  }
+  {
+    TFile inpf(outFName.data());
+    BOOST_CHECK(!inpf.IsZombie());
+    auto tree = (TTree*)inpf.GetObjectChecked("PODTree", "TTree");
+    BOOST_CHECK(tree);
+    BOOST_CHECK(tree->GetEntries() == nit);
+    int id = -1;
+    float x = 0.f;
+    double y = 0.;
+    BOOST_CHECK(!tree->SetBranchAddress("id", &id));
+    BOOST_CHECK(!tree->SetBranchAddress("x", &x));
+    BOOST_CHECK(!tree->SetBranchAddress("y", &y));
+    for (int i = 0; i < nit; i++) {
+      tree->GetEntry(i);
+      BOOST_CHECK(id == i);
+      BOOST_CHECK(x == 2.f * i);
+      BOOST_CHECK(y == 0.5 * i);
+    }
+  }
+}
+
 //_________________________________________________
 bool UnitTestSparse(Double_t scale, Int_t testEntries)
 {
@@ -63,6 +63,11 @@ class MatrixCache
   const T& getMatrix(int sensID) const { return mCache[sensID]; }
   bool isFilled() const { return !mCache.empty(); }
 
+  /// bulk access to the cached matrices, e.g. for a flat export
+  const std::vector<T>& getCache() const { return mCache; }
+  /// bulk assignment, e.g. to fill the cache from a flat copy instead of the geometry
+  void setCache(const std::vector<T>& c) { mCache = c; }
+
  private:
   std::vector<T> mCache;
   ClassDefNV(MatrixCache, 1);
@@ -503,6 +503,11 @@ class EncodedBlocks
   template <typename input_IT, typename buffer_T>
   o2::ctf::CTFIOSize encode(const input_IT srcBegin, const input_IT srcEnd, int slot, uint8_t symbolTablePrecision, Metadata::OptStore opt, buffer_T* buffer = nullptr, const std::any& encoderExt = {}, float memfc = 1.f);
 
+  /// append to the next slot to fill a copy of the block (metadata + payload) encoded at slot srcSlot
+  /// of another container of the same type, e.g. one filled independently by a worker thread
+  template <typename buffer_T>
+  o2::ctf::CTFIOSize appendBlockFrom(const EncodedBlocks& src, int srcSlot, buffer_T* buffer = nullptr);
+
   /// decode block at provided slot to destination vector (will be resized as needed)
   template <class container_T, class container_IT = typename container_T::iterator>
   o2::ctf::CTFIOSize decode(container_T& dest, int slot, const std::any& decoderExt = {}) const;
@@ -1145,6 +1150,29 @@ o2::ctf::CTFIOSize EncodedBlocks<H, N, W>::encode(const input_IT srcBegin,
   }
 };
 
+///_____________________________________________________________________________
+template <typename H, int N, typename W>
+template <typename buffer_T>
+o2::ctf::CTFIOSize EncodedBlocks<H, N, W>::appendBlockFrom(const EncodedBlocks& src, int srcSlot, buffer_T* buffer)
+{
+  const auto& srcBlock = src.getBlock(srcSlot);
+  const int slot = mRegistry.nFilledBlocks;
+  auto* thisC = this;
+  const size_t additionalSize = estimateBlockSize(srcBlock.getNStored());
+  if (additionalSize >= getFreeSize()) { // after expansion "this" (and any reference to its members) may be invalid
+    if (!buffer) {
+      throw std::runtime_error("failed to allocate additional space in provided external buffer");
+    }
+    expand(*buffer, size() + (additionalSize - getFreeSize()));
+    thisC = get(buffer->data());
+  }
+  thisC->mRegistry.nFilledBlocks++;
+  thisC->mMetadata[slot] = src.getMetadata(srcSlot);
+  thisC->mBlocks[slot].store(srcBlock.getNDict(), srcBlock.getNData(), srcBlock.getNLiterals(), srcBlock.getDict(), srcBlock.getData(), srcBlock.getLiterals());
+  const auto& md = thisC->mMetadata[slot];
+  return {0, md.getUncompressedSize(), md.getCompressedSize()};
+}
+
 template <typename H, int N, typename W>
 template <typename T>
 [[nodiscard]] auto EncodedBlocks<H, N, W>::expandStorage(size_t slot, size_t nElements, T* buffer) -> decltype(auto)
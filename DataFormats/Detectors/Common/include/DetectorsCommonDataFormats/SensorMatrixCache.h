@@ -0,0 +1,70 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+/// \file SensorMatrixCache.h
+/// \brief Flat copyable snapshot of the per-sensor matrix caches of a detector
+
+#ifndef ALICEO2_BASE_SENSORMATRIXCACHE_H
+#define ALICEO2_BASE_SENSORMATRIXCACHE_H
+
+#include "GPUCommonRtypes.h"
+
+#include <vector>
+
+#include "MathUtils/Cartesian.h"
+#include "DetectorsCommonDataFormats/DetID.h"
+
+namespace o2
+{
+namespace detectors
+{
+class DetMatrixCache;
+
+/// Flat copyable snapshot of the per-sensor transformation matrices cached by a
+/// DetMatrixCache. Contrary to the cache itself it can be copied and shipped as a
+/// plain object, so that a single device on a node extracts the matrices from the
+/// TGeo geometry and the other consumers fill their caches from the snapshot.
+
+class SensorMatrixCache
+{
+ public:
+  typedef o2::math_utils::Transform3D Mat3D;
+  typedef o2::math_utils::Rotation2Df_t Rot2D;
+
+  SensorMatrixCache() = default;
+
+  /// snapshot whatever caches are filled in src
+  void fillFrom(const DetMatrixCache& src);
+  /// fill the caches of dst from the snapshot, booking its size if needed
+  void copyTo(DetMatrixCache& dst) const;
+
+  const o2::detectors::DetID& getDetID() const { return mDetID; }
+  int getSize() const { return mSize; }
+  const std::vector<Mat3D>& getL2G() const { return mL2G; }
+  const std::vector<Mat3D>& getT2L() const { return mT2L; }
+  const std::vector<Mat3D>& getT2G() const { return mT2G; }
+  const std::vector<Rot2D>& getT2GRot() const { return mT2GRot; }
+
+ private:
+  o2::detectors::DetID mDetID; ///< detector ID
+  int mSize = 0;               ///< number of sensors
+
+  std::vector<Mat3D> mL2G;    ///< Local to Global matrices
+  std::vector<Mat3D> mT2L;    ///< Tracking to Local matrices
+  std::vector<Mat3D> mT2G;    ///< Tracking to Global matrices (general case)
+  std::vector<Rot2D> mT2GRot; ///< Tracking to Global matrices in case of barrel (simple rotation)
+
+  ClassDefNV(SensorMatrixCache, 1);
+};
+} // namespace detectors
+} // namespace o2
+
+#endif
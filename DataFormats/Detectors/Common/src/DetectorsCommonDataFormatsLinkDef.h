@@ -23,6 +23,7 @@
 #pragma link C++ class o2::detectors::MatrixCache < o2::math_utils::Rotation2Df_t> + ;
 #pragma link C++ class o2::detectors::DetMatrixCache + ;
 #pragma link C++ class o2::detectors::DetMatrixCacheIndirect + ;
+#pragma link C++ class o2::detectors::SensorMatrixCache + ;
 
 #pragma link C++ class o2::detectors::SimTraits + ;
 
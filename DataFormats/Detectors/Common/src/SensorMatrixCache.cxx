@@ -0,0 +1,55 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+#include "DetectorsCommonDataFormats/SensorMatrixCache.h"
+#include "DetectorsCommonDataFormats/DetMatrixCache.h"
+
+using namespace o2::detectors;
+
+ClassImp(o2::detectors::SensorMatrixCache);
+
+//_______________________________________________________
+void SensorMatrixCache::fillFrom(const DetMatrixCache& src)
+{
+  // snapshot the caches filled so far in src, the others stay empty
+  mDetID = src.getDetID();
+  mSize = src.getSize();
+  mL2G = src.getCacheL2G().getCache();
+  mT2L = src.getCacheT2L().getCache();
+  mT2G = src.getCacheT2G().getCache();
+  mT2GRot = src.getCacheT2GRot().getCache();
+}
+
+//_______________________________________________________
+void SensorMatrixCache::copyTo(DetMatrixCache& dst) const
+{
+  // fill the caches of dst from the snapshot, only the caches not yet filled are touched
+  if (!mSize) {
+    LOG(fatal) << "Attempt to fill " << dst.getName() << " matrix cache from an empty snapshot";
+  }
+  if (!dst.isBuilt()) {
+    dst.setSize(mSize);
+  } else if (dst.getSize() != mSize) {
+    LOG(fatal) << "Snapshot of " << mSize << " sensors does not match " << dst.getName() << " cache size of " << dst.getSize();
+  }
+  if (!mL2G.empty() && !dst.getCacheL2G().isFilled()) {
+    dst.getCacheL2G().setCache(mL2G);
+  }
+  if (!mT2L.empty() && !dst.getCacheT2L().isFilled()) {
+    dst.getCacheT2L().setCache(mT2L);
+  }
+  if (!mT2G.empty() && !dst.getCacheT2G().isFilled()) {
+    dst.getCacheT2G().setCache(mT2G);
+  }
+  if (!mT2GRot.empty() && !dst.getCacheT2GRot().isFilled()) {
+    dst.getCacheT2GRot().setCache(mT2GRot);
+  }
+}
@@ -253,6 +253,49 @@ struct DataRequest {
 #endif
 };
 
+// Canonical structure-of-arrays snapshot of the kinematics of the loaded barrel tracks,
+// i.e. of the sources whose tracks derive from o2::track::TrackParCov.
+// It is built once per TF on the first RecoContainer::getTracksSoA() call and shared
+// read-only by all consumers, so that they do not need to re-gather the parameters into
+// private staging arrays via createTracks(Variadic).
+// The rows follow the createTracksVariadic order (from the most complete track type to
+// the least complete one, the contributors of a stored track are skipped), with the rows
+// of every source contiguous; time and timeErr keep the per-source conventions of
+// createTracksVariadic documented in RecoContainerCreateTracksVariadic.h.
+struct TracksSoA {
+  using GTrackID = o2::dataformats::GlobalTrackID;
+
+  std::vector<GTrackID> gid;                                  ///< global track ID of every row
+  std::vector<float> x;                                       ///< X of the track local frame
+  std::vector<float> alpha;                                   ///< rotation angle of the track local frame
+  std::vector<float> y;                                       ///< track parameter Y
+  std::vector<float> z;                                       ///< track parameter Z
+  std::vector<float> snp;                                     ///< track parameter sin(phi)
+  std::vector<float> tgl;                                     ///< track parameter tan(lambda)
+  std::vector<float> q2pt;                                    ///< track parameter q/pT
+  std::vector<float> pt;                                      ///< transverse momentum
+  std::vector<float> time;                                    ///< track time
+  std::vector<float> timeErr;                                 ///< track time uncertainty
+  std::array<std::vector<float>, o2::track::kCovMatSize> cov; ///< covariance matrix columns, indexed as in TrackParCov
+
+  std::array<o2::dataformats::RangeReference<int, int>, GTrackID::NSources> sourceRows{}; ///< row range of every source
+
+  size_t size() const { return gid.size(); }
+
+  // typed read-only views
+  gsl::span<const GTrackID> getGIDs() const { return gid; }
+  gsl::span<const float> getPt() const { return pt; }
+  gsl::span<const float> getTgl() const { return tgl; }
+  gsl::span<const float> getQ2Pt() const { return q2pt; }
+  gsl::span<const float> getTime() const { return time; }
+  gsl::span<const float> getTimeErr() const { return timeErr; }
+  gsl::span<const float> getCov(int i) const { return cov[i]; }
+  o2::dataformats::RangeReference<int, int> getSourceRows(int src) const { return sourceRows[src]; }
+
+  /// reassemble the full covariance-matrix track of a given row
+  o2::track::TrackParCov getTrackParCov(int row) const;
+};
+
 // Helper class to requested data.
 // Most common data have dedicated getters, some need to be called with returned typa as a template.
 // In general on either gets a gsl::span<const Type> via getter like e.g. getITSTracks()
@@ -349,10 +392,20 @@ struct RecoContainer {
   std::unique_ptr<o2::tpc::internal::getWorkflowTPCInput_ret> inputsTPCclusters; // special struct for TPC clusters access
   std::unique_ptr<o2::trd::RecoInputContainer> inputsTRD;                        // special struct for TRD tracklets, trigger records
 
+  mutable std::unique_ptr<TracksSoA> mTracksSoA; // lazily built SoA snapshot of the loaded tracks, use getTracksSoA()
+
   void collectData(o2::framework::ProcessingContext& pc, const DataRequest& request);
   void createTracks(std::function<bool(const o2::track::TrackParCov&, GTrackID)> const& creator) const;
   template <class T>
   void createTracksVariadic(T creator, GTrackID::mask_t srcSel = GTrackID::getSourcesMask("all")) const;
+  // iterate over the tracks of the sources fixed by the compile-time mask, e.g.
+  // forEachTrack<(1u << GTrackID::TPC) | (1u << GTrackID::ITSTPC)>(creator), with the
+  // source dispatch resolved at compile time, see RecoContainerCreateTracksVariadic.h
+  template <uint32_t srcMask, class T>
+  void forEachTrack(T creator) const;
+  // canonical SoA snapshot of the loaded barrel tracks, built on the 1st call and
+  // shared read-only by all consumers of this TF, see TracksSoA above
+  const TracksSoA& getTracksSoA() const;
   void fillTrackMCLabels(const gsl::span<GTrackID> gids, std::vector<o2::MCCompLabel>& mcinfo) const;
 
   void addITSTracks(o2::framework::ProcessingContext& pc, bool mc);
@@ -458,6 +458,60 @@ void o2::globaltracking::RecoContainer::createTracksVariadic(T creator, GTrackID
   LOG(info) << "RecoContainer::createTracks took " << std::chrono::duration_cast<std::chrono::microseconds>(current_time - start_time).count() * 1e-6 << " CPU s.";
 }
 
+//________________________________________________________
+template <uint32_t srcMask, class T>
+void o2::globaltracking::RecoContainer::forEachTrack(T creator) const
+{
+  // Call creator(track, gid) for every track of the sources selected by the compile-time
+  // mask, built as e.g. (1u << GTrackID::TPC) | (1u << GTrackID::ITSTPC). Since the source
+  // set is fixed at compile time, every per-source loop is instantiated with the concrete
+  // track type and the per-ID runtime source dispatch of getTrackParam & co is avoided.
+  // Contrary to createTracksVariadic no contributor bookkeeping or timing is provided:
+  // every track of every selected source is visited exactly once.
+  // Only sources owning their kinematics can be requested: the TOF-matched sources
+  // (ITSTPCTOF, TPCTRDTOF, ITSTPCTRDTOF) hold bare matches referring to the tracks of
+  // their parent source.
+  constexpr uint32_t supported = (1u << GTrackID::ITS) | (1u << GTrackID::MFT) | (1u << GTrackID::MCH) | (1u << GTrackID::MID) |
+                                 (1u << GTrackID::TPC) | (1u << GTrackID::ITSTPC) | (1u << GTrackID::TPCTOF) | (1u << GTrackID::TPCTRD) |
+                                 (1u << GTrackID::MFTMCH) | (1u << GTrackID::ITSTPCTRD);
+  static_assert(srcMask != 0 && (srcMask & ~supported) == 0, "mask contains sources without own track kinematics");
+  auto iterate = [&creator](const auto& tracks, GTrackID::Source src) {
+    for (unsigned i = 0; i < tracks.size(); i++) {
+      creator(tracks[i], GTrackID{i, src});
+    }
+  };
+  if constexpr ((srcMask & (1u << GTrackID::ITS)) != 0) {
+    iterate(getITSTracks(), GTrackID::ITS);
+  }
+  if constexpr ((srcMask & (1u << GTrackID::MFT)) != 0) {
+    iterate(getMFTTracks(), GTrackID::MFT);
+  }
+  if constexpr ((srcMask & (1u << GTrackID::MCH)) != 0) {
+    iterate(getMCHTracks(), GTrackID::MCH);
+  }
+  if constexpr ((srcMask & (1u << GTrackID::MID)) != 0) {
+    iterate(getMIDTracks(), GTrackID::MID);
+  }
+  if constexpr ((srcMask & (1u << GTrackID::TPC)) != 0) {
+    iterate(getTPCTracks(), GTrackID::TPC);
+  }
+  if constexpr ((srcMask & (1u << GTrackID::ITSTPC)) != 0) {
+    iterate(getTPCITSTracks(), GTrackID::ITSTPC);
+  }
+  if constexpr ((srcMask & (1u << GTrackID::TPCTOF)) != 0) {
+    iterate(getTPCTOFTracks(), GTrackID::TPCTOF);
+  }
+  if constexpr ((srcMask & (1u << GTrackID::TPCTRD)) != 0) {
+    iterate(getTPCTRDTracks<o2::trd::TrackTRD>(), GTrackID::TPCTRD);
+  }
+  if constexpr ((srcMask & (1u << GTrackID::MFTMCH)) != 0) {
+    iterate(getGlobalFwdTracks(), GTrackID::MFTMCH);
+  }
+  if constexpr ((srcMask & (1u << GTrackID::ITSTPCTRD)) != 0) {
+    iterate(getITSTPCTRDTracks<o2::trd::TrackTRD>(), GTrackID::ITSTPCTRD);
+  }
+}
+
 template <class T>
 inline constexpr auto isITSTrack()
 {
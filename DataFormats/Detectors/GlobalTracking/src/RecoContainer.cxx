@@ -611,6 +611,7 @@ void RecoContainer::collectData(ProcessingContext& pc, const DataRequest& reques
   auto& reqMap = requests.requestMap;
 
   startIR = {0, pc.services().get<o2::framework::TimingInfo>().firstTForbit};
+  mTracksSoA.reset(); // the SoA snapshot of the previous TF is invalidated
 
   auto req = reqMap.find("trackITS");
   if (req != reqMap.end()) {
@@ -1388,6 +1389,83 @@ void o2::globaltracking::RecoContainer::createTracks(std::function<bool(const o2
   });
 }
 
+//________________________________________________________
+o2::track::TrackParCov o2::globaltracking::TracksSoA::getTrackParCov(int row) const
+{
+  std::array<float, o2::track::kNParams> par{y[row], z[row], snp[row], tgl[row], q2pt[row]};
+  std::array<float, o2::track::kCovMatSize> covm;
+  for (int i = 0; i < o2::track::kCovMatSize; i++) {
+    covm[i] = cov[i][row];
+  }
+  return {x[row], alpha[row], par, covm};
+}
+
+//________________________________________________________
+const o2::globaltracking::TracksSoA& o2::globaltracking::RecoContainer::getTracksSoA() const
+{
+  if (mTracksSoA) {
+    return *mTracksSoA;
+  }
+  auto snapshot = std::make_unique<TracksSoA>();
+  auto& soa = *snapshot;
+  // count the rows first, to allocate every column in a single pass
+  size_t nRows = 0;
+  createTracksVariadic([&nRows](const auto& _tr, GTrackID, float, float) {
+    if constexpr (std::is_base_of_v<o2::track::TrackParCov, std::decay_t<decltype(_tr)>>) {
+      nRows++;
+      return true;
+    } else {
+      return false;
+    }
+  });
+  soa.gid.reserve(nRows);
+  soa.x.reserve(nRows);
+  soa.alpha.reserve(nRows);
+  soa.y.reserve(nRows);
+  soa.z.reserve(nRows);
+  soa.snp.reserve(nRows);
+  soa.tgl.reserve(nRows);
+  soa.q2pt.reserve(nRows);
+  soa.pt.reserve(nRows);
+  soa.time.reserve(nRows);
+  soa.timeErr.reserve(nRows);
+  for (auto& c : soa.cov) {
+    c.reserve(nRows);
+  }
+  createTracksVariadic([&soa](const auto& _tr, GTrackID _origID, float t0, float terr) {
+    if constexpr (std::is_base_of_v<o2::track::TrackParCov, std::decay_t<decltype(_tr)>>) {
+      soa.gid.push_back(_origID);
+      soa.x.push_back(_tr.getX());
+      soa.alpha.push_back(_tr.getAlpha());
+      soa.y.push_back(_tr.getY());
+      soa.z.push_back(_tr.getZ());
+      soa.snp.push_back(_tr.getSnp());
+      soa.tgl.push_back(_tr.getTgl());
+      soa.q2pt.push_back(_tr.getQ2Pt());
+      soa.pt.push_back(_tr.getPt());
+      soa.time.push_back(t0);
+      soa.timeErr.push_back(terr);
+      const auto& covm = _tr.getCov();
+      for (int i = 0; i < o2::track::kCovMatSize; i++) {
+        soa.cov[i].push_back(covm[i]);
+      }
+      return true;
+    } else {
+      return false;
+    }
+  });
+  // the rows of every source are contiguous, record their ranges
+  for (size_t i = 0; i < soa.gid.size(); i++) {
+    auto& range = soa.sourceRows[soa.gid[i].getSource()];
+    if (range.getEntries() == 0) {
+      range.setFirstEntry(i);
+    }
+    range.changeEntriesBy(1);
+  }
+  mTracksSoA = std::move(snapshot);
+  return *mTracksSoA;
+}
+
 //________________________________________________________
 // get contributors from single detectors
 RecoContainer::GlobalIDSet RecoContainer::getSingleDetectorRefs(GTrackID gidx) const
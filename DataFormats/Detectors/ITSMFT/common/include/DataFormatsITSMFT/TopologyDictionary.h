@@ -35,6 +35,7 @@
 #include <string>
 #include <unordered_map>
 #include <vector>
+#include <gsl/span>
 #include "MathUtils/Cartesian.h"
 #include "DataFormatsITSMFT/CompCluster.h"
 #include "TH1F.h"
@@ -89,6 +90,15 @@ class TopologyDictionary
 
   int readFromFile(const std::string& fileName);
 
+  /// Serializes the dictionary to a flat, versioned binary image: the packed records of
+  /// writeBinaryFile preceded by a small header with magic word, format version and number
+  /// of entries. Such a payload can be stored on the CCDB as a plain blob
+  /// (CcdbApi::storeAsBinaryFile) and read back without invoking the ROOT streamers.
+  void toBinaryBuffer(std::vector<char>& buffer) const;
+  /// Rebuilds the dictionary, including the derived lookup structures, from the flat
+  /// binary image produced by toBinaryBuffer
+  int fromBinaryBuffer(gsl::span<const char> buffer);
+
   /// Returns the x position of the COG for the n_th element
   inline float getXCOG(int n) const
   {
@@ -182,6 +192,12 @@ class TopologyDictionary
   friend TopologyFastSimulation;
 
  private:
+  /// registers a record in the derived lookup structures (hash map, group map and
+  /// small-topologies LUT), which are not part of the serialized representations
+  void bookRecord(const GroupStruct& gr, int groupID);
+
+  static constexpr uint32_t BinMagicWord = 0x44504f54; ///< "TOPD", marks the flat binary image
+  static constexpr uint32_t BinFormatVersion = 1;      ///< version of the flat binary layout
   static constexpr int STopoSize = 8 * 255 + 1;
   std::unordered_map<unsigned long, int> mCommonMap; ///< Map of pair <hash, position in mVectorOfIDs>
   std::unordered_map<int, int> mGroupMap;            ///< Map of pair <groudID, position in mVectorOfIDs>
@@ -19,6 +19,7 @@
 #include "ITSMFTBase/SegmentationAlpide.h"
 #include "CommonUtils/StringUtils.h"
 #include <TFile.h>
+#include <cstring>
 #include <iostream>
 
 using std::cout;
@@ -114,14 +115,7 @@ int TopologyDictionary::readBinaryFile(const std::string& fname)
       in.read(reinterpret_cast<char*>(&gr.mIsGroup), sizeof(bool));
       in.read(reinterpret_cast<char*>(&gr.mPattern.mBitmap), sizeof(unsigned char) * (ClusterPattern::kExtendedPatternBytes));
       mVectorOfIDs.push_back(gr);
-      if (!gr.mIsGroup) {
-        mCommonMap.insert(std::make_pair(gr.mHash, groupID));
-        if (gr.mPattern.getUsedBytes() == 1) {
-          mSmallTopologiesLUT[(gr.mPattern.getColumnSpan() - 1) * 255 + (int)gr.mPattern.mBitmap[2]] = groupID;
-        }
-      } else {
-        mGroupMap.insert(std::make_pair((int)(gr.mHash >> 32) & 0x00000000ffffffff, groupID));
-      }
+      bookRecord(gr, groupID);
       groupID++;
     }
   }
@@ -129,6 +123,95 @@ int TopologyDictionary::readBinaryFile(const std::string& fname)
   return 0;
 }
 
+void TopologyDictionary::bookRecord(const GroupStruct& gr, int groupID)
+{
+  if (!gr.mIsGroup) {
+    mCommonMap.insert(std::make_pair(gr.mHash, groupID));
+    if (gr.mPattern.getUsedBytes() == 1) {
+      mSmallTopologiesLUT[(gr.mPattern.getColumnSpan() - 1) * 255 + (int)gr.mPattern.mBitmap[2]] = groupID;
+    }
+  } else {
+    mGroupMap.insert(std::make_pair((int)(gr.mHash >> 32) & 0x00000000ffffffff, groupID));
+  }
+}
+
+void TopologyDictionary::toBinaryBuffer(std::vector<char>& buffer) const
+{
+  // layout: magic word, format version and number of entries, followed by the records
+  // packed field by field as in writeBinaryFile; the derived lookup structures are not
+  // stored, they are rebuilt when the image is read back
+  constexpr size_t recordSize = sizeof(unsigned long) + 6 * sizeof(float) + sizeof(int) + sizeof(double) + sizeof(bool) + sizeof(unsigned char) * ClusterPattern::kExtendedPatternBytes;
+  buffer.clear();
+  buffer.reserve(3 * sizeof(uint32_t) + mVectorOfIDs.size() * recordSize);
+  auto put = [&buffer](const void* src, size_t n) {
+    const char* c = reinterpret_cast<const char*>(src);
+    buffer.insert(buffer.end(), c, c + n);
+  };
+  uint32_t magic = BinMagicWord, version = BinFormatVersion, nEntries = mVectorOfIDs.size();
+  put(&magic, sizeof(uint32_t));
+  put(&version, sizeof(uint32_t));
+  put(&nEntries, sizeof(uint32_t));
+  for (const auto& p : mVectorOfIDs) {
+    put(&p.mHash, sizeof(unsigned long));
+    put(&p.mErrX, sizeof(float));
+    put(&p.mErrZ, sizeof(float));
+    put(&p.mErr2X, sizeof(float));
+    put(&p.mErr2Z, sizeof(float));
+    put(&p.mXCOG, sizeof(float));
+    put(&p.mZCOG, sizeof(float));
+    put(&p.mNpixels, sizeof(int));
+    put(&p.mFrequency, sizeof(double));
+    put(&p.mIsGroup, sizeof(bool));
+    put(&p.mPattern.mBitmap, sizeof(unsigned char) * (ClusterPattern::kExtendedPatternBytes));
+  }
+}
+
+int TopologyDictionary::fromBinaryBuffer(gsl::span<const char> buffer)
+{
+  mVectorOfIDs.clear();
+  mCommonMap.clear();
+  mGroupMap.clear();
+  for (auto& p : mSmallTopologiesLUT) {
+    p = -1;
+  }
+  size_t pos = 0;
+  auto get = [&buffer, &pos](void* dst, size_t n) {
+    if (pos + n > size_t(buffer.size())) {
+      throw std::runtime_error("The flat topology dictionary image is truncated");
+    }
+    std::memcpy(dst, buffer.data() + pos, n);
+    pos += n;
+  };
+  uint32_t magic = 0, version = 0, nEntries = 0;
+  get(&magic, sizeof(uint32_t));
+  if (magic != BinMagicWord) {
+    throw std::runtime_error("The buffer does not contain a flat topology dictionary image");
+  }
+  get(&version, sizeof(uint32_t));
+  if (version != BinFormatVersion) {
+    throw std::runtime_error(fmt::format("Unsupported flat topology dictionary format version {}", version));
+  }
+  get(&nEntries, sizeof(uint32_t));
+  mVectorOfIDs.reserve(nEntries);
+  GroupStruct gr;
+  for (uint32_t groupID = 0; groupID < nEntries; groupID++) {
+    get(&gr.mHash, sizeof(unsigned long));
+    get(&gr.mErrX, sizeof(float));
+    get(&gr.mErrZ, sizeof(float));
+    get(&gr.mErr2X, sizeof(float));
+    get(&gr.mErr2Z, sizeof(float));
+    get(&gr.mXCOG, sizeof(float));
+    get(&gr.mZCOG, sizeof(float));
+    get(&gr.mNpixels, sizeof(int));
+    get(&gr.mFrequency, sizeof(double));
+    get(&gr.mIsGroup, sizeof(bool));
+    get(&gr.mPattern.mBitmap, sizeof(unsigned char) * (ClusterPattern::kExtendedPatternBytes));
+    mVectorOfIDs.push_back(gr);
+    bookRecord(gr, groupID);
+  }
+  return 0;
+}
+
 void TopologyDictionary::getTopologyDistribution(const TopologyDictionary& dict, TH1F*& histo, const char* histName)
 {
   int dictSize = (int)dict.getSize();
@@ -115,6 +115,33 @@ struct alignas(64) ClusterIndexBuffer {
   value_type clusters[0];
 };
 
+/// @struct ClusterNativeTimeIndex
+/// Coarse time index on top of a ClusterNativeAccess index.
+///
+/// Within each {sector, padrow} the clusters are ordered in time, so storing
+/// per {sector, padrow} the offset of the first cluster of every time-bin
+/// range is sufficient to provide random access to a time slice. Consumers
+/// which need only a small part of a time frame, like the laser track
+/// calibration which looks at the clusters around the laser triggers, can
+/// restrict the iteration to the matching ranges instead of touching all
+/// clusters of the time frame.
+struct ClusterNativeTimeIndex {
+  using value_type = ClusterNative;
+  static constexpr unsigned int DefaultTimeBinsPerRange = 512;
+
+  unsigned int timeBinsPerRange = DefaultTimeBinsPerRange; //< granularity of the index in time bins
+  unsigned int nTimeRanges = 0;                            //< number of time-bin ranges covering the time frame
+  std::vector<unsigned int> offsets;                       //< per {sector, padrow} the nTimeRanges + 1 range boundary offsets within the row
+
+  /// build the index by a single pass over the (time ordered) cluster arrays
+  void build(const ClusterNativeAccess& clusters, unsigned int binsPerRange = DefaultTimeBinsPerRange);
+
+  /// get the clusters of {sector, padrow} covering time bins [firstTimeBin, lastTimeBin]
+  /// the returned span is aligned to the range boundaries of the index, i.e. it is
+  /// the smallest superset of the requested slice which the granularity allows
+  gsl::span<const ClusterNative> getTimeSlice(const ClusterNativeAccess& clusters, int sector, int padrow, float firstTimeBin, float lastTimeBin) const;
+};
+
 /// @class ClusterNativeHelper utility class for TPC native clusters
 /// This class supports the following utility functionality for handling of
 /// TPC ClusterNative data:
@@ -18,6 +18,7 @@
 #include "Algorithm/Parser.h"
 #include <TBranch.h>
 #include <fairlogger/Logger.h>
+#include <algorithm>
 #include <iostream>
 
 using namespace o2::tpc;
@@ -299,3 +300,49 @@ void ClusterNativeHelper::TreeWriter::close()
   mTree.release();
   mFile.reset();
 }
+
+void ClusterNativeTimeIndex::build(const ClusterNativeAccess& clusters, unsigned int binsPerRange)
+{
+  timeBinsPerRange = binsPerRange;
+  float maxTime = 0.f;
+  for (int sector = 0; sector < MAXSECTOR; ++sector) {
+    for (int padrow = 0; padrow < MAXGLOBALPADROW; ++padrow) {
+      unsigned int nCl = clusters.nClusters[sector][padrow];
+      if (nCl > 0 && clusters.clusters[sector][padrow][nCl - 1].getTime() > maxTime) {
+        maxTime = clusters.clusters[sector][padrow][nCl - 1].getTime();
+      }
+    }
+  }
+  nTimeRanges = (unsigned int)(maxTime / timeBinsPerRange) + 1;
+  offsets.resize((size_t)MAXSECTOR * MAXGLOBALPADROW * (nTimeRanges + 1));
+  for (int sector = 0; sector < MAXSECTOR; ++sector) {
+    for (int padrow = 0; padrow < MAXGLOBALPADROW; ++padrow) {
+      unsigned int* rowOffsets = &offsets[((size_t)sector * MAXGLOBALPADROW + padrow) * (nTimeRanges + 1)];
+      const ClusterNative* cl = clusters.clusters[sector][padrow];
+      unsigned int nCl = clusters.nClusters[sector][padrow];
+      unsigned int iCl = 0;
+      for (unsigned int iRange = 0; iRange <= nTimeRanges; ++iRange) {
+        float rangeStart = (float)iRange * timeBinsPerRange;
+        while (iCl < nCl && cl[iCl].getTime() < rangeStart) {
+          ++iCl;
+        }
+        rowOffsets[iRange] = iCl;
+      }
+      rowOffsets[nTimeRanges] = nCl;
+    }
+  }
+}
+
+gsl::span<const ClusterNative> ClusterNativeTimeIndex::getTimeSlice(const ClusterNativeAccess& clusters, int sector, int padrow, float firstTimeBin, float lastTimeBin) const
+{
+  if (nTimeRanges == 0 || lastTimeBin < 0 || firstTimeBin > lastTimeBin) {
+    return {};
+  }
+  const unsigned int* rowOffsets = &offsets[((size_t)sector * MAXGLOBALPADROW + padrow) * (nTimeRanges + 1)];
+  unsigned int rFirst = firstTimeBin < 0 ? 0 : std::min((unsigned int)(firstTimeBin / timeBinsPerRange), nTimeRanges);
+  unsigned int rLast = std::min((unsigned int)(lastTimeBin / timeBinsPerRange) + 1, nTimeRanges);
+  if (rowOffsets[rLast] <= rowOffsets[rFirst]) {
+    return {};
+  }
+  return {clusters.clusters[sector][padrow] + rowOffsets[rFirst], rowOffsets[rLast] - rowOffsets[rFirst]};
+}
@@ -35,6 +35,7 @@
 #pragma link C++ class o2::tpc::LaserTrackContainer + ;
 #pragma link C++ class std::vector < o2::tpc::TrackTPC> + ;
 #pragma link C++ class std::vector < o2::tpc::LaserTrack> + ;
+#pragma link C++ class o2::tpc::ClusterNativeTimeIndex + ;
 #pragma link C++ class o2::tpc::ClusterNativeHelper + ;
 #pragma link C++ class o2::tpc::ClusterNativeHelper::Reader + ;
 #pragma link C++ class o2::tpc::ClusterNativeHelper::TreeWriter + ;
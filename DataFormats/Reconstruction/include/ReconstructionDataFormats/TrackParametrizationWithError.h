@@ -96,6 +96,7 @@ class TrackParametrizationWithError : public TrackParametrization<value_T>
   GPUd() value_t getPredictedChi2Unchecked(const dim2_t& p, const dim3_t& cov) const;
   GPUd() value_t getPredictedChi2(const value_t* p, const value_t* cov) const;
   GPUd() value_t getPredictedChi2Unchecked(const value_t* p, const value_t* cov) const;
+  GPUd() static void getPredictedChi2Batch(const TrackParametrizationWithError* trc, int ntrc, const value_t* p, const value_t* cov, value_t* chi2);
 
   template <typename T>
   GPUd() value_t getPredictedChi2(const BaseCluster<T>& p) const;
@@ -108,6 +109,7 @@ class TrackParametrizationWithError : public TrackParametrization<value_T>
 
   GPUd() bool update(const dim2_t& p, const dim3_t& cov);
   GPUd() bool update(const value_t* p, const value_t* cov);
+  GPUd() static int updateBatch(TrackParametrizationWithError* trc, int ntrc, const value_t* p, const value_t* cov, bool* ok = nullptr);
   GPUd() value_T update(const o2::dataformats::VertexBase& vtx, value_T maxChi2 = 1e15);
 
   template <typename T>
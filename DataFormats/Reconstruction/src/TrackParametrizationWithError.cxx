@@ -754,6 +754,27 @@ GPUd() auto TrackParametrizationWithError<value_T>::getPredictedChi2Unchecked(co
   return (d * (szz * d - sdz * z) + z * (sdd * z - d * sdz)) / det;
 }
 
+//______________________________________________
+template <typename value_T>
+GPUd() void TrackParametrizationWithError<value_T>::getPredictedChi2Batch(const TrackParametrizationWithError<value_T>* trc, int ntrc, const value_t* p, const value_t* cov, value_t* chi2)
+{
+  // batched version of getPredictedChi2Unchecked for many track states tested against the same
+  // space point: the measurement is loaded once and the loop body is free of logging and early
+  // returns, so that the compiler can keep it in registers and vectorize it
+  double c0 = static_cast<double>(cov[0]), c1 = static_cast<double>(cov[1]), c2 = static_cast<double>(cov[2]);
+  for (int i = 0; i < ntrc; i++) {
+    const auto& t = trc[i];
+    auto sdd = static_cast<double>(t.getSigmaY2()) + c0;
+    auto sdz = static_cast<double>(t.getSigmaZY()) + c1;
+    auto szz = static_cast<double>(t.getSigmaZ2()) + c2;
+    auto det = sdd * szz - sdz * sdz;
+    value_t d = t.getY() - p[0];
+    value_t z = t.getZ() - p[1];
+    chi2[i] = gpu::CAMath::Abs(det) < constants::math::Almost0 ? value_t(constants::math::VeryBig)
+                                                               : value_t((d * (szz * d - sdz * z) + z * (sdd * z - d * sdz)) / det);
+  }
+}
+
 #if !defined(GPUCA_GPUCODE) && !defined(GPUCA_STANDALONE) // Disable function relying on ROOT SMatrix on GPU
 
 //______________________________________________
@@ -974,6 +995,24 @@ GPUd() bool TrackParametrizationWithError<value_T>::update(const value_t* p, con
   return true;
 }
 
+//______________________________________________
+template <typename value_T>
+GPUd() int TrackParametrizationWithError<value_T>::updateBatch(TrackParametrizationWithError<value_T>* trc, int ntrc, const value_t* p, const value_t* cov, bool* ok)
+{
+  // apply the same measurement to a batch of track states (e.g. matcher candidates sharing a
+  // cluster); returns the number of successful updates, the per-track status is stored in ok
+  // when provided
+  int nok = 0;
+  for (int i = 0; i < ntrc; i++) {
+    bool res = trc[i].update(p, cov);
+    if (ok) {
+      ok[i] = res;
+    }
+    nok += res;
+  }
+  return nok;
+}
+
 //______________________________________________
 template <typename value_T>
 GPUd() value_T TrackParametrizationWithError<value_T>::update(const o2::dataformats::VertexBase& vtx, value_T maxChi2)
@@ -0,0 +1,106 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+/// \file TriggerRecordIndex.h
+/// \brief Binary-searchable index of trigger-record-like entries by global BC
+
+#ifndef ALICEO2_TRIGGERRECORDINDEX_H
+#define ALICEO2_TRIGGERRECORDINDEX_H
+
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "CommonDataFormat/InteractionRecord.h"
+
+namespace o2
+{
+namespace dataformats
+{
+
+/// \brief Flat index of trigger-record-like entries, searchable by global BC
+///
+/// Consumers frequently need to locate the trigger record (ROF record, digit, ...)
+/// belonging to a given interaction record. Scanning the per-detector vectors
+/// linearly for every query is O(N) per lookup; this helper builds a flat,
+/// sorted (global BC, entry) table once per TF, so that each lookup becomes a
+/// binary search on a cache-friendly contiguous array. The type of the indexed
+/// container is irrelevant, only the mapping of an entry to its interaction
+/// record is needed at build time.
+class TriggerRecordIndex
+{
+ public:
+  using BCEntry = std::pair<uint64_t, int>; ///< global BC + index of the entry in the indexed container
+
+  TriggerRecordIndex() = default;
+
+  /// build the index from a container of records
+  /// \param records container of trigger-record-like entries
+  /// \param getIR functor returning the InteractionRecord of an entry
+  template <typename Container, typename GetIRFunc>
+  void build(const Container& records, GetIRFunc getIR)
+  {
+    mEntries.clear();
+    mEntries.reserve(records.size());
+    int idx = 0;
+    for (const auto& rec : records) {
+      mEntries.emplace_back(static_cast<uint64_t>(getIR(rec).toLong()), idx++);
+    }
+    std::sort(mEntries.begin(), mEntries.end());
+  }
+
+  /// build the index from a container of records providing getBCData()
+  template <typename Container>
+  void build(const Container& records)
+  {
+    build(records, [](const auto& rec) { return rec.getBCData(); });
+  }
+
+  /// insert a single additional entry, keeping the table sorted
+  /// meant for occasional additions after the build, not for bulk filling
+  void insert(uint64_t globalBC, int entry)
+  {
+    const BCEntry key{globalBC, entry};
+    mEntries.insert(std::upper_bound(mEntries.begin(), mEntries.end(), key), key);
+  }
+
+  /// \return index of the first entry at this BC, -1 if there is none
+  int find(uint64_t globalBC) const
+  {
+    auto it = std::lower_bound(mEntries.begin(), mEntries.end(), BCEntry{globalBC, 0});
+    return (it != mEntries.end() && it->first == globalBC) ? it->second : -1;
+  }
+
+  /// \return index of the first entry at this interaction record, -1 if there is none
+  int find(const InteractionRecord& ir) const { return find(static_cast<uint64_t>(ir.toLong())); }
+
+  /// invoke f(entry) for all entries with bcMin <= BC <= bcMax
+  template <typename Func>
+  void forEachInRange(uint64_t bcMin, uint64_t bcMax, Func f) const
+  {
+    for (auto it = std::lower_bound(mEntries.begin(), mEntries.end(), BCEntry{bcMin, 0}); it != mEntries.end() && it->first <= bcMax; ++it) {
+      f(it->second);
+    }
+  }
+
+  size_t size() const { return mEntries.size(); }
+  bool empty() const { return mEntries.empty(); }
+  void clear() { mEntries.clear(); }
+
+ private:
+  std::vector<BCEntry> mEntries; ///< sorted (global BC, entry) table
+};
+
+} // namespace dataformats
+} // namespace o2
+
+#endif
@@ -0,0 +1,61 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+#define BOOST_TEST_MODULE Test TriggerRecordIndex class
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+#include "CommonDataFormat/TriggerRecordIndex.h"
+#include "CommonDataFormat/InteractionRecord.h"
+#include <vector>
+
+namespace o2
+{
+
+namespace
+{
+struct DummyRecord {
+  o2::InteractionRecord mIR{};
+  const o2::InteractionRecord& getBCData() const { return mIR; }
+};
+} // namespace
+
+BOOST_AUTO_TEST_CASE(TriggerRecordIndex)
+{
+  std::vector<DummyRecord> records;
+  records.push_back({{100, 2}});
+  records.push_back({{10, 1}});
+  records.push_back({{2000, 3}});
+  records.push_back({{5, 0}});
+
+  o2::dataformats::TriggerRecordIndex index;
+  index.build(records);
+  BOOST_CHECK_EQUAL(index.size(), records.size());
+
+  // exact lookups return the position in the original container
+  for (size_t i = 0; i < records.size(); ++i) {
+    BOOST_CHECK_EQUAL(index.find(records[i].getBCData()), int(i));
+  }
+  BOOST_CHECK_EQUAL(index.find(o2::InteractionRecord{7, 0}.toLong()), -1);
+
+  // insertion after the build keeps the table searchable
+  records.push_back({{7, 0}});
+  index.insert(records.back().getBCData().toLong(), int(records.size() - 1));
+  BOOST_CHECK_EQUAL(index.find(records.back().getBCData()), int(records.size() - 1));
+
+  // range iteration visits the entries in BC order
+  std::vector<int> visited;
+  index.forEachInRange(o2::InteractionRecord{7, 0}.toLong(), o2::InteractionRecord{100, 2}.toLong(), [&visited](int entry) { visited.push_back(entry); });
+  const std::vector<int> expected{4, 1, 0};
+  BOOST_CHECK_EQUAL_COLLECTIONS(visited.begin(), visited.end(), expected.begin(), expected.end());
+}
+
+} // namespace o2
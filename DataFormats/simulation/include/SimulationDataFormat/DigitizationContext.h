@@ -131,6 +131,12 @@ class DigitizationContext
   // finalize timeframe structure (fixes the indices in mTimeFrameStartIndex)
   void finalizeTimeframeStructure(long startOrbit, long orbitsPerTF);
 
+  // relocate the context to a new first sampling orbit: all interaction records (QED
+  // included) are shifted by the same number of orbits, keeping the collision structure
+  // and the hit-event association untouched. This allows a context produced once per
+  // campaign to be reused by jobs processing other timeframe slots.
+  void rebaseOrbits(uint32_t newFirstOrbit);
+
   // Sample and fix interaction vertices (according to some distribution). Makes sure that same event ids
   // have to have same vertex, as well as event ids associated to same collision.
   void sampleInteractionVertices(o2::dataformats::MeanVertexObject const& v);
@@ -400,6 +400,28 @@ void DigitizationContext::finalizeTimeframeStructure(long startOrbit, long orbit
   }
 }
 
+void DigitizationContext::rebaseOrbits(uint32_t newFirstOrbit)
+{
+  int64_t shift = (int64_t)newFirstOrbit - (int64_t)mFirstOrbitForSampling;
+  if (shift == 0) {
+    return;
+  }
+  auto shiftRecords = [shift](std::vector<o2::InteractionTimeRecord>& records) {
+    for (auto& rec : records) {
+      auto orbit = (int64_t)rec.orbit + shift;
+      if (orbit < 0) {
+        LOG(fatal) << "Rebasing the context would move collisions to negative orbits";
+      }
+      rec.orbit = (uint32_t)orbit;
+    }
+  };
+  // the in-bunch time offsets are relative to orbit/bc, so shifting the orbits
+  // is enough to relocate the collision times
+  shiftRecords(mEventRecords);
+  shiftRecords(mEventRecordsWithQED);
+  mFirstOrbitForSampling = newFirstOrbit;
+}
+
 std::unordered_map<int, int> DigitizationContext::getCollisionIndicesForSource(int source) const
 {
   // go through all collisions and pick those that have the give source
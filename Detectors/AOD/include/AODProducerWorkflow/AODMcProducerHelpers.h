@@ -224,9 +224,50 @@ bool updateHepMCHeavyIon(const HeavyIonCursor& cursor,
                          HepMCUpdate when = HepMCUpdate::anyKey);
 //--------------------------------------------------------------------
 /**
- * Type of mapping from track number to row index
+ * Mapping from track number to row index.
+ *
+ * Track numbers are indices into the per-event MC track vector and
+ * thus dense, so the mapping is kept as a flat array indexed by track
+ * number, with -1 marking tracks without an entry, rather than as a
+ * hash map.  The label to AOD-index translation, which dominates MC
+ * AOD production, thereby becomes a range check plus an array read.
  */
-using TrackToIndex = std::unordered_map<int, int>;
+class TrackToIndex
+{
+ public:
+  static constexpr int NotStored = -1;
+
+  /// Number of tracks with an entry
+  size_t size() const { return mCount; }
+  bool empty() const { return mCount == 0; }
+  void clear()
+  {
+    mEntries.clear();
+    mCount = 0;
+  }
+  /// True if the track has an entry
+  bool contains(int trackNo) const { return get(trackNo) != NotStored; }
+  /// Value stored for the track, or NotStored if there is none
+  int get(int trackNo) const
+  {
+    return (trackNo >= 0 && trackNo < static_cast<int>(mEntries.size())) ? mEntries[trackNo] : NotStored;
+  }
+  /// Store a value for the track, growing the table if needed
+  void put(int trackNo, int value)
+  {
+    if (trackNo >= static_cast<int>(mEntries.size())) {
+      mEntries.resize(trackNo + 1, NotStored);
+    }
+    if (mEntries[trackNo] == NotStored && value != NotStored) {
+      mCount++;
+    }
+    mEntries[trackNo] = value;
+  }
+
+ private:
+  std::vector<int> mEntries; ///< value per track number, NotStored if absent
+  size_t mCount = 0;         ///< number of tracks with an entry
+};
 //--------------------------------------------------------------------
 /**
  * Update aod::McParticles table with information from an MC track.
@@ -316,6 +357,47 @@ uint32_t updateParticles(const ParticleCursor& cursor,
                          uint32_t weightMask = 0xFFFFFFF0,
                          uint32_t momentumMask = 0xFFFFFFF0,
                          uint32_t positionMask = 0xFFFFFFF0);
+//--------------------------------------------------------------------
+/**
+ * Selection phase of updateParticles: mark in @a preselect the tracks
+ * of one event which are to be stored, with the same rules as
+ * documented there.  The function touches only the containers of its
+ * own event and uses no shared state, so it can run concurrently for
+ * different events; the caller then derives the per-event output
+ * extents with a prefix sum over the returned counts.
+ *
+ * @return Number of tracks selected for storage
+ */
+size_t selectParticles(std::vector<MCTrack> const& tracks,
+                       TrackToIndex& preselect,
+                       bool filter = false);
+//--------------------------------------------------------------------
+/**
+ * Indexing phase of updateParticles: turn the selection marks of @a
+ * toStore into table row indices, counting from @a offset.  Like the
+ * selection phase this only touches the event's own mapping and can
+ * run concurrently for different events once their offsets are known.
+ */
+void indexParticles(std::vector<MCTrack> const& tracks,
+                    TrackToIndex& toStore,
+                    uint32_t offset);
+//--------------------------------------------------------------------
+/**
+ * Output phase of updateParticles: write the tracks indexed in @a
+ * toStore to the table.  The cursor is not thread safe, so this phase
+ * stays serial.
+ *
+ * @return Index beyond the last particle added to table
+ */
+uint32_t writeParticles(const ParticleCursor& cursor,
+                        int collisionID,
+                        std::vector<MCTrack> const& tracks,
+                        TrackToIndex& toStore,
+                        uint32_t offset = 0,
+                        bool background = false,
+                        uint32_t weightMask = 0xFFFFFFF0,
+                        uint32_t momentumMask = 0xFFFFFFF0,
+                        uint32_t positionMask = 0xFFFFFFF0);
 } // namespace o2::aodmchelpers
 
 #endif /* O2_AODMCPRODUCER_HELPERS */
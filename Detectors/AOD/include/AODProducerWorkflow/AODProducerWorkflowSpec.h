@@ -311,9 +311,9 @@ class AODProducerWorkflowDPL : public Task
 
   // Container used to mark MC particles to store/transfer to AOD.
   // Mapping of eventID, sourceID, trackID to some integer.
-  // The first two indices are not sparse whereas the trackID index is sparse which explains
-  // the combination of vector and map
-  std::vector<std::vector<std::unordered_map<int, int>>> mToStore;
+  // All three indices are dense, so flat per-event tables are used
+  // (absent tracks are marked inside TrackToIndex)
+  std::vector<std::vector<o2::aodmchelpers::TrackToIndex>> mToStore;
   o2::steer::MCKinematicsReader* mMCKineReader = nullptr; //!
 
   // production metadata
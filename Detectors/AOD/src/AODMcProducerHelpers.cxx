@@ -217,11 +217,7 @@ void updateParticle(const ParticleCursor& cursor,
   using namespace o2::mcgenstatus;
 
   auto mapping = [&toStore](int trackNo) {
-    auto iter = toStore.find(trackNo);
-    if (iter == toStore.end()) {
-      return -1;
-    }
-    return iter->second;
+    return toStore.get(trackNo);
   };
 
   auto statusCode = track.getStatusCode().fullEncoding;
@@ -296,19 +292,11 @@ void updateParticle(const ParticleCursor& cursor,
          truncateFloatFraction(time, positionMask));
 }
 //--------------------------------------------------------------------
-uint32_t updateParticles(const ParticleCursor& cursor,
-                         int collisionID,
-                         std::vector<MCTrack> const& tracks,
-                         TrackToIndex& preselect,
-                         uint32_t offset,
-                         bool filter,
-                         bool background,
-                         uint32_t weightMask,
-                         uint32_t momentumMask,
-                         uint32_t positionMask)
+size_t selectParticles(std::vector<MCTrack> const& tracks,
+                       TrackToIndex& preselect,
+                       bool filter)
 {
   using o2::mcutils::MCTrackNavigator;
-  using namespace o2::aod::mcparticle::enums;
   using namespace o2::mcgenstatus;
 
   // First loop over particles to find out which to store
@@ -321,11 +309,7 @@ uint32_t updateParticles(const ParticleCursor& cursor,
   // Mapping lambda.  This maps the track number to the index into
   // the table exported.
   auto mapping = [&toStore](int trackNo) {
-    auto iter = toStore.find(trackNo);
-    if (iter == toStore.end()) {
-      return -1;
-    }
-    return iter->second;
+    return toStore.get(trackNo);
   };
 
   LOG(verbosity) << "Got a total of " << tracks.size();
@@ -333,7 +317,7 @@ uint32_t updateParticles(const ParticleCursor& cursor,
     auto& track = tracks[trackNo];
     auto hepmc = getHepMCStatusCode(track.getStatusCode());
     if (filter) {
-      if (toStore.find(trackNo) == toStore.end() and
+      if (not toStore.contains(trackNo) and
           /* The above test is in-correct.  The track may be stored in
              the list, but with a negative value.  In that case, the
              above test will still check mothers and daughters, and
@@ -358,59 +342,78 @@ uint32_t updateParticles(const ParticleCursor& cursor,
     // Store this particle.  We mark that putting a 1 in the
     // `toStore` mapping. This will later on be updated with the
     // actual index into the table
-    toStore[trackNo] = 1;
+    toStore.put(trackNo, 1);
 
     // If we're filtering tracks, then also mark mothers and
     // daughters(?) to be stored.
     if (filter) {
       int id;
       if ((id = track.getMotherTrackId()) >= 0) {
-        toStore[id] = 1;
+        toStore.put(id, 1);
       }
       if ((id = track.getSecondMotherTrackId()) >= 0) {
-        toStore[id] = 1;
+        toStore.put(id, 1);
       }
       if ((id = track.getFirstDaughterTrackId()) >= 0) {
-        toStore[id] = 1;
+        toStore.put(id, 1);
       }
       if ((id = track.getLastDaughterTrackId()) >= 0) {
-        toStore[id] = 1;
+        toStore.put(id, 1);
       }
     }
   }
-
-  // Second loop to set indexes.  This is needed to be done before
-  // we actually update the table, because a particle may point to a
-  // later particle.
   LOG(verbosity) << "Will store " << toStore.size() << " particles";
+  return toStore.size();
+}
+//--------------------------------------------------------------------
+void indexParticles(std::vector<MCTrack> const& tracks,
+                    TrackToIndex& toStore,
+                    uint32_t offset)
+{
+  // Loop to set indexes.  This is needed to be done before we
+  // actually update the table, because a particle may point to a
+  // later particle.
   size_t index = 0;
 
   for (size_t trackNo = 0U; trackNo < tracks.size(); trackNo++) {
-    auto storeIt = mapping(trackNo);
-    if (storeIt < 0) {
+    if (toStore.get(trackNo) < 0) {
       continue;
     }
 
-    toStore[trackNo] = offset + index;
+    toStore.put(trackNo, offset + index);
     index++;
   }
 
   // Make sure we have the right number
   assert(index == toStore.size());
+}
+//--------------------------------------------------------------------
+uint32_t writeParticles(const ParticleCursor& cursor,
+                        int collisionID,
+                        std::vector<MCTrack> const& tracks,
+                        TrackToIndex& toStore,
+                        uint32_t offset,
+                        bool background,
+                        uint32_t weightMask,
+                        uint32_t momentumMask,
+                        uint32_t positionMask)
+{
+  using namespace o2::aod::mcparticle::enums;
+  using namespace o2::mcgenstatus;
+
   LOG(verbosity) << "Starting index " << offset << ", last index "
-                 << offset + index << " "
+                 << offset + toStore.size() << " "
                  << "Selected " << toStore.size() << " tracks out of "
                  << tracks.size() << " "
                  << "Collision # " << collisionID;
-  // Third loop to actually store the particles in the order given
+  // Loop to actually store the particles in the order given
   for (size_t trackNo = 0U; trackNo < tracks.size(); trackNo++) {
-    auto storeIt = mapping(trackNo);
+    auto storeIt = toStore.get(trackNo);
     if (storeIt < 0) {
       continue;
     }
 
     auto& track = tracks[trackNo];
-    auto hepmc = getHepMCStatusCode(track.getStatusCode());
     uint8_t flags = (background ? FromBackgroundEvent : 0);
     updateParticle(cursor,
                    toStore,
@@ -422,8 +425,32 @@ uint32_t updateParticles(const ParticleCursor& cursor,
                    momentumMask,
                    positionMask);
   }
-  LOG(verbosity) << "Return new offset " << offset + index;
-  return offset + index;
+  LOG(verbosity) << "Return new offset " << offset + toStore.size();
+  return offset + toStore.size();
+}
+//--------------------------------------------------------------------
+uint32_t updateParticles(const ParticleCursor& cursor,
+                         int collisionID,
+                         std::vector<MCTrack> const& tracks,
+                         TrackToIndex& preselect,
+                         uint32_t offset,
+                         bool filter,
+                         bool background,
+                         uint32_t weightMask,
+                         uint32_t momentumMask,
+                         uint32_t positionMask)
+{
+  selectParticles(tracks, preselect, filter);
+  indexParticles(tracks, preselect, offset);
+  return writeParticles(cursor,
+                        collisionID,
+                        tracks,
+                        preselect,
+                        offset,
+                        background,
+                        weightMask,
+                        momentumMask,
+                        positionMask);
 }
 } // namespace o2::aodmchelpers
 
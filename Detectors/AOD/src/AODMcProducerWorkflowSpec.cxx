@@ -35,6 +35,7 @@ void AODMcProducerWorkflowDPL::init(InitContext& ic)
   mTFNumber = ic.options().get<int64_t>("aod-timeframe-id");
   mFilterMC = ic.options().get<int>("filter-mctracks");
   int truncate = ic.options().get<int>("enable-truncation");
+  int mcTruncationBits = ic.options().get<int>("mc-truncation-bits");
   if (mTFNumber == -1L) {
     LOG(info) << "TFNumber will be obtained from CCDB";
   }
@@ -46,6 +47,15 @@ void AODMcProducerWorkflowDPL::init(InitContext& ic)
     mMcParticleW = 0xFFFFFFFF;
     mMcParticlePos = 0xFFFFFFFF;
     mMcParticleMom = 0xFFFFFFFF;
+  } else if (mcTruncationBits > 0) {
+    // keep only the requested number of mantissa bits for the MC particle
+    // kinematics; 10 bits matches half (float16) precision and shrinks the
+    // compressed size of the kinematics columns accordingly
+    uint32_t mask = mcTruncationBits < 23 ? (0xFFFFFFFFu << (23 - mcTruncationBits)) : 0xFFFFFFFF;
+    LOG(info) << "Keeping " << mcTruncationBits << " mantissa bits for MC particle kinematics";
+    mMcParticleW = mask;
+    mMcParticlePos = mask;
+    mMcParticleMom = mask;
   }
 
   mEnableEmbed = ic.options().get<bool>("enable-embedding");
@@ -313,6 +323,7 @@ DataProcessorSpec getAODMcProducerWorkflowSpec()
     Options{
       ConfigParamSpec{"aod-timeframe-id", VariantType::Int64, 1L, {"Set timeframe number"}},
       ConfigParamSpec{"enable-truncation", VariantType::Int, 1, {"Truncation parameter: 1 -- on, != 1 -- off"}},
+      ConfigParamSpec{"mc-truncation-bits", VariantType::Int, -1, {"Float mantissa bits kept for MC particle kinematics (10 ~ half precision); <= 0 keeps the defaults"}},
       ConfigParamSpec{"lpmp-prod-tag", VariantType::String, "", {"LPMProductionTag"}},
       ConfigParamSpec{"anchor-pass", VariantType::String, "", {"AnchorPassName"}},
       ConfigParamSpec{"anchor-prod", VariantType::String, "", {"AnchorProduction"}},
@@ -43,6 +43,7 @@
 #include "CommonConstants/Triggers.h"
 #include "CommonConstants/PhysicsConstants.h"
 #include "CommonDataFormat/InteractionRecord.h"
+#include "CommonDataFormat/TriggerRecordIndex.h"
 #include "DataFormatsTRD/TrackTRD.h"
 #include "DataFormatsTRD/TrackTriggerRecord.h"
 #include "DataFormatsGlobalTracking/RecoContainer.h"
@@ -161,7 +162,11 @@ void AODProducerWorkflowDPL::createCTPReadout(const o2::globaltracking::RecoCont
     }
   }
 
-  auto genericCTPDigitizer = [&bcsMapT0triggers, &ctpDigits](auto triggerrecords, uint64_t classmask) -> int {
+  // index the CTP digits by global BC once, to avoid a linear scan per trigger record
+  o2::dataformats::TriggerRecordIndex ctpDigitIndex;
+  ctpDigitIndex.build(ctpDigits, [](const o2::ctp::CTPDigit& dig) { return dig.intRecord; });
+
+  auto genericCTPDigitizer = [&bcsMapT0triggers, &ctpDigits, &ctpDigitIndex](auto triggerrecords, uint64_t classmask) -> int {
     // Strategy:
     // find detector trigger based on trigger record from readout and add CTPDigit if trigger there
     int cntwarnings = 0;
@@ -180,17 +185,19 @@ void AODProducerWorkflowDPL::createCTPReadout(const o2::globaltracking::RecoCont
         uint64_t globalBC = trigger.getBCData().toLong();
         auto t0entry = bcsMapT0triggers.find(globalBC);
         if (t0entry != bcsMapT0triggers.end()) {
-          auto ctpdig = std::find_if(ctpDigits.begin(), ctpDigits.end(), [globalBC](const o2::ctp::CTPDigit& dig) { return static_cast<uint64_t>(dig.intRecord.toLong()) == globalBC; });
-          if (ctpdig != ctpDigits.end()) {
+          const auto digIndex = ctpDigitIndex.find(globalBC);
+          if (digIndex >= 0) {
             // CTP digit existing from other trigger, merge detector class mask
-            ctpdig->CTPClassMask |= std::bitset<64>(classmask);
-            LOG(debug) << "createCTPReadout: Merging " << classmask << " CTP digits with existing digit, CTP mask " << ctpdig->CTPClassMask;
+            auto& ctpdig = ctpDigits[digIndex];
+            ctpdig.CTPClassMask |= std::bitset<64>(classmask);
+            LOG(debug) << "createCTPReadout: Merging " << classmask << " CTP digits with existing digit, CTP mask " << ctpdig.CTPClassMask;
           } else {
             // New CTP digit needed
             LOG(debug) << "createCTPReadout: New CTP digit needed for class " << classmask << std::endl;
             auto& ctpdigNew = ctpDigits.emplace_back();
             ctpdigNew.intRecord.setFromLong(globalBC);
             ctpdigNew.CTPClassMask = classmask;
+            ctpDigitIndex.insert(globalBC, int(ctpDigits.size() - 1));
           }
         } else {
           LOG(warning) << "createCTPReadout: Found " << classmask << " and no MTVX:" << globalBC;
@@ -454,6 +461,18 @@ void AODProducerWorkflowDPL::fillTrackTablesPerCollision(int collisionID,
       tracksCovCursor.reserve(nToReserve + tracksCovCursor.lastIndex());
       tracksExtraCursor.reserve(nToReserve + tracksExtraCursor.lastIndex());
     }
+    std::vector<TrackExtraInfo> extraStaging; // precomputed extra info for barrel tracks, the cursors are filled from it serially
+#ifdef WITH_OPENMP
+    if (mNThreads > 1 && nToReserve > 0 && GIndex::includesSource(src, mInputSources) &&
+        src != GIndex::Source::MFT && src != GIndex::Source::MCH && src != GIndex::Source::MFTMCH && src != GIndex::Source::MCHMID) {
+      extraStaging.resize(nToReserve);
+      int ngroup = std::min(50, std::max(1, nToReserve / mNThreads));
+#pragma omp parallel for schedule(dynamic, ngroup) num_threads(mNThreads)
+      for (int ti = start; ti < end; ti++) {
+        extraStaging[ti - start] = processBarrelTrack(collisionID, collisionBC, GIndices[ti], data, bcsMap);
+      }
+    }
+#endif
     for (int ti = start; ti < end; ti++) {
       const auto& trackIndex = GIndices[ti];
       if (GIndex::includesSource(src, mInputSources)) {
@@ -481,7 +500,7 @@ void AODProducerWorkflowDPL::fillTrackTablesPerCollision(int collisionID,
           float weight = 0;
           static std::uniform_real_distribution<> distr(0., 1.);
           bool writeQAData = o2::math_utils::Tsallis::downsampleTsallisCharged(data.getTrackParam(trackIndex).getPt(), mTrackQCFraction, mSqrtS, weight, distr(mGenerator));
-          auto extraInfoHolder = processBarrelTrack(collisionID, collisionBC, trackIndex, data, bcsMap);
+          auto extraInfoHolder = extraStaging.empty() ? processBarrelTrack(collisionID, collisionBC, trackIndex, data, bcsMap) : std::move(extraStaging[ti - start]);
 
           if (writeQAData) {
             auto trackQAInfoHolder = processBarrelTrackQA(collisionID, collisionBC, trackIndex, data, bcsMap);
@@ -875,7 +894,7 @@ void AODProducerWorkflowDPL::updateMCHeader(MCCollisionCursor& collisionCursor,
                        : HepMCUpdate::never);
 }
 
-void dimensionMCKeepStore(std::vector<std::vector<std::unordered_map<int, int>>>& store, int Nsources, int NEvents)
+void dimensionMCKeepStore(std::vector<std::vector<o2::aodmchelpers::TrackToIndex>>& store, int Nsources, int NEvents)
 {
   store.resize(Nsources);
   for (int s = 0; s < Nsources; ++s) {
@@ -883,7 +902,7 @@ void dimensionMCKeepStore(std::vector<std::vector<std::unordered_map<int, int>>>
   }
 }
 
-void clearMCKeepStore(std::vector<std::vector<std::unordered_map<int, int>>>& store)
+void clearMCKeepStore(std::vector<std::vector<o2::aodmchelpers::TrackToIndex>>& store)
 {
   for (auto s = 0U; s < store.size(); ++s) {
     for (auto e = 0U; e < store[s].size(); ++e) {
@@ -893,13 +912,13 @@ void clearMCKeepStore(std::vector<std::vector<std::unordered_map<int, int>>>& st
 }
 
 // helper function to add a particle/track to the MC keep store
-void keepMCParticle(std::vector<std::vector<std::unordered_map<int, int>>>& store, int source, int event, int track, int value = 1)
+void keepMCParticle(std::vector<std::vector<o2::aodmchelpers::TrackToIndex>>& store, int source, int event, int track, int value = 1)
 {
   if (track < 0) {
     LOG(warn) << "trackID is smaller than 0. Neglecting";
     return;
   }
-  store[source][event][track] = value;
+  store[source][event].put(track, value);
 }
 
 void AODProducerWorkflowDPL::fillMCParticlesTable(o2::steer::MCKinematicsReader& mcReader,
@@ -987,26 +1006,51 @@ void AODProducerWorkflowDPL::fillMCParticlesTable(o2::steer::MCKinematicsReader&
   using namespace aodmchelpers;
   using MCTrackNavigator = o2::mcutils::MCTrackNavigator;
 
+  int nMCCol = mcColToEvSrc.size();
+  // the kinematics of all events of the batch have to be resident: ROOT I/O
+  // is not thread safe, so the trees are read up front in a serial pass
+  std::vector<std::vector<MCTrack> const*> eventTracks(nMCCol);
+  for (int i = 0; i < nMCCol; i++) {
+    eventTracks[i] = &mcReader.getTracks(mcColToEvSrc[i][1], mcColToEvSrc[i][2]);
+  }
+  // selection: decides per event which particles to keep; touches only the
+  // event's own containers, so the events can be processed concurrently
+  std::vector<size_t> nSelected(nMCCol);
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(dynamic) num_threads(mNThreads)
+#endif
+  for (int i = 0; i < nMCCol; i++) {
+    nSelected[i] = selectParticles(*eventTracks[i], mToStore[mcColToEvSrc[i][1]][mcColToEvSrc[i][2]], mRecoOnly);
+  }
+  // prefix sum over the selection counts fixes each event's output extent,
+  // after which the index assignment is again independent per event
+  std::vector<uint32_t> offsets(nMCCol);
   size_t offset = 0;
-  for (auto& colInfo : mcColToEvSrc) { // loop over "<eventID, sourceID> <-> combined MC col. ID" key pairs
-    int event = colInfo[2];
-    int source = colInfo[1];
-    int mcColId = colInfo[0];
-    std::vector<MCTrack> const& mcParticles = mcReader.getTracks(source, event);
+  for (int i = 0; i < nMCCol; i++) {
+    offsets[i] = offset;
+    offset += nSelected[i];
+  }
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(dynamic) num_threads(mNThreads)
+#endif
+  for (int i = 0; i < nMCCol; i++) {
+    indexParticles(*eventTracks[i], mToStore[mcColToEvSrc[i][1]][mcColToEvSrc[i][2]], offsets[i]);
+  }
+  // the table cursor is not thread safe: the rows are written serially
+  for (int i = 0; i < nMCCol; i++) {
+    int event = mcColToEvSrc[i][2];
+    int source = mcColToEvSrc[i][1];
+    int mcColId = mcColToEvSrc[i][0];
     LOG(debug) << "Event=" << event << " source=" << source << " collision=" << mcColId;
-    auto& preselect = mToStore[source][event];
-
-    offset = updateParticles(mcParticlesCursor,
-                             mcColId,
-                             mcParticles,
-                             preselect,
-                             offset,
-                             mRecoOnly,
-                             source == 0, // background
-                             mMcParticleW,
-                             mMcParticleMom,
-                             mMcParticlePos);
-
+    writeParticles(mcParticlesCursor,
+                   mcColId,
+                   *eventTracks[i],
+                   mToStore[source][event],
+                   offsets[i],
+                   source == 0, // background
+                   mMcParticleW,
+                   mMcParticleMom,
+                   mMcParticlePos);
     mcReader.releaseTracksForSourceAndEvent(source, event);
   }
 }
@@ -1053,7 +1097,7 @@ void AODProducerWorkflowDPL::fillMCTrackLabelsTable(MCTrackLabelCursorType& mcTr
             continue;
           }
           if (mcTruth.isValid()) { // if not set, -1 will be stored
-            labelHolder.labelID = (mToStore[mcTruth.getSourceID()][mcTruth.getEventID()])[mcTruth.getTrackID()];
+            labelHolder.labelID = mToStore[mcTruth.getSourceID()][mcTruth.getEventID()].get(mcTruth.getTrackID());
           }
           if (mcTruth.isFake()) {
             labelHolder.fwdLabelMask |= (0x1 << 7);
@@ -1073,7 +1117,7 @@ void AODProducerWorkflowDPL::fillMCTrackLabelsTable(MCTrackLabelCursorType& mcTr
             continue;
           }
           if (mcTruth.isValid()) { // if not set, -1 will be stored
-            labelHolder.labelID = (mToStore[mcTruth.getSourceID()][mcTruth.getEventID()])[mcTruth.getTrackID()];
+            labelHolder.labelID = mToStore[mcTruth.getSourceID()][mcTruth.getEventID()].get(mcTruth.getTrackID());
           }
           // treating possible mismatches and fakes for global tracks
           auto contributorsGID = data.getSingleDetectorRefs(trackIndex);
@@ -1084,13 +1128,13 @@ void AODProducerWorkflowDPL::fillMCTrackLabelsTable(MCTrackLabelCursorType& mcTr
           if (isSetTPC && (isSetITS || isSetTOF)) {
             auto mcTruthTPC = data.getTrackMCLabel(contributorsGID[GIndex::Source::TPC]);
             if (mcTruthTPC.isValid()) {
-              labelHolder.labelTPC = (mToStore[mcTruthTPC.getSourceID()][mcTruthTPC.getEventID()])[mcTruthTPC.getTrackID()];
+              labelHolder.labelTPC = mToStore[mcTruthTPC.getSourceID()][mcTruthTPC.getEventID()].get(mcTruthTPC.getTrackID());
               labelHolder.labelID = labelHolder.labelTPC;
             }
             if (isSetITS) {
               auto mcTruthITS = data.getTrackMCLabel(contributorsGID[GIndex::Source::ITS]);
               if (mcTruthITS.isValid()) {
-                labelHolder.labelITS = (mToStore[mcTruthITS.getSourceID()][mcTruthITS.getEventID()])[mcTruthITS.getTrackID()];
+                labelHolder.labelITS = mToStore[mcTruthITS.getSourceID()][mcTruthITS.getEventID()].get(mcTruthITS.getTrackID());
               }
               if (labelHolder.labelITS != labelHolder.labelTPC) {
                 LOG(debug) << "ITS-TPC MCTruth: labelIDs do not match at " << trackIndex.getIndex() << ", src = " << src;
@@ -1132,7 +1176,7 @@ void AODProducerWorkflowDPL::fillMCTrackLabelsTable(MCTrackLabelCursorType& mcTr
       auto& collStrTrk = mCollisionStrTrk[iS];
       auto& label = sTrackLabels[collStrTrk.second];
       MCLabels labelHolder;
-      labelHolder.labelID = label.isValid() ? (mToStore[label.getSourceID()][label.getEventID()])[label.getTrackID()] : -1;
+      labelHolder.labelID = label.isValid() ? mToStore[label.getSourceID()][label.getEventID()].get(label.getTrackID()) : -1;
       labelHolder.labelMask = (label.isFake() << 15) | (label.isNoise() << 14);
       mcTrackLabelCursor(labelHolder.labelID, labelHolder.labelMask);
     }
@@ -1523,18 +1567,18 @@ void AODProducerWorkflowDPL::addToCaloTable(TCaloHandler& caloHandler, TCaloCurs
           if (mEMCselectLeading) {
             if (mclabel.getAmplitudeFraction() > tmpMaxAmplitude) {
               // Check if this MCparticle added to be kept?
-              if (mToStore.at(mclabel.getSourceID()).at(mclabel.getEventID()).find(mclabel.getTrackID()) !=
-                  mToStore.at(mclabel.getSourceID()).at(mclabel.getEventID()).end()) {
+              const auto index = mToStore.at(mclabel.getSourceID()).at(mclabel.getEventID()).get(mclabel.getTrackID());
+              if (index != aodmchelpers::TrackToIndex::NotStored) {
                 tmpMaxAmplitude = mclabel.getAmplitudeFraction();
-                tmpindex = (mToStore.at(mclabel.getSourceID()).at(mclabel.getEventID())).at(mclabel.getTrackID());
+                tmpindex = index;
               }
             }
           } else {
-            auto trackStore = mToStore.at(mclabel.getSourceID()).at(mclabel.getEventID());
-            auto iter = trackStore.find(mclabel.getTrackID());
-            if (iter != trackStore.end()) {
+            const auto& trackStore = mToStore.at(mclabel.getSourceID()).at(mclabel.getEventID());
+            const auto index = trackStore.get(mclabel.getTrackID());
+            if (index != aodmchelpers::TrackToIndex::NotStored) {
               amplitudeFraction.emplace_back(mclabel.getAmplitudeFraction());
-              particleIds.emplace_back(iter->second);
+              particleIds.emplace_back(index);
             } else {
               particleIds.emplace_back(-1); // should the mc particle not be in mToStore make sure something (e.g. -1) is saved in particleIds so the length of particleIds is the same es amplitudeFraction!
               amplitudeFraction.emplace_back(0.f);
@@ -1729,6 +1773,15 @@ void AODProducerWorkflowDPL::init(InitContext& ic)
     mV0Amplitude = 0xFFFFFFFF;
     mFDDAmplitude = 0xFFFFFFFF;
     mT0Amplitude = 0xFFFFFFFF;
+  } else if (int mcTruncationBits = ic.options().get<int>("mc-truncation-bits"); mcTruncationBits > 0) {
+    // keep only the requested number of mantissa bits for the MC particle
+    // kinematics; 10 bits matches half (float16) precision and shrinks the
+    // compressed size of the kinematics columns accordingly
+    uint32_t mask = mcTruncationBits < 23 ? (0xFFFFFFFFu << (23 - mcTruncationBits)) : 0xFFFFFFFF;
+    LOG(info) << "Keeping " << mcTruncationBits << " mantissa bits for MC particle kinematics";
+    mMcParticleW = mask;
+    mMcParticlePos = mask;
+    mMcParticleMom = mask;
   }
   // Initialize ZDC helper maps
   for (int ic = 0; ic < o2::zdc::NChannels; ic++) {
@@ -3059,6 +3112,7 @@ DataProcessorSpec getAODProducerWorkflowSpec(GID::mask_t src, bool enableSV, boo
       ConfigParamSpec{"aod-timeframe-id", VariantType::Int64, -1L, {"Set timeframe number"}},
       ConfigParamSpec{"fill-calo-cells", VariantType::Int, 1, {"Fill calo cells into cell table"}},
       ConfigParamSpec{"enable-truncation", VariantType::Int, 1, {"Truncation parameter: 1 -- on, != 1 -- off"}},
+      ConfigParamSpec{"mc-truncation-bits", VariantType::Int, -1, {"Float mantissa bits kept for MC particle kinematics (10 ~ half precision); <= 0 keeps the defaults"}},
       ConfigParamSpec{"lpmp-prod-tag", VariantType::String, "", {"LPMProductionTag"}},
       ConfigParamSpec{"anchor-pass", VariantType::String, "", {"AnchorPassName"}},
       ConfigParamSpec{"anchor-prod", VariantType::String, "", {"AnchorProduction"}},
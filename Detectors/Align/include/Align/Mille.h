@@ -43,6 +43,7 @@ class Mille
 {
  public:
   Mille(const std::string& outFileName, bool asBinary = true, bool writeZero = false);
+  ~Mille();
   void mille(int NLC, const float* derLc, int NGL, const float* derGl, const int* label, float rMeas, float sigma);
   void special(int nSpecial, const float* floatings, const int* integers);
   void clear();
@@ -51,9 +52,14 @@ class Mille
   int end() { return finalise(); } //  alias to old Mille method
 
  private:
+  void flushChunk();
+
   /// largest label allowed: 2^31 - 1
   static constexpr int MaxLabel = 0x7fffffff;
+  /// size above which the accumulated binary records are written out
+  static constexpr size_t ChunkSize = 8 * 1024 * 1024;
   std::ofstream mOutFile = {};     ///< C-binary for output
+  std::vector<char> mChunk;        ///< accumulated binary records, written out in large blocks
   bool mAsBinary = true;           ///< if false output as text
   bool mWriteZero = false;         ///< if true also write out derivatives/labels ==0
   bool mHasSpecial = false;        ///< if true, special(..) already called for this record
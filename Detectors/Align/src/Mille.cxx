@@ -38,9 +38,18 @@ Mille::Mille(const std::string& outFileName, bool asBinary, bool writeZero)
   }
   mBufferInt.reserve(1024);
   mBufferFloat.reserve(1024);
+  if (mAsBinary) {
+    mChunk.reserve(ChunkSize);
+  }
   clear();
 }
 
+//___________________________________________________________________________
+Mille::~Mille()
+{
+  flushChunk();
+}
+
 //___________________________________________________________________________
 /// Add measurement to buffer.
 /**
@@ -134,9 +143,15 @@ int Mille::finalise()
     const int numWordsToWrite = nw * 2;
 
     if (mAsBinary) {
-      mOutFile.write(reinterpret_cast<const char*>(&numWordsToWrite), sizeof(int));
-      mOutFile.write(reinterpret_cast<const char*>(mBufferFloat.data()), nw * sizeof(mBufferFloat[0]));
-      mOutFile.write(reinterpret_cast<const char*>(mBufferInt.data()), nw * sizeof(mBufferInt[0]));
+      // accumulate the record in memory, the chunk is written out in large blocks
+      // to avoid one system call per track record
+      auto append = [this](const char* data, size_t n) { mChunk.insert(mChunk.end(), data, data + n); };
+      append(reinterpret_cast<const char*>(&numWordsToWrite), sizeof(int));
+      append(reinterpret_cast<const char*>(mBufferFloat.data()), nw * sizeof(mBufferFloat[0]));
+      append(reinterpret_cast<const char*>(mBufferInt.data()), nw * sizeof(mBufferInt[0]));
+      if (mChunk.size() >= ChunkSize) {
+        flushChunk();
+      }
     } else {
       mOutFile << numWordsToWrite << "\n";
       for (int i = 0; i < nw; i++) {
@@ -154,6 +169,16 @@ int Mille::finalise()
   return wrote;
 }
 
+//___________________________________________________________________________
+/// Write out the accumulated records.
+void Mille::flushChunk()
+{
+  if (!mChunk.empty()) {
+    mOutFile.write(mChunk.data(), mChunk.size());
+    mChunk.clear();
+  }
+}
+
 //___________________________________________________________________________
 /// Initialize for new set of locals, e.g. new track.
 void Mille::clear()
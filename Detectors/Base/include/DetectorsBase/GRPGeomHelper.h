@@ -102,6 +102,7 @@ struct GRPGeomRequest {
   bool askAlignments = false; // load detector alignments but don't apply them
   bool askOnceAllButField = false; // for all entries but field query only once
   bool needPropagatorD = false;    // init also PropagatorD
+  bool matLUTFromCache = false;    // matLUT is mapped from the node-local binary dump (O2_MATLUT_CACHE_FILE) instead of being fetched from CCDB
 
   GRPGeomRequest() = delete;
   GRPGeomRequest(bool orbitResetTime, bool GRPECS, bool GRPLHCIF, bool GRPMagField, bool askMatLUT, GeomRequest geom, std::vector<o2::framework::InputSpec>& inputs, bool askOnce = false, bool needPropD = false, std::string detMaskString = "all");
@@ -81,6 +81,11 @@ class MatLayerCylSet : public o2::gpu::FlatObject
   static MatLayerCylSet* loadFromFile(const std::string& inpFName = "matbud.root");
   static MatLayerCylSet* rectifyPtrFromFile(MatLayerCylSet* ptr);
 
+  /// dump the flat buffer in raw binary form to be mapped back with readFlatBinary
+  void writeFlatBinary(const std::string& outFName) const;
+  /// mmap a raw binary dump; the bulk of the buffer stays shared between the processes of a node
+  static MatLayerCylSet* readFlatBinary(const std::string& inpFName);
+
   // initializes internal voxel lookup
   void initLayerVoxelLU();
 
@@ -88,6 +93,8 @@ class MatLayerCylSet : public o2::gpu::FlatObject
 
   MatLayerCyl& getLayer(int i) { return get()->mLayers[i]; }
   MatLayerCylSet* extractCopy(float rmin, float rmax, float tol = 1e-3) const;
+  /// create a copy with cells rebinned (averaged) by the given factors in Z and phi, to trade resolution for memory
+  MatLayerCylSet* extractRebinnedCopy(int nzFactor, int nphiFactor, float tol = 1e-3) const;
   void finalizeStructures();
 
 #endif // !GPUCA_ALIGPUCODE
@@ -26,6 +26,8 @@
 
 #ifndef GPUCA_GPUCODE
 #include <string>
+#include <vector>
+#include <gsl/span>
 #endif
 
 namespace o2
@@ -88,6 +90,21 @@ class PropagatorImpl
                            value_type maxSnp = MAX_SIN_PHI, value_type maxStep = MAX_STEP, MatCorrType matCorr = MatCorrType::USEMatCorrLUT,
                            track::TrackLTIntegral* tofInfo = nullptr, int signCorr = 0) const;
 
+#ifndef GPUCA_GPUCODE
+  /// Propagate a batch of tracks to the same plane X=x, the stepping of every track being identical
+  /// to the scalar propagateTo call. The return value counts the successfully propagated tracks, the
+  /// per-track outcome is flagged in the optional status vector (resized to the batch size).
+  /// Batching tracks of the same spatial region (e.g. a sector time-cache) keeps the field and
+  /// material-LUT queries of neighbouring tracks together and is the single point for vectorization.
+  int propagateBatchToX(gsl::span<TrackParCov_t> tracks, value_type x, bool bzOnly = false,
+                        value_type maxSnp = MAX_SIN_PHI, value_type maxStep = MAX_STEP, MatCorrType matCorr = MatCorrType::USEMatCorrLUT,
+                        std::vector<uint8_t>* status = nullptr, int signCorr = 0) const;
+
+  int propagateBatchToX(gsl::span<TrackPar_t> tracks, value_type x, bool bzOnly = false,
+                        value_type maxSnp = MAX_SIN_PHI, value_type maxStep = MAX_STEP, MatCorrType matCorr = MatCorrType::USEMatCorrLUT,
+                        std::vector<uint8_t>* status = nullptr, int signCorr = 0) const;
+#endif
+
   template <typename track_T>
   GPUd() bool propagateTo(track_T& track, value_type x, bool bzOnly = false, value_type maxSnp = MAX_SIN_PHI, value_type maxStep = MAX_STEP,
                           MatCorrType matCorr = MatCorrType::USEMatCorrLUT, track::TrackLTIntegral* tofInfo = nullptr, int signCorr = 0) const
@@ -13,6 +13,8 @@
 /// \brief Helper for geometry and GRP related CCDB requests
 /// \author ruben.shahoyan@cern.ch
 
+#include <cstdlib>
+#include <filesystem>
 #include <fmt/format.h>
 #include <TGeoGlobalMagField.h>
 #include <TGeoManager.h>
@@ -57,7 +59,12 @@ GRPGeomRequest::GRPGeomRequest(bool orbitResetTime, bool GRPECS, bool GRPLHCIF,
     }
   }
   if (askMatLUT) {
-    addInput({"matLUT", "GLO", "MATLUT", 0, Lifetime::Condition, ccdbParamSpec("GLO/Param/MatLUT")}, inputs);
+    const char* matLUTCache = getenv("O2_MATLUT_CACHE_FILE");
+    if (matLUTCache && std::filesystem::exists(matLUTCache)) {
+      matLUTFromCache = true; // served from the node-local binary dump, no CCDB input and no ROOT deserialization needed
+    } else {
+      addInput({"matLUT", "GLO", "MATLUT", 0, Lifetime::Condition, ccdbParamSpec("GLO/Param/MatLUT")}, inputs);
+    }
   }
   if (askTime) {
     addInput({"orbitReset", "CTP", "ORBITRESET", 0, Lifetime::Condition, ccdbParamSpec("CTP/Calib/OrbitReset")}, inputs);
@@ -101,6 +108,18 @@ bool GRPGeomHelper::finaliseCCDB(ConcreteDataMatcher& matcher, void* obj)
       if (mRequest->needPropagatorD) {
         o2::base::PropagatorD::initFieldFromGRP(mGRPMagField);
       }
+      if (mRequest->askMatLUT && mRequest->matLUTFromCache && !mMatLUT) {
+        // the LUT is mapped from the node-local binary dump at the same point of the
+        // initialization sequence at which the CCDB-fetched one would be applied
+        mMatLUT = o2::base::MatLayerCylSet::readFlatBinary(getenv("O2_MATLUT_CACHE_FILE"));
+        if (!mMatLUT) {
+          LOG(fatal) << "Failed to map material LUT from the cache file pointed to by O2_MATLUT_CACHE_FILE";
+        }
+        o2::base::Propagator::Instance(false)->setMatLUT(mMatLUT);
+        if (mRequest->needPropagatorD) {
+          o2::base::PropagatorD::Instance(false)->setMatLUT(mMatLUT);
+        }
+      }
     } else {
       auto field = TGeoGlobalMagField::Instance()->GetField();
       if (field->InheritsFrom("o2::field::MagneticField")) {
@@ -135,6 +154,12 @@ bool GRPGeomHelper::finaliseCCDB(ConcreteDataMatcher& matcher, void* obj)
     if (mRequest->needPropagatorD) {
       o2::base::PropagatorD::Instance(false)->setMatLUT(mMatLUT);
     }
+    const char* matLUTCache = getenv("O2_MATLUT_CACHE_FILE");
+    if (matLUTCache && !std::filesystem::exists(matLUTCache)) {
+      // seed the node-local cache so that the other devices of the node (and later
+      // restarts) map the binary dump instead of deserializing the CCDB object
+      mMatLUT->writeFlatBinary(matLUTCache);
+    }
     return true;
   }
   if (mRequest->askGeomAlign && matcher == ConcreteDataMatcher("GLO", "GEOMALIGN", 0)) {
@@ -195,7 +220,7 @@ void GRPGeomHelper::checkUpdates(ProcessingContext& pc) const
         return;
       }
     }
-    if (mRequest->askMatLUT) {
+    if (mRequest->askMatLUT && !mRequest->matLUTFromCache) {
       if (pc.inputs().isValid("matLUT")) {
         pc.inputs().get<o2::base::MatLayerCylSet*>("matLUT");
       } else {
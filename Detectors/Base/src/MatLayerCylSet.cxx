@@ -18,6 +18,14 @@
 #include "GPUCommonLogger.h"
 #include <TFile.h>
 #include "CommonUtils/TreeStreamRedirector.h"
+#include <fmt/format.h>
+#include <filesystem>
+#include <fstream>
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 //#define _DBG_LOC_ // for local debugging only
 
 #endif // !GPUCA_ALIGPUCODE
@@ -175,6 +183,86 @@ void MatLayerCylSet::writeToFile(const std::string& outFName)
   outf.Close();
 }
 
+namespace
+{
+// 64 bytes header of the raw binary dump, the size preserves the alignment of the
+// flat buffer which starts right after it in the file
+struct MatLUTBinHeader {
+  char magic[8] = {'O', '2', 'M', 'A', 'T', 'L', 'U', 'T'};
+  std::int32_t version = 1;
+  std::int32_t reserved = 0;
+  std::int64_t bufferSize = 0;
+  char padding[40] = {};
+};
+static_assert(sizeof(MatLUTBinHeader) == 64, "binary matLUT header must be 64 bytes");
+} // namespace
+
+//________________________________________________________________________________
+void MatLayerCylSet::writeFlatBinary(const std::string& outFName) const
+{
+  /// dump the flat buffer in raw binary form, to be mapped back with readFlatBinary.
+  /// The dump is written to a temporary file and renamed, so that concurrent writers
+  /// of the same (deterministic) content race benignly and readers never see a
+  /// partial file.
+  if (mConstructionMask != Constructed || !mFlatBufferPtr) {
+    LOG(error) << "attempt to dump a non-flattened object to " << outFName;
+    return;
+  }
+  MatLUTBinHeader header;
+  header.bufferSize = mFlatBufferSize;
+  std::string tmpName = fmt::format("{}.{}.part", outFName, getpid());
+  std::ofstream outf(tmpName, std::ios::binary);
+  outf.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  outf.write(mFlatBufferPtr, mFlatBufferSize);
+  outf.close();
+  if (!outf) {
+    LOG(error) << "Failed to write binary mat.LUT dump to " << tmpName;
+    std::filesystem::remove(tmpName);
+    return;
+  }
+  std::filesystem::rename(tmpName, outFName);
+  LOGP(info, "Wrote binary mat.LUT dump of {} bytes to {}", mFlatBufferSize, outFName);
+}
+
+//________________________________________________________________________________
+MatLayerCylSet* MatLayerCylSet::readFlatBinary(const std::string& inpFName)
+{
+  /// map a raw binary dump produced by writeFlatBinary. The buffer is mapped
+  /// copy-on-write: only the few pages touched by the pointer relocation are
+  /// private to the process, the bulk of the tables is backed by the page cache
+  /// and shared between all processes of the node mapping the same file.
+  int fd = open(inpFName.c_str(), O_RDONLY);
+  if (fd < 0) {
+    LOG(error) << "Failed to open binary mat.LUT dump " << inpFName;
+    return nullptr;
+  }
+  MatLUTBinHeader header, reference;
+  struct stat st {
+  };
+  if (read(fd, &header, sizeof(header)) != sizeof(header) ||
+      memcmp(header.magic, reference.magic, sizeof(header.magic)) != 0 || header.version != reference.version ||
+      fstat(fd, &st) != 0 || st.st_size != std::int64_t(sizeof(header)) + header.bufferSize) {
+    LOG(error) << "Corrupted or incompatible binary mat.LUT dump " << inpFName;
+    close(fd);
+    return nullptr;
+  }
+  auto* base = mmap(nullptr, st.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (base == MAP_FAILED) {
+    LOG(error) << "Failed to map binary mat.LUT dump " << inpFName;
+    return nullptr;
+  }
+  auto* lut = new MatLayerCylSet();
+  lut->mFlatBufferSize = header.bufferSize;
+  lut->mFlatBufferContainer = nullptr;
+  lut->mFlatBufferPtr = reinterpret_cast<char*>(base) + sizeof(header);
+  lut->mConstructionMask = Constructed;
+  lut->fixPointers(lut->mFlatBufferPtr);
+  lut->initLayerVoxelLU();
+  LOGP(info, "Mapped binary mat.LUT dump of {} bytes from {}", lut->mFlatBufferSize, inpFName);
+  return lut;
+}
+
 void MatLayerCylSet::initLayerVoxelLU()
 {
   if (mInitializedLayerVoxelLU) {
@@ -611,4 +699,53 @@ MatLayerCylSet* MatLayerCylSet::extractCopy(float rmin, float rmax, float tolera
   return copy;
 }
 
+MatLayerCylSet* MatLayerCylSet::extractRebinnedCopy(int nzFactor, int nphiFactor, float tolerance) const
+{
+  // Create a copy with nzFactor x nphiFactor coarser cells, averaging the original ones.
+  // Within a layer all cells merged into a coarse cell have the same volume, so the plain
+  // average preserves the mean material. Together with the phi-slices merging this allows
+  // to trade the LUT resolution for the resident memory of processes sharing a node.
+  if (nzFactor < 1 || nphiFactor < 1) {
+    LOGP(error, "Invalid rebinning factors {} x {}", nzFactor, nphiFactor);
+    return nullptr;
+  }
+  LOGP(info, "Will rebin {} layers by {} in Z and {} in phi", getNLayers(), nzFactor, nphiFactor);
+  MatLayerCylSet* copy = new MatLayerCylSet();
+  for (int il = 0; il < getNLayers(); il++) {
+    const auto& lr = getLayer(il);
+    float drphi = lr.getDPhi() * nphiFactor * (lr.getRMin() + lr.getRMax()) / 2. * 0.999;
+    copy->addLayer(lr.getRMin(), lr.getRMax(), lr.getZMax(), lr.getDZ() * nzFactor * 0.999, drphi);
+    auto& lrNew = copy->getLayer(il);
+    std::vector<MatCell> acc(lrNew.getNPhiBins() * lrNew.getNZBins());
+    std::vector<int> cnt(acc.size(), 0);
+    for (int iz = 0; iz < lr.getNZBins(); iz++) {
+      float zc = 0.5 * (lr.getZBinMin(iz) + lr.getZBinMax(iz));
+      int izNew = std::min(int((zc - lrNew.getZMin()) / lrNew.getDZ()), lrNew.getNZBins() - 1);
+      for (int ip = 0; ip < lr.getNPhiBins(); ip++) {
+        float phic = 0.5 * (lr.getPhiBinMin(ip) + lr.getPhiBinMax(ip));
+        int ipNew = std::min(int(phic / lrNew.getDPhi()), lrNew.getNPhiBins() - 1);
+        const auto& cell = lr.getCellPhiBin(ip, iz);
+        auto& accCell = acc[ipNew * lrNew.getNZBins() + izNew];
+        accCell.meanRho += cell.meanRho;
+        accCell.meanX2X0 += cell.meanX2X0;
+        cnt[ipNew * lrNew.getNZBins() + izNew]++;
+      }
+    }
+    for (int iz = 0; iz < lrNew.getNZBins(); iz++) {
+      for (int ip = 0; ip < lrNew.getNPhiBins(); ip++) {
+        auto& accCell = acc[ip * lrNew.getNZBins() + iz];
+        if (cnt[ip * lrNew.getNZBins() + iz]) {
+          accCell.scale(1.f / cnt[ip * lrNew.getNZBins() + iz]);
+        }
+        lrNew.getCellPhiBin(ip, iz).set(accCell);
+      }
+    }
+  }
+
+  copy->finalizeStructures();
+  copy->optimizePhiSlices(tolerance);
+  copy->flatten();
+  return copy;
+}
+
 #endif
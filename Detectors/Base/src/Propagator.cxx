@@ -418,6 +418,57 @@ GPUd() bool PropagatorImpl<value_T>::propagateToX(TrackPar_t& track, value_type
   return true;
 }
 
+#ifndef GPUCA_GPUCODE
+//_______________________________________________________________________
+template <typename value_T>
+int PropagatorImpl<value_T>::propagateBatchToX(gsl::span<TrackParCov_t> tracks, value_type xToGo, bool bzOnly, value_type maxSnp, value_type maxStep,
+                                               PropagatorImpl<value_T>::MatCorrType matCorr, std::vector<uint8_t>* status, int signCorr) const
+{
+  //----------------------------------------------------------------
+  // Propagates a batch of tracks to the same plane X=xToGo (cm), with the
+  // stepping of the scalar call: the batch groups the field and material-LUT
+  // queries of (presumably neighbouring) tracks and is the aggregation point
+  // for an eventual vectorization of the stepping itself.
+  //----------------------------------------------------------------
+  if (status) {
+    status->resize(tracks.size());
+  }
+  const value_type bZ = getNominalBz();
+  int nOK = 0;
+  for (size_t i = 0; i < tracks.size(); i++) {
+    bool ok = bzOnly ? propagateToX(tracks[i], xToGo, bZ, maxSnp, maxStep, matCorr, nullptr, signCorr)
+                     : PropagateToXBxByBz(tracks[i], xToGo, maxSnp, maxStep, matCorr, nullptr, signCorr);
+    if (status) {
+      (*status)[i] = ok;
+    }
+    nOK += ok;
+  }
+  return nOK;
+}
+
+//_______________________________________________________________________
+template <typename value_T>
+int PropagatorImpl<value_T>::propagateBatchToX(gsl::span<TrackPar_t> tracks, value_type xToGo, bool bzOnly, value_type maxSnp, value_type maxStep,
+                                               PropagatorImpl<value_T>::MatCorrType matCorr, std::vector<uint8_t>* status, int signCorr) const
+{
+  // same as above, without error propagation
+  if (status) {
+    status->resize(tracks.size());
+  }
+  const value_type bZ = getNominalBz();
+  int nOK = 0;
+  for (size_t i = 0; i < tracks.size(); i++) {
+    bool ok = bzOnly ? propagateToX(tracks[i], xToGo, bZ, maxSnp, maxStep, matCorr, nullptr, signCorr)
+                     : PropagateToXBxByBz(tracks[i], xToGo, maxSnp, maxStep, matCorr, nullptr, signCorr);
+    if (status) {
+      (*status)[i] = ok;
+    }
+    nOK += ok;
+  }
+  return nOK;
+}
+#endif // !GPUCA_GPUCODE
+
 //_______________________________________________________________________
 template <typename value_T>
 template <typename track_T>
@@ -11,8 +11,14 @@
 
 /// @file   CTFReaderSpec.cxx
 
+#include <array>
+#include <cstring>
+#include <future>
+#include <memory>
 #include <vector>
+#include <TBranch.h>
 #include <TFile.h>
+#include <TROOT.h>
 #include <TTree.h>
 
 #include "Framework/Logger.h"
@@ -72,6 +78,13 @@ bool readFromTree(TTree& tree, const std::string brname, T& dest, int ev = 0)
 
 using DetID = o2::detectors::DetID;
 
+/// detector blobs and header of one tree entry read ahead of time by the prefetcher thread
+struct CTFPrefetch {
+  CTFHeader header{};
+  std::array<std::vector<o2::ctf::BufferType>, DetID::nDetectors> buffers{};
+  long entry = -1;
+};
+
 class CTFReaderSpec : public o2::framework::Task
 {
  public:
@@ -87,6 +100,11 @@ class CTFReaderSpec : public o2::framework::Task
   void stopReader();
   template <typename C>
   void processDetector(DetID det, const CTFHeader& ctfHeader, ProcessingContext& pc) const;
+  template <typename C>
+  void prefetchDetector(DetID det, CTFPrefetch& prefetch) const;
+  std::unique_ptr<CTFPrefetch> prefetchTF(long entry) const;
+  void collectPrefetch();
+  void launchPrefetch();
   void setMessageHeader(ProcessingContext& pc, const CTFHeader& ctfHeader, const std::string& lbl, unsigned subspec) const; // keep just for the reference
   void tryToFixCTFHeader(CTFHeader& ctfHeader) const;
   CTFReaderInp mInput{};
@@ -96,6 +114,9 @@ class CTFReaderSpec : public o2::framework::Task
   std::unique_ptr<TTree> mCTFTree;
   bool mRunning = false;
   bool mUseLocalTFCounter = false;
+  bool mPrefetchCTF = false;
+  std::future<std::unique_ptr<CTFPrefetch>> mPrefetchFuture;
+  std::unique_ptr<CTFPrefetch> mPrefetched;
   int mCTFCounter = 0;
   int mNFailedFiles = 0;
   int mFilesRead = 0;
@@ -125,6 +146,8 @@ CTFReaderSpec::~CTFReaderSpec()
 ///_______________________________________
 void CTFReaderSpec::stopReader()
 {
+  collectPrefetch(); // make sure no thread is left accessing the tree
+  mPrefetched.reset();
   if (!mFileFetcher) {
     return;
   }
@@ -148,6 +171,10 @@ void CTFReaderSpec::init(InitContext& ic)
   mUseLocalTFCounter = ic.options().get<bool>("local-tf-counter");
   mImposeRunStartMS = ic.options().get<int64_t>("impose-run-start-timstamp");
   mInput.checkTFLimitBeforeReading = ic.options().get<bool>("limit-tf-before-reading");
+  mPrefetchCTF = ic.options().get<bool>("prefetch-ctf");
+  if (mPrefetchCTF) {
+    ROOT::EnableThreadSafety();
+  }
   mRunning = true;
   mFileFetcher = std::make_unique<o2::utils::FileFetcher>(mInput.inpdata, mInput.tffileRegex, mInput.remoteRegex, mInput.copyCmd);
   mFileFetcher->setMaxFilesInQueue(mInput.maxFileCache);
@@ -178,6 +205,22 @@ void CTFReaderSpec::openCTFFile(const std::string& flname)
     if (mCTFTree->GetEntries() < 1) {
       throw std::runtime_error(fmt::format("CTF tree in {} has 0 entries, skipping", flname));
     }
+    if (mInput.detMask != DetID::FullMask) {
+      // restrict the read-ahead cache to the branches of the requested detectors, so that
+      // detector-subset replays do not prefetch baskets which will never be read
+      mCTFTree->SetCacheSize(-1);
+      const auto* branches = mCTFTree->GetListOfBranches();
+      for (int ib = 0; ib < branches->GetEntriesFast(); ib++) {
+        auto* br = (TBranch*)(*branches)[ib];
+        std::string brname = br->GetName();
+        auto pos = brname.find('_');
+        int id = pos != std::string::npos ? DetID::nameToID(brname.substr(0, pos).c_str()) : -1;
+        if (id < 0 || mInput.detMask[id]) { // non-detector branches (CTFHeader) are always needed
+          mCTFTree->AddBranchToCache(br, true);
+        }
+      }
+      mCTFTree->StopCacheLearningPhase();
+    }
   } catch (const std::exception& e) {
     LOG(error) << "Cannot process " << flname << ", reason: " << e.what();
     mCTFTree.reset();
@@ -262,8 +305,14 @@ bool CTFReaderSpec::processTF(ProcessingContext& pc)
   mTimer.Start(false);
 
   static RateLimiter limiter;
+  collectPrefetch();
+  if (mPrefetched && mPrefetched->entry != mCurrTreeEntry) { // entries were skipped since the prefetch was launched
+    mPrefetched.reset();
+  }
   CTFHeader ctfHeader;
-  if (!readFromTree(*(mCTFTree.get()), "CTFHeader", ctfHeader, mCurrTreeEntry)) {
+  if (mPrefetched) {
+    ctfHeader = mPrefetched->header;
+  } else if (!readFromTree(*(mCTFTree.get()), "CTFHeader", ctfHeader, mCurrTreeEntry)) {
     throw std::runtime_error("did not find CTFHeader");
   }
   if (mImposeRunStartMS > 0) {
@@ -335,7 +384,9 @@ bool CTFReaderSpec::processTF(ProcessingContext& pc)
   }
 
   auto entryStr = fmt::format("({} of {} in {})", mCurrTreeEntry, mCTFTree->GetEntries(), mCTFFile->GetName());
+  mPrefetched.reset();
   checkTreeEntries();
+  launchPrefetch(); // overlap reading of the next entry with the downstream processing of this one
   mTimer.Stop();
 
   // do we need to wait to respect the delay ?
@@ -360,6 +411,7 @@ bool CTFReaderSpec::processTF(ProcessingContext& pc)
 void CTFReaderSpec::checkTreeEntries()
 {
   // check if the tree has entries left, if needed, close current tree/file
+  collectPrefetch(); // the prefetcher thread must not outlive the tree
   if (++mCurrTreeEntry >= mCTFTree->GetEntries()) { // this file is done, check if there are other files
     mCTFTree.reset();
     mCTFFile->Close();
@@ -391,16 +443,81 @@ void CTFReaderSpec::processDetector(DetID det, const CTFHeader& ctfHeader, Proce
 {
   if (mInput.detMask[det]) {
     const auto lbl = det.getName();
+    if (!ctfHeader.detectors[det] && !mInput.allowMissingDetectors) {
+      throw std::runtime_error(fmt::format("Requested detector {} is missing in the CTF", lbl));
+    }
+    if (mPrefetched) { // blob was already read by the prefetcher thread, just copy it to the output
+      const auto& src = mPrefetched->buffers[det];
+      auto& bufVec = pc.outputs().make<std::vector<o2::ctf::BufferType>>({lbl, mInput.subspec}, src.size());
+      if (!src.empty()) {
+        std::memcpy(bufVec.data(), src.data(), src.size());
+      }
+      return;
+    }
     auto& bufVec = pc.outputs().make<std::vector<o2::ctf::BufferType>>({lbl, mInput.subspec}, ctfHeader.detectors[det] ? sizeof(C) : 0);
     if (ctfHeader.detectors[det]) {
       C::readFromTree(bufVec, *(mCTFTree.get()), lbl, mCurrTreeEntry);
-    } else if (!mInput.allowMissingDetectors) {
-      throw std::runtime_error(fmt::format("Requested detector {} is missing in the CTF", lbl));
     }
     //    setMessageHeader(pc, ctfHeader, lbl);
   }
 }
 
+///_______________________________________
+template <typename C>
+void CTFReaderSpec::prefetchDetector(DetID det, CTFPrefetch& prefetch) const
+{
+  if (mInput.detMask[det] && prefetch.header.detectors[det]) {
+    auto& bufVec = prefetch.buffers[det];
+    bufVec.resize(sizeof(C));
+    C::readFromTree(bufVec, *(mCTFTree.get()), det.getName(), prefetch.entry);
+  }
+}
+
+///_______________________________________
+std::unique_ptr<CTFPrefetch> CTFReaderSpec::prefetchTF(long entry) const
+{
+  auto prefetch = std::make_unique<CTFPrefetch>();
+  prefetch->entry = entry;
+  if (!readFromTree(*(mCTFTree.get()), "CTFHeader", prefetch->header, entry)) {
+    throw std::runtime_error("did not find CTFHeader");
+  }
+  prefetchDetector<o2::itsmft::CTF>(DetID::ITS, *prefetch);
+  prefetchDetector<o2::itsmft::CTF>(DetID::MFT, *prefetch);
+  prefetchDetector<o2::emcal::CTF>(DetID::EMC, *prefetch);
+  prefetchDetector<o2::hmpid::CTF>(DetID::HMP, *prefetch);
+  prefetchDetector<o2::phos::CTF>(DetID::PHS, *prefetch);
+  prefetchDetector<o2::tpc::CTF>(DetID::TPC, *prefetch);
+  prefetchDetector<o2::trd::CTF>(DetID::TRD, *prefetch);
+  prefetchDetector<o2::ft0::CTF>(DetID::FT0, *prefetch);
+  prefetchDetector<o2::fv0::CTF>(DetID::FV0, *prefetch);
+  prefetchDetector<o2::fdd::CTF>(DetID::FDD, *prefetch);
+  prefetchDetector<o2::tof::CTF>(DetID::TOF, *prefetch);
+  prefetchDetector<o2::mid::CTF>(DetID::MID, *prefetch);
+  prefetchDetector<o2::mch::CTF>(DetID::MCH, *prefetch);
+  prefetchDetector<o2::cpv::CTF>(DetID::CPV, *prefetch);
+  prefetchDetector<o2::zdc::CTF>(DetID::ZDC, *prefetch);
+  prefetchDetector<o2::ctp::CTF>(DetID::CTP, *prefetch);
+  return prefetch;
+}
+
+///_______________________________________
+void CTFReaderSpec::collectPrefetch()
+{
+  // wait for the pending prefetch, if any, to guarantee exclusive access to the tree
+  if (mPrefetchFuture.valid()) {
+    mPrefetched = mPrefetchFuture.get();
+  }
+}
+
+///_______________________________________
+void CTFReaderSpec::launchPrefetch()
+{
+  // read the next entry of the current tree in a detached task while the downstream processes the entry just sent
+  if (mPrefetchCTF && mCTFTree && mCurrTreeEntry < mCTFTree->GetEntries()) {
+    mPrefetchFuture = std::async(std::launch::async, [this, entry = mCurrTreeEntry]() { return prefetchTF(entry); });
+  }
+}
+
 ///_______________________________________
 void CTFReaderSpec::tryToFixCTFHeader(CTFHeader& ctfHeader) const
 {
@@ -474,6 +591,7 @@ DataProcessorSpec getCTFReaderSpec(const CTFReaderInp& inp)
   options.emplace_back(ConfigParamSpec{"local-tf-counter", VariantType::Bool, false, {"reassign header.tfCounter from local TF counter"}});
   options.emplace_back(ConfigParamSpec{"fetch-failure-threshold", VariantType::Float, 0.f, {"Fail if too many failures( >0: fraction, <0: abs number, 0: no threshold)"}});
   options.emplace_back(ConfigParamSpec{"limit-tf-before-reading", VariantType::Bool, false, {"Check TF limiting before reading new TF, otherwhise before injecting it"}});
+  options.emplace_back(ConfigParamSpec{"prefetch-ctf", VariantType::Bool, false, {"read the next CTF from the tree in a background thread while the current one is processed downstream"}});
   if (!inp.metricChannel.empty()) {
     options.emplace_back(ConfigParamSpec{"channel-config", VariantType::String, inp.metricChannel, {"Out-of-band channel config for TF throttling"}});
   }
@@ -56,6 +56,7 @@
 #include <TFile.h>
 #include <TTree.h>
 #include <TRandom.h>
+#include <TROOT.h>
 #include <filesystem>
 #include <ctime>
 #include <sys/stat.h>
@@ -63,6 +64,12 @@
 #include <unistd.h>
 #include <regex>
 #include <numeric>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+#include <chrono>
+#include <functional>
 
 using namespace o2::framework;
 
@@ -107,14 +114,29 @@ class CTFWriterSpec : public o2::framework::Task
   bool isPresent(DetID id) const { return mDets[id]; }
 
  private:
+  // a finalized CTF handed off to the asynchronous writer thread
+  struct CTFWriteJob {
+    CTFHeader header{};
+    o2::framework::TimingInfo timing{};
+    std::array<std::vector<o2::ctf::BufferType>, DetID::nDetectors> buffers{};
+    size_t szCTFEst = 0; // estimated size, used for the new file opening decision
+    size_t nCTF = 0;     // global index of the CTF for logging
+  };
+
   void updateTimeDependentParams(ProcessingContext& pc);
   template <typename C>
-  size_t processDet(o2::framework::ProcessingContext& pc, DetID det, CTFHeader& header, TTree* tree);
+  size_t processDet(o2::framework::ProcessingContext& pc, DetID det, CTFHeader& header, TTree* tree, std::vector<o2::ctf::BufferType>* jobBuffer);
+  template <typename C>
+  size_t appendFromJobBuffer(DetID det, CTFWriteJob& job);
   template <typename C>
   void storeDictionary(DetID det, CTFHeader& header);
   void storeDictionaries();
   void closeTFTreeAndFile();
-  void prepareTFTreeAndFile();
+  void prepareTFTreeAndFile(const o2::framework::TimingInfo& ti);
+  void checkDiskSpace(const std::function<void(unsigned int)>& waitFor);
+  void accountCTFWrite(const CTFHeader& header, const o2::framework::TimingInfo& ti, size_t nCTF, size_t szCTF, double timeSpent);
+  void storeCTFData(CTFWriteJob& job);
+  void writerThreadLoop();
   size_t estimateCTFSize(ProcessingContext& pc);
   size_t getAvailableDiskSpace(const std::string& path, int level);
   void createLockFile(int level);
@@ -133,6 +155,7 @@ class CTFWriterSpec : public o2::framework::Task
   int mReportInterval = -1;
   int mVerbosity = 0;
   int mSaveDictAfter = 0;          // if positive and mWriteCTF==true, save dictionary after each mSaveDictAfter TFs processed
+  int mDictNThreads = 1;           // number of threads for the per-block frequency accumulation in dictionary creation mode
   uint32_t mPrevDictTimeStamp = 0; // timestamp of the previously stored dictionary
   uint32_t mDictTimeStamp = 0;     // timestamp of the currently stored dictionary
   size_t mMinSize = 0;             // if > 0, accumulate CTFs in the same tree until the total size exceeds this minimum
@@ -184,6 +207,15 @@ class CTFWriterSpec : public o2::framework::Task
   std::array<std::shared_ptr<void>, DetID::nDetectors> mHeaders;
   TStopwatch mTimer;
 
+  // asynchronous writing: the run() callback hands off finalized CTFs to a dedicated thread
+  // via a bounded queue, all tree/file manipulations are then done by that thread only
+  int mAsyncQueueDepth = 0; // >0: write CTFs in a dedicated thread, queueing up to this many finalized CTFs
+  bool mWriterStop = false; // protected by mWriterMtx
+  std::deque<std::unique_ptr<CTFWriteJob>> mWriterQueue;
+  std::mutex mWriterMtx;
+  std::condition_variable mWriterCV;
+  std::thread mWriterThread;
+
   static const std::string TMPFileEnding;
 };
 
@@ -220,6 +252,9 @@ void CTFWriterSpec::init(InitContext& ic)
   }
 
   mSaveDictAfter = ic.options().get<int>("save-dict-after");
+#ifdef WITH_OPENMP
+  mDictNThreads = std::max(1, ic.options().get<int>("dict-nthreads"));
+#endif
   mCTFAutoSave = ic.options().get<long>("save-ctf-after");
   mCTFFileCompression = ic.options().get<int>("ctf-file-compression");
   mCTFMetaFileDir = ic.options().get<std::string>("meta-output-dir");
@@ -265,6 +300,15 @@ void CTFWriterSpec::init(InitContext& ic)
   mWaitDiskFull = 1000 * ic.options().get<float>("wait-for-free-disk");
   mWaitDiskFullMax = 1000 * ic.options().get<float>("max-wait-for-free-disk");
 
+  mAsyncQueueDepth = ic.options().get<int>("async-ctf-writing-queue");
+  if (mAsyncQueueDepth > 0 && mWriteCTF) {
+    ROOT::EnableThreadSafety();
+    mWriterThread = std::thread(&CTFWriterSpec::writerThreadLoop, this);
+    LOGP(info, "CTFs will be written by a dedicated thread, up to {} finalized CTFs may be queued", mAsyncQueueDepth);
+  } else {
+    mAsyncQueueDepth = 0;
+  }
+
   mChkSize = std::max(size_t(mMinSize * 1.1), mMaxSize);
   o2::utils::createDirectoriesIfAbsent(LOCKFileDir);
 
@@ -297,7 +341,7 @@ void CTFWriterSpec::updateTimeDependentParams(ProcessingContext& pc)
 //___________________________________________________________________
 // process data of particular detector
 template <typename C>
-size_t CTFWriterSpec::processDet(o2::framework::ProcessingContext& pc, DetID det, CTFHeader& header, TTree* tree)
+size_t CTFWriterSpec::processDet(o2::framework::ProcessingContext& pc, DetID det, CTFHeader& header, TTree* tree, std::vector<o2::ctf::BufferType>* jobBuffer)
 {
   static bool warnedEmpty = false;
   size_t sz = 0;
@@ -314,7 +358,12 @@ size_t CTFWriterSpec::processDet(o2::framework::ProcessingContext& pc, DetID det
     const auto ctfImage = C::getImage(bdata);
     ctfImage.print(o2::utils::Str::concat_string(det.getName(), ": "), mVerbosity);
     if (mWriteCTF && !mRejectCurrentTF) {
-      sz = ctfImage.appendToTree(*tree, det.getName());
+      if (jobBuffer) { // asynchronous writing: copy the blob, the tree manipulations are done by the writer thread
+        jobBuffer->assign(bdata, bdata + ctfBuffer.size());
+        sz = ctfBuffer.size();
+      } else {
+        sz = ctfImage.appendToTree(*tree, det.getName());
+      }
       header.detectors.set(det);
     } else {
       sz = ctfBuffer.size();
@@ -329,19 +378,24 @@ size_t CTFWriterSpec::processDet(o2::framework::ProcessingContext& pc, DetID det
         auto& hb = *static_cast<o2::ctf::CTFDictHeader*>(mHeaders[det].get());
         hb.det = det;
       }
-      for (int ib = 0; ib < C::getNBlocks(); ib++) {
+      const int nBlocks = C::getNBlocks();
+      std::array<bool, 64> saturatedNow{}; // collected per block, the shared bitset is not safe for concurrent writes
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(dynamic) num_threads(mDictNThreads)
+#endif
+      for (int ib = 0; ib < nBlocks; ib++) {
         if (!mIsSaturatedFrequencyTable[det][ib]) {
           const auto& bl = ctfImage.getBlock(ib);
           if (bl.getNDict()) {
             auto freq = mFreqsAccumulation[det][ib];
             auto& mdSave = mFreqsMetaData[det][ib];
             const auto& md = ctfImage.getMetadata(ib);
-            if ([&, this]() {
+            if ([&]() {
                   try {
                     freq.addFrequencies(bl.getDict(), bl.getDict() + bl.getNDict(), md.min);
                   } catch (const std::overflow_error& e) {
                     LOGP(warning, "unable to add frequency table for {}, block {} due to overflow", det.getName(), ib);
-                    mIsSaturatedFrequencyTable[det][ib] = true;
+                    saturatedNow[ib] = true;
                     return false;
                   }
                   return true;
@@ -358,6 +412,11 @@ size_t CTFWriterSpec::processDet(o2::framework::ProcessingContext& pc, DetID det
           }
         }
       }
+      for (int ib = 0; ib < nBlocks; ib++) {
+        if (saturatedNow[ib]) {
+          mIsSaturatedFrequencyTable[det][ib] = true;
+        }
+      }
     }
   } else {
     if (!warnedEmpty) {
@@ -372,6 +431,19 @@ size_t CTFWriterSpec::processDet(o2::framework::ProcessingContext& pc, DetID det
   return sz;
 }
 
+//___________________________________________________________________
+// append detector blob of the queued job to the tree, writer thread only
+template <typename C>
+size_t CTFWriterSpec::appendFromJobBuffer(DetID det, CTFWriteJob& job)
+{
+  auto& buffer = job.buffers[det];
+  if (buffer.empty()) {
+    return 0;
+  }
+  const auto ctfImage = C::getImage(buffer.data());
+  return ctfImage.appendToTree(*mCTFTreeOut.get(), det.getName());
+}
+
 //___________________________________________________________________
 // store dictionary of a particular detector
 template <typename C>
@@ -436,65 +508,37 @@ void CTFWriterSpec::run(ProcessingContext& pc)
   mTimer.Start(false);
   updateTimeDependentParams(pc);
   mRejectCurrentTF = (mRejRate > 0 && int(gRandom->Rndm() * 100) < mRejRate) || (mRejRate < -1 && mTimingInfo.timeslice % (-mRejRate));
-  mCurrCTFSize = estimateCTFSize(pc);
-  if (mWriteCTF && !mRejectCurrentTF) {
-    prepareTFTreeAndFile();
-
-    int totalWait = 0, nwaitCycles = 0;
-    while ((mFallBackDirUsed || !mFallBackDirProvided) && mCheckDiskFull) { // we are on the physical disk and not on the RAM disk
-      constexpr size_t MB = 1024 * 1024;
-      constexpr int showFirstN = 10, prsecaleWarnings = 50;
-      try {
-        const auto si = std::filesystem::space(mCTFFileOut->GetName());
-        std::string wmsg{};
-        if (mCheckDiskFull > 0.f && si.available < mCheckDiskFull) {
-          nwaitCycles++;
-          wmsg = fmt::format("Disk has {} MB available while at least {} MB is requested, wait for {} ms (on top of {} ms)", si.available / MB, size_t(mCheckDiskFull) / MB, mWaitDiskFull, totalWait);
-        } else if (mCheckDiskFull < 0.f && float(si.available) / si.capacity < -mCheckDiskFull) { // relative margin requested
-          nwaitCycles++;
-          wmsg = fmt::format("Disk has {:.3f}% available while at least {:.3f}% is requested, wait for {} ms (on top of {} ms)", si.capacity ? float(si.available) / si.capacity * 100.f : 0., -mCheckDiskFull, mWaitDiskFull, totalWait);
-        } else {
-          nwaitCycles = 0;
-        }
-        if (nwaitCycles) {
-          if (mWaitDiskFullMax > 0 && totalWait > mWaitDiskFullMax) {
-            closeTFTreeAndFile(); // try to save whatever we have
-            LOGP(fatal, "Disk has {} MB available out of {} MB after waiting for {} ms", si.available / MB, si.capacity / MB, mWaitDiskFullMax);
-          }
-          if (nwaitCycles < showFirstN + 1 || (prsecaleWarnings && (nwaitCycles % prsecaleWarnings) == 0)) {
-            LOG(alarm) << wmsg;
-          }
-          pc.services().get<RawDeviceService>().waitFor((unsigned int)(mWaitDiskFull));
-          totalWait += mWaitDiskFull;
-          continue;
-        }
-      } catch (std::exception const& e) {
-        LOG(fatal) << "unable to query disk space info for path " << mCurrentCTFFileNameFull << ", reason: " << e.what();
-      }
-      break;
-    }
+  const bool doWrite = mWriteCTF && !mRejectCurrentTF;
+  std::unique_ptr<CTFWriteJob> job;
+  if (doWrite && mAsyncQueueDepth > 0) {
+    job = std::make_unique<CTFWriteJob>();
+    job->szCTFEst = estimateCTFSize(pc);
+  } else if (doWrite) {
+    mCurrCTFSize = estimateCTFSize(pc);
+    prepareTFTreeAndFile(mTimingInfo);
+    checkDiskSpace([&pc](unsigned int ms) { pc.services().get<RawDeviceService>().waitFor(ms); });
   }
   // create header
   CTFHeader header{mTimingInfo.runNumber, mTimingInfo.creation, mTimingInfo.firstTForbit, mTimingInfo.tfCounter};
   size_t szCTF = 0;
   mSizeReport = "";
   std::array<size_t, DetID::CTP + 1> szCTFperDet{0}; // DetID::TST is between FDD and CTP and remains empty
-  szCTFperDet[DetID::ITS] = processDet<o2::itsmft::CTF>(pc, DetID::ITS, header, mCTFTreeOut.get());
-  szCTFperDet[DetID::TPC] = processDet<o2::tpc::CTF>(pc, DetID::TPC, header, mCTFTreeOut.get());
-  szCTFperDet[DetID::TRD] = processDet<o2::trd::CTF>(pc, DetID::TRD, header, mCTFTreeOut.get());
-  szCTFperDet[DetID::TOF] = processDet<o2::tof::CTF>(pc, DetID::TOF, header, mCTFTreeOut.get());
-  szCTFperDet[DetID::PHS] = processDet<o2::phos::CTF>(pc, DetID::PHS, header, mCTFTreeOut.get());
-  szCTFperDet[DetID::CPV] = processDet<o2::cpv::CTF>(pc, DetID::CPV, header, mCTFTreeOut.get());
-  szCTFperDet[DetID::EMC] = processDet<o2::emcal::CTF>(pc, DetID::EMC, header, mCTFTreeOut.get());
-  szCTFperDet[DetID::HMP] = processDet<o2::hmpid::CTF>(pc, DetID::HMP, header, mCTFTreeOut.get());
-  szCTFperDet[DetID::MFT] = processDet<o2::itsmft::CTF>(pc, DetID::MFT, header, mCTFTreeOut.get());
-  szCTFperDet[DetID::MCH] = processDet<o2::mch::CTF>(pc, DetID::MCH, header, mCTFTreeOut.get());
-  szCTFperDet[DetID::MID] = processDet<o2::mid::CTF>(pc, DetID::MID, header, mCTFTreeOut.get());
-  szCTFperDet[DetID::ZDC] = processDet<o2::zdc::CTF>(pc, DetID::ZDC, header, mCTFTreeOut.get());
-  szCTFperDet[DetID::FT0] = processDet<o2::ft0::CTF>(pc, DetID::FT0, header, mCTFTreeOut.get());
-  szCTFperDet[DetID::FV0] = processDet<o2::fv0::CTF>(pc, DetID::FV0, header, mCTFTreeOut.get());
-  szCTFperDet[DetID::FDD] = processDet<o2::fdd::CTF>(pc, DetID::FDD, header, mCTFTreeOut.get());
-  szCTFperDet[DetID::CTP] = processDet<o2::ctp::CTF>(pc, DetID::CTP, header, mCTFTreeOut.get());
+  szCTFperDet[DetID::ITS] = processDet<o2::itsmft::CTF>(pc, DetID::ITS, header, mCTFTreeOut.get(), job ? &job->buffers[DetID::ITS] : nullptr);
+  szCTFperDet[DetID::TPC] = processDet<o2::tpc::CTF>(pc, DetID::TPC, header, mCTFTreeOut.get(), job ? &job->buffers[DetID::TPC] : nullptr);
+  szCTFperDet[DetID::TRD] = processDet<o2::trd::CTF>(pc, DetID::TRD, header, mCTFTreeOut.get(), job ? &job->buffers[DetID::TRD] : nullptr);
+  szCTFperDet[DetID::TOF] = processDet<o2::tof::CTF>(pc, DetID::TOF, header, mCTFTreeOut.get(), job ? &job->buffers[DetID::TOF] : nullptr);
+  szCTFperDet[DetID::PHS] = processDet<o2::phos::CTF>(pc, DetID::PHS, header, mCTFTreeOut.get(), job ? &job->buffers[DetID::PHS] : nullptr);
+  szCTFperDet[DetID::CPV] = processDet<o2::cpv::CTF>(pc, DetID::CPV, header, mCTFTreeOut.get(), job ? &job->buffers[DetID::CPV] : nullptr);
+  szCTFperDet[DetID::EMC] = processDet<o2::emcal::CTF>(pc, DetID::EMC, header, mCTFTreeOut.get(), job ? &job->buffers[DetID::EMC] : nullptr);
+  szCTFperDet[DetID::HMP] = processDet<o2::hmpid::CTF>(pc, DetID::HMP, header, mCTFTreeOut.get(), job ? &job->buffers[DetID::HMP] : nullptr);
+  szCTFperDet[DetID::MFT] = processDet<o2::itsmft::CTF>(pc, DetID::MFT, header, mCTFTreeOut.get(), job ? &job->buffers[DetID::MFT] : nullptr);
+  szCTFperDet[DetID::MCH] = processDet<o2::mch::CTF>(pc, DetID::MCH, header, mCTFTreeOut.get(), job ? &job->buffers[DetID::MCH] : nullptr);
+  szCTFperDet[DetID::MID] = processDet<o2::mid::CTF>(pc, DetID::MID, header, mCTFTreeOut.get(), job ? &job->buffers[DetID::MID] : nullptr);
+  szCTFperDet[DetID::ZDC] = processDet<o2::zdc::CTF>(pc, DetID::ZDC, header, mCTFTreeOut.get(), job ? &job->buffers[DetID::ZDC] : nullptr);
+  szCTFperDet[DetID::FT0] = processDet<o2::ft0::CTF>(pc, DetID::FT0, header, mCTFTreeOut.get(), job ? &job->buffers[DetID::FT0] : nullptr);
+  szCTFperDet[DetID::FV0] = processDet<o2::fv0::CTF>(pc, DetID::FV0, header, mCTFTreeOut.get(), job ? &job->buffers[DetID::FV0] : nullptr);
+  szCTFperDet[DetID::FDD] = processDet<o2::fdd::CTF>(pc, DetID::FDD, header, mCTFTreeOut.get(), job ? &job->buffers[DetID::FDD] : nullptr);
+  szCTFperDet[DetID::CTP] = processDet<o2::ctp::CTF>(pc, DetID::CTP, header, mCTFTreeOut.get(), job ? &job->buffers[DetID::CTP] : nullptr);
   szCTF = std::accumulate(szCTFperDet.begin(), szCTFperDet.end(), 0);
   if (mReportInterval > 0 && (mTimingInfo.tfCounter % mReportInterval) == 0) {
     LOGP(important, "CTF {} size report:{} - Total:{}", mTimingInfo.tfCounter, mSizeReport, fmt::group_digits(szCTF));
@@ -502,28 +546,21 @@ void CTFWriterSpec::run(ProcessingContext& pc)
 
   mTimer.Stop();
 
-  if (mWriteCTF && !mRejectCurrentTF) {
-    szCTF += appendToTree(*mCTFTreeOut.get(), "CTFHeader", header);
-    size_t prevSizeMB = mAccCTFSize / (1 << 20);
-    mAccCTFSize += szCTF;
-    mCTFTreeOut->SetEntries(++mNAccCTF);
-    mTFOrbits.push_back(mTimingInfo.firstTForbit);
-    LOG(info) << "TF#" << mNCTF << ": wrote CTF{" << header << "} of size " << szCTF << " to " << mCurrentCTFFileNameFull << " in " << mTimer.CpuTime() - cput << " s";
-    if (mNAccCTF > 1) {
-      LOG(info) << "Current CTF tree has " << mNAccCTF << " entries with total size of " << mAccCTFSize << " bytes";
-    }
-    if (mLockFD != -1) {
-      lseek(mLockFD, 0, SEEK_SET);
-      auto nwr = write(mLockFD, &mAccCTFSize, sizeof(size_t));
-      if (nwr != sizeof(size_t)) {
-        LOG(error) << "Failed to write current CTF size " << mAccCTFSize << " to lock file, bytes written: " << nwr;
+  if (doWrite) {
+    if (job) { // hand the finalized CTF over to the writer thread, blocking if the queue is full
+      job->header = header;
+      job->timing = mTimingInfo;
+      job->nCTF = mNCTF;
+      {
+        std::unique_lock<std::mutex> lk(mWriterMtx);
+        mWriterCV.wait(lk, [this] { return int(mWriterQueue.size()) < mAsyncQueueDepth; });
+        mWriterQueue.push_back(std::move(job));
       }
-    }
-
-    if (mAccCTFSize >= mMinSize || (mMaxCTFPerFile > 0 && mNAccCTF >= mMaxCTFPerFile)) {
-      closeTFTreeAndFile();
-    } else if ((mCTFAutoSave > 0 && mNAccCTF % mCTFAutoSave == 0) || (mCTFAutoSave < 0 && int(prevSizeMB / (-mCTFAutoSave)) != size_t(mAccCTFSize / (1 << 20)) / (-mCTFAutoSave))) {
-      mCTFTreeOut->AutoSave("override");
+      mWriterCV.notify_all();
+      LOG(info) << "TF#" << mNCTF << ": queued CTF{" << header << "} of size " << szCTF << " for writing in " << mTimer.CpuTime() - cput << " s";
+    } else {
+      szCTF += appendToTree(*mCTFTreeOut.get(), "CTFHeader", header);
+      accountCTFWrite(header, mTimingInfo, mNCTF, szCTF, mTimer.CpuTime() - cput);
     }
   } else {
     LOG(info) << "TF#" << mNCTF << " {" << header << "} CTF writing is disabled, size was " << szCTF << " bytes";
@@ -544,6 +581,14 @@ void CTFWriterSpec::finalize()
   if (mFinalized) {
     return;
   }
+  if (mWriterThread.joinable()) { // drain pending CTFs before closing the file
+    {
+      std::lock_guard<std::mutex> lk(mWriterMtx);
+      mWriterStop = true;
+    }
+    mWriterCV.notify_all();
+    mWriterThread.join();
+  }
   if (mCreateDict) {
     storeDictionaries();
   }
@@ -558,7 +603,7 @@ void CTFWriterSpec::finalize()
 }
 
 //___________________________________________________________________
-void CTFWriterSpec::prepareTFTreeAndFile()
+void CTFWriterSpec::prepareTFTreeAndFile(const o2::framework::TimingInfo& ti)
 {
   if (!mWriteCTF) {
     return;
@@ -595,7 +640,7 @@ void CTFWriterSpec::prepareTFTreeAndFile()
         LOGP(info, "Created {} directory for CTFs output", ctfDir);
       }
     }
-    mCurrentCTFFileName = o2::base::NameConf::getCTFFileName(mTimingInfo.runNumber, mTimingInfo.firstTForbit, mTimingInfo.tfCounter, mHostName);
+    mCurrentCTFFileName = o2::base::NameConf::getCTFFileName(ti.runNumber, ti.firstTForbit, ti.tfCounter, mHostName);
     mCurrentCTFFileNameFull = fmt::format("{}{}", ctfDir, mCurrentCTFFileName);
     mCTFFileOut.reset(TFile::Open(fmt::format("{}{}", mCurrentCTFFileNameFull, TMPFileEnding).c_str(), "recreate")); // to prevent premature external usage, use temporary name
     if (mCTFFileCompression >= 0) {
@@ -607,6 +652,126 @@ void CTFWriterSpec::prepareTFTreeAndFile()
   }
 }
 
+//___________________________________________________________________
+// wait for the requested disk space margin before writing, using the provided waiting callback
+void CTFWriterSpec::checkDiskSpace(const std::function<void(unsigned int)>& waitFor)
+{
+  int totalWait = 0, nwaitCycles = 0;
+  while ((mFallBackDirUsed || !mFallBackDirProvided) && mCheckDiskFull) { // we are on the physical disk and not on the RAM disk
+    constexpr size_t MB = 1024 * 1024;
+    constexpr int showFirstN = 10, prsecaleWarnings = 50;
+    try {
+      const auto si = std::filesystem::space(mCTFFileOut->GetName());
+      std::string wmsg{};
+      if (mCheckDiskFull > 0.f && si.available < mCheckDiskFull) {
+        nwaitCycles++;
+        wmsg = fmt::format("Disk has {} MB available while at least {} MB is requested, wait for {} ms (on top of {} ms)", si.available / MB, size_t(mCheckDiskFull) / MB, mWaitDiskFull, totalWait);
+      } else if (mCheckDiskFull < 0.f && float(si.available) / si.capacity < -mCheckDiskFull) { // relative margin requested
+        nwaitCycles++;
+        wmsg = fmt::format("Disk has {:.3f}% available while at least {:.3f}% is requested, wait for {} ms (on top of {} ms)", si.capacity ? float(si.available) / si.capacity * 100.f : 0., -mCheckDiskFull, mWaitDiskFull, totalWait);
+      } else {
+        nwaitCycles = 0;
+      }
+      if (nwaitCycles) {
+        if (mWaitDiskFullMax > 0 && totalWait > mWaitDiskFullMax) {
+          closeTFTreeAndFile(); // try to save whatever we have
+          LOGP(fatal, "Disk has {} MB available out of {} MB after waiting for {} ms", si.available / MB, si.capacity / MB, mWaitDiskFullMax);
+        }
+        if (nwaitCycles < showFirstN + 1 || (prsecaleWarnings && (nwaitCycles % prsecaleWarnings) == 0)) {
+          LOG(alarm) << wmsg;
+        }
+        waitFor((unsigned int)(mWaitDiskFull));
+        totalWait += mWaitDiskFull;
+        continue;
+      }
+    } catch (std::exception const& e) {
+      LOG(fatal) << "unable to query disk space info for path " << mCurrentCTFFileNameFull << ", reason: " << e.what();
+    }
+    break;
+  }
+}
+
+//___________________________________________________________________
+// account the CTF just appended to the output tree, decide on autosave or file closing
+void CTFWriterSpec::accountCTFWrite(const CTFHeader& header, const o2::framework::TimingInfo& ti, size_t nCTF, size_t szCTF, double timeSpent)
+{
+  size_t prevSizeMB = mAccCTFSize / (1 << 20);
+  mAccCTFSize += szCTF;
+  mCTFTreeOut->SetEntries(++mNAccCTF);
+  mTFOrbits.push_back(ti.firstTForbit);
+  LOG(info) << "TF#" << nCTF << ": wrote CTF{" << header << "} of size " << szCTF << " to " << mCurrentCTFFileNameFull << " in " << timeSpent << " s";
+  if (mNAccCTF > 1) {
+    LOG(info) << "Current CTF tree has " << mNAccCTF << " entries with total size of " << mAccCTFSize << " bytes";
+  }
+  if (mLockFD != -1) {
+    lseek(mLockFD, 0, SEEK_SET);
+    auto nwr = write(mLockFD, &mAccCTFSize, sizeof(size_t));
+    if (nwr != sizeof(size_t)) {
+      LOG(error) << "Failed to write current CTF size " << mAccCTFSize << " to lock file, bytes written: " << nwr;
+    }
+  }
+
+  if (mAccCTFSize >= mMinSize || (mMaxCTFPerFile > 0 && mNAccCTF >= mMaxCTFPerFile)) {
+    closeTFTreeAndFile();
+  } else if ((mCTFAutoSave > 0 && mNAccCTF % mCTFAutoSave == 0) || (mCTFAutoSave < 0 && int(prevSizeMB / (-mCTFAutoSave)) != size_t(mAccCTFSize / (1 << 20)) / (-mCTFAutoSave))) {
+    mCTFTreeOut->AutoSave("override");
+  }
+}
+
+//___________________________________________________________________
+// serialize a queued CTF to the output tree, writer thread only
+void CTFWriterSpec::storeCTFData(CTFWriteJob& job)
+{
+  TStopwatch sw;
+  sw.Start();
+  mCurrCTFSize = job.szCTFEst;
+  prepareTFTreeAndFile(job.timing);
+  checkDiskSpace([](unsigned int ms) { std::this_thread::sleep_for(std::chrono::milliseconds(ms)); });
+  size_t szCTF = 0;
+  szCTF += appendFromJobBuffer<o2::itsmft::CTF>(DetID::ITS, job);
+  szCTF += appendFromJobBuffer<o2::tpc::CTF>(DetID::TPC, job);
+  szCTF += appendFromJobBuffer<o2::trd::CTF>(DetID::TRD, job);
+  szCTF += appendFromJobBuffer<o2::tof::CTF>(DetID::TOF, job);
+  szCTF += appendFromJobBuffer<o2::phos::CTF>(DetID::PHS, job);
+  szCTF += appendFromJobBuffer<o2::cpv::CTF>(DetID::CPV, job);
+  szCTF += appendFromJobBuffer<o2::emcal::CTF>(DetID::EMC, job);
+  szCTF += appendFromJobBuffer<o2::hmpid::CTF>(DetID::HMP, job);
+  szCTF += appendFromJobBuffer<o2::itsmft::CTF>(DetID::MFT, job);
+  szCTF += appendFromJobBuffer<o2::mch::CTF>(DetID::MCH, job);
+  szCTF += appendFromJobBuffer<o2::mid::CTF>(DetID::MID, job);
+  szCTF += appendFromJobBuffer<o2::zdc::CTF>(DetID::ZDC, job);
+  szCTF += appendFromJobBuffer<o2::ft0::CTF>(DetID::FT0, job);
+  szCTF += appendFromJobBuffer<o2::fv0::CTF>(DetID::FV0, job);
+  szCTF += appendFromJobBuffer<o2::fdd::CTF>(DetID::FDD, job);
+  szCTF += appendFromJobBuffer<o2::ctp::CTF>(DetID::CTP, job);
+  szCTF += appendToTree(*mCTFTreeOut.get(), "CTFHeader", job.header);
+  sw.Stop();
+  accountCTFWrite(job.header, job.timing, job.nCTF, szCTF, sw.CpuTime());
+}
+
+//___________________________________________________________________
+// writer thread body: pop finalized CTFs from the bounded queue and write them out
+void CTFWriterSpec::writerThreadLoop()
+{
+  while (true) {
+    std::unique_ptr<CTFWriteJob> job;
+    {
+      std::unique_lock<std::mutex> lk(mWriterMtx);
+      mWriterCV.wait(lk, [this] { return mWriterStop || !mWriterQueue.empty(); });
+      if (mWriterQueue.empty()) {
+        if (mWriterStop) {
+          return;
+        }
+        continue;
+      }
+      job = std::move(mWriterQueue.front());
+      mWriterQueue.pop_front();
+    }
+    mWriterCV.notify_all(); // the run method may be blocked on a full queue
+    storeCTFData(*job);
+  }
+}
+
 //___________________________________________________________________
 void CTFWriterSpec::closeTFTreeAndFile()
 {
@@ -807,6 +972,7 @@ DataProcessorSpec getCTFWriterSpec(DetID::mask_t dets, const std::string& outTyp
     Options{                                                                               //{"output-type", VariantType::String, "ctf", {"output types: ctf (per TF) or dict (create dictionaries) or both or none"}},
             {"save-ctf-after", VariantType::Int64, 0ll, {"autosave CTF tree with multiple CTFs after every N CTFs if >0 or every -N MBytes if < 0"}},
             {"save-dict-after", VariantType::Int, 0, {"if > 0, in dictionary generation mode save it dictionary after certain number of TFs processed"}},
+            {"dict-nthreads", VariantType::Int, 1, {"number of threads for the per-block frequency tables accumulation in dictionary generation mode"}},
             {"ctf-dict-dir", VariantType::String, "none", {"CTF dictionary directory, must exist"}},
             {"output-dir", VariantType::String, "none", {"CTF output directory, must exist"}},
             {"output-dir-alt", VariantType::String, "/dev/null", {"Alternative CTF output directory, must exist (if not /dev/null)"}},
@@ -820,6 +986,7 @@ DataProcessorSpec getCTFWriterSpec(DetID::mask_t dets, const std::string& outTyp
             {"require-free-disk", VariantType::Float, 0.f, {"pause writing op. if available disk space is below this margin, in bytes if >0, as a fraction of total if <0"}},
             {"wait-for-free-disk", VariantType::Float, 10.f, {"if paused due to the low disk space, recheck after this time (in s)"}},
             {"max-wait-for-free-disk", VariantType::Float, 60.f, {"produce fatal if paused due to the low disk space for more than this amount in s."}},
+            {"async-ctf-writing-queue", VariantType::Int, 0, {"if > 0, write CTFs in a dedicated thread, queueing up to this number of finalized CTFs"}},
             {"ignore-partition-run-dir", VariantType::Bool, false, {"Do not creare partition-run directory in output-dir"}}}};
 }
 
@@ -38,6 +38,12 @@ struct CTPActiveRun {
   counters_t cntslast0; // last minus one read counters needed for overflow correction
   counters_t cntslast;  // last read counters
   counters64_t overflows;
+  // incremental rate aggregation: rates of the last scaler reading, updated in O(1)
+  // from the previous reading only, i.e. without scanning the record history
+  int updateRates(const CTPScalerRecordRaw& scalrec);
+  std::map<uint32_t, std::array<double, 6>> rates; // instantaneous class rates [Hz]: lmb,lma,l0b,l0a,l1b,l1a
+  std::array<double, CTP_NINPUTS> ratesInps{};     // instantaneous input rates [Hz]
+  double rateTime = 0;                             // epoch time the rates refer to
   // QC
   int qcwpcount = 0;
 };
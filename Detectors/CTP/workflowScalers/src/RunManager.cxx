@@ -66,6 +66,38 @@ int CTPActiveRun::send2BK(std::unique_ptr<BkpClient>& BKClient, size_t ts, bool
   }
   return 0;
 }
+int CTPActiveRun::updateRates(const CTPScalerRecordRaw& scalrec)
+{
+  // Incremental aggregation: the instantaneous rates are derived from the new reading
+  // and the previous one only, so the update cost does not grow with the run duration.
+  const auto& recs = scalers.getScalerRecordRaw();
+  if (recs.empty()) {
+    return 1; // first reading of the run, nothing to diff against
+  }
+  const auto& prev = recs.back();
+  double_t tt = (double_t)(scalrec.intRecord.orbit - prev.intRecord.orbit) * 88e-6;
+  if (tt <= 0.) {
+    LOG(warning) << "Non increasing orbit between scaler readings, rates not updated";
+    return 1;
+  }
+  for (size_t i = 0; i < scalrec.scalers.size() && i < prev.scalers.size(); i++) {
+    const auto& s1 = scalrec.scalers[i];
+    const auto& s0 = prev.scalers[i];
+    auto& rts = rates[s1.classIndex];
+    // a single wraparound of the 32 bits raw counters is absorbed by the modular difference
+    rts[0] = (uint32_t)(s1.lmBefore - s0.lmBefore) / tt;
+    rts[1] = (uint32_t)(s1.lmAfter - s0.lmAfter) / tt;
+    rts[2] = (uint32_t)(s1.l0Before - s0.l0Before) / tt;
+    rts[3] = (uint32_t)(s1.l0After - s0.l0After) / tt;
+    rts[4] = (uint32_t)(s1.l1Before - s0.l1Before) / tt;
+    rts[5] = (uint32_t)(s1.l1After - s0.l1After) / tt;
+  }
+  for (size_t i = 0; i < scalrec.scalersInps.size() && i < prev.scalersInps.size() && i < ratesInps.size(); i++) {
+    ratesInps[i] = (uint32_t)(scalrec.scalersInps[i] - prev.scalersInps[i]) / tt;
+  }
+  rateTime = scalrec.epochTime;
+  return 0;
+}
 ///
 /// Run Manager to manage Config and Scalers
 ///
@@ -201,6 +233,9 @@ int CTPRunManager::addScalers(uint32_t irun, std::time_t time, bool start)
     scalrec.intRecord.orbit = mCounters[mScalerName2Position[orbitid]];
   }
   scalrec.intRecord.bc = 0;
+  if (mActiveRuns[irun]->updateRates(scalrec) == 0) { // before the record is added, diffs against the previous one
+    LOG(info) << "Rates updated for run:" << mActiveRuns[irun]->cfg.getRunNumber() << " classes:" << mActiveRuns[irun]->rates.size();
+  }
   mActiveRuns[irun]->scalers.addScalerRacordRaw(scalrec);
   LOG(info) << "Adding scalers for orbit:" << scalrec.intRecord.orbit;
   // scalrec.printStream(std::cout);
@@ -0,0 +1,304 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+/// @brief Streaming (constant memory) statistics accumulators usable as
+///        TimeSlot containers
+
+#ifndef STREAMING_STATISTICS_H_
+#define STREAMING_STATISTICS_H_
+
+#include "DetectorsCalibration/TimeSlot.h"
+#include "Framework/Logger.h"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+namespace o2
+{
+namespace calibration
+{
+
+/// Online mean/variance accumulator (Welford's algorithm). The state is a
+/// fixed number of moments independent of the number of entries, and two
+/// accumulators can be combined exactly, so it can replace per-entry buffers
+/// or histograms wherever only mean and spread are extracted at finalization.
+class WelfordMoments
+{
+ public:
+  WelfordMoments() = default;
+
+  void add(double value)
+  {
+    mN++;
+    double delta = value - mMean;
+    mMean += delta / mN;
+    mM2 += delta * (value - mMean);
+    mMin = std::min(mMin, value);
+    mMax = std::max(mMax, value);
+  }
+
+  /// exact combination of two accumulators (parallel / chunked filling)
+  void merge(const WelfordMoments& other)
+  {
+    if (other.mN == 0) {
+      return;
+    }
+    if (mN == 0) {
+      *this = other;
+      return;
+    }
+    double delta = other.mMean - mMean;
+    double n = mN + other.mN;
+    mM2 += other.mM2 + delta * delta * mN * other.mN / n;
+    mMean += delta * other.mN / n;
+    mN = static_cast<size_t>(n);
+    mMin = std::min(mMin, other.mMin);
+    mMax = std::max(mMax, other.mMax);
+  }
+
+  size_t getN() const { return mN; }
+  double getMean() const { return mMean; }
+  double getVariance() const { return mN > 1 ? mM2 / (mN - 1) : 0.; }
+  double getStdDev() const { return std::sqrt(getVariance()); }
+  double getMin() const { return mMin; }
+  double getMax() const { return mMax; }
+
+  void clear() { *this = WelfordMoments(); }
+
+ private:
+  size_t mN = 0;
+  double mMean = 0.;
+  double mM2 = 0.;
+  double mMin = std::numeric_limits<double>::max();
+  double mMax = std::numeric_limits<double>::lowest();
+
+  ClassDefNV(WelfordMoments, 1);
+};
+
+/// P^2 (piecewise-parabolic) quantile estimator after Jain and Chlamtac.
+/// Tracks a single quantile with 5 markers, i.e. constant memory, without
+/// storing or sorting the entries. The estimate is approximate but accurate
+/// to a small fraction of the local bin width for unimodal distributions.
+///
+/// Note that two P^2 states cannot be combined exactly; merge() averages the
+/// marker heights weighted by the number of entries, which is adequate when
+/// the merged accumulators saw samples of the same distribution (the TimeSlot
+/// use case), but should not be used to combine disparate populations.
+class P2Quantile
+{
+ public:
+  P2Quantile() = default;
+  P2Quantile(double probability) : mP(probability) {}
+
+  void add(double value)
+  {
+    if (mN < 5) {
+      // initialization phase: collect the first 5 entries
+      mQ[mN++] = value;
+      if (mN == 5) {
+        std::sort(mQ.begin(), mQ.end());
+        for (int i = 0; i < 5; i++) {
+          mPos[i] = i + 1;
+        }
+        mDesired = {1., 1. + 2. * mP, 1. + 4. * mP, 3. + 2. * mP, 5.};
+      }
+      return;
+    }
+    // find the cell containing the new value and update extreme markers
+    int k;
+    if (value < mQ[0]) {
+      mQ[0] = value;
+      k = 0;
+    } else if (value >= mQ[4]) {
+      mQ[4] = value;
+      k = 3;
+    } else {
+      for (k = 0; k < 3; k++) {
+        if (value < mQ[k + 1]) {
+          break;
+        }
+      }
+    }
+    for (int i = k + 1; i < 5; i++) {
+      mPos[i]++;
+    }
+    mDesired[1] += mP / 2.;
+    mDesired[2] += mP;
+    mDesired[3] += (1. + mP) / 2.;
+    mDesired[4] += 1.;
+    // adjust the inner markers with the parabolic formula, falling back to
+    // linear interpolation when the parabolic prediction is not monotonic
+    for (int i = 1; i < 4; i++) {
+      double d = mDesired[i] - mPos[i];
+      if ((d >= 1. && mPos[i + 1] - mPos[i] > 1) || (d <= -1. && mPos[i - 1] - mPos[i] < -1)) {
+        int sign = d >= 0. ? 1 : -1;
+        double parabolic = parabolicEstimate(i, sign);
+        if (mQ[i - 1] < parabolic && parabolic < mQ[i + 1]) {
+          mQ[i] = parabolic;
+        } else {
+          mQ[i] += sign * (mQ[i + sign] - mQ[i]) / (mPos[i + sign] - mPos[i]);
+        }
+        mPos[i] += sign;
+      }
+    }
+    mN++;
+  }
+
+  /// approximate combination: marker heights averaged with the entry counts
+  /// as weights, see the class description for the applicability
+  void merge(const P2Quantile& other)
+  {
+    if (other.mN == 0) {
+      return;
+    }
+    if (mN == 0) {
+      *this = other;
+      return;
+    }
+    if (mN < 5 || other.mN < 5) {
+      // at least one side is still in the initialization phase, replay its
+      // collected entries into the more advanced accumulator
+      const P2Quantile& src = mN < 5 && other.mN >= 5 ? *this : other;
+      P2Quantile dst = (&src == this) ? other : *this;
+      for (size_t i = 0; i < std::min<size_t>(src.mN, 5); i++) {
+        dst.add(src.mQ[i]);
+      }
+      *this = dst;
+      return;
+    }
+    double wThis = static_cast<double>(mN) / (mN + other.mN);
+    double wOther = 1. - wThis;
+    mQ[0] = std::min(mQ[0], other.mQ[0]);
+    mQ[4] = std::max(mQ[4], other.mQ[4]);
+    for (int i = 1; i < 4; i++) {
+      mQ[i] = wThis * mQ[i] + wOther * other.mQ[i];
+    }
+    for (int i = 0; i < 5; i++) {
+      mPos[i] += other.mPos[i];
+      mDesired[i] += other.mDesired[i];
+    }
+    mN += other.mN;
+  }
+
+  size_t getN() const { return mN; }
+  double getProbability() const { return mP; }
+
+  /// current estimate of the tracked quantile; with fewer than 5 entries the
+  /// exact value from the collected entries is returned
+  double getQuantile() const
+  {
+    if (mN == 0) {
+      return 0.;
+    }
+    if (mN < 5) {
+      std::array<double, 5> sorted = mQ;
+      std::sort(sorted.begin(), sorted.begin() + mN);
+      size_t idx = static_cast<size_t>(mP * (mN - 1) + 0.5);
+      return sorted[std::min(idx, mN - 1)];
+    }
+    return mQ[2];
+  }
+
+  void clear()
+  {
+    double p = mP;
+    *this = P2Quantile(p);
+  }
+
+ private:
+  double parabolicEstimate(int i, int sign) const
+  {
+    double d = sign;
+    return mQ[i] + d / (mPos[i + 1] - mPos[i - 1]) *
+                     ((mPos[i] - mPos[i - 1] + d) * (mQ[i + 1] - mQ[i]) / (mPos[i + 1] - mPos[i]) +
+                      (mPos[i + 1] - mPos[i] - d) * (mQ[i] - mQ[i - 1]) / (mPos[i] - mPos[i - 1]));
+  }
+
+  double mP = 0.5;                    ///< tracked quantile, e.g. 0.5 for the median
+  size_t mN = 0;                      ///< number of entries seen
+  std::array<double, 5> mQ{};         ///< marker heights
+  std::array<double, 5> mPos{};       ///< marker positions
+  std::array<double, 5> mDesired{};   ///< desired marker positions
+
+  ClassDefNV(P2Quantile, 1);
+};
+
+/// Per-channel streaming statistics fulfilling the TimeSlot container concept
+/// (fill / merge / print). The memory footprint is a fixed number of doubles
+/// per channel, independent of the number of entries, and finalization is a
+/// plain per-channel readout; this replaces per-channel entry buffers or
+/// histograms for aggregators which extract mean, spread and a quantile
+/// (typically the median) per channel.
+class StreamingChannelStats
+{
+ public:
+  StreamingChannelStats() = default;
+  StreamingChannelStats(size_t nChannels, double quantile = 0.5)
+  {
+    mMoments.resize(nChannels);
+    mQuantiles.resize(nChannels, P2Quantile(quantile));
+  }
+
+  void fill(int channel, double value)
+  {
+    mMoments[channel].add(value);
+    mQuantiles[channel].add(value);
+    mEntries++;
+  }
+
+  void merge(const StreamingChannelStats* prev)
+  {
+    for (size_t ch = 0; ch < mMoments.size(); ch++) {
+      mMoments[ch].merge(prev->mMoments[ch]);
+      mQuantiles[ch].merge(prev->mQuantiles[ch]);
+    }
+    mEntries += prev->mEntries;
+  }
+
+  void print() const
+  {
+    LOGP(info, "StreamingChannelStats: {} channels, {} entries", mMoments.size(), mEntries);
+  }
+
+  size_t getNChannels() const { return mMoments.size(); }
+  size_t getEntries() const { return mEntries; }
+  size_t getEntries(int channel) const { return mMoments[channel].getN(); }
+  double getMean(int channel) const { return mMoments[channel].getMean(); }
+  double getStdDev(int channel) const { return mMoments[channel].getStdDev(); }
+  double getQuantile(int channel) const { return mQuantiles[channel].getQuantile(); }
+  const WelfordMoments& getMoments(int channel) const { return mMoments[channel]; }
+
+  void clear()
+  {
+    for (auto& m : mMoments) {
+      m.clear();
+    }
+    for (auto& q : mQuantiles) {
+      q.clear();
+    }
+    mEntries = 0;
+  }
+
+ private:
+  std::vector<WelfordMoments> mMoments;
+  std::vector<P2Quantile> mQuantiles;
+  size_t mEntries = 0;
+
+  ClassDefNV(StreamingChannelStats, 1);
+};
+
+} // namespace calibration
+} // namespace o2
+
+#endif
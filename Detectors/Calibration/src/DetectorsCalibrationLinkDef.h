@@ -15,6 +15,12 @@
 #pragma link off all classes;
 #pragma link off all functions;
 
+#pragma link C++ class o2::calibration::WelfordMoments + ;
+#pragma link C++ class o2::calibration::P2Quantile + ;
+#pragma link C++ class o2::calibration::StreamingChannelStats + ;
+#pragma link C++ class o2::calibration::TimeSlot < o2::calibration::StreamingChannelStats> + ;
+#pragma link C++ class o2::calibration::TimeSlotCalibration < o2::calibration::StreamingChannelStats> + ;
+
 #pragma link C++ class o2::calibration::MeanVertexData + ;
 #pragma link C++ class o2::calibration::TimeSlotMetaData + ;
 #pragma link C++ class o2::calibration::TimeSlot < o2::calibration::MeanVertexData> + ;
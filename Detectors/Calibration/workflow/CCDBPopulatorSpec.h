@@ -31,6 +31,12 @@
 #include "CommonUtils/NameConf.h"
 #include <unordered_map>
 #include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <thread>
 
 namespace o2
 {
@@ -51,7 +57,17 @@ class CCDBPopulator : public o2::framework::Task
     mFatalOnFailure = ic.options().get<bool>("fatal-on-failure");
     mValidateUpload = ic.options().get<bool>("validate-upload");
     mThrottlingDelayMS = ic.options().get<std::int64_t>("throttling-delay");
+    mAsyncUpload = ic.options().get<bool>("async-upload");
+    mUploadRetries = ic.options().get<int>("upload-retries");
+    mSpoolDir = ic.options().get<std::string>("upload-spool-dir");
     mAPI.init(mCCDBpath);
+    if (mAsyncUpload) {
+      if (!mSpoolDir.empty()) {
+        std::filesystem::create_directories(mSpoolDir);
+        loadSpooledUploads();
+      }
+      mUploaderThread = std::thread(&CCDBPopulator::uploaderLoop, this);
+    }
   }
 
   void run(o2::framework::ProcessingContext& pc) final
@@ -115,36 +131,25 @@ class CCDBPopulator : public o2::framework::Task
         LOG(info) << msg;
       }
 
-      auto uploadTS = o2::ccdb::getCurrentTimestamp();
-
-      int res = mAPI.storeAsBinaryFile(&pld[0], pld.size(), wrp->getFileName(), wrp->getObjectType(), wrp->getPath(),
-                                       *md, wrp->getStartValidityTimestamp(), wrp->getEndValidityTimestamp());
-      if (res) {
-        if (mFatalOnFailure) {
-          LOGP(fatal, "failed on uploading to {} / {} for [{}:{}]", mAPI.getURL(), wrp->getPath(), wrp->getStartValidityTimestamp(), wrp->getEndValidityTimestamp());
-        } else {
-          LOGP(error, "failed on uploading to {} / {} for [{}:{}]", mAPI.getURL(), wrp->getPath(), wrp->getStartValidityTimestamp(), wrp->getEndValidityTimestamp());
-        }
-      }
-      // do we need to override previous object?
-      if (wrp->isAdjustableEOV() && !mAPI.isSnapshotMode()) {
-        o2::ccdb::adjustOverriddenEOV(mAPI, *wrp.get());
-      }
-      // if requested, make sure that the new object can be queried
-      if (mValidateUpload || wrp->getValidateUpload()) {
-        constexpr long MAXDESYNC = 3;
-        auto headers = mAPI.retrieveHeaders(wrp->getPath(), {}, wrp->getStartValidityTimestamp() + (wrp->getEndValidityTimestamp() - wrp->getStartValidityTimestamp()) / 2);
-        if (headers.empty() ||
-            std::atol(headers["Created"].c_str()) < uploadTS - MAXDESYNC ||
-            std::atol(headers["Valid-From"].c_str()) != wrp->getStartValidityTimestamp() ||
-            std::atol(headers["Valid-Until"].c_str()) != wrp->getEndValidityTimestamp()) {
+      UploadRequest req{};
+      req.payload.assign(pld.begin(), pld.end());
+      req.fileName = wrp->getFileName();
+      req.objectType = wrp->getObjectType();
+      req.path = wrp->getPath();
+      req.metadata = *md;
+      req.startTS = wrp->getStartValidityTimestamp();
+      req.endTS = wrp->getEndValidityTimestamp();
+      req.adjustEOV = wrp->isAdjustableEOV();
+      req.validate = mValidateUpload || wrp->getValidateUpload();
+      if (mAsyncUpload) {
+        enqueueUpload(std::move(req));
+      } else {
+        if (!uploadObject(req)) {
           if (mFatalOnFailure) {
-            LOGP(fatal, "Failed to validate upload to {} / {} for [{}:{}]", mAPI.getURL(), wrp->getPath(), wrp->getStartValidityTimestamp(), wrp->getEndValidityTimestamp());
+            LOGP(fatal, "failed on uploading to {} / {} for [{}:{}]", mAPI.getURL(), req.path, req.startTS, req.endTS);
           } else {
-            LOGP(error, "Failed to validate upload to {} / {} for [{}:{}]", mAPI.getURL(), wrp->getPath(), wrp->getStartValidityTimestamp(), wrp->getEndValidityTimestamp());
+            LOGP(error, "failed on uploading to {} / {} for [{}:{}]", mAPI.getURL(), req.path, req.startTS, req.endTS);
           }
-        } else {
-          LOGP(important, "Validated upload to {} / {} for [{}:{}]", mAPI.getURL(), wrp->getPath(), wrp->getStartValidityTimestamp(), wrp->getEndValidityTimestamp());
         }
       }
     }
@@ -153,9 +158,200 @@ class CCDBPopulator : public o2::framework::Task
   void endOfStream(o2::framework::EndOfStreamContext& ec) final
   {
     LOG(info) << "EndOfStream received";
+    if (mAsyncUpload) { // make sure the EOR burst is fully drained before the device may be shut down
+      std::unique_lock lock(mQueueMutex);
+      mQueueCV.wait(lock, [this]() { return mUploadQueue.empty() && !mUploadInFlight; });
+      LOGP(info, "Async upload queue drained, {} objects uploaded, {} failed", mUploadedCount, mFailedCount);
+    }
+  }
+
+  void stop() final
+  {
+    if (mUploaderThread.joinable()) {
+      {
+        std::lock_guard lock(mQueueMutex);
+        mStopUploader = true;
+      }
+      mQueueCV.notify_all();
+      mUploaderThread.join();
+    }
   }
 
  private:
+  // self-contained upload request, detached from the DPL message it was received in
+  struct UploadRequest {
+    std::vector<char> payload;
+    std::string fileName;
+    std::string objectType;
+    std::string path;
+    std::map<std::string, std::string> metadata;
+    long startTS = 0;
+    long endTS = 0;
+    bool adjustEOV = false;
+    bool validate = false;
+  };
+
+  // perform the upload with the eventual EOV adjustment and validation, return success
+  bool uploadObject(const UploadRequest& req)
+  {
+    auto uploadTS = o2::ccdb::getCurrentTimestamp();
+    int res = mAPI.storeAsBinaryFile(req.payload.data(), req.payload.size(), req.fileName, req.objectType, req.path,
+                                     req.metadata, req.startTS, req.endTS);
+    if (res) {
+      return false;
+    }
+    // do we need to override previous object?
+    if (req.adjustEOV && !mAPI.isSnapshotMode()) {
+      CcdbObjectInfo info(req.path, req.objectType, req.fileName, req.metadata, req.startTS, req.endTS, true, req.validate);
+      o2::ccdb::adjustOverriddenEOV(mAPI, info);
+    }
+    // if requested, make sure that the new object can be queried
+    if (req.validate) {
+      constexpr long MAXDESYNC = 3;
+      auto headers = mAPI.retrieveHeaders(req.path, {}, req.startTS + (req.endTS - req.startTS) / 2);
+      if (headers.empty() ||
+          std::atol(headers["Created"].c_str()) < uploadTS - MAXDESYNC ||
+          std::atol(headers["Valid-From"].c_str()) != req.startTS ||
+          std::atol(headers["Valid-Until"].c_str()) != req.endTS) {
+        if (mFatalOnFailure) {
+          LOGP(fatal, "Failed to validate upload to {} / {} for [{}:{}]", mAPI.getURL(), req.path, req.startTS, req.endTS);
+        } else {
+          LOGP(error, "Failed to validate upload to {} / {} for [{}:{}]", mAPI.getURL(), req.path, req.startTS, req.endTS);
+        }
+      } else {
+        LOGP(important, "Validated upload to {} / {} for [{}:{}]", mAPI.getURL(), req.path, req.startTS, req.endTS);
+      }
+    }
+    return true;
+  }
+
+  void enqueueUpload(UploadRequest&& req)
+  {
+    std::unique_lock lock(mQueueMutex);
+    // backpressure towards the workflow instead of unbounded memory growth
+    mQueueCV.wait(lock, [this]() { return mUploadQueue.size() < MaxQueuedUploads; });
+    mUploadQueue.push_back(std::move(req));
+    lock.unlock();
+    mQueueCV.notify_all();
+  }
+
+  void uploaderLoop()
+  {
+    std::unique_lock lock(mQueueMutex);
+    while (true) {
+      mQueueCV.wait(lock, [this]() { return mStopUploader || !mUploadQueue.empty(); });
+      if (mUploadQueue.empty()) {
+        if (mStopUploader) {
+          return;
+        }
+        continue;
+      }
+      auto req = std::move(mUploadQueue.front());
+      mUploadQueue.pop_front();
+      mUploadInFlight = true;
+      lock.unlock();
+      mQueueCV.notify_all();
+      bool done = false;
+      for (int attempt = 0; attempt <= mUploadRetries && !done; attempt++) {
+        if (attempt > 0) {
+          std::this_thread::sleep_for(std::chrono::seconds(attempt)); // linear backoff between retries
+        }
+        done = uploadObject(req);
+      }
+      if (!done) {
+        if (!mSpoolDir.empty()) {
+          spoolUpload(req);
+          LOGP(error, "failed on uploading to {} / {} for [{}:{}] after {} attempts, object spooled to {}",
+               mAPI.getURL(), req.path, req.startTS, req.endTS, mUploadRetries + 1, mSpoolDir);
+        } else if (mFatalOnFailure) {
+          LOGP(fatal, "failed on uploading to {} / {} for [{}:{}] after {} attempts", mAPI.getURL(), req.path, req.startTS, req.endTS, mUploadRetries + 1);
+        } else {
+          LOGP(error, "failed on uploading to {} / {} for [{}:{}] after {} attempts", mAPI.getURL(), req.path, req.startTS, req.endTS, mUploadRetries + 1);
+        }
+      }
+      lock.lock();
+      mUploadInFlight = false;
+      done ? mUploadedCount++ : mFailedCount++;
+      lock.unlock();
+      mQueueCV.notify_all();
+      lock.lock();
+    }
+  }
+
+  // persist an upload which could not be delivered, to be retried at the next start
+  void spoolUpload(const UploadRequest& req)
+  {
+    auto stamp = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    auto base = fmt::format("{}/ccdbspool_{}", mSpoolDir, stamp);
+    std::ofstream pldFile(base + ".payload", std::ios::binary);
+    pldFile.write(req.payload.data(), req.payload.size());
+    std::ofstream metaFile(base + ".desc");
+    metaFile << "path=" << req.path << '\n'
+             << "fileName=" << req.fileName << '\n'
+             << "objectType=" << req.objectType << '\n'
+             << "startTS=" << req.startTS << '\n'
+             << "endTS=" << req.endTS << '\n'
+             << "adjustEOV=" << int(req.adjustEOV) << '\n'
+             << "validate=" << int(req.validate) << '\n';
+    for (const auto& [key, value] : req.metadata) {
+      metaFile << "md." << key << '=' << value << '\n';
+    }
+  }
+
+  void loadSpooledUploads()
+  {
+    for (const auto& entry : std::filesystem::directory_iterator(mSpoolDir)) {
+      if (entry.path().extension() != ".desc") {
+        continue;
+      }
+      auto pldName = entry.path();
+      pldName.replace_extension(".payload");
+      UploadRequest req{};
+      std::ifstream metaFile(entry.path());
+      std::string line;
+      while (std::getline(metaFile, line)) {
+        auto sep = line.find('=');
+        if (sep == std::string::npos) {
+          continue;
+        }
+        auto key = line.substr(0, sep);
+        auto value = line.substr(sep + 1);
+        if (key == "path") {
+          req.path = value;
+        } else if (key == "fileName") {
+          req.fileName = value;
+        } else if (key == "objectType") {
+          req.objectType = value;
+        } else if (key == "startTS") {
+          req.startTS = std::atol(value.c_str());
+        } else if (key == "endTS") {
+          req.endTS = std::atol(value.c_str());
+        } else if (key == "adjustEOV") {
+          req.adjustEOV = std::atoi(value.c_str());
+        } else if (key == "validate") {
+          req.validate = std::atoi(value.c_str());
+        } else if (key.rfind("md.", 0) == 0) {
+          req.metadata[key.substr(3)] = value;
+        }
+      }
+      std::ifstream pldFile(pldName, std::ios::binary | std::ios::ate);
+      if (!pldFile) {
+        LOGP(error, "Spooled upload {} has no payload file, dropping it", entry.path().native());
+        std::filesystem::remove(entry.path());
+        continue;
+      }
+      req.payload.resize(pldFile.tellg());
+      pldFile.seekg(0);
+      pldFile.read(req.payload.data(), req.payload.size());
+      LOGP(important, "Requeueing spooled upload of {} for [{}:{}]", req.path, req.startTS, req.endTS);
+      mUploadQueue.push_back(std::move(req));
+      std::filesystem::remove(entry.path());
+      std::filesystem::remove(pldName);
+    }
+  }
+
+  static constexpr size_t MaxQueuedUploads = 500; // limit of the async queue before backpressuring the workflow
+
   CcdbApi mAPI;
   long mThrottlingDelayMS = 0;                             // LOG(important) at most once per this period for given path
   bool mFatalOnFailure = true;                             // produce fatal on failed upload
@@ -164,6 +360,18 @@ class CCDBPopulator : public o2::framework::Task
   std::int64_t mSSpecMin = -1;                             // min subspec to accept
   std::int64_t mSSpecMax = -1;                             // max subspec to accept
   std::string mCCDBpath = "http://ccdb-test.cern.ch:8080"; // CCDB path
+
+  bool mAsyncUpload = false; // upload from a dedicated thread instead of blocking the run method
+  int mUploadRetries = 3;    // number of retries of a failed upload before it is spooled / reported
+  std::string mSpoolDir;     // where failed uploads are persisted for the next start, empty: disabled
+  std::deque<UploadRequest> mUploadQueue;
+  std::mutex mQueueMutex;
+  std::condition_variable mQueueCV;
+  std::thread mUploaderThread;
+  bool mStopUploader = false;
+  bool mUploadInFlight = false;
+  size_t mUploadedCount = 0;
+  size_t mFailedCount = 0;
 };
 
 } // namespace calibration
@@ -188,7 +396,10 @@ DataProcessorSpec getCCDBPopulatorDeviceSpec(const std::string& defCCDB, const s
       {"sspec-max", VariantType::Int64, -1L, {"max subspec to accept"}},
       {"throttling-delay", VariantType::Int64, 300000L, {"produce important type log at most once per this period in ms for each CCDB path"}},
       {"validate-upload", VariantType::Bool, false, {"valider upload by querying its headers"}},
-      {"fatal-on-failure", VariantType::Bool, false, {"do not produce fatal on failed upload"}}}};
+      {"fatal-on-failure", VariantType::Bool, false, {"do not produce fatal on failed upload"}},
+      {"async-upload", VariantType::Bool, false, {"upload from a dedicated thread, blocking the device only when the queue is full"}},
+      {"upload-retries", VariantType::Int, 3, {"number of retries of a failed async upload"}},
+      {"upload-spool-dir", VariantType::String, "", {"directory to persist failed async uploads for retry at the next start, empty: disabled"}}}};
 }
 
 } // namespace framework
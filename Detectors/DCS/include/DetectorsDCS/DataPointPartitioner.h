@@ -0,0 +1,95 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+#ifndef O2_DCS_DATA_POINT_PARTITIONER_H
+#define O2_DCS_DATA_POINT_PARTITIONER_H
+
+#include "DetectorsDCS/DataPointCompositeObject.h"
+#include "DetectorsDCS/DataPointIdentifier.h"
+#include <cstdint>
+#include <gsl/span>
+#include <thread>
+#include <vector>
+
+namespace o2::dcs
+{
+
+/**
+  * partitionByAlias splits a span of data points into nPartitions buckets
+  * such that all data points carrying the same alias end up in the same
+  * bucket, in their original order.
+  *
+  * The partition of an alias depends only on the alias (its hash code modulo
+  * the number of partitions), so per-alias state held by a processor (last
+  * value maps, per-alias accumulators, ...) can be split along the same
+  * scheme and accessed from the partition's thread without locking.
+  *
+  * @param dps the data points of one processing cycle
+  * @param nPartitions the number of buckets
+  *
+  * @returns per bucket the indices into dps belonging to it
+  */
+inline std::vector<std::vector<uint32_t>> partitionByAlias(gsl::span<const DataPointCompositeObject> dps,
+                                                           size_t nPartitions)
+{
+  std::vector<std::vector<uint32_t>> partitions(nPartitions);
+  for (auto& partition : partitions) {
+    partition.reserve(dps.size() / nPartitions + 1);
+  }
+  for (uint32_t i = 0; i < dps.size(); i++) {
+    partitions[dps[i].id.hash_code() % nPartitions].push_back(i);
+  }
+  return partitions;
+}
+
+/**
+  * processPartitionedByAlias processes a span of data points with nThreads
+  * threads, with the guarantee that all data points of a given alias are
+  * handled by the same thread and in their original order.
+  *
+  * The callable is invoked as proc(partition, dp) where partition is in
+  * [0, nThreads) and identifies the thread. It must only touch state local
+  * to the partition (e.g. the corresponding slice of alias-partitioned maps
+  * or a per-partition output buffer); results are typically merged by the
+  * caller after this function returns. With nThreads <= 1 everything is
+  * processed in the calling thread.
+  *
+  * @param dps the data points of one processing cycle
+  * @param nThreads the number of worker threads / partitions
+  * @param proc callable with signature void(size_t, const DataPointCompositeObject&)
+  */
+template <typename Proc>
+void processPartitionedByAlias(gsl::span<const DataPointCompositeObject> dps, size_t nThreads, Proc proc)
+{
+  if (nThreads <= 1) {
+    for (const auto& dp : dps) {
+      proc(0, dp);
+    }
+    return;
+  }
+  auto partitions = partitionByAlias(dps, nThreads);
+  std::vector<std::thread> workers;
+  workers.reserve(nThreads);
+  for (size_t p = 0; p < nThreads; p++) {
+    workers.emplace_back([&, p]() {
+      for (auto i : partitions[p]) {
+        proc(p, dps[i]);
+      }
+    });
+  }
+  for (auto& worker : workers) {
+    worker.join();
+  }
+}
+
+} // namespace o2::dcs
+
+#endif
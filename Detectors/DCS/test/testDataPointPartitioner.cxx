@@ -0,0 +1,94 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+#define BOOST_TEST_MODULE Test DCS DataPointPartitioner
+#define BOOST_TEST_MAIN
+
+#define BOOST_TEST_DYN_LINK
+
+#include <boost/test/unit_test.hpp>
+#include "DetectorsDCS/DataPointPartitioner.h"
+#include "DetectorsDCS/DataPointGenerator.h"
+#include <array>
+#include <unordered_map>
+#include <unordered_set>
+
+using o2::dcs::DataPointCompositeObject;
+using o2::dcs::DataPointIdentifier;
+
+namespace
+{
+std::vector<DataPointCompositeObject> makeDataPoints(int nCopiesPerAlias)
+{
+  // several updates per alias in one cycle, as delivered during ramps
+  auto aliases = o2::dcs::generateRandomDataPoints({"TST/SECTOR[00..06]/CRATE[0..3]/voltage"},
+                                                   1620.0, 1710.5, "2022-November-18 12:34:56");
+  std::vector<DataPointCompositeObject> dps;
+  for (int copy = 0; copy < nCopiesPerAlias; copy++) {
+    for (const auto& dp : aliases) {
+      dps.emplace_back(dp);
+    }
+  }
+  return dps;
+}
+} // namespace
+
+BOOST_AUTO_TEST_CASE(PartitionByAlias)
+{
+  auto dps = makeDataPoints(5);
+  constexpr size_t nPartitions = 4;
+  auto partitions = o2::dcs::partitionByAlias(dps, nPartitions);
+  BOOST_CHECK_EQUAL(partitions.size(), nPartitions);
+
+  size_t total = 0;
+  std::unordered_map<DataPointIdentifier, size_t> aliasPartition;
+  for (size_t p = 0; p < nPartitions; p++) {
+    uint32_t previous = 0;
+    for (auto i : partitions[p]) {
+      // indices are in original order and every alias maps to a single bucket
+      BOOST_CHECK(i >= previous);
+      previous = i;
+      auto insertion = aliasPartition.emplace(dps[i].id, p);
+      BOOST_CHECK_EQUAL(insertion.first->second, p);
+      total++;
+    }
+  }
+  BOOST_CHECK_EQUAL(total, dps.size());
+}
+
+BOOST_AUTO_TEST_CASE(ProcessPartitioned)
+{
+  auto dps = makeDataPoints(3);
+  constexpr size_t nThreads = 3;
+
+  std::array<std::unordered_map<DataPointIdentifier, int>, nThreads> counts;
+  o2::dcs::processPartitionedByAlias(dps, nThreads, [&counts](size_t partition, const DataPointCompositeObject& dp) {
+    counts[partition][dp.id]++;
+  });
+
+  // every alias is seen by exactly one partition, with all its updates
+  std::unordered_set<DataPointIdentifier> seen;
+  for (const auto& partitionCounts : counts) {
+    for (const auto& [id, n] : partitionCounts) {
+      BOOST_CHECK_EQUAL(n, 3);
+      BOOST_CHECK(seen.insert(id).second);
+    }
+  }
+  BOOST_CHECK_EQUAL(seen.size(), 28);
+
+  // serial fallback goes through partition 0
+  std::unordered_map<DataPointIdentifier, int> serial;
+  o2::dcs::processPartitionedByAlias(dps, 1, [&serial](size_t partition, const DataPointCompositeObject& dp) {
+    BOOST_CHECK_EQUAL(partition, 0);
+    serial[dp.id]++;
+  });
+  BOOST_CHECK_EQUAL(serial.size(), 28);
+}
@@ -52,6 +52,8 @@ struct EMCALCalibParams : public o2::conf::ConfigurableParamHelper<EMCALCalibPar
   float minCellEnergy_bc = 0.1;         ///< minimum cell energy considered for filling the histograms for bad channel calib. Should speedup the filling of the histogram to suppress noise
   float fractionEvents_bc = 1.;         ///< fraction of events used in bad channel calibration
   size_t nThreads_bc = 4;               ///< number of threads used for the bad channel calinration for filling the histograms
+  bool useReservoirSampling_bc = false; ///< accumulate per-cell sample reservoirs instead of full per-thread histograms to reduce the memory footprint of a slot
+  unsigned int reservoirSize_bc = 500;  ///< maximum number of energy / time samples kept per cell and thread if reservoir sampling is enabled
   float fracMaskSMFully_bc = 0.5;       ///< fraction of bad+dead channel for a SM to be fully masked
   float fracMaskFECFully_bc = 0.9;      ///< fraction of bad+dead channel for a FEC to be fully masked
 
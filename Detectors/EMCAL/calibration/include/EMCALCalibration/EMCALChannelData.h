@@ -39,6 +39,7 @@
 #include <boost/histogram/ostream.hpp>
 // #include <boost/format.hpp>
 
+#include <random>
 #include <thread>
 
 // #include <array>
@@ -61,7 +62,7 @@ class EMCALChannelData
   o2::emcal::Geometry* mGeometry = o2::emcal::Geometry::GetInstanceFromRunNumber(300000);
   int NCELLS = mGeometry->GetNCells();
 
-  EMCALChannelData() : mNBins(EMCALCalibParams::Instance().nBinsEnergyAxis_bc), mRange(EMCALCalibParams::Instance().maxValueEnergyAxis_bc), mNBinsTime(EMCALCalibParams::Instance().nBinsTimeAxis_bc), mRangeTimeLow(EMCALCalibParams::Instance().rangeTimeAxisLow_bc), mRangeTimeHigh(EMCALCalibParams::Instance().rangeTimeAxisHigh_bc), mNThreads(EMCALCalibParams::Instance().nThreads_bc)
+  EMCALChannelData() : mNBins(EMCALCalibParams::Instance().nBinsEnergyAxis_bc), mRange(EMCALCalibParams::Instance().maxValueEnergyAxis_bc), mNBinsTime(EMCALCalibParams::Instance().nBinsTimeAxis_bc), mRangeTimeLow(EMCALCalibParams::Instance().rangeTimeAxisLow_bc), mRangeTimeHigh(EMCALCalibParams::Instance().rangeTimeAxisHigh_bc), mNThreads(EMCALCalibParams::Instance().nThreads_bc), mUseReservoir(EMCALCalibParams::Instance().useReservoirSampling_bc), mReservoirSize(EMCALCalibParams::Instance().reservoirSize_bc)
   {
 
     // NCELLS includes DCal, treat as one calibration
@@ -69,13 +70,25 @@ class EMCALChannelData
     int NCELLS = mGeometry->GetNCells();
 
     mVecNEntriesInHisto.resize(mNThreads);
-    mHisto.resize(mNThreads);
-    mHistoTime.resize(mNThreads);
-    for (size_t i = 0; i < mNThreads; ++i) {
+    // with reservoir sampling only one full histogram is kept, to absorb merged or adopted data
+    size_t nHistos = mUseReservoir ? 1 : mNThreads;
+    mHisto.resize(nHistos);
+    mHistoTime.resize(nHistos);
+    for (size_t i = 0; i < nHistos; ++i) {
       mHisto[i] = boost::histogram::make_histogram(boost::histogram::axis::regular<>(mNBins, 0., mRange), boost::histogram::axis::regular<>(NCELLS, -0.5, NCELLS - 0.5));
       mHistoTime[i] = boost::histogram::make_histogram(boost::histogram::axis::regular<>(mNBinsTime, mRangeTimeLow, mRangeTimeHigh), boost::histogram::axis::regular<>(NCELLS, -0.5, NCELLS - 0.5));
+    }
+    for (size_t i = 0; i < mNThreads; ++i) {
       mVecNEntriesInHisto[i] = 0;
     }
+    if (mUseReservoir) {
+      mEnergyReservoir.resize(mNThreads, std::vector<CellReservoir>(NCELLS));
+      mTimeReservoir.resize(mNThreads, std::vector<CellReservoir>(NCELLS));
+      std::random_device rd;
+      for (size_t i = 0; i < mNThreads; ++i) {
+        mRndEngine.emplace_back(rd());
+      }
+    }
   }
 
   ~EMCALChannelData() = default;
@@ -106,6 +119,9 @@ class EMCALChannelData
     for (const auto& h : mHisto) {
       mHistoSummed += h;
     }
+    if (mUseReservoir) {
+      fillHistoFromReservoir(mHistoSummed, mEnergyReservoir);
+    }
     return mHistoSummed;
   }
 
@@ -120,6 +136,9 @@ class EMCALChannelData
     for (const auto& h : mHistoTime) {
       mHistoTimeSummed += h;
     }
+    if (mUseReservoir) {
+      fillHistoFromReservoir(mHistoTimeSummed, mTimeReservoir);
+    }
     return mHistoTimeSummed;
   }
 
@@ -155,6 +174,34 @@ class EMCALChannelData
   }
 
  private:
+  /// \brief Fixed-size per-cell sample reservoir replacing the full-resolution histograms
+  /// Samples are kept with Vitter's algorithm R, so the reservoir stays an unbiased
+  /// sample of the full distribution. When a histogram is requested the samples are
+  /// filled with weight nSeen / nStored to preserve the expected number of entries.
+  struct CellReservoir {
+    std::vector<float> samples; ///< stored samples, bounded by reservoirSize_bc
+    unsigned long nSeen = 0;    ///< total number of values offered to the reservoir
+
+    void fill(float val, unsigned int maxSize, std::mt19937& rnd)
+    {
+      ++nSeen;
+      if (samples.size() < maxSize) {
+        samples.push_back(val);
+        return;
+      }
+      std::uniform_int_distribution<unsigned long> dist(0, nSeen - 1);
+      unsigned long j = dist(rnd);
+      if (j < maxSize) {
+        samples[j] = val;
+      }
+    }
+  };
+
+  /// \brief Fill hist with the content of the per-cell reservoirs, weighted to preserve the expected entry counts
+  void fillHistoFromReservoir(boostHisto& hist, const std::vector<std::vector<CellReservoir>>& reservoirs);
+  /// \brief Merge the samples of another reservoir into this one, weighted by the number of values each side has seen
+  void mergeCellReservoir(CellReservoir& into, const CellReservoir& from);
+
   float mRange = 10;                                    ///< Maximum energy range of boost histogram (will be overwritten by values in the EMCALCalibParams)
   int mNBins = 1000;                                    ///< Number of bins in the boost histogram (will be overwritten by values in the EMCALCalibParams)
   size_t mNThreads = 1;                                 ///< Number of threads used for filling the boost histograms
@@ -177,8 +224,13 @@ class EMCALChannelData
   o2::emcal::GainCalibrationFactors* mGainCalibFactors; ///< Gain calibration factors applied to the data before filling the histograms
   std::array<double, 17664> mArrGainCalibFactors;       ///< array of gain calibration factors
   std::shared_ptr<EMCALCalibExtractor> mCalibExtractor; ///< calib extractor
+  bool mUseReservoir = false;                           ///< accumulate per-cell sample reservoirs instead of full per-thread histograms
+  unsigned int mReservoirSize = 500;                    ///< maximum number of samples per cell reservoir (will be overwritten by values in the EMCALCalibParams)
+  std::vector<std::vector<CellReservoir>> mEnergyReservoir; ///< per-thread, per-cell energy sample reservoirs
+  std::vector<std::vector<CellReservoir>> mTimeReservoir;   ///< per-thread, per-cell time sample reservoirs
+  std::vector<std::mt19937> mRndEngine;                 //!< per-thread random engines for the reservoir sampling
 
-  ClassDefNV(EMCALChannelData, 1);
+  ClassDefNV(EMCALChannelData, 2);
 };
 /// \brief Printing EMCALChannelData on the stream
 /// \param in Stream where the EMCALChannelData is printed on
@@ -59,8 +59,8 @@ void EMCALChannelData::fill(const gsl::span<const o2::emcal::Cell> data)
 
   auto fillfunction = [this](int thread, const gsl::span<const o2::emcal::Cell>& data, double minCellEnergy, double minCellEnergyTime) {
     LOG(debug) << "filling in thread " << thread << " ncells = " << data.size();
-    auto& mCurrentHist = mHisto[thread];
-    auto& mCurrentHistTime = mHistoTime[thread];
+    auto& mCurrentHist = mHisto[mUseReservoir ? 0 : thread];
+    auto& mCurrentHistTime = mHistoTime[mUseReservoir ? 0 : thread];
     unsigned int nEntries = 0; // counter set inside function increases speed compared to simply using mVecNEntriesInHisto[thread]. Added to global counter at end of function
     for (const auto& cell : data) {
       int id = cell.getTower();
@@ -77,13 +77,21 @@ void EMCALChannelData::fill(const gsl::span<const o2::emcal::Cell> data)
       }
 
       LOG(debug) << "inserting in cell ID " << id << ": energy = " << cellEnergy;
-      mCurrentHist(cellEnergy, id);
+      if (mUseReservoir) {
+        mEnergyReservoir[thread][id].fill(cellEnergy, mReservoirSize, mRndEngine[thread]);
+      } else {
+        mCurrentHist(cellEnergy, id);
+      }
       nEntries++;
 
       if (cellEnergy > minCellEnergyTime) {
         double cellTime = cell.getTimeStamp();
         LOG(debug) << "inserting in cell ID " << id << ": time = " << cellTime;
-        mCurrentHistTime(cellTime, id);
+        if (mUseReservoir) {
+          mTimeReservoir[thread][id].fill(cellTime, mReservoirSize, mRndEngine[thread]);
+        } else {
+          mCurrentHistTime(cellTime, id);
+        }
       }
     }
     mVecNEntriesInHisto[thread] += nEntries;
@@ -129,8 +137,67 @@ void EMCALChannelData::merge(EMCALChannelData* prev)
 {
   mEvents += prev->getNEvents();
   mNEntriesInHisto += prev->getNEntriesInHisto();
-  mHisto[0] += prev->getHisto();
-  mHistoTime[0] += prev->getHisto();
+  if (mUseReservoir && prev->mUseReservoir) {
+    // merge the bounded reservoirs directly, much cheaper than adding full histograms
+    for (size_t ithread = 0; ithread < prev->mEnergyReservoir.size(); ++ithread) {
+      for (int id = 0; id < NCELLS; ++id) {
+        mergeCellReservoir(mEnergyReservoir[0][id], prev->mEnergyReservoir[ithread][id]);
+        mergeCellReservoir(mTimeReservoir[0][id], prev->mTimeReservoir[ithread][id]);
+      }
+    }
+    // absorb data the previous slot adopted in histogram form
+    mHisto[0] += prev->mHisto[0];
+    mHistoTime[0] += prev->mHistoTime[0];
+  } else {
+    mHisto[0] += prev->getHisto();
+    mHistoTime[0] += prev->getHisto();
+  }
+}
+
+//_____________________________________________
+void EMCALChannelData::fillHistoFromReservoir(boostHisto& hist, const std::vector<std::vector<CellReservoir>>& reservoirs)
+{
+  for (const auto& perThread : reservoirs) {
+    for (int id = 0; id < static_cast<int>(perThread.size()); ++id) {
+      const auto& res = perThread[id];
+      if (res.samples.empty()) {
+        continue;
+      }
+      const double weight = static_cast<double>(res.nSeen) / res.samples.size();
+      for (float val : res.samples) {
+        hist(val, id, boost::histogram::weight(weight));
+      }
+    }
+  }
+}
+
+//_____________________________________________
+void EMCALChannelData::mergeCellReservoir(CellReservoir& into, const CellReservoir& from)
+{
+  if (from.nSeen == 0) {
+    return;
+  }
+  if (into.nSeen == 0) {
+    into = from;
+    return;
+  }
+  // draw the combined reservoir from both inputs, picking each side with a
+  // probability proportional to the number of values it has seen
+  auto& rnd = mRndEngine[0];
+  std::uniform_real_distribution<double> uni(0., 1.);
+  const double fracInto = static_cast<double>(into.nSeen) / (into.nSeen + from.nSeen);
+  std::vector<float> merged;
+  merged.reserve(mReservoirSize);
+  size_t iInto = 0, iFrom = 0;
+  while (merged.size() < mReservoirSize && (iInto < into.samples.size() || iFrom < from.samples.size())) {
+    if (iFrom >= from.samples.size() || (iInto < into.samples.size() && uni(rnd) < fracInto)) {
+      merged.push_back(into.samples[iInto++]);
+    } else {
+      merged.push_back(from.samples[iFrom++]);
+    }
+  }
+  into.samples = std::move(merged);
+  into.nSeen += from.nSeen;
 }
 
 //_____________________________________________
@@ -155,6 +155,7 @@ class Clusterizer
   std::array<cellWithE, NROWS * NCOLS> mSeedList;                 //!<! seed array
   std::array<std::array<InputwithIndex, NCOLS>, NROWS> mInputMap; //!<! topology arrays
   std::array<std::array<bool, NCOLS>, NROWS> mCellMask;           //!<! topology arrays
+  int mLastNCells = 0;                                            //!<! number of topology map entries used in the previous event (for sparse reset)
 
   std::vector<Cluster> mFoundClusters;     ///<  vector of cluster objects
   std::vector<ClusterIndex> mInputIndices; ///<  vector of associated cell/digit tower ID, ordered by cluster
@@ -127,10 +127,13 @@ void Clusterizer<InputType>::findClusters(const gsl::span<InputType const>& inpu
   // --> Seed cell and all neighbours belonging to cluster will be put in 2D bitmap
 
   // Reset cell/digit maps and cell masks
-  // Loop over one array dim, then reset each array
-  for (auto iArr = 0; iArr < NROWS; iArr++) {
-    mCellMask[iArr].fill(kFALSE);
-    mInputMap[iArr].fill({nullptr, -1});
+  // Only the entries used in the previous event are reset: the maps cover the
+  // full topological representation and wiping them entirely costs much more
+  // than the typical cell occupancy of one event
+  // The maps start zero-initialized, so the invariant holds from the first event
+  for (int i = 0; i < mLastNCells; i++) {
+    mCellMask[mSeedList[i].row][mSeedList[i].column] = kFALSE;
+    mInputMap[mSeedList[i].row][mSeedList[i].column] = {nullptr, -1};
   }
 
   // Calibrate cells/digits and fill the maps/arrays
@@ -163,6 +166,9 @@ void Clusterizer<InputType>::findClusters(const gsl::span<InputType const>& inpu
     mSeedList[nCells].column = column;
     nCells++;
   }
+  // The (row,column) pairs in mSeedList identify the used map entries
+  // and drive the sparse reset of the next event (sorting keeps the set)
+  mLastNCells = nCells;
 
   // Sort struct arrays with ascending energy
   std::sort(mSeedList.begin(), std::next(std::begin(mSeedList), nCells));
@@ -0,0 +1,58 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+/// \file bench_Clusterizer.cxx
+/// \brief Benchmark of the EMCAL clusterizer
+
+#include "benchmark/benchmark.h"
+#include <random>
+#include <vector>
+#include <gsl/span>
+#include "DataFormatsEMCAL/Cell.h"
+#include "DataFormatsEMCAL/Constants.h"
+#include "EMCALBase/Geometry.h"
+#include "EMCALReconstruction/Clusterizer.h"
+
+static std::vector<o2::emcal::Cell> generateTestData(const o2::emcal::Geometry* geometry, int nSeeds, int clusterSize, std::mt19937& mt)
+{
+  // Place nSeeds high-energy cells at random towers, each followed by
+  // clusterSize - 1 cells at adjacent tower IDs with an energy above the
+  // aggregation threshold
+  std::uniform_int_distribution<int> distTower(0, geometry->GetNCells() - clusterSize);
+  std::vector<o2::emcal::Cell> cells;
+  for (int iseed = 0; iseed < nSeeds; ++iseed) {
+    int tower = distTower(mt);
+    cells.emplace_back(tower, 1.f, 0.f, o2::emcal::ChannelType_t::HIGH_GAIN);
+    for (int icell = 1; icell < clusterSize; ++icell) {
+      cells.emplace_back(tower + icell, 0.3f, 0.f, o2::emcal::ChannelType_t::HIGH_GAIN);
+    }
+  }
+  return cells;
+}
+
+static void benchFindClusters(benchmark::State& state)
+{
+  auto geometry = o2::emcal::Geometry::GetInstanceFromRunNumber(300000);
+  o2::emcal::Clusterizer<o2::emcal::Cell> clusterizer(10000., -10000., 10000., 0.03, false, 0.5, 0.1);
+  clusterizer.setGeometry(geometry);
+
+  std::mt19937 mt(12345);
+  auto cells = generateTestData(geometry, state.range(0), 4, mt);
+
+  for (auto _ : state) {
+    clusterizer.findClusters(gsl::span<const o2::emcal::Cell>(cells));
+    benchmark::DoNotOptimize(clusterizer.getFoundClusters());
+  }
+}
+
+BENCHMARK(benchFindClusters)->Arg(10)->Arg(100)->Arg(1000);
+
+BENCHMARK_MAIN();
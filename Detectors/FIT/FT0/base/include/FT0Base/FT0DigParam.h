@@ -49,6 +49,9 @@ struct FT0DigParam : o2::conf::ConfigurableParamHelper<FT0DigParam> {
   float mMV_2_Nchannels = 2.2857143;          // amplitude channel 7 mV ->16channels
   float mMV_2_NchannelsInverse = 0.437499997; // inverse amplitude channel 7 mV ->16channels
 
+  bool mUseFastResponse = false;        // use precomputed CFD response templates instead of scanning the summed pulse shape per channel
+  float mFastResponseTimeSmear = 0.013; // gaussian time smearing replacing the noise convolution in the fast response mode [ns]
+
   O2ParamDef(FT0DigParam, "FT0DigParam");
 };
 } // namespace o2::ft0
@@ -51,7 +51,11 @@ class CollisionTimeRecoTask
                                   const gsl::span<const o2::ft0::ChannelData> inChData,
                                   std::vector<o2::ft0::ChannelDataFloat>& outChData);
   void FinishTask();
-  void SetTimeCalibObject(o2::ft0::TimeSpectraInfoObject const* timeCalibObject) { mTimeCalibObject = timeCalibObject; };
+  void SetTimeCalibObject(o2::ft0::TimeSpectraInfoObject const* timeCalibObject)
+  {
+    mTimeCalibObject = timeCalibObject;
+    updateTimeOffsets();
+  };
   void SetSlewingCalibObject(o2::ft0::SlewingCoef const* calibSlew)
   {
     LOG(info) << "Init for slewing calib object";
@@ -60,7 +64,11 @@ class CollisionTimeRecoTask
   float getTimeInPS(const o2::ft0::ChannelData& channelData);
 
  private:
+  /// Evaluates the table of per-channel time offsets for the current calibration object
+  void updateTimeOffsets();
+
   o2::ft0::TimeSpectraInfoObject const* mTimeCalibObject = nullptr;
+  std::array<float, NCHANNELS> mTimeOffset{}; ///< Per-channel time offsets from the calibration object
   typename o2::ft0::SlewingCoef::SlewingPlots_t mCalibSlew{};
 };
 } // namespace ft0
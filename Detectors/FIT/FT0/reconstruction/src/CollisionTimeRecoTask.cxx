@@ -36,8 +36,9 @@ void CollisionTimeRecoTask::processTF(const gsl::span<const o2::ft0::Digit>& dig
                                       std::vector<o2::ft0::RecPoints>& vecRecPoints,
                                       std::vector<o2::ft0::ChannelDataFloat>& vecChData)
 {
+  const auto& channelFilter = ChannelFilterParam::Instance();
   for (const auto& digit : digits) {
-    if (!ChannelFilterParam::Instance().checkTCMbits(digit.getTriggers().getTriggersignals())) {
+    if (!channelFilter.checkTCMbits(digit.getTriggers().getTriggersignals())) {
       continue;
     }
     const auto channelsPerDigit = digit.getBunchChannelData(channels);
@@ -58,18 +59,20 @@ RP CollisionTimeRecoTask::processDigit(const o2::ft0::Digit& digit,
   constexpr int nMCPsA = 4 * Geometry::NCellsA;
 
   int nch{0};
+  const auto& channelFilter = ChannelFilterParam::Instance();
+  const auto& timeFilter = TimeFilterParam::Instance();
   for (const auto& channelData : inChData) {
     if (channelData.ChId >= NCHANNELS) {
       // Reference channels shouldn't participate in reco at all!
       continue;
     }
     const float timeInPS = getTimeInPS(channelData);
-    if (ChannelFilterParam::Instance().checkAll(channelData)) {
+    if (channelFilter.checkAll(channelData)) {
       outChData.emplace_back(channelData.ChId, timeInPS, (float)channelData.QTCAmpl, channelData.ChainQTC);
       nch++;
     }
     //  only signals which satisfy conditions may participate in time calculation
-    if (TimeFilterParam::Instance().checkAll(channelData)) {
+    if (timeFilter.checkAll(channelData)) {
       if (channelData.ChId < nMCPsA) {
         sideAtime += timeInPS;
         ndigitsA++;
@@ -101,34 +104,44 @@ void CollisionTimeRecoTask::FinishTask()
 
 float CollisionTimeRecoTask::getTimeInPS(const o2::ft0::ChannelData& channelData)
 {
-  // Getting time offset
-  float offsetChannel{0};
-  if (mTimeCalibObject) {
+  // Getting slewing offset
+  float slewoffset{0};
+  const auto& gr = mCalibSlew[static_cast<int>(channelData.getFlag(o2::ft0::ChannelData::EEventDataBit::kNumberADC))][channelData.ChId];
+  slewoffset = gr.Eval(channelData.QTCAmpl);
+
+  // Final calculation, the per-channel time offset is taken from the precomputed table
+  const float globalOffset = mTimeOffset[channelData.ChId] + slewoffset;
+  return (static_cast<float>(channelData.CFDTime) - globalOffset) * Geometry::ChannelWidth;
+}
+
+void CollisionTimeRecoTask::updateTimeOffsets()
+{
+  // The time offsets depend only on the calibration object: evaluate them for
+  // all channels at once when the object is updated instead of repeating the
+  // quality checks for every channel of every processed BC
+  mTimeOffset.fill(0.f);
+  if (!mTimeCalibObject) {
+    return;
+  }
+  const auto& calibParam = CalibParam::Instance();
+  for (int ich = 0; ich < NCHANNELS; ich++) {
     // Temporary, will be changed to status bit checking
     // Check statistics
-    const auto& stat = mTimeCalibObject->mTime[channelData.ChId].mStat;
-    const bool isEnoughStat = stat > CalibParam::Instance().mMaxEntriesThreshold;
-    const bool isNotGoogStat = stat > CalibParam::Instance().mMinEntriesThreshold && !isEnoughStat;
+    const auto& stat = mTimeCalibObject->mTime[ich].mStat;
+    const bool isEnoughStat = stat > calibParam.mMaxEntriesThreshold;
+    const bool isNotGoogStat = stat > calibParam.mMinEntriesThreshold && !isEnoughStat;
     // Check fit quality
-    const auto& meanGaus = mTimeCalibObject->mTime[channelData.ChId].mGausMean;
-    const auto& meanHist = mTimeCalibObject->mTime[channelData.ChId].mStatMean;
-    const auto& sigmaGaus = mTimeCalibObject->mTime[channelData.ChId].mGausRMS;
-    const auto& rmsHist = mTimeCalibObject->mTime[channelData.ChId].mStatRMS;
-    const bool isGoodFitResult = (mTimeCalibObject->mTime[channelData.ChId].mStatusBits & 1) > 0;
-    const bool isBadFit = std::abs(meanGaus - meanHist) > CalibParam::Instance().mMaxDiffMean || rmsHist < CalibParam::Instance().mMinRMS || sigmaGaus > CalibParam::Instance().mMaxSigma;
+    const auto& meanGaus = mTimeCalibObject->mTime[ich].mGausMean;
+    const auto& meanHist = mTimeCalibObject->mTime[ich].mStatMean;
+    const auto& sigmaGaus = mTimeCalibObject->mTime[ich].mGausRMS;
+    const auto& rmsHist = mTimeCalibObject->mTime[ich].mStatRMS;
+    const bool isGoodFitResult = (mTimeCalibObject->mTime[ich].mStatusBits & 1) > 0;
+    const bool isBadFit = std::abs(meanGaus - meanHist) > calibParam.mMaxDiffMean || rmsHist < calibParam.mMinRMS || sigmaGaus > calibParam.mMaxSigma;
 
     if (isEnoughStat && isGoodFitResult && !isBadFit) {
-      offsetChannel = meanGaus;
+      mTimeOffset[ich] = meanGaus;
     } else if ((isNotGoogStat || isEnoughStat) && isBadFit) {
-      offsetChannel = meanHist;
+      mTimeOffset[ich] = meanHist;
     }
   }
-  // Getting slewing offset
-  float slewoffset{0};
-  const auto& gr = mCalibSlew[static_cast<int>(channelData.getFlag(o2::ft0::ChannelData::EEventDataBit::kNumberADC))][channelData.ChId];
-  slewoffset = gr.Eval(channelData.QTCAmpl);
-
-  // Final calculation
-  const float globalOffset = offsetChannel + slewoffset;
-  return (static_cast<float>(channelData.CFDTime) - globalOffset) * Geometry::ChannelWidth;
 }
@@ -19,6 +19,7 @@ struct DigitizationConstants {
   static constexpr int SINC_TABLE_SIZE = 2048;
   static constexpr int SIGNAL_TABLE_SIZE = 4096;
   static constexpr double SIGNAL_CACHE_DT = 0.005;
+  static constexpr int FAST_RESPONSE_NBINS = 64;
 };
 } // namespace o2::ft0
 #endif
@@ -82,6 +82,10 @@ class Digitizer
     double deadTime;
   };
   CFDOutput get_time(const std::vector<float>& times, float deadTime);
+  /// parameterized CFD response (FT0DigParam.mUseFastResponse): the crossing time is
+  /// looked up in a precomputed template indexed by the channel multiplicity instead
+  /// of scanning the summed pulse shape of the individual hits
+  CFDOutput get_time_fast(const std::vector<float>& times, float deadTime);
 
   void setContinuous(bool v = true) { mIsContinuous = v; }
   bool isContinuous() const { return mIsContinuous; }
@@ -158,7 +162,10 @@ class Digitizer
   std::vector<float> mNoiseSamples;
   std::array<std::vector<float>, DP::SINC_TABLE_SIZE> mSincTable;
   std::array<float, DP::SIGNAL_TABLE_SIZE> mSignalTable;
-  std::vector<float> mSignalCache; // cached summed signal used by the CFD
+  std::vector<float> mSignalCache;    // cached summed signal used by the CFD
+  std::vector<float> mFastCFDShift;   // CFD crossing time vs channel multiplicity, template of the fast response mode
+
+  void initFastResponseTemplate();
 
   void storeBC(BCCache& bc,
                std::vector<o2::ft0::Digit>& digitsBC,
@@ -169,7 +176,7 @@ class Digitizer
   o2::ft0::FT0ChannelTimeCalibrationObject const* mCalibOffset = nullptr;
   o2::fit::DeadChannelMap const* mDeadChannelMap = nullptr;
 
-  ClassDefNV(Digitizer, 3);
+  ClassDefNV(Digitizer, 4);
 };
 
 } // namespace ft0
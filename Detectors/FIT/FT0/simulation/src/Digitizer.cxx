@@ -164,6 +164,27 @@ Digitizer::CFDOutput Digitizer::get_time(const std::vector<float>& times, float
   return result;
 }
 
+Digitizer::CFDOutput Digitizer::get_time_fast(const std::vector<float>& times, float deadTime)
+{
+  assert(std::is_sorted(std::begin(times), std::end(times)));
+  const auto& params = FT0DigParam::Instance();
+  CFDOutput result{std::nullopt, -0.5f * params.mBunchWidth};
+  // the template is indexed by the channel multiplicity: the CFD zero crossing is
+  // amplitude independent, only the threshold crossing moves with the pulse height
+  int const bin = std::min<int>(times.size(), DP::FAST_RESPONSE_NBINS) - 1;
+  float const shift = mFastCFDShift[bin];
+  if (shift < 0.0f) { // the template pulse never passes the CFD threshold
+    return result;
+  }
+  // the noise convolution of the full CFD scan is replaced by a gaussian jitter
+  double const time = times.front() + shift + params.mFastResponseTimeSmear * mRndGaus.getNextValue();
+  if (time >= deadTime && time < 0.5 * params.mBunchWidth) {
+    result.particle = time;
+    result.deadTime = time + params.mCFDdeadTime;
+  }
+  return result;
+}
+
 double Digitizer::measure_amplitude(const std::vector<float>& times) const
 {
   float const from = FT0DigParam::Instance().mAmpRecordLow;
@@ -271,9 +292,11 @@ void Digitizer::storeBC(BCCache& bc,
     channel_times.resize(channel_end - channel_begin);
     std::transform(channel_begin, channel_end, channel_times.begin(), [](BCCache::particle const& p) { return p.hit_time; });
     int chain = (std::rand() % 2) ? 1 : 0;
-    auto cfd = get_time(channel_times, mDeadTimes[ipmt].intrec.bc2ns() -
-                                         firstBCinDeque.bc2ns() +
-                                         mDeadTimes[ipmt].deadTime);
+    float const channelDeadTime = mDeadTimes[ipmt].intrec.bc2ns() -
+                                  firstBCinDeque.bc2ns() +
+                                  mDeadTimes[ipmt].deadTime;
+    auto cfd = params.mUseFastResponse ? get_time_fast(channel_times, channelDeadTime)
+                                       : get_time(channel_times, channelDeadTime);
     mDeadTimes[ipmt].intrec = firstBCinDeque;
     mDeadTimes[ipmt].deadTime = cfd.deadTime;
 
@@ -413,6 +436,35 @@ void Digitizer::initParameters()
 
   // cache for signal time series used by the CFD -BC/2 .. +3BC/2
   mSignalCache.resize(std::lround(params.mBunchWidth / DP::SIGNAL_CACHE_DT));
+
+  // response templates for the parameterized fast mode
+  initFastResponseTemplate();
+}
+
+//_______________________________________________________________________
+void Digitizer::initFastResponseTemplate()
+{
+  // precompute the CFD crossing time for n simultaneous photo-electrons arriving at
+  // the start of the pulse, using the same discriminator logic (and time stepping) as
+  // the full scan in get_time(); the zero crossing does not depend on the amplitude,
+  // only the moment the threshold condition is satisfied does
+  const auto& params = FT0DigParam::Instance();
+  mFastCFDShift.resize(DP::FAST_RESPONSE_NBINS);
+  for (int n = 1; n <= DP::FAST_RESPONSE_NBINS; ++n) {
+    float shift = -1.0f; // stays negative if the pulse never passes the threshold
+    bool is_positive = true;
+    for (double time = 0.0; time < params.mBunchWidth; time += DP::SIGNAL_CACHE_DT) {
+      float const val = n * signalForm(time);
+      float const val_prev = n * signalForm(time - params.mCFDShiftPos);
+      float const cfd_val = 5.0f * val_prev - val;
+      if (std::abs(val) > params.mCFD_trsh && !is_positive && cfd_val > 0.0f) {
+        shift = time;
+        break;
+      }
+      is_positive = cfd_val > 0.0f;
+    }
+    mFastCFDShift[n - 1] = shift;
+  }
 }
 //_______________________________________________________________________
 void Digitizer::init()
@@ -437,7 +489,8 @@ void Digitizer::printParameters() const
             << params.mCfdShift << "CFD distance between 0.3 of max amplitude  to max \n"
             << params.mCFDShiftPos << "MIP -> mV " << params.mMip_in_V << " Pe in MIP \n"
             << params.mPe_in_mip << "noise level " << params.mNoiseVar << " noise frequency \n"
-            << params.mNoisePeriod << " mMCPs " << params.mMCPs;
+            << params.mNoisePeriod << " mMCPs " << params.mMCPs
+            << " fast parameterized response " << params.mUseFastResponse;
 }
 
 O2ParamImpl(FT0DigParam);
@@ -12,7 +12,11 @@
 /// @file MatrixSparse.cxx
 
 #include <iomanip>
+#include <vector>
 #include <TStopwatch.h>
+#ifdef WITH_OPENMP
+#include <omp.h>
+#endif
 
 #include "Framework/Logger.h"
 #include "ForwardAlign/MatrixSparse.h"
@@ -118,6 +122,54 @@ void MatrixSparse::MultiplyByVec(const Double_t* vecIn, Double_t* vecOut) const
 {
   memset(vecOut, 0, GetSize() * sizeof(Double_t));
 
+#ifdef WITH_OPENMP
+  // this product dominates the iterative solvers; the symmetric storage scatters
+  // into vecOut[col] as well, so every thread accumulates into its own buffer and
+  // the buffers are merged serially in thread order to keep the result deterministic
+  const int sz = GetSize();
+  if (IsSymmetric() && sz > 1000) {
+    const int nThreads = omp_get_max_threads();
+    std::vector<std::vector<Double_t>> partials(nThreads);
+#pragma omp parallel num_threads(nThreads)
+    {
+      auto& partial = partials[omp_get_thread_num()];
+      partial.resize(sz, 0.);
+      Double_t* out = partial.data();
+#pragma omp for schedule(static)
+      for (int rw = 0; rw < sz; rw++) {
+        const VectorSparse* rowV = GetRow(rw);
+        Int_t nel = rowV->GetNElems();
+        if (!nel) {
+          continue;
+        }
+        UShort_t* indV = rowV->GetIndices();
+        Double_t* elmV = rowV->GetElems();
+        // treat diagonal term separately. If filled, it should be the last one
+        if (indV[--nel] == rw) {
+          out[rw] += vecIn[rw] * elmV[nel];
+        } else {
+          nel = rowV->GetNElems(); // diag elem was not filled
+        }
+        for (int iel = nel; iel--;) {
+          if (elmV[iel]) {
+            out[rw] += vecIn[indV[iel]] * elmV[iel];
+            out[indV[iel]] += vecIn[rw] * elmV[iel];
+          }
+        }
+      }
+    }
+    for (const auto& partial : partials) {
+      if (partial.empty()) {
+        continue;
+      }
+      for (int i = 0; i < sz; i++) {
+        vecOut[i] += partial[i];
+      }
+    }
+    return;
+  }
+#endif
+
   for (int rw = GetSize(); rw--;) { // loop over rows >>>
     const VectorSparse* rowV = GetRow(rw);
     Int_t nel = rowV->GetNElems();
@@ -51,6 +51,7 @@
 #include "TPCFastTransform.h"
 #include "GPUO2InterfaceRefit.h"
 #include "GlobalTracking/MatchTPCITSParams.h"
+#include "GlobalTracking/TimeIntervalLUT.h"
 #include "DataFormatsITSMFT/TopologyDictionary.h"
 #include "DataFormatsITSMFT/TrkClusRef.h"
 #include "ITSMFTReconstruction/ChipMappingITS.h"
@@ -687,13 +688,24 @@ class MatchTPCITS
   size_t mNABRefsClus = 0;
   float mAB2MatchGuess = 0.2;                      // heuristic guess about fraction of AB matches in total matches
   std::vector<InteractionCandidate> mInteractions; ///< possible interaction times
-  std::vector<int> mInteractionMUSLUT;             ///< LUT for interactions in 1MUS bins
+  TimeIntervalLUT mInteractionTimeLUT;             ///< LUT for interactions in 1MUS bins
 
   ///< container for record the match of TPC track to single ITS track
   std::vector<MatchRecord> mMatchRecordsTPC; // RSS DEQ
   ///< container for reference to MatchRecord involving particular ITS track
   std::vector<MatchRecord> mMatchRecordsITS; // RSS DEQ
 
+  ///< matching candidate found by doMatching, to be registered in the match records
+  struct MatchCand {
+    int iITS = MinusOne;
+    int iTPC = MinusOne;
+    float chi2 = -1.f;
+    int candIC = MinusOne;
+  };
+  ///< per sector matching candidates: doMatching of different sectors may run concurrently,
+  ///< the registration in the (shared) match records is done serially afterwards
+  std::array<std::vector<MatchCand>, o2::constants::math::NSectors> mSectMatchCand;
+
   ////  std::vector<int> mITSROFofTPCBin;    ///< aux structure for mapping of TPC time-bins on ITS ROFs
   std::vector<BracketF> mITSROFTimes;       ///< min/max times of ITS ROFs in \mus
   std::vector<TrackLocTPC> mTPCWork;        ///< TPC track params prepared for matching
@@ -0,0 +1,84 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+/// \file TimeIntervalLUT.h
+/// \brief Flat time-bucketed start-index LUT for matching candidates lookup
+
+#ifndef ALICEO2_GLOBTRACKING_TIMEINTERVALLUT_
+#define ALICEO2_GLOBTRACKING_TIMEINTERVALLUT_
+
+#include <algorithm>
+#include <vector>
+
+namespace o2
+{
+namespace globaltracking
+{
+
+/// Flat bucketed index over a collection ordered in time: every time bin stores the
+/// position of its first entry, so that the start of the candidates window of a track
+/// is found in O(1) instead of a binary search or a scan cursor carried over the
+/// (not necessarily equally ordered) tracks. The lookup is conservative: the returned
+/// position may precede the query time by up to a bin width, the caller is expected
+/// to skip the too-early entries as it would do during a plain scan.
+class TimeIntervalLUT
+{
+ public:
+  bool isBuilt() const { return !mLUT.empty(); }
+  void clear() { mLUT.clear(); }
+
+  /// build the LUT for nEntries entries with non-decreasing times provided by timeOf(i)
+  template <typename GetTime>
+  void build(int nEntries, float tMin, float tMax, float binWidth, GetTime timeOf)
+  {
+    mTMin = tMin;
+    mBinWidthInv = 1.f / binWidth;
+    int nBins = std::max(1, int((tMax - tMin) * mBinWidthInv) + 1);
+    mLUT.clear();
+    mLUT.resize(nBins, nEntries); // bins past the last entry point beyond the end
+    int bin = 0;
+    for (int i = 0; i < nEntries; i++) {
+      int b = timeToBin(timeOf(i));
+      if (b < 0) {
+        b = 0;
+      } else if (b >= nBins) {
+        b = nBins - 1;
+      }
+      while (bin <= b) {
+        mLUT[bin++] = i;
+      }
+    }
+  }
+
+  /// position from which the entries with time >= t may start
+  int getStart(float t) const
+  {
+    int b = timeToBin(t);
+    if (b < 0) {
+      b = 0;
+    } else if (b >= int(mLUT.size())) {
+      b = int(mLUT.size()) - 1;
+    }
+    return mLUT[b];
+  }
+
+ private:
+  int timeToBin(float t) const { return int((t - mTMin) * mBinWidthInv); }
+
+  float mTMin = 0.f;        ///< lower edge of the first bin
+  float mBinWidthInv = 1.f; ///< inverse bin width
+  std::vector<int> mLUT;    ///< first entry of each bin
+};
+
+} // namespace globaltracking
+} // namespace o2
+
+#endif
@@ -495,12 +495,11 @@ void MatchGlobalFwd::ROFMatch(int MFTROFId, int firstMCHROFId, int lastMCHROFId)
         }
 
         if constexpr (saveAllMode == SaveMode::kSaveNCandidates) { // In saveAllmode save all pairs to output container
-          auto score = mMatchFunc(thisMCHTrack, thisMFTTrack);
-          std::pair<int, int> scoreID = {score, MFTId};
-          mCandidates[MCHId].push_back(scoreID);
-          std::sort(mCandidates[MCHId].begin(), mCandidates[MCHId].end(), compare);
-          if (mCandidates[MCHId].size() > mNCandidates) {
-            mCandidates[MCHId].pop_back();
+          std::pair<int, int> scoreID = {score, MFTId};           // score evaluated above for the best-match update
+          auto& candidates = mCandidates[MCHId];
+          candidates.insert(std::upper_bound(candidates.begin(), candidates.end(), scoreID, compare), scoreID);
+          if (candidates.size() > mNCandidates) {
+            candidates.pop_back();
           }
         }
 
@@ -381,11 +381,27 @@ void MatchHMP::doMatching()
 
   float timeFromTF = o2::InteractionRecord::bc2ns(mStartIR.bc, mStartIR.orbit);
 
+  std::array<std::vector<Cluster>, o2::hmpid::Param::kMaxCh + 1> clustersPerChamber; // event clusters grouped per chamber
+
   for (int ievt = 0; ievt < cacheTriggerHMP.size(); ievt++) { // events loop
 
     auto& event = mHMPTriggersWork[cacheTriggerHMP[ievt]];
     auto evtTime = event.getIr().differenceInBCMUS(mStartIR);
 
+    // group the clusters of this event per chamber once, so that the tracks
+    // falling into the event time window only scan the clusters of their
+    // intersected chamber instead of the full event cluster range
+    for (auto& clusters : clustersPerChamber) {
+      clusters.clear();
+    }
+    for (int j = event.getFirstEntry(); j <= event.getLastEntry(); j++) { // event clusters loop
+      auto& cluster = (o2::hmpid::Cluster&)mHMPClustersArray[j];
+      if (cluster.ch() < o2::hmpid::Param::kMinCh || cluster.ch() > o2::hmpid::Param::kMaxCh) {
+        continue;
+      }
+      clustersPerChamber[cluster.ch()].push_back(cluster);
+    }
+
     int evtTracks = 0;
 
     for (int itrk = 0; itrk < cacheTrk.size(); itrk++) { // tracks loop
@@ -394,9 +410,6 @@ void MatchHMP::doMatching()
       auto& trackGid = mTrackGid[type][cacheTrk[itrk]];
       auto& trefTrk = trackWork.first;
 
-      prop->getFieldXYZ(trefTrk.getXYZGlo(), bxyz);
-      double bz = -bxyz[2];
-
       double timeUncert = trackWork.second.getTimeStampError();
 
       float minTrkTime = (trackWork.second.getTimeStamp() - mSigmaTimeCut * timeUncert);
@@ -407,6 +420,9 @@ void MatchHMP::doMatching()
 
         evtTracks++;
 
+        prop->getFieldXYZ(trefTrk.getXYZGlo(), bxyz);
+        double bz = -bxyz[2];
+
         MatchInfo matching(999999, mTrackGid[type][cacheTrk[itrk]]);
 
         matching.setHMPIDtrk(0, 0, 0, 0);            // no intersection found
@@ -437,16 +453,10 @@ void MatchHMP::doMatching()
         bool isMatched = kFALSE;
 
         Cluster* bestHmpCluster = nullptr; // the best matching cluster
-        std::vector<Cluster> oneEventClusters;
+        auto& oneEventClusters = clustersPerChamber[iCh];
 
-        for (int j = event.getFirstEntry(); j <= event.getLastEntry(); j++) { // event clusters loop
-          auto& cluster = (o2::hmpid::Cluster&)mHMPClustersArray[j];
-
-          if (cluster.ch() != iCh) {
-            continue;
-          }
-          oneEventClusters.push_back(cluster);
-          double qthre = pParam->qCut();
+        for (int j = 0; j < oneEventClusters.size(); j++) { // chamber clusters loop
+          auto& cluster = oneEventClusters[j];
 
           if (cluster.q() < 150. || cluster.size() > 10) {
             continue;
@@ -466,16 +476,15 @@ void MatchHMP::doMatching()
 
           if (dist < dmin) {
             dmin = dist;
-            index = oneEventClusters.size() - 1;
+            index = j;
             bestHmpCluster = &cluster;
           }
 
-        } // event clusters loop
+        } // chamber clusters loop
 
         // 2. Propagate track to the MIP cluster using the central method
 
         if (!bestHmpCluster) {
-          oneEventClusters.clear();
           continue;
         }
 
@@ -489,7 +498,6 @@ void MatchHMP::doMatching()
           continue;
         }
         if (!prop->PropagateToXBxByBz(hmpTrk, radiusH, o2::base::Propagator::MAX_SIN_PHI, o2::base::Propagator::MAX_STEP, matCorr)) {
-          oneEventClusters.clear();
           continue;
         }
 
@@ -508,7 +516,6 @@ void MatchHMP::doMatching()
         TrackHMP hmpTrkConstrained(trackC);
         hmpTrkConstrained.set(trackC.getX(), trackC.getAlpha(), trackC.getParams(), trackC.getCharge(), trackC.getPID());
         if (!prop->PropagateToXBxByBz(hmpTrkConstrained, radiusH - kdRadiator, o2::base::Propagator::MAX_SIN_PHI, o2::base::Propagator::MAX_STEP, matCorr)) {
-          oneEventClusters.clear();
           continue;
         }
 
@@ -552,7 +559,6 @@ void MatchHMP::doMatching()
 
         if (!isMatched) {
           mMatchedTracks[type].push_back(matching);
-          oneEventClusters.clear();
           continue;
         } // If matched continue...
 
@@ -565,8 +571,6 @@ void MatchHMP::doMatching()
 
         mMatchedTracks[type].push_back(matching);
 
-        oneEventClusters.clear();
-
       } // if matching in time
     }   // tracks loop
   }     // events loop
@@ -37,6 +37,7 @@
 #include "DataFormatsGlobalTracking/TrackTuneParams.h"
 
 #include "GlobalTracking/MatchTOF.h"
+#include "GlobalTracking/TimeIntervalLUT.h"
 
 #include "TPCBase/ParameterGas.h"
 #include "TPCBase/ParameterElectronics.h"
@@ -163,7 +164,11 @@ void MatchTOF::run(const o2::globaltracking::RecoContainer& inp, unsigned long f
   }
   mTimerMatchTPC.Stop();
 
-  // finalize
+  // finalize: the per-sector fake-match tagging only touches the pairs of its own sector,
+  // so it runs in parallel; only the merge of the best matches into the shared outputs is serial
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(dynamic) num_threads(mNlanes)
+#endif
   for (int sec = o2::constants::math::NSectors - 1; sec > -1; sec--) {
     if (mStoreMatchable) {
       // if MC check if good or fake matches
@@ -208,10 +213,18 @@ void MatchTOF::run(const o2::globaltracking::RecoContainer& inp, unsigned long f
       }
     }
 
-    LOG(debug) << "...done. Now check the best matches";
     nMatches[sec] = mMatchedTracksPairsSec[sec].size();
-    selectBestMatches(sec);
+  }
+
+  for (int sec = o2::constants::math::NSectors - 1; sec > -1; sec--) {
+    LOG(debug) << "...done. Now check the best matches";
+    selectBestMatches(sec); // appends to the shared output vectors, must stay serial
+  }
 
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(dynamic) num_threads(mNlanes)
+#endif
+  for (int sec = o2::constants::math::NSectors - 1; sec > -1; sec--) {
     if (mStoreMatchable) {
       for (auto& matchingPair : mMatchedTracksPairsSec[sec]) {
         trkType trkTypeSplitted = trkType::TPC;
@@ -820,7 +833,12 @@ void MatchTOF::doMatching(int sec)
   if (!nTracks || !nTOFCls) {
     return;
   }
-  int itof0 = 0;                          // starting index in TOF clusters for matching of the track
+  // flat time-bucketed LUT over the time-ordered cached TOF clusters: O(1) lookup of the first
+  // cluster which may match a track, instead of a scan cursor carried over the tracks (whose
+  // time windows are not necessarily ordered, due to the per-track errors)
+  TimeIntervalLUT tofTimeLUT;
+  tofTimeLUT.build(nTOFCls, mTOFClusWork[cacheTOF.front()].getTime(), mTOFClusWork[cacheTOF.back()].getTime(), 1.E6, // 1 mus bins, times are in ps
+                   [&](int i) { return mTOFClusWork[cacheTOF[i]].getTime(); });
   int detId[2][5];                        // at maximum one track can fall in 2 strips during the propagation; the second dimention of the array is the TOF det index
   float deltaPos[2][3];                   // at maximum one track can fall in 2 strips during the propagation; the second dimention of the array is the residuals
   o2::track::TrackLTIntegral trkLTInt[2]; // Here we store the integrated track length and time for the (max 2) matched strips
@@ -962,7 +980,7 @@ void MatchTOF::doMatching(int sec)
       continue; // the track never hit a TOF strip during the propagation
     }
     bool foundCluster = false;
-    for (auto itof = itof0; itof < nTOFCls; itof++) {
+    for (auto itof = tofTimeLUT.getStart(minTrkTime); itof < nTOFCls; itof++) {
       //      printf("itof = %d\n", itof);
       auto& trefTOF = mTOFClusWork[cacheTOF[itof]];
       // compare the times of the track and the TOF clusters - remember that they both are ordered in time!
@@ -970,7 +988,6 @@ void MatchTOF::doMatching(int sec)
 
       if (trefTOF.getTime() < minTrkTime) { // this cluster has a time that is too small for the current track, we will get to the next one
         //Printf("In trefTOF.getTime() < minTrkTime");
-        itof0 = itof + 1; // but for the next track that we will check, we will ignore this cluster (the time is anyway too small)
         continue;
       }
       if (trefTOF.getTime() > maxTrkTime) { // no more TOF clusters can be matched to this track
@@ -1115,7 +1132,10 @@ void MatchTOF::doMatchingForTPC(int sec)
   if (!nTracks || !nTOFCls) {
     return;
   }
-  int itof0 = 0; // starting index in TOF clusters for matching of the track
+  // flat time-bucketed LUT over the time-ordered cached TOF clusters, see doMatching
+  TimeIntervalLUT tofTimeLUT;
+  tofTimeLUT.build(nTOFCls, mTOFClusWork[cacheTOF.front()].getTime(), mTOFClusWork[cacheTOF.back()].getTime(), 1.E6, // 1 mus bins, times are in ps
+                   [&](int i) { return mTOFClusWork[cacheTOF[i]].getTime(); });
   float deltaPosTemp[3];
   std::array<float, 3> pos;
   std::array<float, 3> posBeforeProp;
@@ -1164,12 +1184,12 @@ void MatchTOF::doMatchingForTPC(int sec)
     }
 
     int itofMax = nTOFCls;
+    int itof0 = tofTimeLUT.getStart(minTrkTime); // starting index in TOF clusters for matching of the track
 
     for (auto itof = itof0; itof < nTOFCls; itof++) {
       auto& trefTOF = mTOFClusWork[cacheTOF[itof]];
 
       if (trefTOF.getTime() < minTrkTime) { // this cluster has a time that is too small for the current track, we will get to the next one
-        itof0 = itof + 1;
         continue;
       }
 
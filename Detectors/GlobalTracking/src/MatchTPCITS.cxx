@@ -104,9 +104,27 @@ void MatchTPCITS::run(const o2::globaltracking::RecoContainer& inp,
     }
 
     mTimer[SWDoMatching].Start(false);
-    for (int sec = o2::constants::math::NSectors; sec--;) {
+#ifdef WITH_OPENMP
+    int nthreads = mNThreads;
+#ifdef _ALLOW_DEBUG_TREES_
+    if (mDBGOut) {
+      nthreads = 1; // the debug tree filling is not thread-safe
+    }
+#endif
+#pragma omp parallel for schedule(dynamic) num_threads(nthreads)
+#endif
+    for (int sec = 0; sec < o2::constants::math::NSectors; sec++) {
       doMatching(sec);
     }
+    // register the collected candidates serially, in the same sector order as the
+    // original serial matching, to keep the match records deterministic
+    for (int sec = o2::constants::math::NSectors; sec--;) {
+      for (const auto& cand : mSectMatchCand[sec]) {
+        registerMatchRecordTPC(cand.iITS, cand.iTPC, cand.chi2, cand.candIC);
+      }
+      mNMatchesControl += mSectMatchCand[sec].size();
+      mSectMatchCand[sec].clear();
+    }
     mTimer[SWDoMatching].Stop();
     if constexpr (false) { // enabling this creates very verbose output
       mTimer[SWTot].Stop();
@@ -618,8 +636,7 @@ bool MatchTPCITS::prepareTPCData()
     mITSROFofTPCBin[ib] = itsROF;
   }
 */
-  mInteractionMUSLUT.clear();
-  mInteractionMUSLUT.resize(maxTime + 3 * o2::constants::lhc::LHCOrbitMUS, -1);
+  mInteractionTimeLUT.clear();
   mTimer[SWPrepTPC].Stop();
   return mTPCWork.size() > 0;
 }
@@ -839,7 +856,9 @@ bool MatchTPCITS::prepareFITData()
 //_____________________________________________________
 void MatchTPCITS::doMatching(int sec)
 {
-  ///< run matching for currently cached ITS data for given TPC sector
+  ///< run matching for currently cached ITS data for given TPC sector.
+  ///< Only collects the accepted candidates into mSectMatchCand[sec]: the shared match
+  ///< records are untouched, so different sectors may be matched concurrently.
   auto& cacheITS = mITSSectIndexCache[sec]; // array of cached ITS track indices for this sector
   auto& cacheTPC = mTPCSectIndexCache[sec]; // array of cached ITS track indices for this sector
   auto& timeStartTPC = mTPCTimeStart[sec];  // array of 1st TPC track with timeMax in ITS ROFrame
@@ -869,6 +888,29 @@ void MatchTPCITS::doMatching(int sec)
   auto t2nbs = tpcTimeBin2MUS(mZ2TPCBin * mParams->tpcTimeICMatchingNSigma);
   bool checkInteractionCandidates = mUseFT0 && mParams->validateMatchByFIT != MatchTPCITSParams::Disable;
 
+  // SoA snapshot of the ITS tracks cached for this sector: the rough time-bracket and Tgl
+  // gates are evaluated on these flat arrays for the whole candidate list of every TPC track,
+  // only the surviving pairs enter the full per-pair comparison below
+  std::vector<float> itsTglA(nTracksITS), itsErr2TglA(nTracksITS), itsTMinA(nTracksITS), itsTMaxA(nTracksITS);
+  for (int iits = 0; iits < nTracksITS; iits++) {
+    const auto& trefITS = mITSWork[cacheITS[iits]];
+    itsTglA[iits] = trefITS.getParam(o2::track::kTgl);
+    float err2Tgl = trefITS.getDiagError2(o2::track::kTgl);
+    if (mVDriftCalibOn) {
+      float addErr = itsTglA[iits] * mParams->maxVDriftUncertainty;
+      err2Tgl += addErr * addErr;
+    }
+    itsErr2TglA[iits] = err2Tgl;
+    itsTMinA[iits] = trefITS.tBracket.getMin();
+    itsTMaxA[iits] = trefITS.tBracket.getMax();
+  }
+  bool useTglGate = true;
+#ifdef _ALLOW_DEBUG_TREES_
+  useTglGate = !mDBGOut || !isDebugFlag(MatchTreeAll); // the gate would suppress the debug records of Tgl-rejected pairs
+#endif
+  std::vector<int> candList;
+  candList.reserve(nTracksITS);
+
   int itsROBin = 0;
   for (int itpc = idxMinTPC; itpc < nTracksTPC; itpc++) {
     auto& trefTPC = mTPCWork[cacheTPC[itpc]];
@@ -882,16 +924,30 @@ void MatchTPCITS::doMatching(int sec)
     }
     int iits0 = timeStartITS[itsROBin];
     nCheckTPCControl++;
-    for (auto iits = iits0; iits < nTracksITS; iits++) {
+    // since TPC tracks are sorted in timeMax and ITS tracks are sorted in timeMin, the ITS tracks
+    // starting after the TPC bracket cannot match this and any further TPC track
+    const float tpcTMin = trefTPC.tBracket.getMin(), tpcTMax = trefTPC.tBracket.getMax();
+    int iitsEnd = iits0;
+    while (iitsEnd < nTracksITS && itsTMinA[iitsEnd] <= tpcTMax) {
+      iitsEnd++;
+    }
+    // vectorizable gate over the whole candidate list of this TPC track: reject the pairs with
+    // disjoint time brackets or incompatible Tgl, as the full comparison would do anyway
+    candList.clear();
+    const float tglTPC = trefTPC.getParam(o2::track::kTgl), err2TglTPC = trefTPC.getDiagError2(o2::track::kTgl);
+    const float absCutTgl = mParams->crudeAbsDiffCut[o2::track::kTgl], nSigma2CutTgl = mParams->crudeNSigma2Cut[o2::track::kTgl];
+    for (int iits = iits0; iits < iitsEnd; iits++) {
+      const float diffTgl = itsTglA[iits] - tglTPC;
+      bool pass = itsTMaxA[iits] >= tpcTMin &&
+                  (!useTglGate || (diffTgl <= absCutTgl && diffTgl >= -absCutTgl &&
+                                   diffTgl * diffTgl <= nSigma2CutTgl * (itsErr2TglA[iits] + err2TglTPC)));
+      if (pass) {
+        candList.push_back(iits);
+      }
+    }
+    for (auto iits : candList) {
       auto& trefITS = mITSWork[cacheITS[iits]];
-      // compare if the ITS and TPC tracks may overlap in time
       LOG(debug) << "TPC bracket: " << trefTPC.tBracket.asString() << " ITS bracket: " << trefITS.tBracket.asString() << " TPCtgl: " << trefTPC.getTgl() << " ITStgl: " << trefITS.getTgl();
-      if (trefTPC.tBracket < trefITS.tBracket) { // since TPC tracks are sorted in timeMax and ITS tracks are sorted in timeMin all following ITS tracks also will not match
-        break;
-      }
-      if (trefTPC.tBracket > trefITS.tBracket) { // its bracket precedes TPC bracket
-        continue;
-      }
 
       // is corrected TPC track time compatible with ITS ROF expressed
       auto deltaT = (trefITS.getZ() - trefTPC.getZ()) * mTPCVDriftInv;                                                    // drift time difference corresponding to Z differences
@@ -969,7 +1025,7 @@ void MatchTPCITS::doMatching(int sec)
           if (tmus < 0) {
             tmus = 0;
           }
-          auto entStart = tmus < int(mInteractionMUSLUT.size()) ? mInteractionMUSLUT[tmus] : (mInteractionMUSLUT.size() ? mInteractionMUSLUT.back() : 0);
+          auto entStart = std::max(mInteractionTimeLUT.getStart(tmus) - 1, 0); // step back by 1 entry for the brackets spilling over the bin edge
           for (int ent = entStart; ent < (int)mInteractions.size(); ent++) {
             auto cmp = mInteractions[ent].tBracket.isOutside(trange);
             if (cmp == o2::math_utils::Bracketf_t::Above) { // trange is above this interaction candidate, the following ones may match
@@ -985,7 +1041,7 @@ void MatchTPCITS::doMatching(int sec)
           continue;
         }
       }
-      registerMatchRecordTPC(cacheITS[iits], cacheTPC[itpc], chi2, matchedIC); // register matching candidate
+      mSectMatchCand[sec].push_back({cacheITS[iits], cacheTPC[itpc], chi2, matchedIC}); // collect matching candidate, registered by the caller
       nMatchesControl++;
     }
   }
@@ -994,7 +1050,6 @@ void MatchTPCITS::doMatching(int sec)
               << " N TPC tracks checked: " << nCheckTPCControl << " (starting from " << idxMinTPC
               << "), checks: " << nCheckITSControl << ", matches:" << nMatchesControl;
   }
-  mNMatchesControl += nMatchesControl;
 }
 
 //______________________________________________
@@ -1497,7 +1552,7 @@ void MatchTPCITS::fillCalibDebug(int ifit, int iTPC, const o2::dataformats::Trac
       if (timeC0 < 0) {
         timeC0 = 0;
       }
-      auto entStart = timeC0 < int(mInteractionMUSLUT.size()) ? mInteractionMUSLUT[timeC0] : (mInteractionMUSLUT.size() ? mInteractionMUSLUT.back() : 0);
+      auto entStart = std::max(mInteractionTimeLUT.getStart(timeC0) - 1, 0); // step back by 1 entry for the brackets spilling over the bin edge
       for (int ent = entStart; ent < (int)mInteractions.size(); ent++) {
         float diff = mInteractions[ent].tBracket.mean() - timeC;
         if (diff > minDiffA) {
@@ -1923,12 +1978,6 @@ int MatchTPCITS::prepareInteractionTimes()
       if (fitTime < 0) { // should not happen
         continue;
       }
-      if (size_t(fitTime) >= mInteractionMUSLUT.size()) {
-        mInteractionMUSLUT.resize(size_t(fitTime) + 1, -1);
-      }
-      if (mInteractionMUSLUT[fitTime] < 0) {
-        mInteractionMUSLUT[fitTime] = mInteractions.size();
-      }
       for (; rof < nITSROFs; rof++) {
         if (mITSROFTimes[rof] < fitTime) {
           continue;
@@ -1941,13 +1990,9 @@ int MatchTPCITS::prepareInteractionTimes()
       mInteractions.emplace_back(ft.getInteractionRecord(), fitTime, ft0Uncertainty, rof, o2::detectors::DetID::FT0);
     }
   }
-  int ent = 0;
-  for (auto& val : mInteractionMUSLUT) {
-    if (val < 0) { // was not assigned == no interactions in this mus, assign previous one
-      val = ent;
-    } else {
-      ent = val > 0 ? val - 1 : val;
-    }
+  if (mInteractions.size()) {
+    mInteractionTimeLUT.build(int(mInteractions.size()), 0.f, mInteractions.back().tBracket.getMax(), 1.f, // 1 mus bins
+                              [this](int i) { return mInteractions[i].tBracket.getMin(); });
   }
   return mInteractions.size();
 }
@@ -33,6 +33,11 @@
 
 class TGeoPNEntry;
 
+namespace o2::detectors
+{
+class SensorMatrixCache;
+}
+
 namespace o2::its
 {
 /// GeometryTGeo is a simple interface class to TGeoManager. It is used in the simulation
@@ -100,6 +105,9 @@ class GeometryTGeo : public o2::itsmft::GeometryTGeo
   using o2::itsmft::GeometryTGeo::fillMatrixCache;
   void fillMatrixCache(int mask) override;
 
+  // fill the matrix cache from a flat snapshot shared by another device instead of extracting the matrices from TGeo
+  void fillMatrixCache(const o2::detectors::SensorMatrixCache& cache);
+
   // cache parameters of sensors tracking frames
   void fillTrackingFramesCache();
 
@@ -19,6 +19,7 @@
 #include <fairlogger/Logger.h> // for LOG
 #include "ITSBase/GeometryTGeo.h"
 #include "DetectorsBase/GeometryManager.h"
+#include "DetectorsCommonDataFormats/SensorMatrixCache.h"
 #include "ITSMFTBase/SegmentationAlpide.h"
 #include "MathUtils/Cartesian.h"
 
@@ -586,6 +587,15 @@ void GeometryTGeo::fillMatrixCache(int mask)
   }
 }
 
+//__________________________________________________________________________
+void GeometryTGeo::fillMatrixCache(const o2::detectors::SensorMatrixCache& cache)
+{
+  // populate the matrix cache from a flat snapshot prepared by another device,
+  // avoiding the extraction and adaption of the matrices from TGeo
+  LOGP(info, "Loading {} matrices from a shared snapshot of {} sensors", getName(), cache.getSize());
+  cache.copyTo(*this);
+}
+
 //__________________________________________________________________________
 void GeometryTGeo::fillTrackingFramesCache()
 {
@@ -27,6 +27,76 @@ using namespace constants::its2;
 
 namespace gpu
 {
+GPUd() float smallestAngleDifference(float a, float b)
+{
+  float diff = fmod(b - a + constants::math::Pi, constants::math::TwoPi) - constants::math::Pi;
+  return (diff < -constants::math::Pi) ? diff + constants::math::TwoPi : ((diff > constants::math::Pi) ? diff - constants::math::TwoPi : diff);
+}
+
+template <TrackletMode Mode>
+GPUg() void trackleterKernelMultipleRof(
+  const Cluster* clustersNextLayer,    // 0 2
+  const Cluster* clustersCurrentLayer, // 1 1
+  const int* sizeNextLClusters,
+  const int* sizeCurrentLClusters,
+  const int* nextIndexTables,
+  Tracklet* Tracklets,
+  int* foundTracklets,
+  const IndexTableUtils* utils,
+  const unsigned int startRofId,
+  const unsigned int rofSize,
+  const float phiCut,
+  const size_t maxTrackletsPerCluster)
+{
+  const int phiBins{utils->getNphiBins()};
+  const int zBins{utils->getNzBins()};
+  for (unsigned int iRof{blockIdx.x}; iRof < rofSize; iRof += gridDim.x) {
+    const short rof = static_cast<short>(startRofId + iRof);
+    auto* clustersNextLayerRof = clustersNextLayer + (sizeNextLClusters[rof] - sizeNextLClusters[startRofId]);
+    auto* clustersCurrentLayerRof = clustersCurrentLayer + (sizeCurrentLClusters[rof] - sizeCurrentLClusters[startRofId]);
+    auto nClustersNextLayerRof = sizeNextLClusters[rof + 1] - sizeNextLClusters[rof];
+    auto nClustersCurrentLayerRof = sizeCurrentLClusters[rof + 1] - sizeCurrentLClusters[rof];
+    auto* indexTableNextRof = nextIndexTables + iRof * (phiBins * zBins + 1);
+    auto* TrackletsRof = Tracklets + (sizeCurrentLClusters[rof] - sizeCurrentLClusters[startRofId]) * maxTrackletsPerCluster;
+    auto* foundTrackletsRof = foundTracklets + (sizeCurrentLClusters[rof] - sizeCurrentLClusters[startRofId]);
+
+    // single rof loop on layer1 clusters
+    for (int iCurrentLayerClusterIndex = threadIdx.x; iCurrentLayerClusterIndex < nClustersCurrentLayerRof; iCurrentLayerClusterIndex += blockDim.x) {
+      unsigned int storedTracklets{0};
+      const size_t stride{iCurrentLayerClusterIndex * maxTrackletsPerCluster};
+      const Cluster& currentCluster = clustersCurrentLayerRof[iCurrentLayerClusterIndex];
+      const int4 selectedBinsRect{VertexerTraits::getBinsRect(currentCluster, (int)Mode, 0.f, 50.f, phiCut / 2, *utils)};
+      if (selectedBinsRect.x != 0 || selectedBinsRect.y != 0 || selectedBinsRect.z != 0 || selectedBinsRect.w != 0) {
+        int phiBinsNum{selectedBinsRect.w - selectedBinsRect.y + 1};
+        if (phiBinsNum < 0) {
+          phiBinsNum += phiBins;
+        }
+        // loop on phi bins next layer
+        for (unsigned int iPhiBin{(unsigned int)selectedBinsRect.y}, iPhiCount{0}; iPhiCount < (unsigned int)phiBinsNum; iPhiBin = ++iPhiBin == phiBins ? 0 : iPhiBin, iPhiCount++) {
+          const int firstBinIndex{utils->getBinIndex(selectedBinsRect.x, iPhiBin)};
+          const int firstRowClusterIndex{indexTableNextRof[firstBinIndex]};
+          const int maxRowClusterIndex{indexTableNextRof[firstBinIndex + zBins]};
+          // loop on clusters next layer
+          for (int iNextLayerClusterIndex{firstRowClusterIndex}; iNextLayerClusterIndex < maxRowClusterIndex && iNextLayerClusterIndex < nClustersNextLayerRof; ++iNextLayerClusterIndex) {
+            const Cluster& nextCluster = clustersNextLayerRof[iNextLayerClusterIndex];
+            if (o2::gpu::GPUCommonMath::Abs(smallestAngleDifference(currentCluster.phi, nextCluster.phi)) < phiCut) {
+              if (storedTracklets < maxTrackletsPerCluster) {
+                if constexpr (Mode == TrackletMode::Layer0Layer1) {
+                  new (TrackletsRof + stride + storedTracklets) Tracklet{iNextLayerClusterIndex, iCurrentLayerClusterIndex, nextCluster, currentCluster, rof, rof};
+                } else {
+                  new (TrackletsRof + stride + storedTracklets) Tracklet{iCurrentLayerClusterIndex, iNextLayerClusterIndex, currentCluster, nextCluster, rof, rof};
+                }
+                ++storedTracklets;
+              }
+            }
+          }
+        }
+      }
+      foundTrackletsRof[iCurrentLayerClusterIndex] = storedTracklets;
+    }
+  }
+}
+
 template <TrackletMode Mode>
 void trackletFinderHandler(const Cluster* clustersNextLayer,    // 0 2
                            const Cluster* clustersCurrentLayer, // 1 1
@@ -41,14 +111,28 @@ void trackletFinderHandler(const Cluster* clustersNextLayer,    // 0 2
                            const float phiCut,
                            const size_t maxTrackletsPerCluster)
 {
-}
-/*
-GPUd() float smallestAngleDifference(float a, float b)
-{
-  float diff = fmod(b - a + constants::math::Pi, constants::math::TwoPi) - constants::math::Pi;
-  return (diff < -constants::math::Pi) ? diff + constants::math::TwoPi : ((diff > constants::math::Pi) ? diff - constants::math::TwoPi : diff);
+  if (rofSize) {
+    trackleterKernelMultipleRof<Mode><<<rofSize, 1024>>>(
+      clustersNextLayer,       // const Cluster* clustersNextLayer,    // 0 2
+      clustersCurrentLayer,    // const Cluster* clustersCurrentLayer, // 1 1
+      sizeNextLClusters,       // const int* sizeNextLClusters,
+      sizeCurrentLClusters,    // const int* sizeCurrentLClusters,
+      nextIndexTables,         // const int* nextIndexTables,
+      Tracklets,               // Tracklet* Tracklets,
+      foundTracklets,          // int* foundTracklets,
+      utils,                   // const IndexTableUtils* utils,
+      startRofId,              // const unsigned int startRofId,
+      rofSize,                 // const unsigned int rofSize,
+      phiCut,                  // const float phiCut,
+      maxTrackletsPerCluster); // const size_t maxTrackletsPerCluster
+  }
+  checkGPUError(cudaPeekAtLastError());
+  checkGPUError(cudaDeviceSynchronize());
 }
 
+template void trackletFinderHandler<TrackletMode::Layer0Layer1>(const Cluster*, const Cluster*, const int*, const int*, const int*, Tracklet*, int*, const IndexTableUtils*, const unsigned int, const unsigned int, const float, const size_t);
+template void trackletFinderHandler<TrackletMode::Layer1Layer2>(const Cluster*, const Cluster*, const int*, const int*, const int*, Tracklet*, int*, const IndexTableUtils*, const unsigned int, const unsigned int, const float, const size_t);
+/*
 GPUd() const int4 getBinsRect(const Cluster& currentCluster, const int layerIndex,
                               const float z1, float maxdeltaz, float maxdeltaphi)
 {
@@ -205,73 +289,6 @@ GPUg() void trackleterKernelSingleRof(
   }
 }
 
-template <TrackletMode Mode>
-GPUg() void trackleterKernelMultipleRof(
-  const Cluster* clustersNextLayer,    // 0 2
-  const Cluster* clustersCurrentLayer, // 1 1
-  const int* sizeNextLClusters,
-  const int* sizeCurrentLClusters,
-  const int* nextIndexTables,
-  Tracklet* Tracklets,
-  int* foundTracklets,
-  const IndexTableUtils* utils,
-  const short startRofId,
-  const short rofSize,
-  const float phiCut,
-  const size_t maxTrackletsPerCluster = 1e2)
-{
-  const int phiBins{utils->getNphiBins()};
-  const int zBins{utils->getNzBins()};
-  for (auto iRof{blockIdx.x}; iRof < rofSize; iRof += gridDim.x) {
-    short rof = static_cast<short>(iRof) + startRofId;
-    auto* clustersNextLayerRof = clustersNextLayer + (sizeNextLClusters[rof] - sizeNextLClusters[startRofId]);
-    auto* clustersCurrentLayerRof = clustersCurrentLayer + (sizeCurrentLClusters[rof] - sizeCurrentLClusters[startRofId]);
-    auto nClustersNextLayerRof = sizeNextLClusters[rof + 1] - sizeNextLClusters[rof];
-    auto nClustersCurrentLayerRof = sizeCurrentLClusters[rof + 1] - sizeCurrentLClusters[rof];
-    auto* indexTableNextRof = nextIndexTables + iRof * (phiBins * zBins + 1);
-    auto* TrackletsRof = Tracklets + (sizeCurrentLClusters[rof] - sizeCurrentLClusters[startRofId]) * maxTrackletsPerCluster;
-    auto* foundTrackletsRof = foundTracklets + (sizeCurrentLClusters[rof] - sizeCurrentLClusters[startRofId]);
-
-    // single rof loop on layer1 clusters
-    for (int iCurrentLayerClusterIndex = threadIdx.x; iCurrentLayerClusterIndex < nClustersCurrentLayerRof; iCurrentLayerClusterIndex += blockDim.x) {
-      unsigned int storedTracklets{0};
-      const size_t stride{iCurrentLayerClusterIndex * maxTrackletsPerCluster};
-      const Cluster& currentCluster = clustersCurrentLayerRof[iCurrentLayerClusterIndex];
-      const int4 selectedBinsRect{VertexerTraits::getBinsRect(currentCluster, (int)Mode, 0.f, 50.f, phiCut / 2, *utils)};
-      if (selectedBinsRect.x != 0 || selectedBinsRect.y != 0 || selectedBinsRect.z != 0 || selectedBinsRect.w != 0) {
-        int phiBinsNum{selectedBinsRect.w - selectedBinsRect.y + 1};
-        if (phiBinsNum < 0) {
-          phiBinsNum += phiBins;
-        }
-        // loop on phi bins next layer
-        for (unsigned int iPhiBin{(unsigned int)selectedBinsRect.y}, iPhiCount{0}; iPhiCount < (unsigned int)phiBinsNum; iPhiBin = ++iPhiBin == phiBins ? 0 : iPhiBin, iPhiCount++) {
-          const int firstBinIndex{utils->getBinIndex(selectedBinsRect.x, iPhiBin)};
-          const int firstRowClusterIndex{indexTableNextRof[firstBinIndex]};
-          const int maxRowClusterIndex{indexTableNextRof[firstBinIndex + zBins]};
-          // loop on clusters next layer
-          for (int iNextLayerClusterIndex{firstRowClusterIndex}; iNextLayerClusterIndex < maxRowClusterIndex && iNextLayerClusterIndex < nClustersNextLayerRof; ++iNextLayerClusterIndex) {
-            const Cluster& nextCluster = clustersNextLayerRof[iNextLayerClusterIndex];
-            if (o2::gpu::GPUCommonMath::Abs(smallestAngleDifference(currentCluster.phi, nextCluster.phi)) < phiCut) {
-              if (storedTracklets < maxTrackletsPerCluster) {
-                if constexpr (Mode == TrackletMode::Layer0Layer1) {
-                  new (TrackletsRof + stride + storedTracklets) Tracklet{iNextLayerClusterIndex, iCurrentLayerClusterIndex, nextCluster, currentCluster, rof, rof};
-                } else {
-                  new (TrackletsRof + stride + storedTracklets) Tracklet{iCurrentLayerClusterIndex, iNextLayerClusterIndex, currentCluster, nextCluster, rof, rof};
-                }
-                ++storedTracklets;
-              }
-            }
-          }
-        }
-      }
-      foundTrackletsRof[iCurrentLayerClusterIndex] = storedTracklets;
-      // if (storedTracklets >= maxTrackletsPerCluster && storedTracklets - maxTrackletsPerCluster < 5) {
-      //   printf("gpu tracklet finder: some lines will be left behind for cluster %d in rof: %d. valid: %u max: %lu (suppressing after 5 msgs)\n", iCurrentLayerClusterIndex, rof, storedTracklets, maxTrackletsPerCluster);
-      // }
-    }
-  }
-}
-
 template <bool initRun>
 GPUg() void trackletSelectionKernelSingleRof(
   const Cluster* clusters0,
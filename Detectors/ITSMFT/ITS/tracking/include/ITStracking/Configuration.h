@@ -130,6 +130,7 @@ struct VertexingParameters {
   int maxTrackletsPerCluster = 2e3;
   int phiSpan = -1;
   int zSpan = -1;
+  int subSamplingMultCut = -1; // layer-1 cluster multiplicity per ROF above which tracklet finding stride-samples the target clusters (<=0: disabled)
 
   int nThreads = 1;
 };
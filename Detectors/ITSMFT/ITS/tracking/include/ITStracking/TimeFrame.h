@@ -244,6 +244,15 @@ class TimeFrame
   void setExtAllocator(bool ext) { mExtAllocator = ext; }
   bool getExtAllocator() const { return mExtAllocator; }
 
+  /// keep the capacity of the internal vectors when they are reset, so that the
+  /// memory acquired for the largest timeframe processed so far is reused instead of
+  /// being reallocated (and the pages faulted in again) for every new timeframe
+  void setMemoryPooling(bool pool) { mPoolMemory = pool; }
+  bool getMemoryPooling() const { return mPoolMemory; }
+
+  void setNThreads(int n);
+  int getNThreads() const { return mNThreads; }
+
   /// Debug and printing
   void checkTrackletLUTs();
   void printROFoffsets();
@@ -290,12 +299,19 @@ class TimeFrame
   template <typename T>
   void deepVectorClear(std::vector<T>& vec)
   {
-    std::vector<T>().swap(vec);
+    if (mPoolMemory) {
+      vec.clear(); // the capacity acts as high watermark and is reused for the next timeframes
+    } else {
+      std::vector<T>().swap(vec);
+    }
   }
 
+  bool mPoolMemory = false;
+
  private:
   void prepareClusters(const TrackingParameters& trkParam, const int maxLayers);
   float mBz = 5.;
+  int mNThreads = 1;
   unsigned int mNTotalLowPtVertices = 0;
   int mBeamPosWeight = 0;
   std::array<float, 2> mBeamPos = {0.f, 0.f};
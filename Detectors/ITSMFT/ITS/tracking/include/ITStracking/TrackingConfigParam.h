@@ -49,6 +49,9 @@ struct VertexerParamConfig : public o2::conf::ConfigurableParamHelper<VertexerPa
   int ZBins = 1;
   int PhiBins = 128;
 
+  // Deterministic sub-sampling of high-pile-up ROFs
+  int subSamplingMultCut = -1; // layer-1 cluster multiplicity per ROF above which tracklet finding stride-samples the target clusters (<=0: disabled)
+
   int nThreads = 1;
 
   O2ParamDef(VertexerParamConfig, "ITSVertexerParam");
@@ -85,6 +88,7 @@ struct TrackerParamConfig : public o2::conf::ConfigurableParamHelper<TrackerPara
   bool overrideBeamEstimation = false; // used by gpuwf only
   int trackingMode = -1;               // -1: unset, 0=sync, 1=async, 2=cosmics used by gpuwf only
   bool doUPCIteration = false;
+  bool poolTFMemory = false; // reuse the TimeFrame vector capacities across timeframes instead of freeing them
 
   O2ParamDef(TrackerParamConfig, "ITSCATrackerParam");
 };
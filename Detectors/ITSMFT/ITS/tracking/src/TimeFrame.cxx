@@ -23,6 +23,7 @@
 #include "ITStracking/TrackingConfigParam.h"
 
 #include <iostream>
+#include <limits>
 
 #ifdef WITH_OPENMP
 #include <omp.h>
@@ -277,20 +278,26 @@ int TimeFrame::getTotalClusters() const
 
 void TimeFrame::prepareClusters(const TrackingParameters& trkParam, const int maxLayers)
 {
-  std::vector<ClusterHelper> cHelper;
-  std::vector<int> clsPerBin(trkParam.PhiBins * trkParam.ZBins, 0);
-  for (int rof{0}; rof < mNrof; ++rof) {
-    if ((int)mMultiplicityCutMask.size() == mNrof && !mMultiplicityCutMask[rof]) {
-      continue;
-    }
-    for (int iLayer{0}; iLayer < std::min(trkParam.NLayers, maxLayers); ++iLayer) {
-      std::fill(clsPerBin.begin(), clsPerBin.end(), 0);
+  const int nLayers{std::min(trkParam.NLayers, maxLayers)};
+  const bool useCutMask{(int)mMultiplicityCutMask.size() == mNrof};
+  // every (rof, layer) pair bins an independent set of clusters and writes to disjoint
+  // slices of the index tables, only the per-layer radius ranges and bogus-cluster
+  // counters are shared and get merged once per pair
+#pragma omp parallel for num_threads(mNThreads) schedule(dynamic) collapse(2)
+  for (int rof = 0; rof < mNrof; ++rof) {
+    for (int iLayer = 0; iLayer < nLayers; ++iLayer) {
+      if (useCutMask && !mMultiplicityCutMask[rof]) {
+        continue;
+      }
       const auto unsortedClusters{getUnsortedClustersOnLayer(rof, iLayer)};
       const int clustersNum{static_cast<int>(unsortedClusters.size())};
 
-      deepVectorClear(cHelper);
-      cHelper.resize(clustersNum);
+      std::vector<ClusterHelper> cHelper(clustersNum);
+      std::vector<int> clsPerBin(trkParam.PhiBins * trkParam.ZBins, 0);
 
+      float minR{std::numeric_limits<float>::max()};
+      float maxR{-1.f};
+      int bogusClusters{0};
       for (int iCluster{0}; iCluster < clustersNum; ++iCluster) {
 
         const Cluster& c = unsortedClusters[iCluster];
@@ -302,19 +309,25 @@ void TimeFrame::prepareClusters(const TrackingParameters& trkParam, const int ma
         int zBin{mIndexTableUtils.getZBinIndex(iLayer, z)};
         if (zBin < 0) {
           zBin = 0;
-          mBogusClusters[iLayer]++;
+          bogusClusters++;
         } else if (zBin >= trkParam.ZBins) {
           zBin = trkParam.ZBins - 1;
-          mBogusClusters[iLayer]++;
+          bogusClusters++;
         }
         int bin = mIndexTableUtils.getBinIndex(zBin, mIndexTableUtils.getPhiBinIndex(phi));
         h.phi = phi;
         h.r = math_utils::hypot(x, y);
-        mMinR[iLayer] = o2::gpu::GPUCommonMath::Min(h.r, mMinR[iLayer]);
-        mMaxR[iLayer] = o2::gpu::GPUCommonMath::Max(h.r, mMaxR[iLayer]);
+        minR = o2::gpu::GPUCommonMath::Min(h.r, minR);
+        maxR = o2::gpu::GPUCommonMath::Max(h.r, maxR);
         h.bin = bin;
         h.ind = clsPerBin[bin]++;
       }
+#pragma omp critical
+      {
+        mMinR[iLayer] = o2::gpu::GPUCommonMath::Min(minR, mMinR[iLayer]);
+        mMaxR[iLayer] = o2::gpu::GPUCommonMath::Max(maxR, mMaxR[iLayer]);
+        mBogusClusters[iLayer] += bogusClusters;
+      }
       std::vector<int> lutPerBin(clsPerBin.size());
       lutPerBin[0] = 0;
       for (unsigned int iB{1}; iB < lutPerBin.size(); ++iB) {
@@ -451,6 +464,15 @@ void TimeFrame::initialise(const int iteration, const TrackingParameters& trkPar
   }
 }
 
+void TimeFrame::setNThreads(int n)
+{
+#ifdef WITH_OPENMP
+  mNThreads = n > 0 ? n : 1;
+#else
+  mNThreads = 1;
+#endif
+}
+
 unsigned long TimeFrame::getArtefactsMemory()
 {
   unsigned long size{0};
@@ -536,6 +536,9 @@ bool Tracker::isMatLUT() const
 void Tracker::setNThreads(int n)
 {
   mTraits->setNThreads(n);
+  if (mTimeFrame != nullptr) {
+    mTimeFrame->setNThreads(n);
+  }
 }
 
 int Tracker::getNThreads() const
@@ -32,6 +32,8 @@
 
 #ifdef WITH_OPENMP
 #include <omp.h>
+#else
+static inline int omp_get_thread_num() { return 0; }
 #endif
 
 using o2::base::PropagatorF;
@@ -72,18 +74,31 @@ void TrackerTraits::computeLayerTracklets(const int iteration, int iROFslice, in
   gsl::span<const Vertex> diamondSpan(&diamondVert, 1);
   int startROF{mTrkParams[iteration].nROFsPerIterations > 0 ? iROFslice * mTrkParams[iteration].nROFsPerIterations : 0};
   int endROF{mTrkParams[iteration].nROFsPerIterations > 0 ? (iROFslice + 1) * mTrkParams[iteration].nROFsPerIterations + mTrkParams[iteration].DeltaROF : tf->getNrof()};
-  for (int rof0{startROF}; rof0 < endROF; ++rof0) {
-    gsl::span<const Vertex> primaryVertices = mTrkParams[iteration].UseDiamond ? diamondSpan : tf->getPrimaryVertices(rof0);
-    const int startVtx{iVertex >= 0 ? iVertex : 0};
-    const int endVtx{iVertex >= 0 ? std::min(iVertex + 1, static_cast<int>(primaryVertices.size())) : static_cast<int>(primaryVertices.size())};
-    int minRof = std::max(startROF, rof0 - mTrkParams[iteration].DeltaROF);
-    int maxRof = std::min(endROF - 1, rof0 + mTrkParams[iteration].DeltaROF);
-#pragma omp parallel for num_threads(mNThreads)
-    for (int iLayer = 0; iLayer < mTrkParams[iteration].TrackletsPerRoad(); ++iLayer) {
+  const int nTrackletLayers{mTrkParams[iteration].TrackletsPerRoad()};
+#ifdef WITH_OPENMP
+  const int nThreadBuffers{mNThreads};
+#else
+  const int nThreadBuffers{1};
+#endif
+  // Process all combinations of ROF and layer in one parallel loop: especially in pp the per-ROF
+  // work is too small to keep all threads busy when parallelising only over the layers of a
+  // single ROF. Each thread collects the tracklets in private buffers which are merged per layer
+  // afterwards; the subsequent sorting and duplicate removal makes the result independent of the
+  // thread scheduling.
+  std::vector<std::vector<std::vector<Tracklet>>> threadTracklets(nThreadBuffers, std::vector<std::vector<Tracklet>>(nTrackletLayers));
+#pragma omp parallel for num_threads(mNThreads) schedule(dynamic) collapse(2)
+  for (int rof0 = startROF; rof0 < endROF; ++rof0) {
+    for (int iLayer = 0; iLayer < nTrackletLayers; ++iLayer) {
       gsl::span<const Cluster> layer0 = tf->getClustersOnLayer(rof0, iLayer);
       if (layer0.empty()) {
         continue;
       }
+      gsl::span<const Vertex> primaryVertices = mTrkParams[iteration].UseDiamond ? diamondSpan : tf->getPrimaryVertices(rof0);
+      const int startVtx{iVertex >= 0 ? iVertex : 0};
+      const int endVtx{iVertex >= 0 ? std::min(iVertex + 1, static_cast<int>(primaryVertices.size())) : static_cast<int>(primaryVertices.size())};
+      const int minRof{std::max(startROF, rof0 - mTrkParams[iteration].DeltaROF)};
+      const int maxRof{std::min(endROF - 1, rof0 + mTrkParams[iteration].DeltaROF)};
+      auto& trackletBuffer = threadTracklets[omp_get_thread_num()][iLayer];
       float meanDeltaR{mTrkParams[iteration].LayerRadii[iLayer + 1] - mTrkParams[iteration].LayerRadii[iLayer]};
 
       const int currentLayerClustersNum{static_cast<int>(layer0.size())};
@@ -183,13 +198,14 @@ void TrackerTraits::computeLayerTracklets(const int iteration, int iROFslice, in
                     (deltaPhi < tf->getPhiCut(iLayer) ||
                      gpu::GPUCommonMath::Abs(deltaPhi - constants::math::TwoPi) < tf->getPhiCut(iLayer))) {
                   if (iLayer > 0) {
+#pragma omp atomic update
                     tf->getTrackletsLookupTable()[iLayer - 1][currentSortedIndex]++;
                   }
                   const float phi{o2::gpu::GPUCommonMath::ATan2(currentCluster.yCoordinate - nextCluster.yCoordinate,
                                                                 currentCluster.xCoordinate - nextCluster.xCoordinate)};
                   const float tanL{(currentCluster.zCoordinate - nextCluster.zCoordinate) /
                                    (currentCluster.radius - nextCluster.radius)};
-                  tf->getTracklets()[iLayer].emplace_back(currentSortedIndex, tf->getSortedIndex(rof1, iLayer + 1, iNextCluster), tanL, phi, rof0, rof1);
+                  trackletBuffer.emplace_back(currentSortedIndex, tf->getSortedIndex(rof1, iLayer + 1, iNextCluster), tanL, phi, rof0, rof1);
                 }
               }
             }
@@ -198,6 +214,21 @@ void TrackerTraits::computeLayerTracklets(const int iteration, int iROFslice, in
       }
     }
   }
+  /// Merge the thread-private tracklet buffers
+  for (int iLayer{0}; iLayer < nTrackletLayers; ++iLayer) {
+    auto& layerTracklets = tf->getTracklets()[iLayer];
+    size_t nTracklets{layerTracklets.size()};
+    for (int iThread{0}; iThread < nThreadBuffers; ++iThread) {
+      nTracklets += threadTracklets[iThread][iLayer].size();
+    }
+    layerTracklets.reserve(nTracklets);
+    for (int iThread{0}; iThread < nThreadBuffers; ++iThread) {
+      auto& buffer = threadTracklets[iThread][iLayer];
+      layerTracklets.insert(layerTracklets.end(), buffer.begin(), buffer.end());
+      buffer.clear();
+    }
+  }
+
   if (!tf->checkMemory(mTrkParams[iteration].MaxMemory)) {
     return;
   }
@@ -93,6 +93,10 @@ void ITSTrackingInterface::initialise()
   for (auto& params : trackParams) {
     params.CorrType = o2::base::PropagatorImpl<float>::MatCorrType::USEMatCorrLUT;
   }
+  if (o2::its::TrackerParamConfig::Instance().poolTFMemory) {
+    LOGP(info, "Pooling the TimeFrame memory across timeframes");
+    mTimeFrame->setMemoryPooling(true);
+  }
   mTracker->setParameters(trackParams);
   mVertexer->setParameters(vertParams);
 }
@@ -104,7 +108,10 @@ void ITSTrackingInterface::run(framework::ProcessingContext& pc)
   gsl::span<const unsigned char> patterns = pc.inputs().get<gsl::span<unsigned char>>("patterns");
   gsl::span<const o2::itsmft::PhysTrigger> physTriggers;
   std::vector<o2::itsmft::PhysTrigger> fromTRD;
-  if (mUseTriggers == 2) { // use TRD triggers
+  if (mUseTriggers && !pc.inputs().isValid("phystrig")) {
+    // with a streaming completion policy the tracker may be dispatched before the trigger input arrived
+    LOGP(alarm, "Trigger input is not (yet) available, no ROF will be selected for this TF");
+  } else if (mUseTriggers == 2) { // use TRD triggers
     o2::InteractionRecord ir{0, pc.services().get<o2::framework::TimingInfo>().firstTForbit};
     auto trdTriggers = pc.inputs().get<gsl::span<o2::trd::TriggerRecord>>("phystrig");
     for (const auto& trig : trdTriggers) {
@@ -124,6 +124,7 @@ void Vertexer::getGlobalConfiguration()
   mVertParams[0].maxZPositionAllowed = vc.maxZPositionAllowed;
   mVertParams[0].clusterContributorsCut = vc.clusterContributorsCut;
   mVertParams[0].maxTrackletsPerCluster = vc.maxTrackletsPerCluster;
+  mVertParams[0].subSamplingMultCut = vc.subSamplingMultCut;
   mVertParams[0].phiSpan = vc.phiSpan;
   mVertParams[0].nThreads = vc.nThreads;
   mVertParams[0].ZBins = vc.ZBins;
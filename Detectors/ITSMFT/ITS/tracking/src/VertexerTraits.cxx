@@ -57,7 +57,8 @@ void trackleterKernelHost(
   const short pivotRof,
   const short targetRof,
   gsl::span<int> rofFoundTrackletsOffsets, // we want to change those, to keep track of the offset in deltaRof>0
-  const int maxTrackletsPerCluster = static_cast<int>(2e3))
+  const int maxTrackletsPerCluster = static_cast<int>(2e3),
+  const int clusterStride = 1) // deterministic stride over the next-layer clusters of each bin, to sub-sample high-multiplicity ROFs
 {
   const int PhiBins{utils.getNphiBins()};
   const int ZBins{utils.getNzBins()};
@@ -77,7 +78,7 @@ void trackleterKernelHost(
         const int firstRowClusterIndex{indexTableNext[firstBinIndex]};
         const int maxRowClusterIndex{indexTableNext[firstBinIndex + ZBins]};
         // loop on clusters next layer
-        for (int iNextLayerClusterIndex{firstRowClusterIndex}; iNextLayerClusterIndex < maxRowClusterIndex && iNextLayerClusterIndex < static_cast<int>(clustersNextLayer.size()); ++iNextLayerClusterIndex) {
+        for (int iNextLayerClusterIndex{firstRowClusterIndex}; iNextLayerClusterIndex < maxRowClusterIndex && iNextLayerClusterIndex < static_cast<int>(clustersNextLayer.size()); iNextLayerClusterIndex += clusterStride) {
           if (usedClustersNextLayer[iNextLayerClusterIndex]) {
             continue;
           }
@@ -194,6 +195,13 @@ void VertexerTraits::computeTracklets(const int iteration)
       bool skipROF = iteration && (int)mTimeFrame->getPrimaryVertices(pivotRofId).size() > mVrtParams[iteration].vertPerRofThreshold;
       short startROF{std::max((short)0, static_cast<short>(pivotRofId - mVrtParams[iteration].deltaRof))};
       short endROF{std::min(static_cast<short>(mTimeFrame->getNrof()), static_cast<short>(pivotRofId + mVrtParams[iteration].deltaRof + 1))};
+      int clusterStride{1}; // above the multiplicity cut every clusterStride-th target cluster is probed, bounding the combinatorics per ROF
+      if (mVrtParams[iteration].subSamplingMultCut > 0) {
+        const int pivotMult{static_cast<int>(mTimeFrame->getClustersOnLayer(pivotRofId, 1).size())};
+        if (pivotMult > mVrtParams[iteration].subSamplingMultCut) {
+          clusterStride = 1 + (pivotMult - 1) / mVrtParams[iteration].subSamplingMultCut;
+        }
+      }
       for (auto targetRofId = startROF; targetRofId < endROF; ++targetRofId) {
         trackleterKernelHost<TrackletMode::Layer0Layer1, true>(
           !skipROF ? mTimeFrame->getClustersOnLayer(targetRofId, 0) : gsl::span<Cluster>(), // Clusters to be matched with the next layer in target rof
@@ -207,7 +215,8 @@ void VertexerTraits::computeTracklets(const int iteration)
           pivotRofId,
           targetRofId,
           gsl::span<int>(), // Offset in the tracklet buffer
-          mVrtParams[iteration].maxTrackletsPerCluster);
+          mVrtParams[iteration].maxTrackletsPerCluster,
+          clusterStride);
         trackleterKernelHost<TrackletMode::Layer1Layer2, true>(
           !skipROF ? mTimeFrame->getClustersOnLayer(targetRofId, 2) : gsl::span<Cluster>(),
           !skipROF ? mTimeFrame->getClustersOnLayer(pivotRofId, 1) : gsl::span<Cluster>(),
@@ -220,7 +229,8 @@ void VertexerTraits::computeTracklets(const int iteration)
           pivotRofId,
           targetRofId,
           gsl::span<int>(), // Offset in the tracklet buffer
-          mVrtParams[iteration].maxTrackletsPerCluster);
+          mVrtParams[iteration].maxTrackletsPerCluster,
+          clusterStride);
       }
       mTimeFrame->getNTrackletsROF(pivotRofId, 0) = std::accumulate(mTimeFrame->getNTrackletsCluster(pivotRofId, 0).begin(), mTimeFrame->getNTrackletsCluster(pivotRofId, 0).end(), 0);
       mTimeFrame->getNTrackletsROF(pivotRofId, 1) = std::accumulate(mTimeFrame->getNTrackletsCluster(pivotRofId, 1).begin(), mTimeFrame->getNTrackletsCluster(pivotRofId, 1).end(), 0);
@@ -237,6 +247,13 @@ void VertexerTraits::computeTracklets(const int iteration)
       bool skipROF = iteration && (int)mTimeFrame->getPrimaryVertices(pivotRofId).size() > mVrtParams[iteration].vertPerRofThreshold;
       short startROF{std::max((short)0, static_cast<short>(pivotRofId - mVrtParams[iteration].deltaRof))};
       short endROF{std::min(static_cast<short>(mTimeFrame->getNrof()), static_cast<short>(pivotRofId + mVrtParams[iteration].deltaRof + 1))};
+      int clusterStride{1}; // above the multiplicity cut every clusterStride-th target cluster is probed, bounding the combinatorics per ROF
+      if (mVrtParams[iteration].subSamplingMultCut > 0) {
+        const int pivotMult{static_cast<int>(mTimeFrame->getClustersOnLayer(pivotRofId, 1).size())};
+        if (pivotMult > mVrtParams[iteration].subSamplingMultCut) {
+          clusterStride = 1 + (pivotMult - 1) / mVrtParams[iteration].subSamplingMultCut;
+        }
+      }
       auto mobileOffset0 = mTimeFrame->getNTrackletsROF(pivotRofId, 0);
       auto mobileOffset1 = mTimeFrame->getNTrackletsROF(pivotRofId, 1);
       for (auto targetRofId = startROF; targetRofId < endROF; ++targetRofId) {
@@ -252,7 +269,8 @@ void VertexerTraits::computeTracklets(const int iteration)
           pivotRofId,
           targetRofId,
           mTimeFrame->getExclusiveNTrackletsCluster(pivotRofId, 0),
-          mVrtParams[iteration].maxTrackletsPerCluster);
+          mVrtParams[iteration].maxTrackletsPerCluster,
+          clusterStride);
         trackleterKernelHost<TrackletMode::Layer1Layer2, false>(
           !skipROF ? mTimeFrame->getClustersOnLayer(targetRofId, 2) : gsl::span<Cluster>(),
           !skipROF ? mTimeFrame->getClustersOnLayer(pivotRofId, 1) : gsl::span<Cluster>(),
@@ -265,7 +283,8 @@ void VertexerTraits::computeTracklets(const int iteration)
           pivotRofId,
           targetRofId,
           mTimeFrame->getExclusiveNTrackletsCluster(pivotRofId, 1),
-          mVrtParams[iteration].maxTrackletsPerCluster);
+          mVrtParams[iteration].maxTrackletsPerCluster,
+          clusterStride);
       }
     }
   }
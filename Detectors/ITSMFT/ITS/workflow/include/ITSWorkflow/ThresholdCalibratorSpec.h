@@ -51,7 +51,6 @@
 // ROOT includes
 #include "TTree.h"
 #include "TH1F.h"
-#include "TF1.h"
 #include "TFile.h"
 
 using namespace o2::framework;
@@ -177,9 +176,8 @@ class ITSThresholdCalibrator : public Task
   unsigned char vHits[N_COL];
   short int mColStep = 8; // save s-curves to tree every mColStep pixels on 1 row
 
-  // Initialize pointers for doing error function fits
+  // Histogram used to dump the s-curves on request
   TH1F* mFitHist = nullptr;
-  TF1* mFitFunction = nullptr;
 
   // Some private helper functions
   // Helper functions related to the running over data
@@ -14,6 +14,8 @@
 #include "ITSWorkflow/ThresholdCalibratorSpec.h"
 #include "CommonUtils/FileSystemUtils.h"
 #include "CCDB/BasicCCDBManager.h"
+#include "TMath.h"
+#include <cmath>
 
 #ifdef WITH_OPENMP
 #include <omp.h>
@@ -25,16 +27,68 @@ namespace its
 {
 
 //////////////////////////////////////////////////////////////////////////////
-// Define error function for ROOT fitting
-double erf(double* xx, double* par)
+// Analytic least-squares fit of the S-curve model
+// (nInjScaled / 2) * (1 +- Erf((x - thr) / (sqrt(2) * noise))), Gauss-Newton
+// on threshold and noise: no ROOT fit objects, no shared state, so the pixels
+// of a row can be fitted concurrently
+bool fitErfAnalytic(const std::vector<float>& x, const std::vector<float>& y, bool flip, float start,
+                    float& thresh, float& noise, float& chi2ndf)
 {
-  return (nInjScaled / 2) * TMath::Erf((xx[0] - par[0]) / (sqrt(2) * par[1])) + (nInjScaled / 2);
-}
-
-// ITHR erf is reversed
-double erf_ithr(double* xx, double* par)
-{
-  return (nInjScaled / 2) * (1 - TMath::Erf((xx[0] - par[0]) / (sqrt(2) * par[1])));
+  const int nPoints = (int)x.size();
+  const int ndf = nPoints - 2;
+  if (ndf <= 0) {
+    return false;
+  }
+  const double amp = nInjScaled / 2.;
+  const double sq2 = std::sqrt(2.);
+  const double dc = 2. / std::sqrt(TMath::Pi());
+  double t = start, n = 8.;
+  for (int iter = 0; iter < 50; iter++) {
+    double a11 = 0., a12 = 0., a22 = 0., b1 = 0., b2 = 0.;
+    for (int i = 0; i < nPoints; i++) {
+      const double u = (x[i] - t) / (sq2 * n);
+      const double model = flip ? amp * (1. - std::erf(u)) : amp * (std::erf(u) + 1.);
+      const double g = amp * dc * std::exp(-u * u) * (flip ? 1. : -1.);
+      const double dfdt = g / (sq2 * n);
+      const double dfdn = g * u / n;
+      const double r = y[i] - model;
+      a11 += dfdt * dfdt;
+      a12 += dfdt * dfdn;
+      a22 += dfdn * dfdn;
+      b1 += dfdt * r;
+      b2 += dfdn * r;
+    }
+    const double det = a11 * a22 - a12 * a12;
+    if (std::abs(det) < 1.e-12) {
+      break;
+    }
+    const double dt = (b1 * a22 - b2 * a12) / det;
+    const double dn = (a11 * b2 - a12 * b1) / det;
+    t += dt;
+    n += dn;
+    if (n < 0.01) {
+      n = 0.01;
+    }
+    if (std::abs(dt) < 1.e-4 && std::abs(dn) < 1.e-4) {
+      break;
+    }
+  }
+  if (!std::isfinite(t) || !std::isfinite(n)) {
+    return false;
+  }
+  // Pearson chi2 with the binomial variance of the hit counts, floored on the plateaus
+  double chi2 = 0.;
+  for (int i = 0; i < nPoints; i++) {
+    const double u = (x[i] - t) / (sq2 * n);
+    const double model = flip ? amp * (1. - std::erf(u)) : amp * (std::erf(u) + 1.);
+    const double p = std::min(std::max(model / nInjScaled, 0.), 1.);
+    const double var = std::max(nInjScaled * p * (1. - p), 0.25);
+    chi2 += (y[i] - model) * (y[i] - model) / var;
+  }
+  thresh = (float)t;
+  noise = (float)n;
+  chi2ndf = (float)(chi2 / ndf);
+  return true;
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -57,8 +111,6 @@ ITSThresholdCalibrator::~ITSThresholdCalibrator()
   if (this->mFitType == FIT) {
     delete this->mFitHist;
     this->mFitHist = nullptr;
-    delete this->mFitFunction;
-    this->mFitFunction = nullptr;
   }
 }
 
@@ -123,11 +175,6 @@ void ITSThresholdCalibrator::init(InitContext& ic)
   // Get number of threads
   this->mNThreads = ic.options().get<int>("nthreads");
 
-  // Check fit type vs nthreads (fit option is not thread safe!)
-  if (mFitType == FIT && mNThreads > 1) {
-    throw std::runtime_error("Multiple threads are requested with fit method which is not thread safe");
-  }
-
   // Machine hostname
   this->mHostname = boost::asio::ip::host_name();
 
@@ -217,6 +264,10 @@ void ITSThresholdCalibrator::init(InitContext& ic)
   if (isDumpS && mFitType != FIT) {
     LOG(error) << "S-curve dump enabled but `fittype` is not fit. Please check";
   }
+  // The fit itself is thread safe, but the dump goes through shared ROOT objects
+  if (isDumpS && mNThreads > 1) {
+    throw std::runtime_error("S-curve dump is requested with multiple threads, use nthreads=1");
+  }
   if (isDumpS) {
     fileDumpS = TFile::Open(Form("s-curves_%d.root", mChipModSel), "RECREATE"); // in case of multiple processes, every process will have it's own file
     if (maxDumpS < 0) {
@@ -542,31 +593,43 @@ bool ITSThresholdCalibrator::findThresholdFit(
     return false;
   }
 
+  // Gather the points inside the fit range into local buffers (same range as the
+  // previously used TF1) and fit them analytically, without any shared ROOT object
+  const float fitMin = (this->mScanType == 'T' || this->mScanType == 'r') ? 3 : mMin;
+  const float fitMax = (this->mScanType == 'r') ? mMax2 : mMax;
+  std::vector<float> xFit, yFit;
+  xFit.reserve(NPoints);
+  yFit.reserve(NPoints);
   for (int i = 0; i < NPoints; i++) {
-    this->mFitHist->SetBinContent(i + 1, mScanType != 'r' ? data[iloop2][i] : data[i][iloop2]);
+    if (x[i] < fitMin || x[i] > fitMax) {
+      continue;
+    }
+    xFit.push_back(x[i]);
+    yFit.push_back(mScanType != 'r' ? data[iloop2][i] : data[i][iloop2]);
   }
 
-  // Initialize starting parameters
-  this->mFitFunction->SetParameter(0, start);
-  this->mFitFunction->SetParameter(1, 8);
+  float chi2 = 0.;
+  if (!fitErfAnalytic(xFit, yFit, flip, start, thresh, noise, chi2)) {
+    if (this->mVerboseOutput) {
+      LOG(warning) << "S-curve fit unsuccessful for chip " << chipID;
+    }
+    return false;
+  }
 
-  this->mFitHist->Fit("mFitFunction", "RQL");
   if (isDumpS && (dumpCounterS[chipID] < maxDumpS || maxDumpS < 0) && (fndVal != chipDumpList.end() || !chipDumpList.size())) { // save good s-curves
+    for (int i = 0; i < NPoints; i++) {
+      this->mFitHist->SetBinContent(i + 1, mScanType != 'r' ? data[iloop2][i] : data[i][iloop2]);
+    }
     fileDumpS->cd();
     mFitHist->Write();
+    this->mFitHist->Reset();
   }
   if (isDumpS) {
     dumpCounterS[chipID]++;
   }
 
-  noise = this->mFitFunction->GetParameter(1);
-  thresh = this->mFitFunction->GetParameter(0);
-  float chi2 = this->mFitFunction->GetChisquare() / this->mFitFunction->GetNDF();
   spoints = upper - lower - 1;
 
-  // Clean up histogram for next time it is used
-  this->mFitHist->Reset();
-
   return (chi2 < 5);
 }
 
@@ -1079,17 +1142,9 @@ void ITSThresholdCalibrator::setRunType(const short int& runtype)
 
   // Initialize objects for doing the threshold fits
   if (this->mFitType == FIT) {
-    // Initialize the histogram used for error function fits
-    // Will initialize the TF1 in setRunType (it is different for different runs)
+    // Initialize the histogram used for dumping the s-curves
     this->mFitHist = new TH1F(
       "mFitHist", "mFitHist", mScanType == 'r' ? N_RANGE2 : N_RANGE, mX[0] - 1., mX[(mScanType == 'r' ? N_RANGE2 : N_RANGE) - 1]);
-
-    // Initialize correct fit function for the scan type
-    this->mFitFunction = (this->mScanType == 'I')
-                           ? new TF1("mFitFunction", erf_ithr, mMin, mMax, 2)
-                           : new TF1("mFitFunction", erf, (mScanType == 'T' || mScanType == 'r') ? 3 : mMin, mScanType == 'r' ? mMax2 : mMax, 2);
-    this->mFitFunction->SetParName(0, "Threshold");
-    this->mFitFunction->SetParName(1, "Noise");
   }
 
   return;
@@ -32,6 +32,10 @@ void customize(std::vector<o2::framework::CompletionPolicy>& policies)
   // ordered policies for the writers
   policies.push_back(CompletionPolicyHelpers::consumeWhenAllOrdered(".*(?:ITS|its).*[W,w]riter.*"));
   policies.push_back(CompletionPolicyHelpers::consumeWhenAllOrdered(".*irframe-writer.*"));
+  if (getenv("O2_ITS_TRACKER_STREAMING") && atoi(getenv("O2_ITS_TRACKER_STREAMING"))) {
+    // dispatch the tracker as soon as the cluster data are in, without stalling on trigger inputs from slower devices
+    policies.push_back(CompletionPolicyHelpers::consumeWhenEssential(".*its-tracker.*", "compClusters|patterns|ROframes"));
+  }
 }
 
 void customize(std::vector<o2::framework::ConfigParamSpec>& workflowOptions)
@@ -42,7 +42,7 @@ constexpr int DefRDHVersion = o2::raw::RDHUtils::getVersion<o2::header::RAWDataH
 
 void setupLinks(o2::itsmft::MC2RawEncoder<MAP>& m2r, std::string_view outDir, std::string_view outPrefix, std::string_view fileFor);
 void digi2raw(std::string_view inpName, std::string_view outDir, std::string_view fileFor, int verbosity, uint32_t rdhV = DefRDHVersion, bool enablePadding = false,
-              bool noEmptyHBF = false, bool noEmptyROF = false, int superPageSizeInB = 1024 * 1024);
+              bool noEmptyHBF = false, bool noEmptyROF = false, int superPageSizeInB = 1024 * 1024, int nThreads = 1);
 
 int main(int argc, char** argv)
 {
@@ -64,6 +64,7 @@ int main(int argc, char** argv)
     add_option("enable-padding", bpo::value<bool>()->default_value(false)->implicit_value(true), "enable GBT word padding to 128 bits even for RDH V7");
     add_option("no-empty-hbf,e", bpo::value<bool>()->default_value(false)->implicit_value(true), "do not create empty HBF pages (except for HBF starting TF)");
     add_option("no-empty-rof", bpo::value<bool>()->default_value(false)->implicit_value(true), "do not create empty ROF blocks");
+    add_option("nthreads,n", bpo::value<int>()->default_value(1), "number of threads for conversion (if built with OpenMP)");
     add_option("hbfutils-config,u", bpo::value<std::string>()->default_value(std::string(o2::base::NameConf::DIGITIZATIONCONFIGFILE)), "config file for HBFUtils (or none)");
     add_option("configKeyValues", bpo::value<std::string>()->default_value(""), "comma-separated configKeyValues");
 
@@ -98,7 +99,9 @@ int main(int argc, char** argv)
            vm["rdh-version"].as<uint32_t>(),
            vm["enable-padding"].as<bool>(),
            vm["no-empty-hbf"].as<bool>(),
-           vm["no-empty-rof"].as<bool>());
+           vm["no-empty-rof"].as<bool>(),
+           1024 * 1024,
+           vm["nthreads"].as<int>());
   LOG(info) << "HBFUtils settings used for conversion:";
 
   o2::raw::HBFUtils::Instance().print();
@@ -106,7 +109,7 @@ int main(int argc, char** argv)
   return 0;
 }
 
-void digi2raw(std::string_view inpName, std::string_view outDir, std::string_view fileFor, int verbosity, uint32_t rdhV, bool enablePadding, bool noEmptyHBF, bool noEmptyROF, int superPageSizeInB)
+void digi2raw(std::string_view inpName, std::string_view outDir, std::string_view fileFor, int verbosity, uint32_t rdhV, bool enablePadding, bool noEmptyHBF, bool noEmptyROF, int superPageSizeInB, int nThreads)
 {
   TStopwatch swTot;
   swTot.Start();
@@ -159,6 +162,7 @@ void digi2raw(std::string_view inpName, std::string_view outDir, std::string_vie
   m2r.setContinuousReadout(grp->isDetContinuousReadOut(MAP::getDetID())); // must be set explicitly
   m2r.setDefaultSinkName(o2::utils::Str::concat_string(MAP::getName(), ".raw"));
   m2r.setMinMaxRUSW(ruSWMin, ruSWMax);
+  m2r.setNThreads(nThreads);
   m2r.getWriter().setSuperPageSize(superPageSizeInB);
   m2r.getWriter().useRDHVersion(rdhV);
   m2r.getWriter().useRDHDataFormat(enablePadding ? 0 : 2);
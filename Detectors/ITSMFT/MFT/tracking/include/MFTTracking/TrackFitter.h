@@ -74,10 +74,12 @@ class TrackFitter
   bool mVerbose = false;
 };
 
-// Functions to estimate momentum and charge from track curvature
+// Functions to estimate momentum and charge from track curvature.
+// They operate on fixed-size per-layer arrays to keep the seeding free of
+// heap allocations (it runs twice per track candidate).
 template <typename T>
 Double_t invQPtFromFCF(const T& track, Double_t bFieldZ, Double_t& chi2);
-Bool_t LinearRegression(Int_t nVal, std::vector<double>& xVal, std::vector<double>& yVal, std::vector<double>& yErr, Double_t& a, Double_t& ae, Double_t& b, Double_t& be);
+Bool_t LinearRegression(Int_t nVal, const std::array<double, constants::mft::LayersNumber>& xVal, const std::array<double, constants::mft::LayersNumber>& yVal, const std::array<double, constants::mft::LayersNumber>& yErr, Double_t& a, Double_t& ae, Double_t& b, Double_t& be);
 
 } // namespace mft
 } // namespace o2
@@ -403,28 +403,22 @@ Double_t invQPtFromFCF(const T& track, Double_t bFieldZ, Double_t& sigmainvqptsq
 
   const std::array<Float_t, constants::mft::LayersNumber>& xPositions = track.getXCoordinates();
   const std::array<Float_t, constants::mft::LayersNumber>& yPositions = track.getYCoordinates();
-  const std::array<Float_t, constants::mft::LayersNumber>& zPositions = track.getZCoordinates();
   const std::array<Float_t, constants::mft::LayersNumber>& SigmasX2 = track.getSigmasX2();
   const std::array<Float_t, constants::mft::LayersNumber>& SigmasY2 = track.getSigmasY2();
 
   // Fast Circle Fit (Hansroul, Jeremie, Savard, 1987)
+  // The working buffers are fixed-size stack arrays (one entry per MFT layer):
+  // this function runs twice per track candidate and heap allocations here
+  // dominated the seeding cost.
   auto nPoints = track.getNumberOfPoints();
-  std::vector<double> xVal(nPoints);
-  std::vector<double> yVal(nPoints);
-  std::vector<double> zVal(nPoints);
-  std::vector<double> xErr(nPoints);
-  std::vector<double> yErr(nPoints);
-  std::vector<double> uVal(nPoints);
-  std::vector<double> vVal(nPoints);
-  std::vector<double> vErr(nPoints);
-  std::vector<double> fweight(nPoints);
-  std::vector<double> Rn(nPoints);
-  std::vector<double> Pn(nPoints);
-  Double_t A, Aerr, B, Berr, x2, y2, invx2y2, a, b, r, sigmaRsq, u2, sigma;
-  Double_t F0, F1, F2, F3, F4, SumSRn, SumSPn, SumRn, SumUPn, SumRP;
-
-  SumSRn = SumSPn = SumRn = SumUPn = SumRP = 0.0;
-  F0 = F1 = F2 = F3 = F4 = 0.0;
+  std::array<double, constants::mft::LayersNumber> xVal;
+  std::array<double, constants::mft::LayersNumber> yVal;
+  std::array<double, constants::mft::LayersNumber> xErr;
+  std::array<double, constants::mft::LayersNumber> yErr;
+  std::array<double, constants::mft::LayersNumber> uVal;
+  std::array<double, constants::mft::LayersNumber> vVal;
+  std::array<double, constants::mft::LayersNumber> vErr;
+  Double_t A, Aerr, B, Berr, x2, y2, invx2y2, a, b, r;
 
   for (auto np = 0; np < nPoints; np++) {
     xErr[np] = SigmasX2[np];
@@ -436,7 +430,6 @@ Double_t invQPtFromFCF(const T& track, Double_t bFieldZ, Double_t& sigmainvqptsq
       xVal[np] = .00001;
       yVal[np] = 0.;
     }
-    zVal[np] = zPositions[np];
   }
   for (int i = 0; i < nPoints; i++) {
     x2 = xVal[i] * xVal[i];
@@ -459,7 +452,6 @@ Double_t invQPtFromFCF(const T& track, Double_t bFieldZ, Double_t& sigmainvqptsq
     b = 1. / (2. * A);
     a = -B * b;
     r = std::sqrt(a * a + b * b);
-    double_t invR = 1. / r;
 
     // pt --->
     Double_t invpt = 1. / (o2::constants::math::B2C * bFieldZ * r);
@@ -468,7 +460,7 @@ Double_t invQPtFromFCF(const T& track, Double_t bFieldZ, Double_t& sigmainvqptsq
     // rotate around the first point (0,0) to bring the last point
     // on the x axis (y = 0) and check the y sign of the rotated
     // center of the circle
-    Double_t x = xVal[nPoints - 1], y = yVal[nPoints - 1], z = zVal[nPoints - 1];
+    Double_t x = xVal[nPoints - 1], y = yVal[nPoints - 1];
     Double_t slope = TMath::ATan2(y, x);
     Double_t cosSlope = TMath::Cos(slope);
     Double_t sinSlope = TMath::Sin(slope);
@@ -486,7 +478,7 @@ Double_t invQPtFromFCF(const T& track, Double_t bFieldZ, Double_t& sigmainvqptsq
 }
 
 ////_________________________________________________________________________________________________
-Bool_t LinearRegression(Int_t nVal, std::vector<double>& xVal, std::vector<double>& yVal, std::vector<double>& yErr, Double_t& B, Double_t& Berr, Double_t& A, Double_t& Aerr)
+Bool_t LinearRegression(Int_t nVal, const std::array<double, constants::mft::LayersNumber>& xVal, const std::array<double, constants::mft::LayersNumber>& yVal, const std::array<double, constants::mft::LayersNumber>& yErr, Double_t& B, Double_t& Berr, Double_t& A, Double_t& Aerr)
 {
   // linear regression y = B * x + A
 
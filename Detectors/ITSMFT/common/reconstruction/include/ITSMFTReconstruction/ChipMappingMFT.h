@@ -61,7 +61,7 @@ struct MFTModuleMappingData {
 class ChipMappingMFT
 {
  public:
-  ChipMappingMFT();
+  ChipMappingMFT() = default;
   ~ChipMappingMFT() = default;
 
   static constexpr std::string_view getName() { return "MFT"; }
@@ -74,13 +74,13 @@ class ChipMappingMFT
   static constexpr Int_t getNRUs() { return NRUs; }
 
   ///< get FEEId of the RU (software id of the RU), read via given link
-  uint8_t FEEId2RUSW(uint16_t hw) const { return mFEEId2RUSW[hw & 0xff]; }
+  uint8_t FEEId2RUSW(uint16_t hw) const { return sMapData.FEEId2RUSW[hw & 0xff]; }
 
   ///< get HW id of the RU (software id of the RU)
-  uint16_t RUSW2FEEId(uint16_t sw, uint16_t linkID = 0) const { return ((linkID << 8) + mRUInfo[sw].idHW); }
+  uint16_t RUSW2FEEId(uint16_t sw, uint16_t linkID = 0) const { return ((linkID << 8) + sMapData.ruInfo[sw].idHW); }
 
   ///< compose FEEid for given stave (ru) relative to layer and link, see documentation in the constructor
-  uint16_t composeFEEId(uint16_t layer, uint16_t ruOnLayer, uint16_t link) const
+  static uint16_t composeFEEId(uint16_t layer, uint16_t ruOnLayer, uint16_t link)
   {
     // only one link is used
     // ruOnLayer is 0, 1, 2, 3 for half = 0
@@ -115,7 +115,7 @@ class ChipMappingMFT
   }
 
   ///< get info on sw RU
-  const RUInfo* getRUInfoFEEId(Int_t feeID) const { return &mRUInfo[FEEId2RUSW(feeID)]; }
+  const RUInfo* getRUInfoFEEId(Int_t feeID) const { return &sMapData.ruInfo[FEEId2RUSW(feeID)]; }
 
   ///< get number of chips served by single cable on given RU type
   uint8_t getGBTHeaderRUType(Int_t ruType, Int_t cableHW)
@@ -124,13 +124,13 @@ class ChipMappingMFT
   }
 
   ///< convert HW cable ID to its position on the ActiveLanes word in the GBT.header for given RU type
-  uint8_t cableHW2Pos(uint8_t ruType, uint8_t hwid) const { return mCableHW2Pos[ruType][hwid]; }
+  uint8_t cableHW2Pos(uint8_t ruType, uint8_t hwid) const { return sMapData.cableHW2Pos[ruType][hwid]; }
 
   ///< convert HW cable ID to SW ID for give RU type
-  uint8_t cableHW2SW(uint8_t ruType, uint8_t hwid) const { return hwid < mCableHW2SW[ruType].size() ? mCableHW2SW[ruType][hwid] : 0xff; }
+  uint8_t cableHW2SW(uint8_t ruType, uint8_t hwid) const { return hwid < sMapData.cableHW2SW[ruType].size() ? sMapData.cableHW2SW[ruType][hwid] : 0xff; }
 
   ///< convert cable iterator ID to its position on the ActiveLanes word in the GBT.header for given RU type
-  uint8_t cablePos(uint8_t ruType, uint8_t id) const { return mCablePos[ruType][id]; }
+  uint8_t cablePos(uint8_t ruType, uint8_t id) const { return sMapData.cablePos[ruType][id]; }
 
   ///< get chipID on module from chip global SW ID, cable SW ID and stave (RU) info
   uint16_t getLocalChipID(uint16_t globalID, int cableHW, const RUInfo& ruInfo) const
@@ -143,7 +143,7 @@ class ChipMappingMFT
   uint16_t getGlobalChipID(uint16_t chOnModuleHW, int cableHW, const RUInfo& ruInfo) const
   {
     auto chipOnRU = cableHW2SW(ruInfo.ruType, cableHW);
-    return mRUGlobalChipID[(int)(ruInfo.idSW)].at((int)(chipOnRU));
+    return sMapData.ruGlobalChipID[(int)(ruInfo.idSW)].at((int)(chipOnRU));
   }
 
   ///< convert HW id of chip in the module to SW ID (sequential ID on the module)
@@ -224,7 +224,7 @@ class ChipMappingMFT
   /// < with sequential ID SWID within the stave
   const ChipOnRUInfo* getChipOnRUInfo(Int_t ruType, Int_t chipOnRU) const
   {
-    return &mChipsInfo[mChipInfoEntryRU[ruType] + chipOnRU];
+    return &sMapData.chipsInfo[sMapData.chipInfoEntryRU[ruType] + chipOnRU];
   }
 
   static constexpr std::int16_t getRUDetectorField() { return 0x0; }
@@ -233,13 +233,13 @@ class ChipMappingMFT
   {
     uint32_t pattern = 0;
     for (Int_t i = 0; i < NRUCables; i++) {
-      pattern |= (0x1 << mCableHW2Pos[ruType][i]);
+      pattern |= (0x1 << sMapData.cableHW2Pos[ruType][i]);
     }
     return pattern;
   }
 
   ///< get info on sw RU
-  const RUInfo* getRUInfoSW(int ruSW) const { return &mRUInfo[ruSW]; }
+  const RUInfo* getRUInfoSW(int ruSW) const { return &sMapData.ruInfo[ruSW]; }
 
   ///< convert layer ID and RU sequential ID on Layer to absolute RU IDSW
   int getRUIDSW(int layer, int ruOnLayer) const
@@ -429,22 +429,24 @@ class ChipMappingMFT
   ///< number of chips per zone (RU)
   static constexpr std::array<int, NRUTypes> NChipsOnRUType{7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 18, 19, 14};
 
-  // info on chips info within the zone (RU)
-  std::array<ChipOnRUInfo, NChipsInfo> mChipsInfo;
-  Int_t mChipInfoEntryRU[NRUTypes];
-
-  /// info per zone (RU)
-  std::array<RUInfo, NRUs> mRUInfo;
-  std::vector<uint8_t> mFEEId2RUSW; // HW RU ID -> SW ID conversion
-
-  std::vector<uint8_t> mCableHW2SW[NRUs];       ///< table of cables HW to SW conversion for each RU type
-  std::vector<uint8_t> mCableHW2Pos[NRUs];      ///< table of cables positions in the ActiveLanes mask for each RU type
-  std::vector<uint8_t> mCablePos[NRUs];         ///< reverse table of cables positions in the ActiveLanes mask for each RU type
-  std::vector<uint8_t> mCableHWFirstChip[NRUs]; ///< 1st chip of module (relative to the 1st chip of the stave) served by each cable
-
-  std::array<std::vector<uint16_t>, NRUs> mRUGlobalChipID;
-
-  ClassDefNV(ChipMappingMFT, 1)
+  /// tables derived from the chip and module mapping, identical for all instances:
+  /// built once at library load instead of in every constructed mapping object
+  struct MappingData {
+    std::array<ChipOnRUInfo, NChipsInfo> chipsInfo{};  ///< info on chips within the zone (RU)
+    Int_t chipInfoEntryRU[NRUTypes]{};                 ///< entry of the 1st chip of each RU type in chipsInfo
+    std::array<RUInfo, NRUs> ruInfo{};                 ///< info per zone (RU)
+    std::vector<uint8_t> FEEId2RUSW;                   ///< HW RU ID -> SW ID conversion
+    std::vector<uint8_t> cableHW2SW[NRUs];             ///< table of cables HW to SW conversion for each RU type
+    std::vector<uint8_t> cableHW2Pos[NRUs];            ///< table of cables positions in the ActiveLanes mask for each RU type
+    std::vector<uint8_t> cablePos[NRUs];               ///< reverse table of cables positions in the ActiveLanes mask for each RU type
+    std::vector<uint8_t> cableHWFirstChip[NRUs];       ///< 1st chip of module (relative to the 1st chip of the stave) served by each cable
+    std::array<std::vector<uint16_t>, NRUs> ruGlobalChipID;
+  };
+
+  static MappingData buildMappingData();
+  static const MappingData sMapData;
+
+  ClassDefNV(ChipMappingMFT, 2)
 };
 } // namespace itsmft
 } // namespace o2
@@ -46,8 +46,26 @@ class LookUp
   auto getDictionaty() const { return mDictionary; }
 
  private:
+  static constexpr int CacheSize = 1024;         ///< number of slots of the direct-mapped topology cache, must be a power of 2
+  static constexpr int MaxCachedBytes = 8;       ///< only topologies with a bitmask up to this size are cached
+  static constexpr int MaxCachedTopologies = 128; ///< number of most frequent topologies entered in the cache
+
+  /// cached topology: the bounding box and the bitmask identify the topology uniquely,
+  /// so frequent topologies can be recognised with a byte comparison instead of the
+  /// full hash computation and map lookup
+  struct CacheEntry {
+    unsigned char rows = 0;
+    unsigned char cols = 0;
+    unsigned char patt[MaxCachedBytes] = {0};
+    int id = -1;
+  };
+
+  static unsigned int cacheIndex(int nRow, int nCol, const unsigned char* patt, int nBytes);
+  void fillTopologyCache();
+
   TopologyDictionary mDictionary;
   int mTopologiesOverThreshold;
+  std::array<CacheEntry, CacheSize> mTopologyCache; //!< direct-mapped cache of the most frequent topologies, rebuilt when the dictionary is set
 
   ClassDefNV(LookUp, 3);
 };
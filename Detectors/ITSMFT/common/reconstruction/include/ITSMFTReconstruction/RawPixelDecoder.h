@@ -151,6 +151,7 @@ class RawPixelDecoder final : public PixelReader
   std::vector<RUDecodeData> mRUDecodeVec;                                             // set of active RUs
   std::array<short, Mapping::getNRUs()> mRUEntry;                                     // entry of the RU with given SW ID in the mRUDecodeVec
   std::vector<ChipPixelData*> mOrderedChipsPtr;                                       // special ordering helper used for the MFT (its chipID is not contiguous in RU)
+  std::vector<std::pair<size_t, int>> mRUDecodeOrder;                                 // RUs ordered by pending cable data, to decode the heavy ones first
   std::vector<PhysTrigger> mExtTriggers;                                              // external triggers
   GBTLink* mLinkForTriggers = nullptr;                                                // link assigned to collect the triggers
   std::string mSelfName{};                                                            // self name
@@ -1620,12 +1620,13 @@ const std::array<MFTModuleMappingData, ChipMappingMFT::NModules> ChipMappingMFT:
 }};
 
 //_____________________________________________________________________________
-ChipMappingMFT::ChipMappingMFT()
+ChipMappingMFT::MappingData ChipMappingMFT::buildMappingData()
 {
-  // init chips info
+  // build the tables derived from the chip and module mapping, shared by all instances
+  MappingData md;
 
   uint32_t maxRUHW = composeFEEId(NLayers - 1, NZonesPerLayer - 1, NLinks - 1); // Max possible FEE ID
-  mFEEId2RUSW.resize(maxRUHW + 1, 0xff);
+  md.FEEId2RUSW.resize(maxRUHW + 1, 0xff);
 
   int curLayer = -1, curZone = -1, curHalf = -1;
   int chipsOnRUType[NRUTypes]{0};
@@ -1650,18 +1651,18 @@ ChipMappingMFT::ChipMappingMFT()
         curLayer = layer;
         curZone = zone;
         curHalf = half;
-        mChipInfoEntryRU[iRU] = ctrChip;
-        mCableHW2SW[iRU].resize(NRUCables, 0xff);
-        mCableHW2Pos[iRU].resize(NRUCables, 0xff);
-        mCablePos[iRU].resize(NRUCables, 0xff);
-        mCableHWFirstChip[iRU].resize(NRUCables, 0xff);
+        md.chipInfoEntryRU[iRU] = ctrChip;
+        md.cableHW2SW[iRU].resize(NRUCables, 0xff);
+        md.cableHW2Pos[iRU].resize(NRUCables, 0xff);
+        md.cablePos[iRU].resize(NRUCables, 0xff);
+        md.cableHWFirstChip[iRU].resize(NRUCables, 0xff);
       } else {
         if ((layer != curLayer) || (zone != curZone) || (half != curHalf)) {
           continue;
         }
       }
 
-      auto& chInfo = mChipsInfo[mChipInfoEntryRU[iRU] + chipOnRU];
+      auto& chInfo = md.chipsInfo[md.chipInfoEntryRU[iRU] + chipOnRU];
 
       chInfo.id = chipOnRU;
 
@@ -1682,10 +1683,10 @@ ChipMappingMFT::ChipMappingMFT()
 
       chInfo.chipOnCable = 0;
 
-      mCablePos[iRU][chInfo.id] = chInfo.cableHWPos;
-      mCableHW2Pos[iRU][chInfo.cableHW] = chInfo.cableHWPos;
-      mCableHW2SW[iRU][chInfo.cableHW] = chInfo.cableSW;
-      mCableHWFirstChip[iRU][chInfo.cableHW] = 0;
+      md.cablePos[iRU][chInfo.id] = chInfo.cableHWPos;
+      md.cableHW2Pos[iRU][chInfo.cableHW] = chInfo.cableHWPos;
+      md.cableHW2SW[iRU][chInfo.cableHW] = chInfo.cableSW;
+      md.cableHWFirstChip[iRU][chInfo.cableHW] = 0;
 
       ++ctrChip;
       ++chipsOnRUType[iRU];
@@ -1695,12 +1696,12 @@ ChipMappingMFT::ChipMappingMFT()
   int ctrRU = 0;
   for (int iLayer = 0; iLayer < NLayers; ++iLayer) {
     for (int iZone = 0; iZone < NZonesPerLayer; ++iZone) {
-      auto& ruInfo = mRUInfo[ctrRU];
+      auto& ruInfo = md.ruInfo[ctrRU];
       ruInfo.idSW = ctrRU++;
 
       // map FEEIds (RU read out by at most 3 GBT links) to SW ID
       ruInfo.idHW = composeFEEId(iLayer, iZone, 0); // FEEId for link 0
-      mFEEId2RUSW[ruInfo.idHW] = ruInfo.idSW;
+      md.FEEId2RUSW[ruInfo.idHW] = ruInfo.idSW;
       ruInfo.layer = iLayer;
       ruInfo.ruType = ZoneRUType[iZone % 4][iLayer / 2];
       ruInfo.nCables = NChipsOnRUType[ruInfo.ruType];
@@ -1720,17 +1721,21 @@ ChipMappingMFT::ChipMappingMFT()
                       << "\n";
             continue;
           }
-          if (mRUGlobalChipID[ruInfo.idSW].empty()) {
-            mRUGlobalChipID[ruInfo.idSW].resize(NChipsOnRUType[ruType]);
+          if (md.ruGlobalChipID[ruInfo.idSW].empty()) {
+            md.ruGlobalChipID[ruInfo.idSW].resize(NChipsOnRUType[ruType]);
             ruInfo.firstChipIDSW = iChip;
           }
-          mRUGlobalChipID[(int)(ruInfo.idSW)].at((int)(chipOnRU)) = iChip;
+          md.ruGlobalChipID[(int)(ruInfo.idSW)].at((int)(chipOnRU)) = iChip;
         }
       }
     }
   }
+  return md;
 }
 
+// built after ChipMappingData and ModuleMappingData above, which it depends on
+const ChipMappingMFT::MappingData ChipMappingMFT::sMapData = ChipMappingMFT::buildMappingData();
+
 //_____________________________________________________________________________
 void ChipMappingMFT::print() const
 {
@@ -17,6 +17,9 @@
 #include "ITSMFTReconstruction/LookUp.h"
 #include "DataFormatsITSMFT/CompCluster.h"
 
+#include <algorithm>
+#include <cstring>
+
 ClassImp(o2::itsmft::LookUp);
 
 using std::array;
@@ -37,6 +40,7 @@ void LookUp::loadDictionary(std::string fileName)
 {
   mDictionary.readFromFile(fileName);
   mTopologiesOverThreshold = mDictionary.mCommonMap.size();
+  fillTopologyCache();
 }
 
 void LookUp::setDictionary(const TopologyDictionary* dict)
@@ -45,6 +49,58 @@ void LookUp::setDictionary(const TopologyDictionary* dict)
     mDictionary = *dict;
   }
   mTopologiesOverThreshold = mDictionary.mCommonMap.size();
+  fillTopologyCache();
+}
+
+unsigned int LookUp::cacheIndex(int nRow, int nCol, const unsigned char* patt, int nBytes)
+{
+  unsigned int h = 2166136261u; // FNV-1a over the bounding box and the bitmask
+  h = (h ^ (unsigned int)nRow) * 16777619u;
+  h = (h ^ (unsigned int)nCol) * 16777619u;
+  for (int i = 0; i < nBytes; ++i) {
+    h = (h ^ (unsigned int)patt[i]) * 16777619u;
+  }
+  return h & (CacheSize - 1);
+}
+
+void LookUp::fillTopologyCache()
+{
+  mTopologyCache.fill({});
+  // collect the unique big topologies (the small ones are resolved via mSmallTopologiesLUT)
+  // and enter the most frequent ones into the cache first, so that they win the slot in
+  // case of a direct-mapping collision
+  std::vector<int> ids;
+  for (int id{0}; id < mDictionary.getSize(); ++id) {
+    if (mDictionary.isGroup(id)) {
+      continue;
+    }
+    const auto& bitmap = mDictionary.getPattern(id).getPattern();
+    const int nBits = (int)bitmap[0] * (int)bitmap[1];
+    const int nBytes = (nBits >> 3) + ((nBits & 0x7) != 0);
+    if (nBits < 9 || nBytes > MaxCachedBytes) {
+      continue;
+    }
+    ids.push_back(id);
+  }
+  std::sort(ids.begin(), ids.end(), [this](int a, int b) { return mDictionary.getFrequency(a) > mDictionary.getFrequency(b); });
+  int nCached{0};
+  for (auto id : ids) {
+    if (nCached >= MaxCachedTopologies) {
+      break;
+    }
+    const auto& bitmap = mDictionary.getPattern(id).getPattern();
+    const int nBits = (int)bitmap[0] * (int)bitmap[1];
+    const int nBytes = (nBits >> 3) + ((nBits & 0x7) != 0);
+    auto& entry = mTopologyCache[cacheIndex(bitmap[0], bitmap[1], bitmap.data() + 2, nBytes)];
+    if (entry.rows != 0) { // the slot is taken by a more frequent topology
+      continue;
+    }
+    entry.rows = bitmap[0];
+    entry.cols = bitmap[1];
+    std::memcpy(entry.patt, bitmap.data() + 2, nBytes);
+    entry.id = id;
+    nCached++;
+  }
 }
 
 int LookUp::groupFinder(int nRow, int nCol)
@@ -75,6 +131,13 @@ int LookUp::findGroupID(int nRow, int nCol, const unsigned char patt[ClusterPatt
       return ID;
     }
   } else { // Big unique topology
+    const int nBytes = (nBits >> 3) + ((nBits & 0x7) != 0);
+    if (nBytes <= MaxCachedBytes) { // frequent topology, cheap comparison against the cache
+      const auto& entry = mTopologyCache[cacheIndex(nRow, nCol, patt, nBytes)];
+      if (entry.rows == nRow && entry.cols == nCol && std::memcmp(entry.patt, patt, nBytes) == 0) {
+        return entry.id;
+      }
+    }
     unsigned long hash = ClusterTopology::getCompleteHash(nRow, nCol, patt);
     auto ret = mDictionary.mCommonMap.find(hash);
     if (ret != mDictionary.mCommonMap.end()) {
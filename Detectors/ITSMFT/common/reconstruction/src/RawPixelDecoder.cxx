@@ -20,7 +20,9 @@
 #include "Framework/DataRefUtils.h"
 #include "CommonUtils/StringUtils.h"
 #include "CommonUtils/VerbosityConfig.h"
+#include <algorithm>
 #include <filesystem>
+#include <functional>
 
 #ifdef WITH_OPENMP
 #include <omp.h>
@@ -102,11 +104,31 @@ int RawPixelDecoder<Mapping>::decodeNextTrigger()
     }
 
 #ifdef WITH_OPENMP
+    // with the dynamic schedule the iterations are handed out in order: process the RUs
+    // with most pending cable data first, so that the heavily loaded staves (inner barrel)
+    // do not arrive last and leave the other threads idle
+    if (mNThreads > 1) {
+      mRUDecodeOrder.resize(nru);
+      for (int iru = 0; iru < nru; iru++) {
+        const auto& ru = mRUDecodeVec[iru];
+        size_t pending = 0;
+        const int ncab = ru.ruInfo ? ru.ruInfo->nCables : 0;
+        for (int icab = 0; icab < ncab; icab++) {
+          pending += ru.cableData[icab].getUnusedSize();
+        }
+        mRUDecodeOrder[iru] = {pending, iru};
+      }
+      std::sort(mRUDecodeOrder.begin(), mRUDecodeOrder.end(), std::greater<>());
+    }
 #pragma omp parallel for schedule(dynamic) num_threads(mNThreads) reduction(+ \
                                                                             : mNChipsFiredROF, mNPixelsFiredROF)
 #endif
     for (int iru = 0; iru < nru; iru++) {
+#ifdef WITH_OPENMP
+      auto& ru = mRUDecodeVec[mNThreads > 1 ? mRUDecodeOrder[iru].second : iru];
+#else
       auto& ru = mRUDecodeVec[iru];
+#endif
       if (ru.nNonEmptyLinks) {
         ru.ROFRampUpStage = mROFRampUpStage;
         mNPixelsFiredROF += ru.decodeROF(mMAP, mInteractionRecord, mVerifyDecoder);
@@ -21,7 +21,7 @@
 #include "ITSMFTBase/SegmentationAlpide.h"
 #include "ITSMFTSimulation/PreDigit.h"
 #include "DataFormatsITSMFT/NoiseMap.h"
-#include <map>
+#include <unordered_map>
 #include <vector>
 
 namespace o2
@@ -42,7 +42,7 @@ class ChipDigitsContainer
   /// Destructor
   ~ChipDigitsContainer() = default;
 
-  std::map<ULong64_t, o2::itsmft::PreDigit>& getPreDigits() { return mDigits; }
+  std::unordered_map<ULong64_t, o2::itsmft::PreDigit>& getPreDigits() { return mDigits; }
   bool isEmpty() const { return mDigits.empty(); }
   void setNoiseMap(const o2::itsmft::NoiseMap* mp) { mNoiseMap = mp; }
   void setDeadChanMap(const o2::itsmft::NoiseMap* mp) { mDeadChanMap = mp; }
@@ -53,6 +53,12 @@ class ChipDigitsContainer
   void addDigit(ULong64_t key, UInt_t roframe, UShort_t row, UShort_t col, int charge, o2::MCCompLabel lbl);
   void addNoise(UInt_t rofMin, UInt_t rofMax, const o2::itsmft::DigiParams* params, int maxRows = o2::itsmft::SegmentationAlpide::NRows, int maxCols = o2::itsmft::SegmentationAlpide::NCols);
 
+  /// Move the pre-digits with ordering key up to maxKey (i.e. of the RO frames to be flushed)
+  /// to the provided vector in increasing key order and remove them from the container.
+  /// The accumulation is hash-based (unordered), the readout order is restored here by a
+  /// single sort pass per flush instead of keeping the container sorted at every insertion.
+  void extract(ULong64_t maxKey, std::vector<o2::itsmft::PreDigit>& out);
+
   /// Get global ordering key made of readout frame, column and row
   static ULong64_t getOrderingKey(UInt_t roframe, UShort_t row, UShort_t col)
   {
@@ -73,9 +79,10 @@ class ChipDigitsContainer
   bool mDisabled = false;
   const o2::itsmft::NoiseMap* mNoiseMap = nullptr;
   const o2::itsmft::NoiseMap* mDeadChanMap = nullptr;
-  std::map<ULong64_t, o2::itsmft::PreDigit> mDigits; ///< Map of fired pixels, possibly in multiple frames
+  std::unordered_map<ULong64_t, o2::itsmft::PreDigit> mDigits; ///< Map of fired pixels, possibly in multiple frames
+  std::vector<ULong64_t> mSortedKeys;                          //!< scratch buffer to order the keys at flush time
 
-  ClassDefNV(ChipDigitsContainer, 1);
+  ClassDefNV(ChipDigitsContainer, 2);
 };
 
 //_______________________________________________________________________
@@ -73,6 +73,9 @@ class MC2RawEncoder
   int getRUSWMin() const { return mRUSWMin; }
   int getRUSWMax() const { return mRUSWMax; }
 
+  void setNThreads(int n) { mNThreads = n > 1 ? n : 1; }
+  int getNThreads() const { return mNThreads; }
+
   void setContinuousReadout(bool v) { mWriter.setContinuousReadout(v); }
   bool isContinuousReadout() const { return mWriter.isContinuousReadout(); }
 
@@ -104,8 +107,9 @@ class MC2RawEncoder
   const GBTLink* getGBTLink(int i) const { return i < 0 ? nullptr : &mGBTLinks[i]; }
 
  private:
-  void convertEmptyChips(int fromChip, int uptoChip, RUDecodeData& ru);
-  void convertChip(ChipPixelData& chipData, RUDecodeData& ru);
+  void convertRU(RUDecodeData& ru, Coder& coder);
+  void convertEmptyChips(int fromChip, int uptoChip, RUDecodeData& ru, Coder& coder);
+  void convertChip(ChipPixelData& chipData, RUDecodeData& ru, Coder& coder);
   void fillGBTLinks(RUDecodeData& ru);
 
   enum RoMode_t { NotSet,
@@ -117,6 +121,7 @@ class MC2RawEncoder
   Mapping mMAP;
   Coder mCoder;
   int mVerbosity = 0;                                        //! verbosity level
+  int mNThreads = 1;                                         //! number of threads for the per-RU conversion
   uint8_t mRUSWMin = 0;                                      ///< min RU (SW) to convert
   uint8_t mRUSWMax = 0xff;                                   ///< max RU (SW) to convert
   int mNRUs = 0;                                             /// total number of RUs seen
@@ -17,6 +17,7 @@
 #include "ITSMFTSimulation/ChipDigitsContainer.h"
 #include "ITSMFTSimulation/DigiParams.h"
 #include <TRandom.h>
+#include <algorithm>
 
 using namespace o2::itsmft;
 using Segmentation = o2::itsmft::SegmentationAlpide;
@@ -53,3 +54,22 @@ void ChipDigitsContainer::addNoise(UInt_t rofMin, UInt_t rofMax, const o2::itsmf
     }
   }
 }
+
+//______________________________________________________________________
+void ChipDigitsContainer::extract(ULong64_t maxKey, std::vector<o2::itsmft::PreDigit>& out)
+{
+  // move pre-digits with key up to maxKey to the output in increasing key order
+  mSortedKeys.clear();
+  for (const auto& entry : mDigits) {
+    if (entry.first <= maxKey) {
+      mSortedKeys.push_back(entry.first);
+    }
+  }
+  std::sort(mSortedKeys.begin(), mSortedKeys.end());
+  out.reserve(out.size() + mSortedKeys.size());
+  for (auto key : mSortedKeys) {
+    auto entry = mDigits.find(key);
+    out.push_back(entry->second);
+    mDigits.erase(entry);
+  }
+}
@@ -198,6 +198,7 @@ void Digitizer::fillOutputContainer(uint32_t frameLast)
             << frameLast;
 
   o2::itsmft::ROFRecord rcROF;
+  std::vector<o2::itsmft::PreDigit> preDigits; // digits of the flushed frame, ordered at extraction
 
   // we have to write chips in RO increasing order, therefore have to loop over the frames here
   for (; mROFrameMin <= frameLast; mROFrameMin++) {
@@ -210,18 +211,13 @@ void Digitizer::fillOutputContainer(uint32_t frameLast)
         continue;
       }
       chip.addNoise(mROFrameMin, mROFrameMin, &mParams);
-      auto& buffer = chip.getPreDigits();
-      if (buffer.empty()) {
+      if (chip.isEmpty()) {
         continue;
       }
-      auto itBeg = buffer.begin();
-      auto iter = itBeg;
       ULong64_t maxKey = chip.getOrderingKey(mROFrameMin + 1, 0, 0) - 1; // fetch digits with key below that
-      for (; iter != buffer.end(); ++iter) {
-        if (iter->first > maxKey) {
-          break; // is the digit ROFrame from the key > the max requested frame
-        }
-        auto& preDig = iter->second; // preDigit
+      preDigits.clear();
+      chip.extract(maxKey, preDigits);
+      for (auto& preDig : preDigits) {
         if (preDig.charge >= mParams.getChargeThreshold()) {
           int digID = mDigits->size();
           mDigits->emplace_back(chip.getChipIndex(), preDig.row, preDig.col, preDig.charge);
@@ -233,7 +229,6 @@ void Digitizer::fillOutputContainer(uint32_t frameLast)
           }
         }
       }
-      buffer.erase(itBeg, iter);
     }
     // finalize ROF record
     rcROF.setNEntries(mDigits->size() - rcROF.getFirstEntry()); // number of digits
@@ -54,7 +54,9 @@ struct ClusterConfig {
   //
   // Algorithm choices
   //
-  int useSpline = 0;
+  // Evaluate the Mathieson integrals with the cubic-spline interpolation of the
+  // primitive (built once at init) instead of the analytic tanh/atan form
+  int useSpline = 1;
   // Logs
   //
   enum VerboseMode {
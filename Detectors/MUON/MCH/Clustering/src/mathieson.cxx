@@ -298,6 +298,15 @@ void compute1DPadIntegrals(const double* xyInf, const double* xySup, int N,
 {
   // Returning array: Charge Integral on all the pads
   //
+  if (useSpline) {
+    double lBoundPrim[N], uBoundPrim[N];
+    splineMathiesonPrimitive(xyInf, N, axe, chamberId, lBoundPrim);
+    splineMathiesonPrimitive(xySup, N, axe, chamberId, uBoundPrim);
+    for (int i = 0; i < N; i++) {
+      Integrals[i] = uBoundPrim[i] - lBoundPrim[i];
+    }
+    return;
+  }
   mathiesonType = (chamberId <= 2) ? 0 : 1;
 
   //
@@ -443,13 +452,21 @@ void computeCompressed2DPadIntegrals(
   // x Translation (seed location)
   vectorAddScalar(compressedPads->xCompressed, -xShift, nXc, xy);
   // Primitives on compressed pads
-  mathiesonPrimitive(xy, nXc, axe, chamberId, xPrimitives);
+  if (useSpline) {
+    splineMathiesonPrimitive(xy, nXc, axe, chamberId, xPrimitives);
+  } else {
+    mathiesonPrimitive(xy, nXc, axe, chamberId, xPrimitives);
+  }
   // Y axe
   axe = 1;
   // x Translation (seed location)
   vectorAddScalar(compressedPads->yCompressed, -yShift, nYc, xy);
   // Primitives on compressed pads
-  mathiesonPrimitive(xy, nYc, axe, chamberId, yPrimitives);
+  if (useSpline) {
+    splineMathiesonPrimitive(xy, nYc, axe, chamberId, yPrimitives);
+  } else {
+    mathiesonPrimitive(xy, nYc, axe, chamberId, yPrimitives);
+  }
 
   // Compute all the integrals
   int* mapXInf = compressedPads->mapXInf;
@@ -471,126 +488,40 @@ void compute2DPadIntegrals(const double* xInf, const double* xSup,
                            const double* yInf, const double* ySup, int N,
                            int chamberId, double Integrals[])
 {
-  if (1) {
-    int mapXInf[N], mapXSup[N];
-    int mapYInf[N], mapYSup[N];
-    double xy[2 * N];
-    // Primitives on x axe
-    int nXc = compressSameValues(xInf, xSup, mapXInf, mapXSup, N, xy);
-    // vectorPrint("x map", xy, nXc);
-    int axe = 0;
-    double xPrimitives[nXc];
+  int mapXInf[N], mapXSup[N];
+  int mapYInf[N], mapYSup[N];
+  double xy[2 * N];
+  // Primitives on x axe
+  int nXc = compressSameValues(xInf, xSup, mapXInf, mapXSup, N, xy);
+  // vectorPrint("x map", xy, nXc);
+  int axe = 0;
+  double xPrimitives[nXc];
+  if (useSpline) {
+    splineMathiesonPrimitive(xy, nXc, axe, chamberId, xPrimitives);
+  } else {
     mathiesonPrimitive(xy, nXc, axe, chamberId, xPrimitives);
-    // Primitives on y axe
-    int nYc = compressSameValues(yInf, ySup, mapYInf, mapYSup, N, xy);
-    // vectorPrint("y map", xy, nYc);
-    double yPrimitives[nYc];
-    axe = 1;
-    mathiesonPrimitive(xy, nYc, axe, chamberId, yPrimitives);
-
-    for (int i = 0; i < N; i++) {
-      Integrals[i] = (xPrimitives[mapXSup[i]] - xPrimitives[mapXInf[i]]) * (yPrimitives[mapYSup[i]] - yPrimitives[mapYInf[i]]);
-      // printf(" i=%d mapXInf=%d mapXSup=%d mapYInf=%d mapYSup=%d xyIntegrals=%f, %f \n", i,
-      //        mapXInf[i], mapXSup[i], mapYInf[i], mapYSup[i], xPrimitives[mapXSup[i]] - xPrimitives[mapXInf[i]],
-      //        yPrimitives[mapYSup[i]] - yPrimitives[mapYInf[i]]);
-    }
-
-    // vectorPrint("xPrimitives", xPrimitives, nXc);
-    // vectorPrint("yPrimitives", yPrimitives, nYc);
-
+  }
+  // Primitives on y axe
+  int nYc = compressSameValues(yInf, ySup, mapYInf, mapYSup, N, xy);
+  // vectorPrint("y map", xy, nYc);
+  double yPrimitives[nYc];
+  axe = 1;
+  if (useSpline) {
+    splineMathiesonPrimitive(xy, nYc, axe, chamberId, yPrimitives);
   } else {
+    mathiesonPrimitive(xy, nYc, axe, chamberId, yPrimitives);
+  }
 
-    if (useSpline) {
-      double lBoundPrim[N], uBoundPrim[N], xIntegrals[N], yIntegrals[N];
-      int axe = 0;
-      // mathiesonPrimitive(xInf, N, axe, chamberId, lBoundPrim);
-      splineMathiesonPrimitive(xInf, N, axe, chamberId, lBoundPrim);
-      // mathiesonPrimitive(xSup, N, axe, chamberId, uBoundPrim);
-      splineMathiesonPrimitive(xSup, N, axe, chamberId, uBoundPrim);
-      vectorAddVector(uBoundPrim, -1.0, lBoundPrim, N, xIntegrals);
-      // vectorPrint("xIntegrals analytics ", xIntegrals, N);
-      for (int i = 0; i < N; i++) {
-        if (xIntegrals[i] < 0.0) {
-          printf("??? %d x (%f %f) lInt=%f uInt%f xInt=%f\n", i, xInf[i], xSup[i], lBoundPrim[i], uBoundPrim[i], xIntegrals[i]);
-          throw std::out_of_range(
-            "[findLocalMaxWithPEM] ????");
-        }
-      }
-      axe = 1;
-      // mathiesonPrimitive(yInf, N, axe, chamberId, lBoundPrim);
-      splineMathiesonPrimitive(yInf, N, axe, chamberId, lBoundPrim);
-      // mathiesonPrimitive(ySup, N, axe, chamberId, uBoundPrim);
-      splineMathiesonPrimitive(ySup, N, axe, chamberId, uBoundPrim);
-      vectorAddVector(uBoundPrim, -1.0, lBoundPrim, N, yIntegrals);
-      // vectorPrint("yIntegrals analytics ", yIntegrals, N);
-      vectorMultVector(xIntegrals, yIntegrals, N, Integrals);
-      // Invald ????
-
-      for (int i = 0; i < N; i++) {
-        if (yIntegrals[i] < 0.0) {
-          printf("??? %d y (%f %f) lInt=%f uInt%f yInt=%f\n", i, yInf[i], ySup[i], lBoundPrim[i], uBoundPrim[i], yIntegrals[i]);
-          throw std::out_of_range(
-            "[findLocalMaxWithPEM] ????");
-        }
-      } // vectorPrint("Integrals analytics", Integrals, N);
-
-      /* ??????????????????????
-      axe = 0;
-      splineMathiesonPrimitive( xInf, N, axe, chamberId, lBoundPrim );
-      // vectorPrint("x lBoundPrim spline ", lBoundPrim, N);
-      splineMathiesonPrimitive( xSup, N, axe, chamberId, uBoundPrim );
-      vectorAddVector( uBoundPrim, -1.0, lBoundPrim, N, xIntegrals);
-      // vectorPrint("xIntegrals spline", xIntegrals, N);
-      axe = 1;
-      splineMathiesonPrimitive( yInf, N, axe, chamberId, lBoundPrim );
-      splineMathiesonPrimitive( ySup, N, axe, chamberId, uBoundPrim );
-      vectorAddVector( uBoundPrim, -1.0, lBoundPrim, N, yIntegrals);
-
-      // vectorPrint("yIntegrals spline", yIntegrals, N);
-      */
+  for (int i = 0; i < N; i++) {
+    Integrals[i] = (xPrimitives[mapXSup[i]] - xPrimitives[mapXInf[i]]) * (yPrimitives[mapYSup[i]] - yPrimitives[mapYInf[i]]);
+    // printf(" i=%d mapXInf=%d mapXSup=%d mapYInf=%d mapYSup=%d xyIntegrals=%f, %f \n", i,
+    //        mapXInf[i], mapXSup[i], mapYInf[i], mapYSup[i], xPrimitives[mapXSup[i]] - xPrimitives[mapXInf[i]],
+    //        yPrimitives[mapYSup[i]] - yPrimitives[mapYInf[i]]);
+  }
 
-      vectorMultVector(xIntegrals, yIntegrals, N, Integrals);
-      // vectorPrint("Integrals spline", Integrals, N);
+  // vectorPrint("xPrimitives", xPrimitives, nXc);
+  // vectorPrint("yPrimitives", yPrimitives, nYc);
 
-    } else {
-      // Returning array: Charge Integral on all the pads
-      //
-      if (chamberId <= 2) {
-        mathiesonType = 0;
-      } else {
-        mathiesonType = 1;
-      }
-      //
-      // Select Mathieson coef.
-      double curK2x = K2x[mathiesonType];
-      double curK2y = K2y[mathiesonType];
-      double curSqrtK3x = sqrtK3x[mathiesonType];
-      double curSqrtK3y = sqrtK3y[mathiesonType];
-      double curK4x = K4x[mathiesonType];
-      double curK4y = K4y[mathiesonType];
-      double curInvPitch = invPitch[mathiesonType];
-      double cst2x = curK2x * curInvPitch;
-      double cst2y = curK2y * curInvPitch;
-      double cst4 = 4.0 * curK4x * curK4y;
-      double uInf, uSup, vInf, vSup;
-
-      for (int i = 0; i < N; i++) {
-        // x/u
-        uInf = curSqrtK3x * tanh(cst2x * xInf[i]);
-        uSup = curSqrtK3x * tanh(cst2x * xSup[i]);
-        // y/v
-        vInf = curSqrtK3y * tanh(cst2y * yInf[i]);
-        vSup = curSqrtK3y * tanh(cst2y * ySup[i]);
-        //
-        Integrals[i] = cst4 * (atan(uSup) - atan(uInf)) * (atan(vSup) - atan(vInf));
-        // printf(" Ix=%10.6g Iy=%10.6g\n", 2*curK4x * (atan(uSup) - atan(uInf)),  2*curK4y * (atan(vSup) - atan(vInf)));
-        // printf(" xyInfSup %2d  [%10.6g, %10.6g] x [%10.6g, %10.6g]-> %10.6g * %10.6g = %10.6g\n",
-        // i, xInf[i], xSup[i], yInf[i], ySup[i], Integrals[i], 2.0 * curK4x*(atan(uSup) - atan(uInf)), 2.0 * curK4y*(atan(vSup) - atan(vInf)) ) ;
-      }
-      // printf(" I[0..%3ld] = %f, %f, ... %f\n", N-1, Integrals[0], Integrals[1],
-      // Integrals[N-1]);
-    }
-  }
   // CHECK
   if (clusterConfig.mathiesonCheck) {
     checkIntegrals(xInf, xSup, yInf, ySup, Integrals, chamberId, N);
@@ -55,6 +55,11 @@ class PreClusterFinder
 
   int run();
 
+  /// set the number of threads used to preclusterize the DEs (if built with OpenMP)
+  void setNThreads(int n) { mNThreads = n > 1 ? n : 1; }
+  /// return the number of threads used to preclusterize the DEs
+  int getNThreads() const { return mNThreads; }
+
   void getPreClusters(std::vector<o2::mch::PreCluster>& preClusters, std::vector<Digit>& digits);
 
   /// return the counting of encountered errors
@@ -73,10 +78,10 @@ class PreClusterFinder
 
   void reset(int deIndex);
 
-  void preClusterizeRecursive();
+  void preClusterizeRecursive(int deIndex);
   void addPad(DetectionElement& de, uint16_t iPad, PreCluster& cluster);
 
-  int mergePreClusters();
+  int mergePreClusters(int deIndex);
   void mergePreClusters(PreCluster& cluster, std::vector<std::unique_ptr<PreCluster>> preClusters[2],
                         int nPreClusters[2], DetectionElement& de, int iPlane, PreCluster*& mergedCluster);
   PreCluster* usePreClusters(PreCluster* cluster, DetectionElement& de);
@@ -94,6 +99,8 @@ class PreClusterFinder
   int mNPreClusters[SNDEs][2]{};                                     ///< number of preclusters in each cathods of each DE
   std::vector<std::unique_ptr<PreCluster>> mPreClusters[SNDEs][2]{}; ///< preclusters in each cathods of each DE
 
+  int mNThreads = 1; ///< number of threads used to preclusterize the DEs
+
   ErrorMap mErrorMap{}; ///< counting of encountered errors
 };
 
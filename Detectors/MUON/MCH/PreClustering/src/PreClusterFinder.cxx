@@ -203,9 +203,18 @@ int PreClusterFinder::discardHighOccupancy(bool perDE, bool perEvent)
 //_________________________________________________________________________________________________
 int PreClusterFinder::run()
 {
-  /// preclusterize each cathod separately then merge them
-  preClusterizeRecursive();
-  return mergePreClusters();
+  /// preclusterize each cathod separately then merge them.
+  /// the DEs are fully independent (all working structures are per DE and reused
+  /// between events), so they can be processed in parallel
+  int nPreClusters(0);
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(dynamic) num_threads(mNThreads) reduction(+ : nPreClusters)
+#endif
+  for (int iDE = 0; iDE < SNDEs; ++iDE) {
+    preClusterizeRecursive(iDE);
+    nPreClusters += mergePreClusters(iDE);
+  }
+  return nPreClusters;
 }
 
 //_________________________________________________________________________________________________
@@ -245,49 +254,45 @@ void PreClusterFinder::getPreClusters(std::vector<o2::mch::PreCluster>& preClust
 }
 
 //_________________________________________________________________________________________________
-void PreClusterFinder::preClusterizeRecursive()
+void PreClusterFinder::preClusterizeRecursive(int deIndex)
 {
-  /// preclusterize both planes of every DE using recursive algorithm
+  /// preclusterize both planes of the given DE using recursive algorithm
 
   PreCluster* cluster(nullptr);
   uint16_t iPad(0);
 
-  // loop over DEs
-  for (int iDE = 0; iDE < SNDEs; ++iDE) {
-
-    DetectionElement& de(*(mDEs[iDE]));
-
-    // loop over planes
-    for (int iPlane = 0; iPlane < 2; ++iPlane) {
-
-      // loop over fired pads
-      for (int iFiredPad = 0; iFiredPad < de.nFiredPads[iPlane]; ++iFiredPad) {
-
-        iPad = de.firedPads[iPlane][iFiredPad];
+  DetectionElement& de(*(mDEs[deIndex]));
 
-        if (de.mapping->pads[iPad].useMe) {
+  // loop over planes
+  for (int iPlane = 0; iPlane < 2; ++iPlane) {
 
-          // create the precluster if needed
-          if (mNPreClusters[iDE][iPlane] >= mPreClusters[iDE][iPlane].size()) {
-            mPreClusters[iDE][iPlane].push_back(std::make_unique<PreCluster>());
-          }
+    // loop over fired pads
+    for (int iFiredPad = 0; iFiredPad < de.nFiredPads[iPlane]; ++iFiredPad) {
 
-          // get the precluster
-          cluster = mPreClusters[iDE][iPlane][mNPreClusters[iDE][iPlane]].get();
-          ++mNPreClusters[iDE][iPlane];
+      iPad = de.firedPads[iPlane][iFiredPad];
 
-          // reset its content
-          cluster->area[0][0] = 1.e6;
-          cluster->area[0][1] = -1.e6;
-          cluster->area[1][0] = 1.e6;
-          cluster->area[1][1] = -1.e6;
-          cluster->useMe = true;
-          cluster->storeMe = false;
+      if (de.mapping->pads[iPad].useMe) {
 
-          // add the pad and its fired neighbours recusively
-          cluster->firstPad = de.nOrderedPads[0];
-          addPad(de, iPad, *cluster);
+        // create the precluster if needed
+        if (mNPreClusters[deIndex][iPlane] >= mPreClusters[deIndex][iPlane].size()) {
+          mPreClusters[deIndex][iPlane].push_back(std::make_unique<PreCluster>());
         }
+
+        // get the precluster
+        cluster = mPreClusters[deIndex][iPlane][mNPreClusters[deIndex][iPlane]].get();
+        ++mNPreClusters[deIndex][iPlane];
+
+        // reset its content
+        cluster->area[0][0] = 1.e6;
+        cluster->area[0][1] = -1.e6;
+        cluster->area[1][0] = 1.e6;
+        cluster->area[1][1] = -1.e6;
+        cluster->useMe = true;
+        cluster->storeMe = false;
+
+        // add the pad and its fired neighbours recusively
+        cluster->firstPad = de.nOrderedPads[0];
+        addPad(de, iPad, *cluster);
       }
     }
   }
@@ -336,55 +341,51 @@ void PreClusterFinder::addPad(DetectionElement& de, uint16_t iPad, PreCluster& c
 }
 
 //_________________________________________________________________________________________________
-int PreClusterFinder::mergePreClusters()
+int PreClusterFinder::mergePreClusters(int deIndex)
 {
-  /// merge overlapping preclusters on every DE
-  /// return the total number of preclusters after merging
+  /// merge overlapping preclusters on the given DE
+  /// return the number of preclusters after merging
 
   PreCluster* cluster(nullptr);
   int nPreClusters(0);
 
-  // loop over DEs
-  for (int iDE = 0; iDE < SNDEs; ++iDE) {
-
-    DetectionElement& de(*(mDEs[iDE]));
+  DetectionElement& de(*(mDEs[deIndex]));
 
-    // loop over preclusters of one plane
-    for (int iCluster = 0; iCluster < mNPreClusters[iDE][0]; ++iCluster) {
+  // loop over preclusters of one plane
+  for (int iCluster = 0; iCluster < mNPreClusters[deIndex][0]; ++iCluster) {
 
-      if (!mPreClusters[iDE][0][iCluster]->useMe) {
-        continue;
-      }
+    if (!mPreClusters[deIndex][0][iCluster]->useMe) {
+      continue;
+    }
 
-      cluster = mPreClusters[iDE][0][iCluster].get();
-      cluster->useMe = false;
+    cluster = mPreClusters[deIndex][0][iCluster].get();
+    cluster->useMe = false;
 
-      // look for overlapping preclusters in the other plane
-      PreCluster* mergedCluster(nullptr);
-      mergePreClusters(*cluster, mPreClusters[iDE], mNPreClusters[iDE], de, 1, mergedCluster);
+    // look for overlapping preclusters in the other plane
+    PreCluster* mergedCluster(nullptr);
+    mergePreClusters(*cluster, mPreClusters[deIndex], mNPreClusters[deIndex], de, 1, mergedCluster);
 
-      // add the current one
-      if (!mergedCluster) {
-        mergedCluster = usePreClusters(cluster, de);
-      } else {
-        mergePreClusters(*mergedCluster, *cluster, de);
-      }
-
-      ++nPreClusters;
+    // add the current one
+    if (!mergedCluster) {
+      mergedCluster = usePreClusters(cluster, de);
+    } else {
+      mergePreClusters(*mergedCluster, *cluster, de);
     }
 
-    // loop over preclusters of the other plane
-    for (int iCluster = 0; iCluster < mNPreClusters[iDE][1]; ++iCluster) {
-
-      if (!mPreClusters[iDE][1][iCluster]->useMe) {
-        continue;
-      }
+    ++nPreClusters;
+  }
 
-      // all remaining preclusters have to be stored
-      usePreClusters(mPreClusters[iDE][1][iCluster].get(), de);
+  // loop over preclusters of the other plane
+  for (int iCluster = 0; iCluster < mNPreClusters[deIndex][1]; ++iCluster) {
 
-      ++nPreClusters;
+    if (!mPreClusters[deIndex][1][iCluster]->useMe) {
+      continue;
     }
+
+    // all remaining preclusters have to be stored
+    usePreClusters(mPreClusters[deIndex][1][iCluster].get(), de);
+
+    ++nPreClusters;
   }
 
   return nPreClusters;
@@ -99,6 +99,7 @@ class PreClusterFinderTask
     mDiscardHighOccDEs = ic.options().get<bool>("discard-high-occupancy-des");
     mDiscardHighOccEvents = ic.options().get<bool>("discard-high-occupancy-events");
     mSanityCheck = ic.options().get<bool>("sanity-check");
+    mPreClusterFinder.setNThreads(ic.options().get<int>("nthreads"));
   }
 
   //_________________________________________________________________________________________________
@@ -256,7 +257,8 @@ o2::framework::DataProcessorSpec getPreClusterFinderSpec(const char* specName,
     Options{{"check-no-leftover-digits", VariantType::String, "error", {helpstr}},
             {{"sanity-check"}, VariantType::Bool, false, {"perform some input digit sanity checks"}},
             {"discard-high-occupancy-des", VariantType::Bool, false, {"discard DEs with occupancy > 20%"}},
-            {"discard-high-occupancy-events", VariantType::Bool, false, {"discard events with >= 5 DEs above 20% occupancy"}}}};
+            {"discard-high-occupancy-events", VariantType::Bool, false, {"discard events with >= 5 DEs above 20% occupancy"}},
+            {"nthreads", VariantType::Int, 1, {"number of threads for preclusterization (if built with OpenMP)"}}}};
 }
 
 } // end namespace mch
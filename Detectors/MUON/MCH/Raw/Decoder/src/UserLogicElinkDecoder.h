@@ -145,8 +145,26 @@ void UserLogicElinkDecoder<CHARGESUM>::append(uint64_t data50, uint8_t error, bo
 
   auto data = data50;
 
-  int i;
-  for (i = 0; i < 5; i++) {
+  int i = 0;
+  while (i < 5) {
+    // fast path: consume in one go the sample words of the current cluster
+    // available in this 50-bit word, without going through the state machine
+    // for each of them. The last sample of the cluster is left to the state
+    // machine, which completes and sends the cluster
+    if (mState == State::WaitingSample && mSamplesToRead > 1) {
+      int nBulk = std::min(5 - i, mSamplesToRead - 1);
+#ifdef ULDEBUG
+      debugHeader() << (*this) << " --> bulk read of " << nBulk << " samples\n";
+#endif
+      for (int j = 0; j < nBulk; j++) {
+        mSamples.emplace_back(static_cast<uint10_t>(data & 0x3FF));
+        data >>= 10;
+      }
+      mSamplesToRead -= nBulk;
+      mNof10BitWords = std::max(0, mNof10BitWords - nBulk);
+      i += nBulk;
+      continue;
+    }
     bool packetEnd = append10(static_cast<uint10_t>(data & 0x3FF));
     data >>= 10;
 #ifdef ULDEBUG
@@ -167,6 +185,7 @@ void UserLogicElinkDecoder<CHARGESUM>::append(uint64_t data50, uint8_t error, bo
 #endif
       break;
     }
+    ++i;
   }
 
   if (incomplete && (i == 5) && (mState != State::WaitingSync)) {
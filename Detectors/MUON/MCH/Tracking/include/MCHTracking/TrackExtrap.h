@@ -17,6 +17,7 @@
 #ifndef O2_MCH_TRACKEXTRAP_H_
 #define O2_MCH_TRACKEXTRAP_H_
 
+#include <atomic>
 #include <cstddef>
 
 #include <TMatrixD.h>
@@ -140,8 +141,8 @@ class TrackExtrap
   static double sSimpleBValue; ///< Magnetic field value at the centre
   static bool sFieldON;        ///< true if the field is switched ON
 
-  static std::size_t sNCallExtrapToZCov; ///< number of times the method extrapToZCov(...) is called
-  static std::size_t sNCallField;        ///< number of times the method Field(...) is called
+  static std::atomic<std::size_t> sNCallExtrapToZCov; ///< number of times the method extrapToZCov(...) is called
+  static std::atomic<std::size_t> sNCallField;        ///< number of times the method Field(...) is called
 };
 
 } // namespace mch
@@ -23,9 +23,14 @@
 #include <stdexcept>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include <gsl/span>
 
+#ifdef WITH_OPENMP
+#include <omp.h>
+#endif
+
 #include "Framework/CallbackService.h"
 #include "Framework/ConcreteDataMatcher.h"
 #include "Framework/ConfigParamRegistry.h"
@@ -76,6 +81,13 @@ class TrackFinderTask
 
     LOG(info) << "initializing track finder";
 
+    // create one track finder per thread as they are used concurrently to process the ROFs
+    auto nThreads = ic.options().get<int>("nthreads");
+    mNThreads = nThreads > 1 ? nThreads : 1;
+    for (int i = 0; i < mNThreads; ++i) {
+      mTrackFinders.emplace_back(std::make_unique<T>());
+    }
+
     if (mCCDBRequest) {
       base::GRPGeomHelper::instance().setRequest(mCCDBRequest);
     } else {
@@ -87,7 +99,7 @@ class TrackFinderTask
       } else {
         float l3Current = ic.options().get<float>("l3Current");
         float dipoleCurrent = ic.options().get<float>("dipoleCurrent");
-        mTrackFinder.initField(l3Current, dipoleCurrent);
+        mTrackFinders.front()->initField(l3Current, dipoleCurrent);
       }
     }
 
@@ -95,14 +107,17 @@ class TrackFinderTask
     if (!config.empty()) {
       o2::conf::ConfigurableParam::updateFromFile(config, "MCHTracking", true);
     }
-    mTrackFinder.init();
-
     auto debugLevel = ic.options().get<int>("mch-debug");
-    mTrackFinder.debug(debugLevel);
+    for (auto& trackFinder : mTrackFinders) {
+      trackFinder->init();
+      trackFinder->debug(debugLevel);
+    }
 
     auto stop = [this]() {
-      mTrackFinder.printStats();
-      mTrackFinder.printTimers();
+      for (auto& trackFinder : mTrackFinders) {
+        trackFinder->printStats();
+        trackFinder->printTimers();
+      }
       LOG(info) << "tracking duration = " << mElapsedTime.count() << " s";
       mErrorMap.forEach([](Error error) {
         LOGP(warning, "{}", error.asString());
@@ -152,26 +167,64 @@ class TrackFinderTask
 
     trackROFs.reserve(clusterROFs.size());
     auto timeStart = std::chrono::high_resolution_clock::now();
-    auto& errorMap = mTrackFinder.getErrorMap();
-    errorMap.clear();
+    ErrorMap errorMap{};
+    for (auto& trackFinder : mTrackFinders) {
+      trackFinder->getErrorMap().clear();
+    }
 
-    for (const auto& clusterROF : clusterROFs) {
+#ifdef WITH_OPENMP
+    if (mNThreads > 1) {
 
-      // run the track finder
+      // the ROFs are independent, so they are processed concurrently, each thread
+      // using its own track finder, and the outputs are filled in ROF order below
+      std::vector<std::list<Track>> tracksPerROF(clusterROFs.size());
       auto tStart = std::chrono::high_resolution_clock::now();
-      const auto& tracks = mTrackFinder.findTracks(clustersIn.subspan(clusterROF.getFirstIdx(), clusterROF.getNEntries()));
+#pragma omp parallel for schedule(dynamic) num_threads(mNThreads)
+      for (size_t iROF = 0; iROF < clusterROFs.size(); ++iROF) {
+        auto& trackFinder = *mTrackFinders[omp_get_thread_num()];
+        const auto& clusterROF = clusterROFs[iROF];
+        tracksPerROF[iROF] = std::list<Track>(
+          trackFinder.findTracks(clustersIn.subspan(clusterROF.getFirstIdx(), clusterROF.getNEntries())));
+      }
       auto tEnd = std::chrono::high_resolution_clock::now();
       mElapsedTime += tEnd - tStart;
 
       // fill the ouput messages
-      int trackOffset(mchTracks.size());
-      writeTracks(tracks, digitsIn, clusterROF, firstTForbit, mchTracks, usedClusters, usedDigits);
-      trackROFs.emplace_back(clusterROF.getBCData(), trackOffset, mchTracks.size() - trackOffset,
-                             clusterROF.getBCWidth());
+      for (size_t iROF = 0; iROF < clusterROFs.size(); ++iROF) {
+        const auto& clusterROF = clusterROFs[iROF];
+        int trackOffset(mchTracks.size());
+        writeTracks(tracksPerROF[iROF], digitsIn, clusterROF, firstTForbit, mchTracks, usedClusters, usedDigits);
+        trackROFs.emplace_back(clusterROF.getBCData(), trackOffset, mchTracks.size() - trackOffset,
+                               clusterROF.getBCWidth());
+      }
+
+    } else {
+#endif
+
+      for (const auto& clusterROF : clusterROFs) {
+
+        // run the track finder
+        auto tStart = std::chrono::high_resolution_clock::now();
+        const auto& tracks = mTrackFinders.front()->findTracks(clustersIn.subspan(clusterROF.getFirstIdx(), clusterROF.getNEntries()));
+        auto tEnd = std::chrono::high_resolution_clock::now();
+        mElapsedTime += tEnd - tStart;
+
+        // fill the ouput messages
+        int trackOffset(mchTracks.size());
+        writeTracks(tracks, digitsIn, clusterROF, firstTForbit, mchTracks, usedClusters, usedDigits);
+        trackROFs.emplace_back(clusterROF.getBCData(), trackOffset, mchTracks.size() - trackOffset,
+                               clusterROF.getBCWidth());
+      }
+
+#ifdef WITH_OPENMP
     }
+#endif
 
     // create the output message for tracking errors
     auto& trackErrors = pc.outputs().make<std::vector<Error>>(OutputRef{"trackerrors"});
+    for (auto& trackFinder : mTrackFinders) {
+      errorMap.add(trackFinder->getErrorMap());
+    }
     errorMap.forEach([&trackErrors](Error error) {
       trackErrors.emplace_back(error);
     });
@@ -272,7 +325,8 @@ class TrackFinderTask
   bool mDigits = false;                                 ///< send to associated digits
   std::shared_ptr<base::GRPGeomRequest> mCCDBRequest{}; ///< pointer to the CCDB requests
   float mTrackTime3Sigma{6.0};                          ///< three times the digit time resolution, in BC units
-  T mTrackFinder{};                                     ///< track finder
+  int mNThreads = 1;                                    ///< number of threads used to process the ROFs
+  std::vector<std::unique_ptr<T>> mTrackFinders{};      ///< one track finder per thread
   ErrorMap mErrorMap{};                                 ///< counting of encountered errors
   std::chrono::duration<double> mElapsedTime{};         ///< timer
 };
@@ -316,7 +370,8 @@ o2::framework::DataProcessorSpec getTrackFinderSpec(const char* specName, bool c
             {"dipoleCurrent", VariantType::Float, -6000.0f, {"Dipole current"}},
             {"grp-file", VariantType::String, o2::base::NameConf::getGRPFileName(), {"Name of the grp file"}},
             {"mch-config", VariantType::String, "", {"JSON or INI file with tracking parameters"}},
-            {"mch-debug", VariantType::Int, 0, {"debug level"}}}};
+            {"mch-debug", VariantType::Int, 0, {"debug level"}},
+            {"nthreads", VariantType::Int, 1, {"number of threads to process the ROFs (if built with OpenMP)"}}}};
 }
 
 } // namespace mch
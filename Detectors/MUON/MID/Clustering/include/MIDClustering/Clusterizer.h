@@ -17,13 +17,13 @@
 #ifndef O2_MID_CLUSTERIZER_H
 #define O2_MID_CLUSTERIZER_H
 
+#include <array>
 #include <functional>
-#include <unordered_map>
-#include <unordered_set>
 #include <vector>
 #include <gsl/gsl>
 #include "DataFormatsMID/Cluster.h"
 #include "DataFormatsMID/ROFRecord.h"
+#include "MIDBase/DetectorParameters.h"
 #include "MIDBase/MpArea.h"
 #include "MIDClustering/PreCluster.h"
 #include "MIDClustering/PreClusterHelper.h"
@@ -90,13 +90,13 @@ class Clusterizer
   /// \param deId Detection element ID
   void makeCluster(const PreClustersDE::BP& pcBP, const PreClustersDE::BP& pcBPNeigh, const PreClustersDE::NBP& pcNBP, uint8_t deId);
 
-  gsl::span<const PreCluster> mPreClusters;                    //!< Input pre-clusters
-  std::unordered_map<uint8_t, PreClustersDE> mPreClustersDE{}; //!< Pre-clusters per Detection Element
-  std::unordered_set<uint8_t> mActiveDEs{};                    //!< List of active detection elements for event
-  PreClusterHelper mPreClusterHelper{};                        //!< Helper for pre-clusters
-  std::vector<Cluster> mClusters{};                            ///< List of clusters
-  std::vector<ROFRecord> mROFRecords{};                        ///< List of cluster RO frame records
-  size_t mPreClusterOffset{0};                                 //!< RO offset for pre-cluster
+  gsl::span<const PreCluster> mPreClusters;                                   //!< Input pre-clusters
+  std::array<PreClustersDE, detparams::NDetectionElements> mPreClustersDE{};  //!< Pre-clusters per Detection Element
+  std::vector<uint8_t> mActiveDEs{};                                          //!< List of active detection elements for event
+  PreClusterHelper mPreClusterHelper{};                                       //!< Helper for pre-clusters
+  std::vector<Cluster> mClusters{};                                           ///< List of clusters
+  std::vector<ROFRecord> mROFRecords{};                                       ///< List of cluster RO frame records
+  size_t mPreClusterOffset{0};                                                //!< RO offset for pre-cluster
 
   std::function<void(size_t, size_t)> mFunction{[](size_t, size_t) {}}; ///! Function to keep track of input-output relation
 };
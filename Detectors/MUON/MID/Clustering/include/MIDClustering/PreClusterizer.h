@@ -17,10 +17,10 @@
 #ifndef O2_MID_PRECLUSTERIZER_H
 #define O2_MID_PRECLUSTERIZER_H
 
-#include <unordered_map>
-#include <unordered_set>
+#include <array>
 #include <vector>
 #include <gsl/gsl>
+#include "MIDBase/DetectorParameters.h"
 #include "MIDBase/Mapping.h"
 #include "DataFormatsMID/ColumnData.h"
 #include "DataFormatsMID/ROFRecord.h"
@@ -70,11 +70,11 @@ class PreClusterizer
   /// \param de structure containing the ordered strip patterns for one Detection Element
   void preClusterizeNBP(PatternStruct& de);
 
-  Mapping mMapping;                                  //!< Mapping
-  std::unordered_map<uint8_t, PatternStruct> mMpDEs; //!< Internal mapping
-  std::unordered_set<uint8_t> mActiveDEs;            //!< List of active detection elements for event
-  std::vector<PreCluster> mPreClusters;              ///< List of pre-clusters
-  std::vector<ROFRecord> mROFRecords;                ///< List of pre-clusters RO frame records
+  Mapping mMapping;                                                  //!< Mapping
+  std::array<PatternStruct, detparams::NDetectionElements> mMpDEs{}; //!< Internal mapping
+  std::vector<uint8_t> mActiveDEs;                                   //!< List of active detection elements for event
+  std::vector<PreCluster> mPreClusters;                              ///< List of pre-clusters
+  std::vector<ROFRecord> mROFRecords;                                ///< List of pre-clusters RO frame records
 };
 } // namespace mid
 } // namespace o2
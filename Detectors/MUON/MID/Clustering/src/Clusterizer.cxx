@@ -28,6 +28,7 @@ bool Clusterizer::loadPreClusters(gsl::span<const PreCluster>& preClusters)
   // Loop on pre-clusters in the BP
   mActiveDEs.clear();
   mPreClusters = preClusters;
+  std::array<bool, detparams::NDetectionElements> fired{};
   for (auto& pc : preClusters) {
     auto& de = mPreClustersDE[pc.deId];
     de.setDEId(pc.deId);
@@ -41,7 +42,10 @@ bool Clusterizer::loadPreClusters(gsl::span<const PreCluster>& preClusters)
       }
     }
 
-    mActiveDEs.emplace(pc.deId);
+    if (!fired[pc.deId]) {
+      fired[pc.deId] = true;
+      mActiveDEs.emplace_back(pc.deId);
+    }
   }
 
   return (preClusters.size() > 0);
@@ -176,7 +180,7 @@ bool Clusterizer::makeClusters(PreClustersDE& pcs)
 bool Clusterizer::init(std::function<void(size_t, size_t)> func)
 {
   // prepare storage of clusters and PreClusters
-  mPreClustersDE.reserve(detparams::NDetectionElements);
+  mActiveDEs.reserve(detparams::NDetectionElements);
   mFunction = func;
 
   return true;
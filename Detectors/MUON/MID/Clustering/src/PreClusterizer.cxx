@@ -64,7 +64,11 @@ bool PreClusterizer::loadPatterns(gsl::span<const ColumnData>& stripPatterns)
   for (auto& col : stripPatterns) {
     auto& de = mMpDEs[col.deId];
     de.deId = col.deId;
-    mActiveDEs.emplace(col.deId);
+    if (de.firedColumns == 0) {
+      // the fired columns are reset each time the DE is processed,
+      // so this DE is seen for the first time in this event
+      mActiveDEs.emplace_back(col.deId);
+    }
 
     de.firedColumns |= (1 << col.columnId);
     de.columns[col.columnId] = col;
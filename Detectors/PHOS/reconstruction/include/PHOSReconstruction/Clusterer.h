@@ -46,8 +46,16 @@ class Clusterer
 
   void makeClusters(std::vector<Cluster>& clusters, std::vector<o2::phos::CluElement>& cluel);
 
-  void setBadMap(const o2::phos::BadChannelsMap* m) { mBadMap = m; }
-  void setCalibration(const o2::phos::CalibParams* c) { mCalibParams = c; }
+  void setBadMap(const o2::phos::BadChannelsMap* m)
+  {
+    mBadMap = m;
+    updateCellCalib();
+  }
+  void setCalibration(const o2::phos::CalibParams* c)
+  {
+    mCalibParams = c;
+    updateCellCalib();
+  }
   void setL1phase(int phase)
   {
     mL1phase = phase;
@@ -55,13 +63,28 @@ class Clusterer
   }
 
  protected:
+  /// \struct CellCalib
+  /// \brief Per-cell record fusing bad-channel status with energy and time
+  ///        calibration, to replace several CCDB object lookups in the cell
+  ///        conversion loop with a single one
+  struct CellCalib {
+    float gainHG = 0.; ///< High Gain energy calibration coefficient
+    float gainLG = 0.; ///< Low Gain energy calibration coefficient (gain times HG/LG ratio)
+    float timeHG = 0.; ///< High Gain time calibration
+    float timeLG = 0.; ///< Low Gain time calibration
+    bool bad = true;   ///< Channel is marked bad in the bad-channels map
+  };
+
+  /// \brief Rebuild the fused per-cell calibration table from the CCDB objects
+  void updateCellCalib();
+
   // Calibrate energy
   inline float calibrate(float amp, short absId, bool isHighGain)
   {
     if (isHighGain) {
-      return amp * mCalibParams->getGain(absId);
+      return amp * mCellCalib[absId].gainHG;
     } else {
-      return amp * mCalibParams->getGain(absId) * mCalibParams->getHGLGRatio(absId);
+      return amp * mCellCalib[absId].gainLG;
     }
   }
   // Calibrate time
@@ -82,13 +105,13 @@ class Clusterer
     }
     // Calibrate time
     if (isHighGain) {
-      return time - mCalibParams->getHGTimeCalib(absId) - shift;
+      return time - mCellCalib[absId].timeHG - shift;
     } else {
-      return time - mCalibParams->getLGTimeCalib(absId) - shift;
+      return time - mCellCalib[absId].timeLG - shift;
     }
   }
   // Test Bad map
-  inline bool isBadChannel(short absId) { return (!mBadMap->isChannelGood(absId)); }
+  inline bool isBadChannel(short absId) { return mCellCalib[absId].bad; }
 
   char getNumberOfLocalMax(Cluster& clu, std::vector<CluElement>& cluel);
   void evalAll(Cluster& clu, std::vector<CluElement>& cluel) const;
@@ -103,6 +126,7 @@ class Clusterer
 
  protected:
   static constexpr short NLOCMAX = 30; // Maximal number of local maxima in cluster
+  static constexpr short OFFSET = 1793; // Non-existing channels 56*64*0.5+1
   bool mProcessMC = false;
   int miCellLabel = 0;
   bool mFullCluOutput = false;               ///< Write output full of reduced (no contributed digits) clusters
@@ -111,6 +135,7 @@ class Clusterer
   Geometry* mPHOSGeom = nullptr;             ///! PHOS geometry
   const CalibParams* mCalibParams = nullptr; ///! Calibration coefficients, Clusterizer not owner
   const BadChannelsMap* mBadMap = nullptr;   ///! Bad map, Clusterizer not owner
+  std::vector<CellCalib> mCellCalib;         ///! Fused per-cell calibration table, indexed with absId
 
   std::vector<CluElement> mCluEl; ///< internal vector of clusters
   std::vector<Digit> mTrigger;    ///< internal vector of clusters
@@ -47,6 +47,25 @@ void Clusterer::initialize()
   LOG(info) << "mNMaxIterations = " << sp.mNMaxIterations;
 }
 //____________________________________________________________________________
+void Clusterer::updateCellCalib()
+{
+  // Gather the bad-channel map and the energy/time calibration coefficients
+  // into one flat per-cell table: the conversion of cells to cluster elements
+  // then performs a single lookup per cell instead of one per CCDB object
+  if (!mBadMap || !mCalibParams) {
+    return;
+  }
+  mCellCalib.assign(Geometry::getTotalNCells() + 1, CellCalib());
+  for (short absId = OFFSET; absId <= Geometry::getTotalNCells(); absId++) {
+    auto& c = mCellCalib[absId];
+    c.bad = !mBadMap->isChannelGood(absId);
+    c.gainHG = mCalibParams->getGain(absId);
+    c.gainLG = c.gainHG * mCalibParams->getHGLGRatio(absId);
+    c.timeHG = mCalibParams->getHGTimeCalib(absId);
+    c.timeLG = mCalibParams->getLGTimeCalib(absId);
+  }
+}
+//____________________________________________________________________________
 void Clusterer::process(gsl::span<const Digit> digits, gsl::span<const TriggerRecord> dtr,
                         const o2::dataformats::MCTruthContainer<MCLabel>* dmc,
                         std::vector<Cluster>& clusters, std::vector<CluElement>& cluelements, std::vector<TriggerRecord>& trigRec,
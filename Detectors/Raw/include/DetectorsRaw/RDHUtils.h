@@ -24,6 +24,7 @@
 #include "CommonDataFormat/InteractionRecord.h"
 #endif
 #if !defined(GPUCA_GPUCODE) && !defined(GPUCA_STANDALONE)
+#include <utility>
 #include "Headers/DAQID.h"
 #endif // GPUCA_GPUCODE / GPUCA_STANDALONE
 
@@ -680,6 +681,37 @@ struct RDHUtils {
   static bool checkRDH(const RDHAny rdh, bool verbose = true, bool checkZeros = false) { return checkRDH(rdh.voidify(), verbose, checkZeros); }
   static bool checkRDH(const void* rdhP, bool verbose = true, bool checkZeros = false);
 
+  ///_______________________________
+#if !defined(GPUCA_GPUCODE) && !defined(GPUCA_STANDALONE)
+  /// walk all RDHs of a contiguous page stream (e.g. a superpage), resolving the RDH version only
+  /// once for the whole buffer: inside the loop the fields are accessed via the concrete header
+  /// type, avoiding the per-page version dispatch of the generic accessors. The functor is invoked
+  /// as func(const RDHvN& rdh, size_t offset) and returns false to stop the traversal.
+  /// Returns the number of pages visited.
+  template <typename F>
+  static size_t walkPageStream(const void* buffer, size_t size, F&& func)
+  {
+    if (size < sizeof(RDHAny)) {
+      return 0;
+    }
+    int version = getVersion(buffer);
+    if (version == 7) {
+      return walkPageStreamImpl<RDHv7>(buffer, size, std::forward<F>(func));
+    } else if (version == 6) {
+      return walkPageStreamImpl<RDHv6>(buffer, size, std::forward<F>(func));
+    } else if (version == 5) {
+      return walkPageStreamImpl<RDHv5>(buffer, size, std::forward<F>(func));
+    } else if (version == 4 || version == 3) {
+      return walkPageStreamImpl<RDHv4>(buffer, size, std::forward<F>(func));
+    }
+    processError(version, "version");
+    return 0;
+  }
+
+  /// validate all pages of the stream with checkRDH, return the number of failed pages
+  static size_t checkPageStream(const void* buffer, size_t size, bool verbose = false);
+#endif // GPUCA_GPUCODE / GPUCA_STANDALONE
+
   ///_______________________________
 #if !defined(GPUCA_GPUCODE) && !defined(GPUCA_STANDALONE)
   static LinkSubSpec_t getSubSpec(uint16_t cru, uint8_t link, uint8_t endpoint, uint16_t feeId, o2::header::DAQID::ID srcid = o2::header::DAQID::INVALID)
@@ -720,6 +752,26 @@ struct RDHUtils {
 
  private:
   static uint32_t fletcher32(const uint16_t* data, int len);
+#if !defined(GPUCA_GPUCODE) && !defined(GPUCA_STANDALONE)
+  template <typename RDH, typename F>
+  static size_t walkPageStreamImpl(const void* buffer, size_t size, F&& func)
+  {
+    size_t offs = 0, nPages = 0;
+    while (offs + sizeof(RDH) <= size) {
+      const auto& rdh = TOCREF(RDH, reinterpret_cast<const char*>(buffer) + offs);
+      nPages++;
+      if (!func(rdh, offs)) {
+        break;
+      }
+      size_t step = rdh.offsetToNext;
+      if (step < sizeof(RDH)) { // corrupted offset, cannot continue
+        break;
+      }
+      offs += step;
+    }
+    return nPages;
+  }
+#endif // GPUCA_GPUCODE / GPUCA_STANDALONE
 #if defined(GPUCA_GPUCODE_DEVICE) || defined(GPUCA_STANDALONE)
   template <typename T>
   GPUhdi() static void processError(int v, const T* field)
@@ -17,6 +17,7 @@
 /// @brief  Reader for (multiple) raw data files
 
 #include <cstdio>
+#include <mutex>
 #include <unordered_map>
 #include <map>
 #include <tuple>
@@ -54,6 +55,7 @@ struct ReaderInp {
   uint32_t maxTF = 0xffffffff;
   bool partPerSP = true;
   bool cache = false;
+  bool readAhead = false;
   bool autodetectTF0 = false;
   bool preferCalcTF = false;
   bool sup0xccdb = false;
@@ -211,6 +213,8 @@ class RawFileReader
     size_t readNextSuperPage(char* buff, const PartStat* pstat = nullptr);
     size_t skipNextHBF();
     size_t skipNextTF();
+    void preloadTF(uint32_t tf, bool perSuperPage);
+    void releaseCachedTF(uint32_t tf);
 
     bool rewindToTF(uint32_t tf);
     void print(bool verbose = false, const std::string& pref = "") const;
@@ -272,6 +276,9 @@ class RawFileReader
   bool getCacheData() const { return mCacheData; }
   void setCacheData(bool v) { mCacheData = v; }
 
+  void preloadTF(uint32_t tf, bool perSuperPage = true);
+  void releaseTF(uint32_t tf);
+
   o2::header::DataOrigin getDefaultDataOrigin() const { return mDefDataOrigin; }
   o2::header::DataDescription getDefaultDataSpecification() const { return mDefDataDescription; }
   ReadoutCardType getDefaultReadoutCardType() const { return mDefCardType; }
@@ -302,6 +309,7 @@ class RawFileReader
   ReadoutCardType mDefCardType = CRU;                                   //!
   std::vector<std::string> mFileNames;                                  //! input file names
   std::vector<FILE*> mFiles;                                            //! input file handlers
+  std::mutex mFilesMtx;                                                 //! serializes file access between reading and read-ahead threads
   std::vector<std::unique_ptr<char[]>> mFileBuffers;                    //! buffers for input files
   std::vector<OrigDescCard> mDataSpecs;                                 //! data origin and description for every input file + readout card type
   bool mInitDone = false;
@@ -23,7 +23,10 @@
 #include <string>
 #include <string_view>
 #include <functional>
+#include <condition_variable>
+#include <deque>
 #include <mutex>
+#include <thread>
 
 #include <Rtypes.h>
 #include <TTree.h>
@@ -54,6 +57,7 @@ class RawFileWriter
   ///=====================================================================================
   /// output file handler with its own lock
   struct OutputFile {
+    static constexpr size_t MaxPendingBytes = 128 * 1024 * 1024; // max size of queued superpages before writeAsync blocks
     FILE* handler = nullptr;
     std::mutex fileMtx;
     OutputFile() = default;
@@ -66,6 +70,17 @@ class RawFileWriter
       return *this;
     }
     void write(const char* data, size_t size);
+    void writeAsync(std::vector<char>&& data, size_t size);
+    void stop();
+
+   private:
+    void writerLoop();
+    std::mutex queueMtx;                                     //! protects the superpage queue
+    std::condition_variable queueCV;                         //!
+    std::deque<std::pair<std::vector<char>, size_t>> queue;  //! superpages pending writing
+    std::thread writerThread;                                //! started lazily by the 1st writeAsync
+    size_t queuedBytes = 0;                                  //!
+    bool stopWriter = false;                                 //!
   };
   ///=====================================================================================
   struct PayloadCache {
@@ -255,6 +270,9 @@ class RawFileWriter
   int getSuperPageSize() const { return mSuperPageSize; }
   void setSuperPageSize(int nbytes);
 
+  bool getUseAsyncWriting() const { return mAsyncWriting; }
+  void useAsyncWriting(bool v = true) { mAsyncWriting = v; }
+
   /// get highest IR seen so far
   IR getIRMax() const;
 
@@ -370,6 +388,9 @@ class RawFileWriter
   bool getAddSeparateHBFStopPage() const { return mAddSeparateHBFStopPage; }
   void setAddSeparateHBFStopPage(bool v) { mAddSeparateHBFStopPage = v; }
 
+  bool getFlushPerHBF() const { return mFlushPerHBF; }
+  void setFlushPerHBF(bool v) { mFlushPerHBF = v; }
+
   void setRORCDetector()
   {
     mCRUDetector = false;
@@ -417,9 +438,11 @@ class RawFileWriter
   bool mStartTFOnNewSPage = true;                                         // every TF must start on a new SPage
   bool mDontFillEmptyHBF = false;                                         // skipp adding empty HBFs (uness it must have TF flag)
   bool mAddSeparateHBFStopPage = true;                                    // HBF stop is added on a separate CRU page
+  bool mFlushPerHBF = false;                                              // flush superpage buffer after every closed HBF to bound memory at ~1 HBF per link
   bool mUseRDHStop = true;                                                // detector uses STOP in RDH
   bool mCRUDetector = true;                                               // Detector readout via CRU ( RORC if false)
   bool mApplyCarryOverToLastPage = false;                                 // call CarryOver method also for last chunk and overwrite modified trailer
+  bool mAsyncWriting = false;                                             // hand completed superpages to a writer thread per output file
 
   //>> caching --------------
   bool mCachingStage = false; // signal that current data should be cached
@@ -431,7 +454,8 @@ class RawFileWriter
 
   TStopwatch mTimer;
   RoMode_t mROMode = NotSet;
-  IR mFirstIRAdded; // 1st IR seen
+  IR mFirstIRAdded;          // 1st IR seen
+  std::mutex mAddDataMtx;    //! protects writer-level state when addData is called from multiple threads
   DetLazinessCheck mDetLazyCheck{};
   bool mDoLazinessCheck = true;
 
@@ -285,6 +285,22 @@ bool RDHUtils::checkRDH(const RAWDataHeaderV7& rdh, bool verbose, bool checkZero
 /// temporary: provide a hashcode (checksum) for RDH fields to be used as susbspec
 /// until unique soureID / FeeID is implemented
 /// Source: https://en.wikipedia.org/wiki/Fletcher%27s_checksum
+//_____________________________________________________________________
+size_t RDHUtils::checkPageStream(const void* buffer, size_t size, bool verbose)
+{
+  // validate all pages of a contiguous stream; the RDH version is resolved once for the
+  // whole buffer, the per-page checks run on the concrete header type
+  size_t nErrors = 0;
+  walkPageStream(buffer, size, [&nErrors, verbose](const auto& rdh, size_t offs) {
+    if (!checkRDH(rdh, verbose, false)) {
+      nErrors++;
+    }
+    return true;
+  });
+  return nErrors;
+}
+
+//_____________________________________________________________________
 uint32_t RDHUtils::fletcher32(const uint16_t* data, int len)
 {
   uint32_t c0, c1;
@@ -134,6 +134,7 @@ size_t RawFileReader::LinkData::readNextHBF(char* buff)
     if (blc.dataCache) {
       memcpy(buff + sz, blc.dataCache.get(), blc.size);
     } else {
+      std::lock_guard<std::mutex> lock(reader->mFilesMtx);
       auto fl = reader->mFiles[blc.fileID];
       if (fseek(fl, blc.offset, SEEK_SET) || fread(buff + sz, 1, blc.size, fl) != blc.size) {
         LOGF(error, "Failed to read for the %s a bloc:", describe());
@@ -241,6 +242,63 @@ bool RawFileReader::LinkData::rewindToTF(uint32_t tf)
   return true;
 }
 
+//____________________________________________
+void RawFileReader::LinkData::preloadTF(uint32_t tf, bool perSuperPage)
+{
+  // read all data of the given TF into the block caches, so that the subsequent readNextSuperPage
+  // (perSuperPage=true) or readNextHBF (perSuperPage=false) calls are served from memory.
+  // The caching granularity must match the one of the reading: superpages are cached on their
+  // 1st block, HBF mode caches every block separately.
+  if (tf >= tfStartBlock.size()) {
+    return;
+  }
+  int ibl = tfStartBlock[tf].first;
+  int blMax = tf + 1 < tfStartBlock.size() ? tfStartBlock[tf + 1].first : int(blocks.size());
+  while (ibl < blMax) {
+    int ib0 = ibl;
+    size_t sz = blocks[ibl].size;
+    ibl++;
+    if (perSuperPage) { // group consecutive blocks exactly as getNextTFSuperPagesStat does
+      while (ibl < blMax) {
+        const auto& blc = blocks[ibl];
+        if (blc.testFlag(LinkBlock::StartSP) || (sz + blc.size) > size_t(reader->mNominalSPageSize) ||
+            blocks[ibl - 1].offset + blocks[ibl - 1].size < blc.offset) {
+          break;
+        }
+        sz += blc.size;
+        ibl++;
+      }
+    }
+    auto& head = blocks[ib0];
+    if (head.dataCache) { // already cached, e.g. by the global caching at previous loop
+      continue;
+    }
+    auto cache = std::make_unique<char[]>(sz);
+    std::lock_guard<std::mutex> lock(reader->mFilesMtx);
+    auto fl = reader->mFiles[head.fileID];
+    if (fseek(fl, head.offset, SEEK_SET) || fread(cache.get(), 1, sz, fl) != sz) {
+      LOGF(error, "Failed to preload for the %s a block:", describe());
+      head.print();
+    } else {
+      head.dataCache = std::move(cache);
+    }
+  }
+}
+
+//____________________________________________
+void RawFileReader::LinkData::releaseCachedTF(uint32_t tf)
+{
+  // free the block caches of the given TF filled by preloadTF
+  if (tf >= tfStartBlock.size()) {
+    return;
+  }
+  int ibl = tfStartBlock[tf].first;
+  int blMax = tf + 1 < tfStartBlock.size() ? tfStartBlock[tf + 1].first : int(blocks.size());
+  while (ibl < blMax) {
+    blocks[ibl++].dataCache.reset();
+  }
+}
+
 //____________________________________________
 int RawFileReader::LinkData::getNHBFinTF() const
 {
@@ -285,9 +343,10 @@ size_t RawFileReader::LinkData::readNextSuperPage(char* buff, const RawFileReade
     }
   }
   if (sz) {
-    if (reader->mCacheData && blocks[nextBlock2Read].dataCache) {
+    if (blocks[nextBlock2Read].dataCache) { // filled either by the global caching or by the TF read-ahead
       memcpy(buff, blocks[nextBlock2Read].dataCache.get(), sz);
     } else {
+      std::lock_guard<std::mutex> lock(reader->mFilesMtx);
       auto fl = reader->mFiles[blocks[nextBlock2Read].fileID];
       if (fseek(fl, blocks[nextBlock2Read].offset, SEEK_SET) || fread(buff, 1, sz, fl) != sz) {
         LOGF(error, "Failed to read for the %s a bloc:", describe());
@@ -590,8 +649,9 @@ bool RawFileReader::preprocessFile(int ifl)
     boffs = 0;
     while (1) {
       auto& rdh = *reinterpret_cast<RDHUtils::RDHAny*>(&buffer[boffs]);
-      if ((mPosInFile + RDHUtils::getOffsetToNext(rdh)) > fileSize) {
-        LOGP(warning, "File {} truncated current file pos {} + offsetToNext {} > fileSize {}", ifl, mPosInFile, RDHUtils::getOffsetToNext(rdh), fileSize);
+      const auto offsNext = RDHUtils::getOffsetToNext(rdh); // resolve the version-dispatched accessor only once per page
+      if ((mPosInFile + offsNext) > fileSize) {
+        LOGP(warning, "File {} truncated current file pos {} + offsetToNext {} > fileSize {}", ifl, mPosInFile, offsNext, fileSize);
         readMore = false;
         break;
       }
@@ -627,8 +687,8 @@ bool RawFileReader::preprocessFile(int ifl)
         readMore = false;
         break;
       }
-      boffs += RDHUtils::getOffsetToNext(rdh);
-      mPosInFile += RDHUtils::getOffsetToNext(rdh);
+      boffs += offsNext;
+      mPosInFile += offsNext;
       lIDPrev = lID;
       if (boffs + sizeof(RDHUtils::RDHAny) >= nr) {
         if (fseek(fl, mPosInFile, SEEK_SET)) {
@@ -956,6 +1016,28 @@ void RawFileReader::imposeFirstTF(uint32_t orbit)
   hbu.printKeyValues();
 }
 
+//_____________________________________________________________________
+void RawFileReader::preloadTF(uint32_t tf, bool perSuperPage)
+{
+  // read the data of the given TF for all links into the block caches, e.g. from a thread
+  // overlapping the reading of the next TF with the distribution of the current one
+  for (int i = 0; i < getNLinks(); i++) {
+    getLink(i).preloadTF(tf, perSuperPage);
+  }
+}
+
+//_____________________________________________________________________
+void RawFileReader::releaseTF(uint32_t tf)
+{
+  // free the block caches of the given TF, unless the global caching (e.g. for looping) was requested
+  if (mCacheData) {
+    return;
+  }
+  for (int i = 0; i < getNLinks(); i++) {
+    getLink(i).releaseCachedTF(tf);
+  }
+}
+
 std::string RawFileReader::nochk_opt(RawFileReader::ErrTypes e)
 {
   std::string opt = ErrCheckDefaults[e] ? "nocheck-" : "check-";
@@ -41,6 +41,7 @@
 
 #include <unistd.h>
 #include <algorithm>
+#include <future>
 #include <unordered_map>
 #include <cctype>
 #include <string>
@@ -88,15 +89,17 @@ class RawReaderSpecs : public o2f::Task
   size_t mSentMessages = 0;
   bool mPartPerSP = true;                                          // fill part per superpage
   bool mSup0xccdb = false;                                         // suppress explicit FLP/DISTSUBTIMEFRAME/0xccdb output
+  bool mReadAhead = false;                                         // preload the next TF while the current one is being distributed
   std::string mRawChannelName = "";                                // name of optional non-DPL channel
   std::unique_ptr<o2::raw::RawFileReader> mReader;                 // matching engine
+  std::future<uint32_t> mPreloadFuture;                            // pending background preload, must not outlive the reader
   std::unordered_map<std::string, std::pair<int, int>> mDropTFMap; // allows to drop certain fraction of TFs
   TStopwatch mTimer;
 };
 
 //___________________________________________________________
 RawReaderSpecs::RawReaderSpecs(const ReaderInp& rinp)
-  : mLoop(rinp.loop < 0 ? INT_MAX : (rinp.loop < 1 ? 1 : rinp.loop)), mDelayUSec(rinp.delay_us), mMinTFID(rinp.minTF), mMaxTFID(rinp.maxTF), mRunNumber(rinp.runNumber), mPartPerSP(rinp.partPerSP), mSup0xccdb(rinp.sup0xccdb), mReader(std::make_unique<o2::raw::RawFileReader>(rinp.inifile, 0, rinp.bufferSize, rinp.onlyDet)), mRawChannelName(rinp.rawChannelConfig), mPreferCalcTF(rinp.preferCalcTF), mMinSHM(rinp.minSHM)
+  : mLoop(rinp.loop < 0 ? INT_MAX : (rinp.loop < 1 ? 1 : rinp.loop)), mDelayUSec(rinp.delay_us), mMinTFID(rinp.minTF), mMaxTFID(rinp.maxTF), mRunNumber(rinp.runNumber), mPartPerSP(rinp.partPerSP), mSup0xccdb(rinp.sup0xccdb), mReadAhead(rinp.readAhead), mReader(std::make_unique<o2::raw::RawFileReader>(rinp.inifile, 0, rinp.bufferSize, rinp.onlyDet)), mRawChannelName(rinp.rawChannelConfig), mPreferCalcTF(rinp.preferCalcTF), mMinSHM(rinp.minSHM)
 {
   mReader->setCheckErrors(rinp.errMap);
   mReader->setMaxTFToRead(rinp.maxTF);
@@ -225,6 +228,19 @@ void RawReaderSpecs::run(o2f::ProcessingContext& ctx)
   static o2f::RateLimiter limiter;
   limiter.check(ctx, mTFRateLimit, mMinSHM);
 
+  if (mReadAhead) {
+    int64_t preloaded = -1;
+    if (mPreloadFuture.valid()) {
+      preloaded = mPreloadFuture.get(); // guarantees that the background thread stopped accessing the files
+    }
+    if (preloaded != int64_t(tfID)) { // 1st TF or jump in the sequence: preload synchronously
+      mReader->preloadTF(tfID, mPartPerSP);
+    }
+    if (tfID + 1 <= mMaxTFID) { // overlap reading of the next TF with the distribution of this one
+      mPreloadFuture = std::async(std::launch::async, [this, next = tfID + 1]() { mReader->preloadTF(next, mPartPerSP); return next; });
+    }
+  }
+
   // read next time frame
   LOG(info) << "Reading TF#" << mTFCounter << " (" << tfID << " at iteration " << mLoopsDone << ')';
   o2::header::Stack dummyStack{o2h::DataHeader{}, o2f::DataProcessingHeader{0}}; // dummy stack to just to get stack size
@@ -328,6 +344,9 @@ void RawReaderSpecs::run(o2f::ProcessingContext& ctx)
   if (sentSomething) {
     ctx.services().get<o2f::MessageContext>().fakeDispatch();
   }
+  if (mReadAhead) {
+    mReader->releaseTF(tfID); // free the caches of the TF just sent (no-op if global caching is enabled)
+  }
 
   mTimer.Stop();
 
@@ -65,6 +65,7 @@ void RawFileWriter::close()
   // close all files
   for (auto& flh : mFName2File) {
     LOG(info) << "Closing output file " << flh.first;
+    flh.second.stop(); // drain pending asynchronous writes, if any
     fclose(flh.second.handler);
     flh.second.handler = nullptr;
   }
@@ -145,6 +146,9 @@ RawFileWriter::LinkData& RawFileWriter::registerLink(uint16_t fee, uint16_t cru,
       LOG(error) << "Failed to open output file " << outFileName;
       throw std::runtime_error(std::string("cannot open link output file ") + outFileName);
     }
+    // the links write their data in complete superpages, so the stdio buffering would only add
+    // an extra staging copy of every payload on the way to the disk
+    setvbuf(file.handler, nullptr, _IONBF, 0);
   }
   if (!linkData.fileName.empty()) { // this link was already declared and associated with a file
     if (linkData.fileName == outFileName) {
@@ -200,13 +204,16 @@ void RawFileWriter::addData(uint16_t feeid, uint16_t cru, uint8_t lnk, uint8_t e
     }
     return;
   }
-  if (ir < mFirstIRAdded) {
-    mHBFUtils.checkConsistency(); // done only once
-    mFirstIRAdded = ir;
-  }
-  if (mDoLazinessCheck && !mCachingStage) {
-    mDetLazyCheck.completeLinks(this, ir); // make sure that all links for previously called IR got their addData call
-    mDetLazyCheck.acknowledge(sspec, ir, preformatted, trigger, detField);
+  { // writer-level state may be accessed from concurrent addData calls (e.g. parallel per-link encoders)
+    std::lock_guard<std::mutex> lock(mAddDataMtx);
+    if (ir < mFirstIRAdded) {
+      mHBFUtils.checkConsistency(); // done only once
+      mFirstIRAdded = ir;
+    }
+    if (mDoLazinessCheck && !mCachingStage) {
+      mDetLazyCheck.completeLinks(this, ir); // make sure that all links for previously called IR got their addData call
+      mDetLazyCheck.acknowledge(sspec, ir, preformatted, trigger, detField);
+    }
   }
   link.addData(ir, data, preformatted, trigger, detField);
 }
@@ -556,6 +563,9 @@ void RawFileWriter::LinkData::closeHBFPage()
     }
   }
   addHBFPage(true);
+  if (writer->mFlushPerHBF) { // stream out the closed HBF immediately instead of accumulating the superpage
+    flushSuperPage();
+  }
 }
 
 //___________________________________________________________________________________
@@ -602,7 +612,23 @@ void RawFileWriter::LinkData::flushSuperPage(bool keepLastPage)
   if (writer->mVerbosity) {
     LOGF(info, "Flushing super page of %u bytes for %s", pgSize, describe());
   }
-  writer->mFName2File.find(fileName)->second.write(buffer.data(), pgSize);
+  auto& file = writer->mFName2File.find(fileName)->second;
+  if (writer->mAsyncWriting) { // hand the assembled superpage itself over to the writer thread of the file
+    auto toMove = buffer.size() - pgSize;
+    std::vector<char> towrite;
+    towrite.swap(buffer);
+    buffer.reserve(writer->mSuperPageSize);
+    if (toMove) { // keep the incomplete last page in the assembly buffer
+      buffer.resize(toMove);
+      memcpy(buffer.data(), &towrite[pgSize], toMove);
+      lastRDHoffset -= pgSize;
+    } else {
+      lastRDHoffset = -1;
+    }
+    file.writeAsync(std::move(towrite), pgSize);
+    return;
+  }
+  file.write(buffer.data(), pgSize);
   auto toMove = buffer.size() - pgSize;
   if (toMove) { // is there something left in the buffer, move it to the beginning of the buffer
     if (toMove > pgSize) {
@@ -716,6 +742,54 @@ void RawFileWriter::OutputFile::write(const char* data, size_t sz)
   fwrite(data, 1, sz, handler); // flush to file
 }
 
+//____________________________________________
+void RawFileWriter::OutputFile::writeAsync(std::vector<char>&& data, size_t sz)
+{
+  // queue the superpage for the writer thread of this file, throttling if too much data is pending
+  {
+    std::unique_lock<std::mutex> lock(queueMtx);
+    if (!writerThread.joinable()) {
+      writerThread = std::thread(&OutputFile::writerLoop, this);
+    }
+    queueCV.wait(lock, [this] { return queuedBytes < MaxPendingBytes; });
+    queuedBytes += sz;
+    queue.emplace_back(std::move(data), sz);
+  }
+  queueCV.notify_all();
+}
+
+//____________________________________________
+void RawFileWriter::OutputFile::writerLoop()
+{
+  std::unique_lock<std::mutex> lock(queueMtx);
+  while (!stopWriter || !queue.empty()) {
+    queueCV.wait(lock, [this] { return stopWriter || !queue.empty(); });
+    while (!queue.empty()) {
+      auto entry = std::move(queue.front());
+      queue.pop_front();
+      lock.unlock();
+      write(entry.first.data(), entry.second);
+      lock.lock();
+      queuedBytes -= entry.second;
+      queueCV.notify_all();
+    }
+  }
+}
+
+//____________________________________________
+void RawFileWriter::OutputFile::stop()
+{
+  // finalize the writer thread after flushing its queue
+  {
+    std::lock_guard<std::mutex> lock(queueMtx);
+    stopWriter = true;
+  }
+  queueCV.notify_all();
+  if (writerThread.joinable()) {
+    writerThread.join();
+  }
+}
+
 //____________________________________________
 void RawFileWriter::DetLazinessCheck::acknowledge(LinkSubSpec_t s, const IR& _ir, bool _preformatted, uint32_t _trigger, uint32_t _detField)
 {
@@ -348,8 +348,8 @@ class Geo
   static Int_t getTDCFromECH(int ech) { return (ech % 128) >> 3; }
   static Int_t getTDCChFromECH(int ech) { return (ech % 8); }
   static Int_t getECHFromIndexes(int crate, int trm, int chain, int tdc, int chan) { return (crate << 12) + ((trm - 3) << 8) + (chain << 7) + (tdc << 3) + chan; }
-  static Int_t getECHFromCH(int chan) { return CHAN_TO_ELCHAN[chan]; }
-  static Int_t getCHFromECH(int echan) { return ELCHAN_TO_CHAN[echan]; }
+  static Int_t getECHFromCH(int chan);  // electronic channel from TOF channel, see Mapping.cxx
+  static Int_t getCHFromECH(int echan); // TOF channel from electronic channel (-1 if not connected), see Mapping.cxx
 
   static void Init();
   static void InitIdeal();
@@ -385,8 +385,6 @@ class Geo
   // cable length map
   static constexpr Float_t CABLEPROPAGATIONDELAY = 0.0513;           // Propagation delay [ns/cm]
   static const Float_t CABLELENGTH[kNCrate][10][kNChain][kNTdc / 3]; // not constexpr as we initialize it in CableLength.cxx at run time
-  static const Int_t CHAN_TO_ELCHAN[NCHANNELS];
-  static const Int_t ELCHAN_TO_CHAN[N_ELECTRONIC_CHANNELS];
 
   ClassDefNV(Geo, 3);
 };
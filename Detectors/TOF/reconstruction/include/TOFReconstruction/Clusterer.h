@@ -64,6 +64,9 @@ class Clusterer
 
   void setDeltaTforClustering(float val) { mDeltaTforClustering = val; }
   float getDeltaTforClustering() const { return mDeltaTforClustering; }
+
+  void setNThreads(int n) { mNThreads = n > 1 ? n : 1; }
+  int getNThreads() const { return mNThreads; }
   std::vector<o2::tof::CalibInfoCluster>* getInfoFromCluster() { return &mCalibInfosFromCluster; }
   void addDiagnostic(const Diagnostic& dia)
   {
@@ -80,23 +83,24 @@ class Clusterer
   void setCalibStored(bool val = true) { mAreCalibStored = val; }
 
  private:
-  void calibrateStrip();
-  void processStrip(std::vector<Cluster>& clusters, MCLabelContainer const* digitMCTruth);
+  // strips are independent, so the per-strip methods get their scratch state passed
+  // explicitly and can be called concurrently for different strips
+  void calibrateStrip(StripData& stripData);
+  void processStrip(StripData& stripData, std::vector<Cluster>& clusters, MCLabelContainer const* digitMCTruth, std::vector<o2::tof::CalibInfoCluster>& calibInfos);
   //void fetchMCLabels(const Digit* dig, std::array<Label, Cluster::maxLabels>& labels, int& nfilled) const;
 
   StripData mStripData; ///< single strip data provided by the reader
 
   o2::dataformats::MCTruthContainer<o2::MCCompLabel>* mClsLabels = nullptr; // Cluster MC labels
 
-  Digit* mContributingDigit[6];    //! array of digits contributing to the cluster; this will not be stored, it is temporary to build the final cluster
-  int mNumberOfContributingDigits; //! number of digits contributing to the cluster; this will not be stored, it is temporary to build the final cluster
-  void addContributingDigit(Digit* dig);
-  void buildCluster(Cluster& c, MCLabelContainer const* digitMCTruth);
+  void addContributingDigit(Digit* dig, Digit** contributingDigit, int& numberOfContributingDigits);
+  void buildCluster(Cluster& c, MCLabelContainer const* digitMCTruth, Digit** contributingDigit, int& numberOfContributingDigits, std::vector<o2::tof::CalibInfoCluster>& calibInfos);
   CalibApi* mCalibApi = nullptr; //! calib api to handle the TOF calibration
   uint64_t mFirstOrbit = 0;      //! 1st orbit of the TF
   uint64_t mBCOffset = 0;        //! 1st orbit of the TF converted to BCs
 
   float mDeltaTforClustering = 5000; //! delta time (in ps) accepted for clustering
+  int mNThreads = 1;                 //! number of threads for the per-strip clusterization
   bool mCalibFromCluster = false;    //! if producing calib from clusters
   Diagnostic mDiagnosticFrequency;   //! diagnostic frquency in current TF
   bool mIsNoisy[Geo::NCHANNELS];     //! noisy channel map
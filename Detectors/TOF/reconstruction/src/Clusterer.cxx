@@ -30,13 +30,44 @@ void Clusterer::process(DataReader& reader, std::vector<Cluster>& clusters, MCLa
   reader.init();
   int totNumDigits = 0;
 
+#ifdef WITH_OPENMP
+  if (mNThreads > 1 && digitMCTruth == nullptr) {
+    // strips are independent, so they can be clusterized in parallel once all of them
+    // are collected from the reader; clusters and calibration info are appended in strip
+    // order afterwards, so the output is identical to the serial processing.
+    // With MC labels the processing stays serial, since the label container must be
+    // filled in cluster order while the clusters are built
+    std::vector<StripData> strips;
+    while (reader.getNextStripData(mStripData)) {
+      LOG(debug) << "TOFClusterer got Strip " << mStripData.stripID << " with Ndigits "
+                 << mStripData.digits.size();
+      totNumDigits += mStripData.digits.size();
+      strips.push_back(std::move(mStripData));
+    }
+    std::vector<std::vector<Cluster>> clustersPerStrip(strips.size());
+    std::vector<std::vector<o2::tof::CalibInfoCluster>> calibPerStrip(strips.size());
+#pragma omp parallel for schedule(dynamic) num_threads(mNThreads)
+    for (size_t is = 0; is < strips.size(); is++) {
+      calibrateStrip(strips[is]);
+      processStrip(strips[is], clustersPerStrip[is], nullptr, calibPerStrip[is]);
+    }
+    for (size_t is = 0; is < strips.size(); is++) {
+      clusters.insert(clusters.end(), clustersPerStrip[is].begin(), clustersPerStrip[is].end());
+      mCalibInfosFromCluster.insert(mCalibInfosFromCluster.end(), calibPerStrip[is].begin(), calibPerStrip[is].end());
+    }
+    LOG(debug) << "We had " << totNumDigits << " digits in this event";
+    timerProcess.Stop();
+    return;
+  }
+#endif
+
   while (reader.getNextStripData(mStripData)) {
     LOG(debug) << "TOFClusterer got Strip " << mStripData.stripID << " with Ndigits "
                << mStripData.digits.size();
     totNumDigits += mStripData.digits.size();
 
-    calibrateStrip();
-    processStrip(clusters, digitMCTruth);
+    calibrateStrip(mStripData);
+    processStrip(mStripData, clusters, digitMCTruth, mCalibInfosFromCluster);
   }
 
   LOG(debug) << "We had " << totNumDigits << " digits in this event";
@@ -44,13 +75,13 @@ void Clusterer::process(DataReader& reader, std::vector<Cluster>& clusters, MCLa
 }
 
 //__________________________________________________
-void Clusterer::calibrateStrip()
+void Clusterer::calibrateStrip(StripData& stripData)
 {
-  // method to calibrate the times from the current strip
+  // method to calibrate the times from the given strip
 
-  for (int idig = 0; idig < mStripData.digits.size(); idig++) {
+  for (int idig = 0; idig < stripData.digits.size(); idig++) {
     //    LOG(debug) << "Checking digit " << idig;
-    Digit* dig = &mStripData.digits[idig];
+    Digit* dig = &stripData.digits[idig];
     //    LOG(info) << "channel = " << dig->getChannel();
     dig->setBC(dig->getBC() - mBCOffset); // RS Don't use raw BC, always start from the beginning of the TF
     double calib = mCalibApi->getTimeCalibration(dig->getChannel(), dig->getTOT() * Geo::TOTBIN_NS);
@@ -63,9 +94,9 @@ void Clusterer::calibrateStrip()
 }
 
 //__________________________________________________
-void Clusterer::processStrip(std::vector<Cluster>& clusters, MCLabelContainer const* digitMCTruth)
+void Clusterer::processStrip(StripData& stripData, std::vector<Cluster>& clusters, MCLabelContainer const* digitMCTruth, std::vector<o2::tof::CalibInfoCluster>& calibInfos)
 {
-  // method to clusterize the current strip
+  // method to clusterize the given strip
 
   Int_t detId[5];
   Int_t chan, chan2, chan3;
@@ -73,17 +104,20 @@ void Clusterer::processStrip(std::vector<Cluster>& clusters, MCLabelContainer co
   Int_t iphi, iphi2, iphi3;
   Int_t ieta, ieta2, ieta3; // it is the number of padz-row increasing along the various strips
 
-  for (int idig = 0; idig < mStripData.digits.size(); idig++) {
+  Digit* contributingDigit[6]; // scratch array of digits contributing to the current cluster
+  int numberOfContributingDigits = 0;
+
+  for (int idig = 0; idig < stripData.digits.size(); idig++) {
     //    LOG(debug) << "Checking digit " << idig;
-    Digit* dig = &mStripData.digits[idig];
+    Digit* dig = &stripData.digits[idig];
     //printf("checking digit %d - alreadyUsed=%d   -  problematic=%d\n",idig,dig->isUsedInCluster(),dig->isProblematic()); // toberem
     if (dig->isUsedInCluster() || dig->isProblematic()) {
       continue; // the digit was already used to build a cluster, or it was declared problematic
     }
 
-    mNumberOfContributingDigits = 0;
+    numberOfContributingDigits = 0;
     dig->getPhiAndEtaIndex(iphi, ieta);
-    if (mStripData.digits.size() > 1) {
+    if (stripData.digits.size() > 1) {
       LOG(debug) << "idig = " << idig;
     }
 
@@ -92,11 +126,11 @@ void Clusterer::processStrip(std::vector<Cluster>& clusters, MCLabelContainer co
     //    LOG(debug) << "noc = " << noc << "\n";
     clusters.emplace_back();
     Cluster& c = clusters[noc];
-    addContributingDigit(dig);
+    addContributingDigit(dig, contributingDigit, numberOfContributingDigits);
     double timeDig = dig->getCalibratedTime();
 
-    for (int idigNext = idig + 1; idigNext < mStripData.digits.size(); idigNext++) {
-      Digit* digNext = &mStripData.digits[idigNext];
+    for (int idigNext = idig + 1; idigNext < stripData.digits.size(); idigNext++) {
+      Digit* digNext = &stripData.digits[idigNext];
       if (digNext->isUsedInCluster() || dig->isProblematic()) {
         continue; // the digit was already used to build a cluster, or was problematic
       }
@@ -116,28 +150,28 @@ void Clusterer::processStrip(std::vector<Cluster>& clusters, MCLabelContainer co
       }
 
       // if we are here, the digit contributes to the cluster
-      addContributingDigit(digNext);
+      addContributingDigit(digNext, contributingDigit, numberOfContributingDigits);
 
     } // loop on the second digit
 
     //printf("build cluster\n");
-    buildCluster(c, digitMCTruth); // toberem
+    buildCluster(c, digitMCTruth, contributingDigit, numberOfContributingDigits, calibInfos); // toberem
 
   } // loop on the first digit
 }
 //______________________________________________________________________
-void Clusterer::addContributingDigit(Digit* dig)
+void Clusterer::addContributingDigit(Digit* dig, Digit** contributingDigit, int& numberOfContributingDigits)
 {
 
   // adding a digit to the array that stores the contributing ones
 
-  if (mNumberOfContributingDigits == 6) {
+  if (numberOfContributingDigits == 6) {
     LOG(debug) << "The cluster has already 6 digits associated to it, we cannot add more; returning without doing anything";
 
     int phi, eta;
-    for (int i = 0; i < mNumberOfContributingDigits; i++) {
-      mContributingDigit[i]->getPhiAndEtaIndex(phi, eta);
-      LOG(debug) << "digit already in " << i << ", channel = " << mContributingDigit[i]->getChannel() << ",phi,eta = (" << phi << "," << eta << "), TDC = " << mContributingDigit[i]->getTDC() << ", calibrated time = " << mContributingDigit[i]->getCalibratedTime();
+    for (int i = 0; i < numberOfContributingDigits; i++) {
+      contributingDigit[i]->getPhiAndEtaIndex(phi, eta);
+      LOG(debug) << "digit already in " << i << ", channel = " << contributingDigit[i]->getChannel() << ",phi,eta = (" << phi << "," << eta << "), TDC = " << contributingDigit[i]->getTDC() << ", calibrated time = " << contributingDigit[i]->getCalibratedTime();
     }
 
     dig->getPhiAndEtaIndex(phi, eta);
@@ -148,44 +182,44 @@ void Clusterer::addContributingDigit(Digit* dig)
 
     return;
   }
-  mContributingDigit[mNumberOfContributingDigits] = dig;
-  mNumberOfContributingDigits++;
+  contributingDigit[numberOfContributingDigits] = dig;
+  numberOfContributingDigits++;
   dig->setIsUsedInCluster();
 
   return;
 }
 
 //_____________________________________________________________________
-void Clusterer::buildCluster(Cluster& c, MCLabelContainer const* digitMCTruth)
+void Clusterer::buildCluster(Cluster& c, MCLabelContainer const* digitMCTruth, Digit** contributingDigit, int& numberOfContributingDigits, std::vector<o2::tof::CalibInfoCluster>& calibInfos)
 {
   static const float inv12 = 1. / 12.;
 
   // here we finally build the cluster from all the digits contributing to it
 
   Digit* temp;
-  for (int idig = 1; idig < mNumberOfContributingDigits; idig++) {
+  for (int idig = 1; idig < numberOfContributingDigits; idig++) {
     // the digit[0] will be the main one
-    if (mContributingDigit[idig]->getTOT() > mContributingDigit[0]->getTOT()) {
-      temp = mContributingDigit[0];
-      mContributingDigit[0] = mContributingDigit[idig];
-      mContributingDigit[idig] = temp;
+    if (contributingDigit[idig]->getTOT() > contributingDigit[0]->getTOT()) {
+      temp = contributingDigit[0];
+      contributingDigit[0] = contributingDigit[idig];
+      contributingDigit[idig] = temp;
     }
   }
 
-  c.setMainContributingChannel(mContributingDigit[0]->getChannel());
-  c.setTime(mContributingDigit[0]->getCalibratedTime());                                                                                      // time in ps (for now we assume it calibrated)
-  c.setTimeRaw(mContributingDigit[0]->getTDC() * Geo::TDCBIN + mContributingDigit[0]->getBC() * o2::constants::lhc::LHCBunchSpacingNS * 1E3); // time in ps (for now we assume it calibrated)
+  c.setMainContributingChannel(contributingDigit[0]->getChannel());
+  c.setTime(contributingDigit[0]->getCalibratedTime());                                                                                      // time in ps (for now we assume it calibrated)
+  c.setTimeRaw(contributingDigit[0]->getTDC() * Geo::TDCBIN + contributingDigit[0]->getBC() * o2::constants::lhc::LHCBunchSpacingNS * 1E3); // time in ps (for now we assume it calibrated)
 
-  //printf("timeraw= %lf - time real = %lf (%d, %lu) \n",c.getTimeRaw(),mContributingDigit[0]->getTDC() * Geo::TDCBIN + mContributingDigit[0]->getBC() * o2::constants::lhc::LHCBunchSpacingNS * 1E3,mContributingDigit[0]->getTDC(),mContributingDigit[0]->getBC());
+  //printf("timeraw= %lf - time real = %lf (%d, %lu) \n",c.getTimeRaw(),contributingDigit[0]->getTDC() * Geo::TDCBIN + contributingDigit[0]->getBC() * o2::constants::lhc::LHCBunchSpacingNS * 1E3,contributingDigit[0]->getTDC(),contributingDigit[0]->getBC());
 
-  c.setTot(mContributingDigit[0]->getTOT() * Geo::TOTBIN_NS); // TOT in ns (for now we assume it calibrated)
+  c.setTot(contributingDigit[0]->getTOT() * Geo::TOTBIN_NS); // TOT in ns (for now we assume it calibrated)
   //setL0L1Latency(); // to be filled (maybe)
   //setDeltaBC(); // to be filled (maybe)
 
-  c.setDigitInfo(0, mContributingDigit[0]->getChannel(), mContributingDigit[0]->getCalibratedTime(), mContributingDigit[0]->getTOT() * Geo::TOTBIN_NS);
+  c.setDigitInfo(0, contributingDigit[0]->getChannel(), contributingDigit[0]->getCalibratedTime(), contributingDigit[0]->getTOT() * Geo::TOTBIN_NS);
 
-  int ch1 = mContributingDigit[0]->getChannel();
-  short tot1 = mContributingDigit[0]->getTOT() < 20000 ? mContributingDigit[0]->getTOT() : 20000;
+  int ch1 = contributingDigit[0]->getChannel();
+  short tot1 = contributingDigit[0]->getTOT() < 20000 ? contributingDigit[0]->getTOT() : 20000;
   double dtime = c.getTimeRaw();
 
   int chan1, chan2;
@@ -194,10 +228,10 @@ void Clusterer::buildCluster(Cluster& c, MCLabelContainer const* digitMCTruth)
   int deltaPhi, deltaEta;
   int mask;
 
-  mContributingDigit[0]->getPhiAndEtaIndex(phi1, eta1);
+  contributingDigit[0]->getPhiAndEtaIndex(phi1, eta1);
   // now set the mask with the secondary digits
-  for (int idig = 1; idig < mNumberOfContributingDigits; idig++) {
-    mContributingDigit[idig]->getPhiAndEtaIndex(phi2, eta2);
+  for (int idig = 1; idig < numberOfContributingDigits; idig++) {
+    contributingDigit[idig]->getPhiAndEtaIndex(phi2, eta2);
     deltaPhi = phi1 - phi2;
     deltaEta = eta1 - eta2;
 
@@ -229,18 +263,18 @@ void Clusterer::buildCluster(Cluster& c, MCLabelContainer const* digitMCTruth)
       }
     } else { // |delataphi| > 1
       isOk = false;
-      mContributingDigit[idig]->setIsUsedInCluster(false);
+      contributingDigit[idig]->setIsUsedInCluster(false);
     }
 
     if (isOk) {
-      c.setDigitInfo(c.getNumOfContributingChannels(), mContributingDigit[idig]->getChannel(), mContributingDigit[idig]->getCalibratedTime(), mContributingDigit[idig]->getTOT() * Geo::TOTBIN_NS);
+      c.setDigitInfo(c.getNumOfContributingChannels(), contributingDigit[idig]->getChannel(), contributingDigit[idig]->getCalibratedTime(), contributingDigit[idig]->getTOT() * Geo::TOTBIN_NS);
       c.addBitInContributingChannels(mask);
 
-      if (mCalibFromCluster && c.getNumOfContributingChannels() == 2 && !mIsNoisy[mContributingDigit[idig]->getChannel()] && !mIsNoisy[ch1]) { // fill info for calibration excluding noisy channels
-        int8_t dch = int8_t(mContributingDigit[idig]->getChannel() - ch1);
-        short tot2 = mContributingDigit[idig]->getTOT() < 20000 ? mContributingDigit[idig]->getTOT() : 20000;
-        dtime -= mContributingDigit[idig]->getTDC() * Geo::TDCBIN + mContributingDigit[idig]->getBC() * o2::constants::lhc::LHCBunchSpacingNS * 1E3;
-        addCalibFromCluster(ch1, dch, float(dtime), tot1, tot2);
+      if (mCalibFromCluster && c.getNumOfContributingChannels() == 2 && !mIsNoisy[contributingDigit[idig]->getChannel()] && !mIsNoisy[ch1]) { // fill info for calibration excluding noisy channels
+        int8_t dch = int8_t(contributingDigit[idig]->getChannel() - ch1);
+        short tot2 = contributingDigit[idig]->getTOT() < 20000 ? contributingDigit[idig]->getTOT() : 20000;
+        dtime -= contributingDigit[idig]->getTDC() * Geo::TDCBIN + contributingDigit[idig]->getBC() * o2::constants::lhc::LHCBunchSpacingNS * 1E3;
+        calibInfos.emplace_back(ch1, dch, float(dtime), tot1, tot2);
       }
     }
   }
@@ -249,12 +283,12 @@ void Clusterer::buildCluster(Cluster& c, MCLabelContainer const* digitMCTruth)
   if (digitMCTruth != nullptr) {
     int lbl = mClsLabels->getIndexedSize(); // this should correspond to the number of digits also;
     //printf("lbl = %d\n", lbl);
-    for (int i = 0; i < mNumberOfContributingDigits; i++) {
-      if (!mContributingDigit[i]->isUsedInCluster()) {
+    for (int i = 0; i < numberOfContributingDigits; i++) {
+      if (!contributingDigit[i]->isUsedInCluster()) {
         continue;
       }
       //printf("contributing digit = %d\n", i);
-      int digitLabel = mContributingDigit[i]->getLabel();
+      int digitLabel = contributingDigit[i]->getLabel();
       //printf("digitLabel = %d\n", digitLabel);
       gsl::span<const o2::MCCompLabel> mcArray = digitMCTruth->getLabels(digitLabel);
       for (int j = 0; j < static_cast<int>(mcArray.size()); j++) {
@@ -48,6 +48,7 @@ struct SpacePointsCalibConfParam : public o2::conf::ConfigurableParamHelper<Spac
   float maxSnp{.85f};    ///< max snp when propagating tracks
   float maxStep{2.f};    ///< maximum step for propagation
   bool debugTRDTOF{false}; ///< if true, ITS-TPC-TRD-TOF tracks and their seeding ITS-TPC-TRD track will both be interpolated and their residuals stored
+  int nThreads{1};         ///< number of threads used for the interpolation / extrapolation of the seeds
 
   // steering of map creation after the residuals have already been written to file
   bool fitVdrift{true};             ///< if vDrift should be extracted (TODO: currently from unbinned residuals in macro mode only)
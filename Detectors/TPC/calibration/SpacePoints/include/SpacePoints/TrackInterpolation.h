@@ -186,6 +186,19 @@ class TrackInterpolation
     std::bitset<param::NPadRows> flagRej{};
   };
 
+  /// Structure holding the output of the interpolation or extrapolation of a single seed.
+  /// The seeds are processed in parallel and the outputs are attached to the aggregated output vectors in seed order afterwards
+  struct SeedOutput {
+    o2::track::TrackParCov seed{};                      ///< the seed parameters after processing (committed back to mSeeds when the output is attached)
+    TrackData trackData{};                              ///< track quality information
+    TrackDataExtended trackDataExtended{};              ///< full tracking information for debugging (only filled in case mDumpTrackPoints is set)
+    TrackData trackDataUnfiltered{};                    ///< same as trackData, but before outlier filtering (only filled in case writeUnfiltered is set)
+    std::vector<UnbinnedResid> clRes{};                 ///< validated residuals for this seed
+    std::vector<TPCClusterResiduals> clResUnfiltered{}; ///< all residuals for this seed before outlier filtering
+    bool isValidated{false};                            ///< whether the track was validated and its residuals are to be stored
+    bool hasUnfiltered{false};                          ///< whether the unfiltered outputs were filled
+  };
+
   // -------------------------------------- processing functions --------------------------------------------------
 
   /// Initialize everything, set the requested track sources
@@ -207,12 +220,24 @@ class TrackInterpolation
   void process();
 
   /// Extrapolate ITS-only track through TPC and store residuals to TPC clusters along the way
-  /// \param seed index
-  void extrapolateTrack(int iSeed);
+  /// \param iSeed seed index
+  /// \param output structure the results are written to
+  void extrapolateTrack(int iSeed, SeedOutput& output);
 
   /// Interpolate ITS-TRD-TOF track inside TPC and store residuals to TPC clusters along the way
-  /// \param seed index
-  void interpolateTrack(int iSeed);
+  /// \param iSeed seed index
+  /// \param output structure the results are written to
+  void interpolateTrack(int iSeed, SeedOutput& output);
+
+  /// Interpolate or extrapolate the given seeds in parallel (SpacePointsCalibConfParam.nThreads threads)
+  /// \param seedIndices indices of the seeds to be processed
+  /// \return one output structure per seed, in the order of seedIndices
+  std::vector<SeedOutput> processSeedsInParallel(gsl::span<const int> seedIndices);
+
+  /// Append the output obtained for a single seed to the aggregated output vectors
+  /// \param output the result of interpolateTrack() or extrapolateTrack() for this seed
+  /// \param iSeed seed index
+  void attachSeedOutput(SeedOutput& output, int iSeed);
 
   /// Reset cache and output vectors
   void reset();
@@ -320,8 +345,7 @@ class TrackInterpolation
   std::vector<TPCClusterResiduals> mClResUnfiltered{}; ///< same as mClRes, but for all residuals before outlier filtering
 
   // cache
-  std::array<CacheStruct, constants::MAXGLOBALPADROW> mCache{{}}; ///< caching positions, covariances and angles for track extrapolations and interpolation
-  std::vector<o2::dataformats::GlobalTrackID> mGIDsSuccess;       ///< keep track of the GIDs which could be processed successfully
+  std::vector<o2::dataformats::GlobalTrackID> mGIDsSuccess; ///< keep track of the GIDs which could be processed successfully
 
   // helpers
   o2::trd::RecoParam mRecoParam;                      ///< parameters required for TRD refit
@@ -330,7 +354,7 @@ class TrackInterpolation
   float mBz;                                          ///< required for helix approximation
   bool mInitDone{false};                              ///< initialization done flag
 
-  ClassDefNV(TrackInterpolation, 1);
+  ClassDefNV(TrackInterpolation, 2);
 };
 
 } // namespace tpc
@@ -276,33 +276,51 @@ void TrackInterpolation::process()
   int maxOutputTracks = (mMaxTracksPerTF >= 0) ? mMaxTracksPerTF + mAddTracksForMapPerTF : nSeeds;
   mTrackData.reserve(maxOutputTracks);
   mClRes.reserve(maxOutputTracks * param::NPadRows);
-  bool maxTracksReached = false;
+
+  // apply the downsampling already here, since for rejected seeds nothing needs to be done at all
+  std::vector<int> seedsToProcess;
+  seedsToProcess.reserve(nSeeds);
   for (int iSeed = 0; iSeed < nSeeds; ++iSeed) {
-    if (mMaxTracksPerTF >= 0 && mTrackDataCompact.size() >= mMaxTracksPerTF + mAddTracksForMapPerTF) {
-      LOG(info) << "Maximum number of tracks per TF reached. Skipping the remaining " << nSeeds - iSeed << " tracks.";
-      break;
-    }
     int seedIndex = trackIndices[iSeed];
     if (mParams->enableTrackDownsampling && !isTrackSelected(mSeeds[seedIndex])) {
       continue;
     }
-    if (!mSingleSourcesConfigured && !mSourcesConfiguredMap[mGIDs[seedIndex].getSource()]) {
-      auto src = findValidSource(mSourcesConfiguredMap, static_cast<GTrackID::Source>(mGIDs[seedIndex].getSource()));
-      if (src == GTrackID::ITSTPCTRD || src == GTrackID::ITSTPC) {
-        LOGP(debug, "process: Found valid source {}", GTrackID::getSourceName(src));
-        mGIDs.push_back(mGIDtables[seedIndex][src]);
-        mGIDtables.push_back(mRecoCont->getSingleDetectorRefs(mGIDs.back()));
-        mTrackTimes.push_back(mTrackTimes[seedIndex]);
-        mSeeds.push_back(mSeeds[seedIndex]);
+    seedsToProcess.push_back(seedIndex);
+  }
+
+  // The seeds are interpolated / extrapolated in parallel in batches and the outputs are attached
+  // sequentially in seed order afterwards, so the results are identical to single-threaded processing.
+  // The batch size is bound by the maximum number of output tracks to limit the wasted work in case
+  // the limit is reached inside a batch.
+  const size_t batchSize = std::max(static_cast<size_t>(maxOutputTracks), static_cast<size_t>(1));
+  bool limitReached = false;
+  for (size_t iBatch = 0; iBatch < seedsToProcess.size() && !limitReached; iBatch += batchSize) {
+    const size_t nSeedsBatch = std::min(batchSize, seedsToProcess.size() - iBatch);
+    auto outputs = processSeedsInParallel(gsl::span<const int>(seedsToProcess.data() + iBatch, nSeedsBatch));
+    for (size_t i = 0; i < nSeedsBatch; ++i) {
+      if (mMaxTracksPerTF >= 0 && mTrackDataCompact.size() >= mMaxTracksPerTF + mAddTracksForMapPerTF) {
+        LOG(info) << "Maximum number of tracks per TF reached. Skipping the remaining " << seedsToProcess.size() - (iBatch + i) << " tracks.";
+        limitReached = true;
+        break;
       }
-    }
-    if (mMaxTracksPerTF >= 0 && mTrackDataCompact.size() >= mMaxTracksPerTF) {
-      LOG(debug) << "We already have reached mMaxTracksPerTF, but we continue to create seeds until mAddTracksForMapPerTF is also reached";
-      continue;
-    }
-    if (mGIDs[seedIndex].includesDet(DetID::TRD) || mGIDs[seedIndex].includesDet(DetID::TOF)) {
-      interpolateTrack(seedIndex);
-      if (mProcessSeeds) {
+      int seedIndex = seedsToProcess[iBatch + i];
+      if (!mSingleSourcesConfigured && !mSourcesConfiguredMap[mGIDs[seedIndex].getSource()]) {
+        auto src = findValidSource(mSourcesConfiguredMap, static_cast<GTrackID::Source>(mGIDs[seedIndex].getSource()));
+        if (src == GTrackID::ITSTPCTRD || src == GTrackID::ITSTPC) {
+          LOGP(debug, "process: Found valid source {}", GTrackID::getSourceName(src));
+          mGIDs.push_back(mGIDtables[seedIndex][src]);
+          mGIDtables.push_back(mRecoCont->getSingleDetectorRefs(mGIDs.back()));
+          mTrackTimes.push_back(mTrackTimes[seedIndex]);
+          mSeeds.push_back(mSeeds[seedIndex]);
+        }
+      }
+      if (mMaxTracksPerTF >= 0 && mTrackDataCompact.size() >= mMaxTracksPerTF) {
+        LOG(debug) << "We already have reached mMaxTracksPerTF, but we continue to create seeds until mAddTracksForMapPerTF is also reached";
+        continue;
+      }
+      mSeeds[seedIndex] = outputs[i].seed;
+      attachSeedOutput(outputs[i], seedIndex);
+      if (mProcessSeeds && (mGIDs[seedIndex].includesDet(DetID::TRD) || mGIDs[seedIndex].includesDet(DetID::TOF))) {
         if (mGIDs[seedIndex].includesDet(DetID::TRD) && mGIDs[seedIndex].includesDet(DetID::TOF)) {
           mGIDs.push_back(mGIDtables[seedIndex][GTrackID::ITSTPCTRD]);
           mGIDtables.push_back(mRecoCont->getSingleDetectorRefs(mGIDs.back()));
@@ -314,35 +332,43 @@ void TrackInterpolation::process()
         mTrackTimes.push_back(mTrackTimes[seedIndex]);
         mSeeds.push_back(mSeeds[seedIndex]);
       }
-    } else {
-      extrapolateTrack(seedIndex);
     }
   }
   if (mSeeds.size() > nSeeds) {
     LOGP(info, "Up to {} tracks out of {} additional seeds will be processed", mAddTracksForMapPerTF, mSeeds.size() - nSeeds);
   }
+  // these additional seeds exist only in case mProcessSeeds is set
+  std::vector<int> additionalSeeds;
+  additionalSeeds.reserve(mSeeds.size() - nSeeds);
   for (int iSeed = nSeeds; iSeed < (int)mSeeds.size(); ++iSeed) {
-    if (!mProcessSeeds && mAddTracksForMapPerTF > 0 && mTrackDataCompact.size() >= mMaxTracksPerTF + mAddTracksForMapPerTF) {
-      LOG(info) << "Maximum number of additional tracks per TF reached. Skipping the remaining " << mSeeds.size() - iSeed << " tracks.";
-      break;
-    }
-    // this loop will only be entered in case mProcessSeeds is set
-    LOGP(debug, "Processing additional track {}", mGIDs[iSeed].asString());
-    if (mGIDs[iSeed].includesDet(DetID::TRD) || mGIDs[iSeed].includesDet(DetID::TOF)) {
-      interpolateTrack(iSeed);
-    } else {
-      extrapolateTrack(iSeed);
+    additionalSeeds.push_back(iSeed);
+  }
+  limitReached = false;
+  for (size_t iBatch = 0; iBatch < additionalSeeds.size() && !limitReached; iBatch += batchSize) {
+    const size_t nSeedsBatch = std::min(batchSize, additionalSeeds.size() - iBatch);
+    auto outputs = processSeedsInParallel(gsl::span<const int>(additionalSeeds.data() + iBatch, nSeedsBatch));
+    for (size_t i = 0; i < nSeedsBatch; ++i) {
+      if (!mProcessSeeds && mAddTracksForMapPerTF > 0 && mTrackDataCompact.size() >= mMaxTracksPerTF + mAddTracksForMapPerTF) {
+        LOG(info) << "Maximum number of additional tracks per TF reached. Skipping the remaining " << additionalSeeds.size() - (iBatch + i) << " tracks.";
+        limitReached = true;
+        break;
+      }
+      int iSeed = additionalSeeds[iBatch + i];
+      LOGP(debug, "Processing additional track {}", mGIDs[iSeed].asString());
+      mSeeds[iSeed] = outputs[i].seed;
+      attachSeedOutput(outputs[i], iSeed);
     }
   }
   LOG(info) << "Could process " << mTrackData.size() << " tracks successfully";
 }
 
-void TrackInterpolation::interpolateTrack(int iSeed)
+void TrackInterpolation::interpolateTrack(int iSeed, SeedOutput& output)
 {
   LOGP(debug, "Starting track interpolation for GID {}", mGIDs[iSeed].asString());
   TrackData trackData;
   std::unique_ptr<TrackDataExtended> trackDataExtended;
   std::vector<TPCClusterResiduals> clusterResiduals;
+  std::array<CacheStruct, constants::MAXGLOBALPADROW> cache{{}}; // positions, covariances and angles for extrapolations and interpolation
   auto propagator = o2::base::Propagator::Instance();
   const auto& gidTable = mGIDtables[iSeed];
   const auto& trkTPC = mRecoCont->getTPCTrack(gidTable[GTrackID::TPC]);
@@ -350,7 +376,6 @@ void TrackInterpolation::interpolateTrack(int iSeed)
   if (mDumpTrackPoints) {
     trackDataExtended = std::make_unique<TrackDataExtended>();
     (*trackDataExtended).gid = mGIDs[iSeed];
-    (*trackDataExtended).clIdx.setFirstEntry(mClRes.size());
     (*trackDataExtended).trkITS = trkITS;
     (*trackDataExtended).trkTPC = trkTPC;
     auto nCl = trkITS.getNumberOfClusters();
@@ -362,12 +387,8 @@ void TrackInterpolation::interpolateTrack(int iSeed)
   }
   trackData.gid = mGIDs[iSeed];
   trackData.par = mSeeds[iSeed];
-  auto& trkWork = mSeeds[iSeed];
-  // reset the cache array (sufficient to set cluster available to zero)
-  for (auto& elem : mCache) {
-    elem.clAvailable = 0;
-  }
-  trackData.clIdx.setFirstEntry(mClRes.size()); // reference the first cluster residual belonging to this track
+  output.seed = mSeeds[iSeed];
+  auto& trkWork = output.seed; // work on a copy of the seed parameters, they are committed back to mSeeds when the output is attached
   float clusterTimeBinOffset = mTrackTimes[iSeed] / mTPCTimeBinMUS;
 
   // store the TPC cluster positions in the cache
@@ -378,19 +399,19 @@ void TrackInterpolation::interpolateTrack(int iSeed)
     float clTPCX;
     std::array<float, 2> clTPCYZ;
     mFastTransform->TransformIdeal(sector, row, clTPC.getPad(), clTPC.getTime(), clTPCX, clTPCYZ[0], clTPCYZ[1], clusterTimeBinOffset);
-    mCache[row].clSec = sector;
-    mCache[row].clAvailable = 1;
-    mCache[row].clY = clTPCYZ[0];
-    mCache[row].clZ = clTPCYZ[1];
-    mCache[row].clAngle = o2::math_utils::sector2Angle(sector);
+    cache[row].clSec = sector;
+    cache[row].clAvailable = 1;
+    cache[row].clY = clTPCYZ[0];
+    cache[row].clZ = clTPCYZ[1];
+    cache[row].clAngle = o2::math_utils::sector2Angle(sector);
   }
 
   // extrapolate seed through TPC and store track position at each pad row
   for (int iRow = 0; iRow < param::NPadRows; ++iRow) {
-    if (!mCache[iRow].clAvailable) {
+    if (!cache[iRow].clAvailable) {
       continue;
     }
-    if (!trkWork.rotate(mCache[iRow].clAngle)) {
+    if (!trkWork.rotate(cache[iRow].clAngle)) {
       LOG(debug) << "Failed to rotate track during first extrapolation";
       return;
     }
@@ -398,12 +419,12 @@ void TrackInterpolation::interpolateTrack(int iSeed)
       LOG(debug) << "Failed on first extrapolation";
       return;
     }
-    mCache[iRow].y[ExtOut] = trkWork.getY();
-    mCache[iRow].z[ExtOut] = trkWork.getZ();
-    mCache[iRow].sy2[ExtOut] = trkWork.getSigmaY2();
-    mCache[iRow].szy[ExtOut] = trkWork.getSigmaZY();
-    mCache[iRow].sz2[ExtOut] = trkWork.getSigmaZ2();
-    mCache[iRow].snp[ExtOut] = trkWork.getSnp();
+    cache[iRow].y[ExtOut] = trkWork.getY();
+    cache[iRow].z[ExtOut] = trkWork.getZ();
+    cache[iRow].sy2[ExtOut] = trkWork.getSigmaY2();
+    cache[iRow].szy[ExtOut] = trkWork.getSigmaZY();
+    cache[iRow].sz2[ExtOut] = trkWork.getSigmaZ2();
+    cache[iRow].snp[ExtOut] = trkWork.getSnp();
     //printf("Track alpha at row %i: %.2f, Y(%.2f), Z(%.2f)\n", iRow, trkWork.getAlpha(), trkWork.getY(), trkWork.getZ());
   }
 
@@ -491,7 +512,7 @@ void TrackInterpolation::interpolateTrack(int iSeed)
   // go back through the TPC and store updated track positions
   bool outerParamStored = false;
   for (int iRow = param::NPadRows; iRow--;) {
-    if (!mCache[iRow].clAvailable) {
+    if (!cache[iRow].clAvailable) {
       continue;
     }
     if (mProcessSeeds && !outerParamStored) {
@@ -503,7 +524,7 @@ void TrackInterpolation::interpolateTrack(int iSeed)
       trackData.par = trkWork;
       outerParamStored = true;
     }
-    if (!trkWork.rotate(mCache[iRow].clAngle)) {
+    if (!trkWork.rotate(cache[iRow].clAngle)) {
       LOG(debug) << "Failed to rotate track during back propagation";
       return;
     }
@@ -512,36 +533,36 @@ void TrackInterpolation::interpolateTrack(int iSeed)
       //printf("trkX(%.2f), clX(%.2f), clY(%.2f), clZ(%.2f), alphaTOF(%.2f)\n", trkWork.getX(), param::RowX[iRow], clTOFYZ[0], clTOFYZ[1], clTOFAlpha);
       return;
     }
-    mCache[iRow].y[ExtIn] = trkWork.getY();
-    mCache[iRow].z[ExtIn] = trkWork.getZ();
-    mCache[iRow].sy2[ExtIn] = trkWork.getSigmaY2();
-    mCache[iRow].szy[ExtIn] = trkWork.getSigmaZY();
-    mCache[iRow].sz2[ExtIn] = trkWork.getSigmaZ2();
-    mCache[iRow].snp[ExtIn] = trkWork.getSnp();
+    cache[iRow].y[ExtIn] = trkWork.getY();
+    cache[iRow].z[ExtIn] = trkWork.getZ();
+    cache[iRow].sy2[ExtIn] = trkWork.getSigmaY2();
+    cache[iRow].szy[ExtIn] = trkWork.getSigmaZY();
+    cache[iRow].sz2[ExtIn] = trkWork.getSigmaZ2();
+    cache[iRow].snp[ExtIn] = trkWork.getSnp();
   }
 
   // calculate weighted mean at each pad row (assume for now y and z are uncorrelated) and store residuals to TPC clusters
   unsigned short deltaRow = 0;
   for (int iRow = 0; iRow < param::NPadRows; ++iRow) {
-    if (!mCache[iRow].clAvailable) {
+    if (!cache[iRow].clAvailable) {
       ++deltaRow;
       continue;
     }
-    float wTotY = 1.f / mCache[iRow].sy2[ExtOut] + 1.f / mCache[iRow].sy2[ExtIn];
-    float wTotZ = 1.f / mCache[iRow].sz2[ExtOut] + 1.f / mCache[iRow].sz2[ExtIn];
-    mCache[iRow].y[Int] = (mCache[iRow].y[ExtOut] / mCache[iRow].sy2[ExtOut] + mCache[iRow].y[ExtIn] / mCache[iRow].sy2[ExtIn]) / wTotY;
-    mCache[iRow].z[Int] = (mCache[iRow].z[ExtOut] / mCache[iRow].sz2[ExtOut] + mCache[iRow].z[ExtIn] / mCache[iRow].sz2[ExtIn]) / wTotZ;
+    float wTotY = 1.f / cache[iRow].sy2[ExtOut] + 1.f / cache[iRow].sy2[ExtIn];
+    float wTotZ = 1.f / cache[iRow].sz2[ExtOut] + 1.f / cache[iRow].sz2[ExtIn];
+    cache[iRow].y[Int] = (cache[iRow].y[ExtOut] / cache[iRow].sy2[ExtOut] + cache[iRow].y[ExtIn] / cache[iRow].sy2[ExtIn]) / wTotY;
+    cache[iRow].z[Int] = (cache[iRow].z[ExtOut] / cache[iRow].sz2[ExtOut] + cache[iRow].z[ExtIn] / cache[iRow].sz2[ExtIn]) / wTotZ;
 
     // simple average w/o weighting for angle
-    mCache[iRow].snp[Int] = (mCache[iRow].snp[ExtOut] + mCache[iRow].snp[ExtIn]) / 2.f;
+    cache[iRow].snp[Int] = (cache[iRow].snp[ExtOut] + cache[iRow].snp[ExtIn]) / 2.f;
 
     TPCClusterResiduals res;
-    res.setDY(mCache[iRow].clY - mCache[iRow].y[Int]);
-    res.setDZ(mCache[iRow].clZ - mCache[iRow].z[Int]);
-    res.setY(mCache[iRow].y[Int]);
-    res.setZ(mCache[iRow].z[Int]);
-    res.setSnp(mCache[iRow].snp[Int]);
-    res.sec = mCache[iRow].clSec;
+    res.setDY(cache[iRow].clY - cache[iRow].y[Int]);
+    res.setDZ(cache[iRow].clZ - cache[iRow].z[Int]);
+    res.setY(cache[iRow].y[Int]);
+    res.setZ(cache[iRow].z[Int]);
+    res.setSnp(cache[iRow].snp[Int]);
+    res.sec = cache[iRow].clSec;
     res.dRow = deltaRow;
     clusterResiduals.push_back(std::move(res));
     deltaRow = 1;
@@ -558,7 +579,6 @@ void TrackInterpolation::interpolateTrack(int iSeed)
   TrackParams params; // for refitted track parameters and flagging rejected clusters
   if (mParams->skipOutlierFiltering || validateTrack(trackData, params, clusterResiduals)) {
     // track is good
-    int nClValidated = 0;
     int iRow = 0;
     for (unsigned int iCl = 0; iCl < clusterResiduals.size(); ++iCl) {
       iRow += clusterResiduals[iCl].dRow;
@@ -566,43 +586,39 @@ void TrackInterpolation::interpolateTrack(int iSeed)
         // skip masked cluster residual
         continue;
       }
-      ++nClValidated;
       float tgPhi = clusterResiduals[iCl].snp / std::sqrt((1.f - clusterResiduals[iCl].snp) * (1.f + clusterResiduals[iCl].snp));
-      mClRes.emplace_back(clusterResiduals[iCl].dy, clusterResiduals[iCl].dz, tgPhi, clusterResiduals[iCl].y, clusterResiduals[iCl].z, iRow, clusterResiduals[iCl].sec);
+      output.clRes.emplace_back(clusterResiduals[iCl].dy, clusterResiduals[iCl].dz, tgPhi, clusterResiduals[iCl].y, clusterResiduals[iCl].z, iRow, clusterResiduals[iCl].sec);
     }
-    trackData.clIdx.setEntries(nClValidated);
-    mTrackData.push_back(std::move(trackData));
+    trackData.clIdx.setEntries(output.clRes.size());
+    output.trackData = std::move(trackData);
     if (mDumpTrackPoints) {
-      (*trackDataExtended).clIdx.setEntries(nClValidated);
-      mTrackDataExtended.push_back(std::move(*trackDataExtended));
+      (*trackDataExtended).clIdx.setEntries(output.clRes.size());
+      output.trackDataExtended = std::move(*trackDataExtended);
     }
-    mGIDsSuccess.push_back(mGIDs[iSeed]);
-    mTrackDataCompact.emplace_back(mClRes.size() - nClValidated, nClValidated, mGIDs[iSeed].getSource());
+    output.isValidated = true;
   }
   if (mParams->writeUnfiltered) {
-    TrackData trkDataTmp = trackData;
-    trkDataTmp.clIdx.setFirstEntry(mClResUnfiltered.size());
+    TrackData trkDataTmp = output.isValidated ? output.trackData : trackData;
     trkDataTmp.clIdx.setEntries(clusterResiduals.size());
-    mTrackDataUnfiltered.push_back(std::move(trkDataTmp));
-    mClResUnfiltered.insert(mClResUnfiltered.end(), clusterResiduals.begin(), clusterResiduals.end());
+    output.trackDataUnfiltered = std::move(trkDataTmp);
+    output.clResUnfiltered = std::move(clusterResiduals);
+    output.hasUnfiltered = true;
   }
 }
 
-void TrackInterpolation::extrapolateTrack(int iSeed)
+void TrackInterpolation::extrapolateTrack(int iSeed, SeedOutput& output)
 {
-  // extrapolate ITS-only track through TPC and store residuals to TPC clusters in the output vectors
+  // extrapolate ITS-only track through TPC and store residuals to TPC clusters in the output structure
   LOGP(debug, "Starting track extrapolation for GID {}", mGIDs[iSeed].asString());
   const auto& gidTable = mGIDtables[iSeed];
   TrackData trackData;
   std::unique_ptr<TrackDataExtended> trackDataExtended;
   std::vector<TPCClusterResiduals> clusterResiduals;
-  trackData.clIdx.setFirstEntry(mClRes.size());
   const auto& trkITS = mRecoCont->getITSTrack(gidTable[GTrackID::ITS]);
   const auto& trkTPC = mRecoCont->getTPCTrack(gidTable[GTrackID::TPC]);
   if (mDumpTrackPoints) {
     trackDataExtended = std::make_unique<TrackDataExtended>();
     (*trackDataExtended).gid = mGIDs[iSeed];
-    (*trackDataExtended).clIdx.setFirstEntry(mClRes.size());
     (*trackDataExtended).trkITS = trkITS;
     (*trackDataExtended).trkTPC = trkTPC;
     auto nCl = trkITS.getNumberOfClusters();
@@ -615,7 +631,8 @@ void TrackInterpolation::extrapolateTrack(int iSeed)
   trackData.gid = mGIDs[iSeed];
   trackData.par = mSeeds[iSeed];
 
-  auto& trkWork = mSeeds[iSeed];
+  output.seed = mSeeds[iSeed];
+  auto& trkWork = output.seed; // work on a copy of the seed parameters, they are committed back to mSeeds when the output is attached
   float clusterTimeBinOffset = mTrackTimes[iSeed] / mTPCTimeBinMUS;
   auto propagator = o2::base::Propagator::Instance();
   unsigned short rowPrev = 0; // used to calculate dRow of two consecutive cluster residuals
@@ -674,7 +691,6 @@ void TrackInterpolation::extrapolateTrack(int iSeed)
   }
   if (mParams->skipOutlierFiltering || validateTrack(trackData, params, clusterResiduals)) {
     // track is good
-    int nClValidated = 0;
     int iRow = 0;
     for (unsigned int iCl = 0; iCl < clusterResiduals.size(); ++iCl) {
       iRow += clusterResiduals[iCl].dRow;
@@ -682,25 +698,61 @@ void TrackInterpolation::extrapolateTrack(int iSeed)
         // skip masked cluster residual
         continue;
       }
-      ++nClValidated;
       float tgPhi = clusterResiduals[iCl].snp / std::sqrt((1.f - clusterResiduals[iCl].snp) * (1.f + clusterResiduals[iCl].snp));
-      mClRes.emplace_back(clusterResiduals[iCl].dy, clusterResiduals[iCl].dz, tgPhi, clusterResiduals[iCl].y, clusterResiduals[iCl].z, iRow, clusterResiduals[iCl].sec);
+      output.clRes.emplace_back(clusterResiduals[iCl].dy, clusterResiduals[iCl].dz, tgPhi, clusterResiduals[iCl].y, clusterResiduals[iCl].z, iRow, clusterResiduals[iCl].sec);
     }
-    trackData.clIdx.setEntries(nClValidated);
-    mTrackData.push_back(std::move(trackData));
-    mGIDsSuccess.push_back(mGIDs[iSeed]);
-    mTrackDataCompact.emplace_back(mClRes.size() - nClValidated, nClValidated, mGIDs[iSeed].getSource());
+    trackData.clIdx.setEntries(output.clRes.size());
+    output.trackData = std::move(trackData);
     if (mDumpTrackPoints) {
-      (*trackDataExtended).clIdx.setEntries(nClValidated);
-      mTrackDataExtended.push_back(std::move(*trackDataExtended));
+      (*trackDataExtended).clIdx.setEntries(output.clRes.size());
+      output.trackDataExtended = std::move(*trackDataExtended);
     }
+    output.isValidated = true;
   }
   if (mParams->writeUnfiltered) {
-    TrackData trkDataTmp = trackData;
-    trkDataTmp.clIdx.setFirstEntry(mClResUnfiltered.size());
+    TrackData trkDataTmp = output.isValidated ? output.trackData : trackData;
     trkDataTmp.clIdx.setEntries(clusterResiduals.size());
-    mTrackDataUnfiltered.push_back(std::move(trkDataTmp));
-    mClResUnfiltered.insert(mClResUnfiltered.end(), clusterResiduals.begin(), clusterResiduals.end());
+    output.trackDataUnfiltered = std::move(trkDataTmp);
+    output.clResUnfiltered = std::move(clusterResiduals);
+    output.hasUnfiltered = true;
+  }
+}
+
+std::vector<TrackInterpolation::SeedOutput> TrackInterpolation::processSeedsInParallel(gsl::span<const int> seedIndices)
+{
+  std::vector<SeedOutput> outputs(seedIndices.size());
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(dynamic) num_threads(mParams->nThreads)
+#endif
+  for (size_t i = 0; i < seedIndices.size(); ++i) {
+    const int iSeed = seedIndices[i];
+    if (mGIDs[iSeed].includesDet(DetID::TRD) || mGIDs[iSeed].includesDet(DetID::TOF)) {
+      interpolateTrack(iSeed, outputs[i]);
+    } else {
+      extrapolateTrack(iSeed, outputs[i]);
+    }
+  }
+  return outputs;
+}
+
+void TrackInterpolation::attachSeedOutput(SeedOutput& output, int iSeed)
+{
+  if (output.isValidated) {
+    const auto nClValidated = output.clRes.size();
+    output.trackData.clIdx.setFirstEntry(mClRes.size()); // reference the first cluster residual belonging to this track
+    mClRes.insert(mClRes.end(), output.clRes.begin(), output.clRes.end());
+    mTrackData.push_back(std::move(output.trackData));
+    if (mDumpTrackPoints) {
+      output.trackDataExtended.clIdx.setFirstEntry(mClRes.size() - nClValidated);
+      mTrackDataExtended.push_back(std::move(output.trackDataExtended));
+    }
+    mGIDsSuccess.push_back(mGIDs[iSeed]);
+    mTrackDataCompact.emplace_back(mClRes.size() - nClValidated, nClValidated, mGIDs[iSeed].getSource());
+  }
+  if (output.hasUnfiltered) {
+    output.trackDataUnfiltered.clIdx.setFirstEntry(mClResUnfiltered.size());
+    mTrackDataUnfiltered.push_back(std::move(output.trackDataUnfiltered));
+    mClResUnfiltered.insert(mClResUnfiltered.end(), output.clResUnfiltered.begin(), output.clResUnfiltered.end());
   }
 }
 
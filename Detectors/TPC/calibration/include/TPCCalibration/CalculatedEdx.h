@@ -110,6 +110,16 @@ class CalculatedEdx
   ///                                                      GainResidual = residuals gain map from calibration container, dEdxResidual = residual dEdx correction
   void calculatedEdx(TrackTPC& track, dEdxInfo& output, float low = 0.05f, float high = 0.6f, CorrectionFlags mask = CorrectionFlags::TopologyPol | CorrectionFlags::GainFull | CorrectionFlags::GainResidual | CorrectionFlags::dEdxResidual);
 
+  /// get the truncated mean for a batch of tracks
+  /// the cluster charges and combined correction factors of all tracks are gathered into flat arrays first,
+  /// the corrections are then applied in one pass before the truncated means are calculated per track
+  /// \param tracks input tracks
+  /// \param outputs output dEdxInfo, resized to the number of input tracks
+  /// \param low lower cluster cut
+  /// \param high higher cluster cut
+  /// \param mask to apply different corrections, see calculatedEdx() for a single track
+  void calculatedEdx(std::vector<TrackTPC>& tracks, std::vector<dEdxInfo>& outputs, float low = 0.05f, float high = 0.6f, CorrectionFlags mask = CorrectionFlags::TopologyPol | CorrectionFlags::GainFull | CorrectionFlags::GainResidual | CorrectionFlags::dEdxResidual);
+
   /// get the truncated mean for the input charge vector and the truncation range low*nCl<nCl<high*nCl
   /// \param charge input vector
   /// \param low lower cluster cut (e.g. 0.05)
@@ -152,6 +162,12 @@ class CalculatedEdx
 
   std::array<std::vector<float>, 5> mChargeTotROC;
   std::array<std::vector<float>, 5> mChargeMaxROC;
+
+  std::vector<float> mBatchChargeTot;   ///< uncorrected total cluster charges of all tracks of a batch
+  std::vector<float> mBatchChargeMax;   ///< uncorrected maximum cluster charges of all tracks of a batch
+  std::vector<float> mBatchCorrTot;     ///< combined correction factors for the total cluster charges
+  std::vector<float> mBatchCorrMax;     ///< combined correction factors for the maximum cluster charges
+  std::vector<unsigned char> mBatchROC; ///< ROC type (0: IROC ... 3: OROC3) per cluster of a batch
 };
 
 } // namespace o2::tpc
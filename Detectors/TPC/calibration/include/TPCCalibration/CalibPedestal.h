@@ -131,16 +131,21 @@ class CalibPedestal : public CalibRawBase
   int mADCMin;                                      ///< minimum adc value
   int mADCMax;                                      ///< maximum adc value
   int mNumberOfADCs;                                ///< number of adc values (mADCMax-mADCMin+1)
+  size_t mNThreads;                                 ///< number of threads the ADC data is accumulated with
   StatisticsType mStatisticsType;                   ///< statistics type to be used for pedestal and noise evaluation
   std::unordered_map<std::string, CalPad> mCalDets; ///< CalDet objects for pedestal and noise
 
-  std::vector<std::unique_ptr<vectorType>> mADCdata; //!< ADC data to calculate noise and pedestal
+  std::vector<std::unique_ptr<vectorType>> mADCdata; //!< ADC data to calculate noise and pedestal, one set of ROC vectors per filling thread
 
   /// return the value vector for a readout chamber
   ///
   /// \param roc readout chamber
   /// \param create if to create the vector if it does not exist
-  vectorType* getVector(ROC roc, bool create = kFALSE);
+  /// \param thread index of the filling thread
+  vectorType* getVector(ROC roc, bool create = kFALSE, size_t thread = 0);
+
+  /// merge the per-thread accumulation buffers into the thread 0 buffer
+  void mergeThreadData();
 
   /// dummy reset
   void resetEvent() final {}
@@ -32,6 +32,7 @@ struct CalibPedestalParam : public o2::conf::ConfigurableParamHelper<CalibPedest
   int ADCMin{0};                                        ///< minimum adc value
   int ADCMax{120};                                      ///< maximum adc value
   StatisticsType StatType{StatisticsType::GausFitFast}; ///< statistics type to be used for pedestal and noise evaluation
+  int NThreads{1};                                      ///< number of threads used to process the CRUs of an event in parallel
 
   O2ParamDef(CalibPedestalParam, "TPCCalibPedestal");
 };
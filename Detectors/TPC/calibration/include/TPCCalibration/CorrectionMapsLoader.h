@@ -64,6 +64,10 @@ class CorrectionMapsLoader : public o2::gpu::CorrectionMapsHelper
   void copySettings(const CorrectionMapsLoader& src);
   void updateInverse(); /// recalculate inverse correction
 
+  /// restrict recalculation of the inverse correction to the given sectors (1 bit per sector, by default all)
+  void setInverseSectorMask(unsigned long long mask) { mInverseSectorMask = mask; }
+  unsigned long long getInverseSectorMask() const { return mInverseSectorMask; }
+
   static void requestCCDBInputs(std::vector<o2::framework::InputSpec>& inputs, std::vector<o2::framework::ConfigParamSpec>& options, const CorrectionMapsLoaderGloOpts& gloOpts);
   static void addGlobalOptions(std::vector<o2::framework::ConfigParamSpec>& options);
   static void addOptions(std::vector<o2::framework::ConfigParamSpec>& options);
@@ -73,8 +77,9 @@ class CorrectionMapsLoader : public o2::gpu::CorrectionMapsHelper
   static void addOption(std::vector<o2::framework::ConfigParamSpec>& options, o2::framework::ConfigParamSpec&& osp);
   static void addInput(std::vector<o2::framework::InputSpec>& inputs, o2::framework::InputSpec&& isp);
 
-  float mInstLumiCTPFactor = 1.0; // multiplicative factor for inst. lumi
-  int mLumiCTPSource = 0;         // 0: main, 1: alternative CTP lumi source
+  float mInstLumiCTPFactor = 1.0;             // multiplicative factor for inst. lumi
+  int mLumiCTPSource = 0;                     // 0: main, 1: alternative CTP lumi source
+  unsigned long long mInverseSectorMask = ~0ULL; // sectors for which the inverse correction is recalculated
   std::unique_ptr<GPUCA_NAMESPACE::gpu::TPCFastTransform> mCorrMapMShape{nullptr};
 #endif
 };
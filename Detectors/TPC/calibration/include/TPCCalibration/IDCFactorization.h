@@ -105,6 +105,11 @@ class IDCFactorization : public IDCGroupHelperSector
   /// calculate \Delta I(r,\phi,t) = I(r,\phi,t) / ( I_0(r,\phi) * I_1(t) )
   void calcIDCDelta();
 
+  /// calculate \Delta I(r,\phi,t) for a single chunk and side only. Can be used to compute, compress and emit the chunks one after another to bound the resident memory
+  /// \param chunk chunk of the IDCDelta
+  /// \param side side of the TPC
+  void calcIDCDelta(const unsigned int chunk, const Side side);
+
   /// calculate I_1(t) = <I(r,\phi,t) / I_0(r,\phi)>_{r,\phi}
   template <typename DataVec>
   static void calcIDCOne(const DataVec& idcsData, const int idcsPerCRU, const int integrationIntervalOffset, const unsigned int indexOffset, const CRU cru, std::vector<std::vector<float>>& idcOneTmp, const IDCZero* idcZero, const CalDet<PadFlags>* flagMap = nullptr, const bool usePadStatusMap = false);
@@ -64,6 +64,14 @@ class IDCFourierTransform : public IDCFourierTransformBase<Type>
   /// \param fft use FFTW3 or not (naive approach)
   static void setFFT(const bool fft) { sFftw = fft; }
 
+  /// use the sliding DFT which updates the coefficients incrementally from interval to interval instead of recalculating each interval from scratch
+  /// \param sliding use sliding DFT or not
+  template <bool IsEnabled = true, typename std::enable_if<(IsEnabled && (std::is_same<Type, IDCFourierTransformBaseAggregator>::value)), int>::type = 0>
+  static void setUseSlidingDFT(const bool sliding)
+  {
+    sSlidingDFT = sliding;
+  }
+
   /// This function has to be called before the constructor is called
   /// \param nThreads set the number of threads used for calculation of the fourier coefficients
   template <bool IsEnabled = true, typename std::enable_if<(IsEnabled && (std::is_same<Type, IDCFourierTransformBaseAggregator>::value)), int>::type = 0>
@@ -77,7 +85,11 @@ class IDCFourierTransform : public IDCFourierTransformBase<Type>
   void calcFourierCoefficients(const unsigned int timeFrames = 2000)
   {
     mFourierCoefficients.resize(timeFrames);
-    sFftw ? calcFourierCoefficientsFFTW3() : calcFourierCoefficientsNaive();
+    if (sSlidingDFT) {
+      calcFourierCoefficientsSliding();
+    } else {
+      sFftw ? calcFourierCoefficientsFFTW3() : calcFourierCoefficientsNaive();
+    }
   }
 
   /// calculate fourier coefficients for one TPC side
@@ -99,6 +111,9 @@ class IDCFourierTransform : public IDCFourierTransformBase<Type>
   /// get type of used fourier transform
   static bool getFFT() { return sFftw; }
 
+  /// get whether the sliding DFT is used
+  static bool getUseSlidingDFT() { return sSlidingDFT; }
+
   /// get the number of threads used for calculation of the fourier coefficients
   static int getNThreads() { return sNThreads; }
 
@@ -129,6 +144,7 @@ class IDCFourierTransform : public IDCFourierTransformBase<Type>
  private:
   FourierCoeff mFourierCoefficients;         ///< fourier coefficients. interval -> coefficient
   inline static int sFftw{1};                ///< using fftw or naive approach for calculation of fourier coefficients
+  inline static int sSlidingDFT{0};          ///< updating the coefficients incrementally between overlapping intervals instead of recalculating each interval from scratch
   inline static int sNThreads{1};            ///< number of threads which are used during the calculation of the fourier coefficients
   fftwf_plan mFFTWPlan{nullptr};             ///<! FFTW plan which is used during the ft
   std::vector<float*> mVal1DIDCs;            ///<! buffer for the 1D-IDC values for SIMD usage (each thread will get his one obejct)
@@ -140,6 +156,9 @@ class IDCFourierTransform : public IDCFourierTransformBase<Type>
   /// calculate fourier coefficients
   void calcFourierCoefficientsFFTW3();
 
+  /// calculate fourier coefficients by sliding the DFT window from interval to interval (each interval costs O(hop * nCoefficients) instead of O(rangeIDC * nCoefficients))
+  void calcFourierCoefficientsSliding();
+
   /// get IDC0 values from the inverse fourier transform. Can be used for debugging. std::vector<std::vector<float>>: first vector interval second vector IDC0 values
   std::vector<std::vector<float>> inverseFourierTransformNaive() const;
 
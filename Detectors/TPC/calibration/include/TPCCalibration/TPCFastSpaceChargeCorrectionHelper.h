@@ -101,7 +101,8 @@ class TPCFastSpaceChargeCorrectionHelper
   void initInverse(o2::gpu::TPCFastSpaceChargeCorrection& correction, bool prn);
 
   /// initialise inverse transformation from linear combination of several input corrections
-  void initInverse(std::vector<o2::gpu::TPCFastSpaceChargeCorrection*>& corrections, const std::vector<float>& scaling, bool prn);
+  /// only slices with their bit set in sliceMask are (re)initialised, by default all slices
+  void initInverse(std::vector<o2::gpu::TPCFastSpaceChargeCorrection*>& corrections, const std::vector<float>& scaling, bool prn, unsigned long long sliceMask = ~0ULL);
 
  private:
   /// geometry initialization
@@ -384,6 +384,228 @@ void CalculatedEdx::calculatedEdx(o2::tpc::TrackTPC& track, dEdxInfo& output, fl
   }
 }
 
+void CalculatedEdx::calculatedEdx(std::vector<o2::tpc::TrackTPC>& tracks, std::vector<dEdxInfo>& outputs, float low, float high, CorrectionFlags mask)
+{
+  outputs.resize(tracks.size());
+
+  // the debug streamer is filled per track, fall back to single track processing
+  if (mDebug) {
+    for (size_t iTrack = 0; iTrack < tracks.size(); ++iTrack) {
+      calculatedEdx(tracks[iTrack], outputs[iTrack], low, high, mask);
+    }
+    return;
+  }
+
+  struct TrackClusterCounts {
+    size_t firstCluster{0};
+    int nClsROC[4] = {0};
+    int nClsSubThreshROC[4] = {0};
+  };
+  std::vector<TrackClusterCounts> counts(tracks.size());
+
+  size_t nClustersTotal = 0;
+  for (const auto& track : tracks) {
+    nClustersTotal += track.getNClusterReferences();
+  }
+
+  mBatchChargeTot.clear();
+  mBatchChargeMax.clear();
+  mBatchCorrTot.clear();
+  mBatchCorrMax.clear();
+  mBatchROC.clear();
+  mBatchChargeTot.reserve(nClustersTotal);
+  mBatchChargeMax.reserve(nClustersTotal);
+  mBatchCorrTot.reserve(nClustersTotal);
+  mBatchCorrMax.reserve(nClustersTotal);
+  mBatchROC.reserve(nClustersTotal);
+
+  // gather the cluster charges and the combined correction factors of all tracks
+  for (size_t iTrack = 0; iTrack < tracks.size(); ++iTrack) {
+    auto& track = tracks[iTrack];
+    auto& trackCounts = counts[iTrack];
+    trackCounts.firstCluster = mBatchChargeTot.size();
+
+    const int nClusters = track.getNClusterReferences();
+    unsigned char rowIndexOld = 0;
+    unsigned char sectorIndexOld = 0;
+
+    for (int iCl = 0; iCl < nClusters; iCl++) {
+
+      const o2::tpc::ClusterNative& cl = track.getCluster(*mTPCTrackClIdxVecInput, iCl, *mClusterIndex);
+
+      unsigned char sectorIndex = 0;
+      unsigned char rowIndex = 0;
+      unsigned int clusterIndexNumb = 0;
+
+      // set sectorIndex, rowIndex, clusterIndexNumb
+      track.getClusterReference(*mTPCTrackClIdxVecInput, iCl, sectorIndex, rowIndex, clusterIndexNumb);
+
+      // get x position of the track
+      const float xPosition = Mapper::instance().getPadCentre(PadPos(rowIndex, 0)).X();
+
+      bool check = true;
+      if (!mPropagateTrack) {
+        if (mRefit == nullptr) {
+          LOGP(error, "mRefit is a nullptr, call the function setRefit() before looping over the tracks.");
+        }
+        mRefit->setTrackReferenceX(xPosition);
+        check = (mRefit->RefitTrackAsGPU(track, false, true) < 0) ? false : true;
+      } else {
+        // propagate this track to the plane X=xk (cm) in the field "b" (kG)
+        track.rotate(o2::math_utils::detail::sector2Angle<float>(sectorIndex));
+        check = o2::base::Propagator::Instance()->PropagateToXBxByBz(track, xPosition, 0.9f, 2., o2::base::Propagator::MatCorrType::USEMatCorrLUT);
+      }
+
+      if (!check || std::isnan(track.getParam(1))) {
+        rowIndexOld = rowIndex;
+        sectorIndexOld = sectorIndex;
+        continue;
+      }
+
+      // get region and charge value
+      const int region = Mapper::REGION[rowIndex];
+      float chargeTot = cl.qTot;
+      float chargeMax = cl.qMax;
+
+      // get pad and threshold
+      const unsigned char pad = std::clamp(static_cast<unsigned int>(cl.getPad() + 0.5f), static_cast<unsigned int>(0), Mapper::PADSPERROW[region][Mapper::getLocalRowFromGlobalRow(rowIndex)] - 1); // the left side of the pad is defined at e.g. 3.5 and the right side at 4.5
+      const float threshold = mCalibCont.getZeroSupressionThreshold(sectorIndex, rowIndex, pad);
+
+      // get stack and stack ID
+      const CRU cru(Sector(sectorIndex), region);
+      const auto stack = cru.gemStack();
+      StackID stackID{sectorIndex, stack};
+      const int rocType = int(stack);
+
+      // find missing clusters
+      int missingClusters = rowIndexOld - rowIndex - 1;
+      if ((missingClusters > 0) && (missingClusters <= mMaxMissingCl) && (sectorIndexOld == sectorIndex)) {
+        trackCounts.nClsSubThreshROC[rocType] += missingClusters;
+        trackCounts.nClsROC[rocType] += missingClusters;
+      };
+      rowIndexOld = rowIndex;
+      sectorIndexOld = sectorIndex;
+
+      // accumulate the correction factors, the polynomial topology correction depends on the
+      // charge corrected by the previous step, so the intermediate charges are tracked as well
+      float corrFactorTot = 1.0f;
+      float corrFactorMax = 1.0f;
+      if ((mask & CorrectionFlags::TopologySimple) == CorrectionFlags::TopologySimple) {
+        const float effectiveLength = getTrackTopologyCorrection(track, region);
+        corrFactorTot *= effectiveLength;
+        corrFactorMax *= effectiveLength;
+        chargeTot /= effectiveLength;
+        chargeMax /= effectiveLength;
+      };
+      if ((mask & CorrectionFlags::TopologyPol) == CorrectionFlags::TopologyPol) {
+        const float effectiveLengthTot = getTrackTopologyCorrectionPol(track, cl, region, chargeTot, ChargeType::Tot, threshold);
+        const float effectiveLengthMax = getTrackTopologyCorrectionPol(track, cl, region, chargeMax, ChargeType::Max, threshold);
+        corrFactorTot *= effectiveLengthTot;
+        corrFactorMax *= effectiveLengthMax;
+        chargeTot /= effectiveLengthTot;
+        chargeMax /= effectiveLengthMax;
+      };
+
+      float gain = 1.0f;
+      float gainResidual = 1.0f;
+      if ((mask & CorrectionFlags::GainFull) == CorrectionFlags::GainFull) {
+        gain = mCalibCont.getGain(sectorIndex, rowIndex, pad);
+      };
+      if ((mask & CorrectionFlags::GainResidual) == CorrectionFlags::GainResidual) {
+        gainResidual = mCalibCont.getResidualGain(sectorIndex, rowIndex, pad);
+      };
+      corrFactorTot *= gain * gainResidual;
+      corrFactorMax *= gain * gainResidual;
+
+      if ((mask & CorrectionFlags::dEdxResidual) == CorrectionFlags::dEdxResidual) {
+        const float corrTot = mCalibCont.getResidualCorrection(stackID, ChargeType::Tot, track.getTgl(), track.getSnp());
+        const float corrMax = mCalibCont.getResidualCorrection(stackID, ChargeType::Max, track.getTgl(), track.getSnp());
+        if (corrTot > 0) {
+          corrFactorTot *= corrTot;
+        };
+        if (corrMax > 0) {
+          corrFactorMax *= corrMax;
+        };
+      };
+
+      trackCounts.nClsROC[rocType]++;
+      mBatchChargeTot.emplace_back(cl.qTot);
+      mBatchChargeMax.emplace_back(cl.qMax);
+      mBatchCorrTot.emplace_back(corrFactorTot);
+      mBatchCorrMax.emplace_back(corrFactorMax);
+      mBatchROC.emplace_back(static_cast<unsigned char>(rocType));
+    }
+  }
+
+  // apply the gathered correction factors in one pass over the flat arrays
+  for (size_t i = 0; i < mBatchChargeTot.size(); ++i) {
+    mBatchChargeTot[i] /= mBatchCorrTot[i];
+    mBatchChargeMax[i] /= mBatchCorrMax[i];
+  }
+
+  // calculate the truncated means per track
+  for (size_t iTrack = 0; iTrack < tracks.size(); ++iTrack) {
+    auto& trackCounts = counts[iTrack];
+    const size_t lastCluster = (iTrack + 1 < tracks.size()) ? counts[iTrack + 1].firstCluster : mBatchChargeTot.size();
+    auto& output = outputs[iTrack];
+
+    for (auto& charge : mChargeTotROC) {
+      charge.clear();
+    }
+    for (auto& charge : mChargeMaxROC) {
+      charge.clear();
+    }
+
+    float minChargeTot = 100000.f;
+    float minChargeMax = 100000.f;
+
+    for (size_t i = trackCounts.firstCluster; i < lastCluster; ++i) {
+      const float chargeTot = mBatchChargeTot[i];
+      const float chargeMax = mBatchChargeMax[i];
+      const int rocType = mBatchROC[i];
+
+      if (chargeTot < minChargeTot) {
+        minChargeTot = chargeTot;
+      };
+      if (chargeMax < minChargeMax) {
+        minChargeMax = chargeMax;
+      };
+
+      mChargeTotROC[rocType].emplace_back(chargeTot);
+      mChargeMaxROC[rocType].emplace_back(chargeMax);
+      mChargeTotROC[4].emplace_back(chargeTot);
+      mChargeMaxROC[4].emplace_back(chargeMax);
+    }
+
+    // number of clusters
+    output.NHitsIROC = trackCounts.nClsROC[0] - trackCounts.nClsSubThreshROC[0];
+    output.NHitsOROC1 = trackCounts.nClsROC[1] - trackCounts.nClsSubThreshROC[1];
+    output.NHitsOROC2 = trackCounts.nClsROC[2] - trackCounts.nClsSubThreshROC[2];
+    output.NHitsOROC3 = trackCounts.nClsROC[3] - trackCounts.nClsSubThreshROC[3];
+
+    output.NHitsSubThresholdIROC = trackCounts.nClsROC[0];
+    output.NHitsSubThresholdOROC1 = trackCounts.nClsROC[1];
+    output.NHitsSubThresholdOROC2 = trackCounts.nClsROC[2];
+    output.NHitsSubThresholdOROC3 = trackCounts.nClsROC[3];
+
+    // fill subthreshold clusters
+    fillMissingClusters(trackCounts.nClsSubThreshROC, minChargeTot, minChargeMax, 0);
+
+    // calculate dEdx
+    output.dEdxTotIROC = getTruncMean(mChargeTotROC[0], low, high);
+    output.dEdxTotOROC1 = getTruncMean(mChargeTotROC[1], low, high);
+    output.dEdxTotOROC2 = getTruncMean(mChargeTotROC[2], low, high);
+    output.dEdxTotOROC3 = getTruncMean(mChargeTotROC[3], low, high);
+    output.dEdxTotTPC = getTruncMean(mChargeTotROC[4], low, high);
+
+    output.dEdxMaxIROC = getTruncMean(mChargeMaxROC[0], low, high);
+    output.dEdxMaxOROC1 = getTruncMean(mChargeMaxROC[1], low, high);
+    output.dEdxMaxOROC2 = getTruncMean(mChargeMaxROC[2], low, high);
+    output.dEdxMaxOROC3 = getTruncMean(mChargeMaxROC[3], low, high);
+    output.dEdxMaxTPC = getTruncMean(mChargeMaxROC[4], low, high);
+  }
+}
+
 float CalculatedEdx::getTruncMean(std::vector<float>& charge, float low, float high) const
 {
   // sort the charge vector
@@ -21,6 +21,12 @@
 #include "MathUtils/fit.h"
 #include "TPCCalibration/CalibPedestal.h"
 
+#if (defined(WITH_OPENMP) || defined(_OPENMP)) && !defined(__CLING__)
+#include <omp.h>
+#else
+static inline int omp_get_thread_num() { return 0; }
+#endif
+
 using namespace o2::tpc;
 using o2::math_utils::fit;
 using o2::math_utils::fitGaus;
@@ -34,6 +40,7 @@ CalibPedestal::CalibPedestal(PadSubset padSubset)
     mADCMin(20),
     mADCMax(140),
     mNumberOfADCs(mADCMax - mADCMin + 1),
+    mNThreads(1),
     mStatisticsType(StatisticsType::GausFitFast),
     mADCdata()
 
@@ -53,6 +60,11 @@ void CalibPedestal::init()
   mADCMax = param.ADCMax;
   mNumberOfADCs = mADCMax - mADCMin + 1;
   mStatisticsType = param.StatType;
+
+  // one set of accumulation buffers per thread processing the CRUs of an event
+  mNThreads = std::max(param.NThreads, 1);
+  mADCdata.resize(ROC::MaxROC * mNThreads);
+  rawreader::RawReaderCRUManager::setNThreads(mNThreads);
 }
 
 //______________________________________________________________________________
@@ -69,7 +81,8 @@ Int_t CalibPedestal::updateROC(const Int_t roc, const Int_t row, const Int_t pad
 
   const GlobalPadNumber padInROC = mMapper.getPadNumberInROC(PadROCPos(roc, row, pad));
   Int_t bin = padInROC * mNumberOfADCs + (adcValue - mADCMin);
-  vectorType& adcVec = *getVector(ROC(roc), kTRUE);
+  const size_t thread = std::min(static_cast<size_t>(omp_get_thread_num()), mNThreads - 1);
+  vectorType& adcVec = *getVector(ROC(roc), kTRUE, thread);
   ++(adcVec[bin]);
 
   // printf("bin: %5d, val: %.2f\n", bin, adcVec[bin]);
@@ -78,9 +91,10 @@ Int_t CalibPedestal::updateROC(const Int_t roc, const Int_t row, const Int_t pad
 }
 
 //______________________________________________________________________________
-CalibPedestal::vectorType* CalibPedestal::getVector(ROC roc, bool create /*=kFALSE*/)
+CalibPedestal::vectorType* CalibPedestal::getVector(ROC roc, bool create /*=kFALSE*/, size_t thread /*=0*/)
 {
-  vectorType* vec = mADCdata[roc].get();
+  const size_t index = roc + ROC::MaxROC * thread;
+  vectorType* vec = mADCdata[index].get();
   if (vec || !create) {
     return vec;
   }
@@ -90,20 +104,40 @@ CalibPedestal::vectorType* CalibPedestal::getVector(ROC roc, bool create /*=kFAL
   vec = new vectorType;
   vec->resize(numberOfPads * mNumberOfADCs);
 
-  mADCdata[roc] = std::unique_ptr<vectorType>(vec);
+  mADCdata[index] = std::unique_ptr<vectorType>(vec);
 
   return vec;
 }
 
+//______________________________________________________________________________
+void CalibPedestal::mergeThreadData()
+{
+  for (size_t thread = 1; thread < mNThreads; ++thread) {
+    for (size_t iroc = 0; iroc < ROC::MaxROC; ++iroc) {
+      auto threadVec = mADCdata[iroc + ROC::MaxROC * thread].get();
+      if (!threadVec) {
+        continue;
+      }
+      auto vec = getVector(ROC(iroc), kTRUE);
+      std::transform(vec->begin(), vec->end(), threadVec->begin(), vec->begin(), std::plus<>());
+      // zero the thread buffer to allow further accumulation and repeated calls to analyse
+      std::fill(threadVec->begin(), threadVec->end(), 0.f);
+    }
+  }
+}
+
 //______________________________________________________________________________
 void CalibPedestal::analyse()
 {
+  // accumulation buffers of all threads are merged into the thread 0 buffer before the analysis
+  mergeThreadData();
+
   ROC roc;
 
   std::vector<float> fitValues;
 
-  for (auto& vecPtr : mADCdata) {
-    auto vec = vecPtr.get();
+  for (size_t iroc = 0; iroc < ROC::MaxROC; ++iroc) {
+    auto vec = mADCdata[iroc].get();
     if (!vec) {
       ++roc;
       continue;
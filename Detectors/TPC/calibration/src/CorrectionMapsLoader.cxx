@@ -277,12 +277,17 @@ void CorrectionMapsLoader::copySettings(const CorrectionMapsLoader& src)
   mLumiCTPSource = src.mLumiCTPSource;
   mLumiScaleMode = src.mLumiScaleMode;
   mScaleInverse = src.getScaleInverse();
+  mInverseSectorMask = src.mInverseSectorMask;
 }
 
 void CorrectionMapsLoader::updateInverse()
 {
   if (mLumiScaleMode == 1 || mLumiScaleMode == 2) {
-    LOGP(info, "Recalculating the inverse correction");
+    if (mInverseSectorMask == ~0ULL) {
+      LOGP(info, "Recalculating the inverse correction");
+    } else {
+      LOGP(info, "Recalculating the inverse correction for sector mask 0x{:09x}", mInverseSectorMask);
+    }
     setUpdatedMap();
     std::vector<float> scaling{1, mLumiScale};
     std::vector<o2::gpu::TPCFastSpaceChargeCorrection*> corr{&(mCorrMap->getCorrection()), &(mCorrMapRef->getCorrection())};
@@ -290,7 +295,7 @@ void CorrectionMapsLoader::updateInverse()
       scaling.emplace_back(1);
       corr.emplace_back(&(mCorrMapMShape->getCorrection()));
     }
-    TPCFastSpaceChargeCorrectionHelper::instance()->initInverse(corr, scaling, false);
+    TPCFastSpaceChargeCorrectionHelper::instance()->initInverse(corr, scaling, false, mInverseSectorMask);
   } else {
     LOGP(info, "Reinitializing inverse correction with lumi scale mode {} not supported for now", mLumiScaleMode);
   }
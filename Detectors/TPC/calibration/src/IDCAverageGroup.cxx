@@ -266,6 +266,14 @@ void o2::tpc::IDCAverageGroup<Type>::loopOverGroups(IDCAverageGroupHelper<LoopTy
   unsigned int rowGrouped = 0;
   const bool applyWeights = mOverlapRows && mOverlapPads;
 
+  // the status map is indexed per CRU, look up the CalArray once instead of for every pad
+  const CalArray<PadFlags>* padStatusFlagsCRU = nullptr;
+  if constexpr (std::is_same_v<LoopType, IDCAverageGroupCRU> || std::is_same_v<LoopType, IDCAverageGroupTPC>) {
+    if (padStatusFlags) {
+      padStatusFlagsCRU = &padStatusFlags->getCalArray(idcStruct.getCRU());
+    }
+  }
+
   if (groupPadsSectorEdges) {
     const auto groupingType = idcStruct.getEdgePadGroupingType();
     const bool groupRowsEdge = groupingType == EdgePadGroupingMethod::ROWS;
@@ -291,8 +299,8 @@ void o2::tpc::IDCAverageGroup<Type>::loopOverGroups(IDCAverageGroupHelper<LoopTy
               const int padInRegion = Mapper::OFFSETCRULOCAL[region][irow] + ungroupedPad;
 
               if constexpr (std::is_same_v<LoopType, IDCAverageGroupCRU> || std::is_same_v<LoopType, IDCAverageGroupTPC>) {
-                if (padStatusFlags) {
-                  const auto flag = padStatusFlags->getCalArray(idcStruct.getCRU()).getValue(padInRegion);
+                if (padStatusFlagsCRU) {
+                  const auto flag = padStatusFlagsCRU->getValue(padInRegion);
                   if ((flag & PadFlags::flagSkip) == PadFlags::flagSkip) {
                     continue;
                   }
@@ -355,8 +363,8 @@ void o2::tpc::IDCAverageGroup<Type>::loopOverGroups(IDCAverageGroupHelper<LoopTy
             // averaging and grouping
             if constexpr (std::is_same_v<LoopType, IDCAverageGroupCRU> || std::is_same_v<LoopType, IDCAverageGroupTPC>) {
               // check status flag
-              if (padStatusFlags) {
-                const auto flag = padStatusFlags->getCalArray(idcStruct.getCRU()).getValue(padInRegion);
+              if (padStatusFlagsCRU) {
+                const auto flag = padStatusFlagsCRU->getValue(padInRegion);
                 if ((flag & PadFlags::flagSkip) == PadFlags::flagSkip) {
                   continue;
                 }
@@ -428,32 +428,36 @@ void o2::tpc::IDCFactorization::calcIDCOne(const DataVec& idcsData, const int id
 
 void o2::tpc::IDCFactorization::calcIDCDelta()
 {
-  const unsigned int nIDCsSide = mNIDCsPerSector * SECTORSPERSIDE;
   for (auto side : mSides) {
-    for (unsigned int i = 0; i < getNChunks(side); ++i) {
-      const auto idcsSide = nIDCsSide * getNIntegrationIntervalsInChunk(i);
-      mIDCDelta[mSideIndex[side]][i].getIDCDelta().clear();
-      mIDCDelta[mSideIndex[side]][i].getIDCDelta().resize(idcsSide);
+    for (unsigned int chunk = 0; chunk < getNChunks(side); ++chunk) {
+      calcIDCDelta(chunk, side);
     }
   }
+}
+
+void o2::tpc::IDCFactorization::calcIDCDelta(const unsigned int chunk, const Side side)
+{
+  const unsigned int nIDCsSide = mNIDCsPerSector * SECTORSPERSIDE;
+  const auto idcsSide = nIDCsSide * getNIntegrationIntervalsInChunk(chunk);
+  mIDCDelta[mSideIndex[side]][chunk].getIDCDelta().clear();
+  mIDCDelta[mSideIndex[side]][chunk].getIDCDelta().resize(idcsSide);
+
+  const unsigned int firstTF = chunk * getNTFsPerChunk(0);
+  const unsigned int lastTF = firstTF + getNTFsPerChunk(chunk);
 
 #pragma omp parallel for num_threads(sNThreads)
   for (unsigned int cruInd = 0; cruInd < mCRUs.size(); ++cruInd) {
     const unsigned int cru = mCRUs[cruInd];
     const o2::tpc::CRU cruTmp(cru);
+    if (cruTmp.side() != side) {
+      continue;
+    }
     const unsigned int region = cruTmp.region();
-    const auto side = cruTmp.side();
     const auto factorIndexGlob = mRegionOffs[region] + mNIDCsPerSector * (cruTmp.sector() % o2::tpc::SECTORSPERSIDE);
-    unsigned int integrationIntervallast = 0;
+    unsigned int integrationIntervallast = getNIntegrationIntervalsToChunk(chunk);
     unsigned int integrationIntervallastLocal = 0;
-    unsigned int lastChunk = 0;
-
-    for (unsigned int timeframe = 0; timeframe < mTimeFrames; ++timeframe) {
-      const unsigned int chunk = getChunk(timeframe);
-      if (lastChunk != chunk) {
-        integrationIntervallastLocal = 0;
-      }
 
+    for (unsigned int timeframe = firstTF; timeframe < lastTF; ++timeframe) {
       for (unsigned int idcs = 0; idcs < mIDCs[cru][timeframe].size(); ++idcs) {
         if ((mIDCs[cru][timeframe][idcs] == -1) || (mIDCs[cru][timeframe][idcs] == 0)) {
           continue;
@@ -479,7 +483,6 @@ void o2::tpc::IDCFactorization::calcIDCDelta()
       const unsigned int intervals = mIntegrationIntervalsPerTF[timeframe];
       integrationIntervallast += intervals;
       integrationIntervallastLocal += intervals;
-      lastChunk = chunk;
     }
   }
 }
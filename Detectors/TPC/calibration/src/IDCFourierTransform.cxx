@@ -15,6 +15,7 @@
 #include "Framework/Logger.h"
 #include "TFile.h"
 #include <fftw3.h>
+#include <complex>
 
 #if (defined(WITH_OPENMP) || defined(_OPENMP)) && !defined(__CLING__)
 #include <omp.h>
@@ -88,6 +89,62 @@ void o2::tpc::IDCFourierTransform<Type>::calcFourierCoefficientsNaive()
   normalizeCoefficients();
 }
 
+template <class Type>
+void o2::tpc::IDCFourierTransform<Type>::calcFourierCoefficientsSliding()
+{
+  LOGP(info, "calculating fourier coefficients for current TF using sliding DFT");
+
+  // check if IDCs are present for current side
+  if (this->getNIDCs() == 0) {
+    LOGP(warning, "no 1D-IDCs found!");
+    mFourierCoefficients.reset();
+    return;
+  }
+
+  const auto offsetIndex = this->getLastIntervals();
+  const std::vector<float>& idcOneExpanded{this->getExpandedIDCOne()}; // 1D-IDC values which will be used for the FT
+
+  // number of complex coefficients which are tracked (for an odd number of stored values the imaginary part of the last coefficient is dropped when storing)
+  const unsigned int nCoefficients = mFourierCoefficients.getNCoefficientsPerTF() / 2 + mFourierCoefficients.getNCoefficientsPerTF() % 2;
+  const double factor = o2::constants::math::TwoPI / this->mRangeIDC;
+
+  // the coefficients are accumulated in double precision to keep the rounding errors of the incremental updates negligible over all intervals
+  std::vector<std::complex<double>> dft(nCoefficients);
+
+  for (unsigned int interval = 0; interval < this->getNIntervals(); ++interval) {
+    if (interval == 0) {
+      // the first interval is calculated from scratch (see naive approach)
+      for (unsigned int coeff = 0; coeff < nCoefficients; ++coeff) {
+        std::complex<double> sum{};
+        for (unsigned int index = 0; index < this->mRangeIDC; ++index) {
+          sum += static_cast<double>(idcOneExpanded[index + offsetIndex[interval]]) * std::polar(1., -factor * coeff * index);
+        }
+        dft[coeff] = sum;
+      }
+    } else {
+      // consecutive windows overlap by all but 'hop' points: subtract the samples leaving the window, add the ones entering it and rotate the phase to the new window start
+      const unsigned int hop = offsetIndex[interval] - offsetIndex[interval - 1];
+      for (unsigned int coeff = 0; coeff < nCoefficients; ++coeff) {
+        std::complex<double> update{};
+        for (unsigned int index = 0; index < hop; ++index) {
+          const double deltaIDC = static_cast<double>(idcOneExpanded[offsetIndex[interval - 1] + this->mRangeIDC + index]) - idcOneExpanded[offsetIndex[interval - 1] + index];
+          update += deltaIDC * std::polar(1., -factor * coeff * index);
+        }
+        dft[coeff] = (dft[coeff] + update) * std::polar(1., factor * coeff * hop);
+      }
+    }
+
+    // store the coefficients for this interval
+    for (unsigned int coeff = 0; coeff < mFourierCoefficients.getNCoefficientsPerTF(); ++coeff) {
+      const double val = (coeff % 2) ? dft[coeff / 2].imag() : dft[coeff / 2].real();
+      mFourierCoefficients(mFourierCoefficients.getIndex(interval, coeff)) = static_cast<float>(val);
+    }
+  }
+
+  // normalize coefficient to number of used points
+  normalizeCoefficients();
+}
+
 template <class Type>
 void o2::tpc::IDCFourierTransform<Type>::calcFourierCoefficientsFFTW3()
 {
@@ -658,7 +658,7 @@ void TPCFastSpaceChargeCorrectionHelper::initInverse(o2::gpu::TPCFastSpaceCharge
   initInverse(corr, std::vector<float>{1}, prn);
 }
 
-void TPCFastSpaceChargeCorrectionHelper::initInverse(std::vector<o2::gpu::TPCFastSpaceChargeCorrection*>& corrections, const std::vector<float>& scaling, bool prn)
+void TPCFastSpaceChargeCorrectionHelper::initInverse(std::vector<o2::gpu::TPCFastSpaceChargeCorrection*>& corrections, const std::vector<float>& scaling, bool prn, unsigned long long sliceMask)
 {
   /// initialise inverse transformation
   TStopwatch watch;
@@ -679,6 +679,9 @@ void TPCFastSpaceChargeCorrectionHelper::initInverse(std::vector<o2::gpu::TPCFas
   tpcR2max = tpcR2max * tpcR2max;
 
   for (int slice = 0; slice < mGeo.getNumberOfSlices(); slice++) {
+    if (!(sliceMask & (1ULL << slice))) {
+      continue;
+    }
     // LOG(info) << "inverse transform for slice " << slice ;
     double vLength = (slice < mGeo.getNumberOfSlicesA()) ? mGeo.getTPCzLengthA() : mGeo.getTPCzLengthC();
 
@@ -0,0 +1,70 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+///
+/// @file   benchCalculatedEdx.cxx
+/// @brief  microbenchmark for the charge normalization and truncation used in the dEdx calculation
+///
+
+#include "TPCCalibration/CalculatedEdx.h"
+
+#include <benchmark/benchmark.h>
+#include <random>
+#include <vector>
+
+using namespace o2::tpc;
+
+namespace
+{
+
+std::vector<float> makeCharges(size_t n)
+{
+  std::mt19937 rng(n);
+  std::uniform_real_distribution<float> dist(20.f, 500.f);
+  std::vector<float> charges(n);
+  for (auto& charge : charges) {
+    charge = dist(rng);
+  }
+  return charges;
+}
+
+} // namespace
+
+static void BM_getTruncMean(benchmark::State& state)
+{
+  CalculatedEdx dEdxCalculator{};
+  const auto chargesRef = makeCharges(state.range(0));
+  std::vector<float> charges;
+
+  for (auto _ : state) {
+    charges = chargesRef;
+    benchmark::DoNotOptimize(dEdxCalculator.getTruncMean(charges, 0.05f, 0.6f));
+  }
+}
+
+static void BM_applyCorrections(benchmark::State& state)
+{
+  auto charges = makeCharges(state.range(0));
+  const auto corrections = makeCharges(state.range(0));
+
+  for (auto _ : state) {
+    for (size_t i = 0; i < charges.size(); ++i) {
+      charges[i] /= corrections[i];
+    }
+    benchmark::ClobberMemory();
+  }
+}
+
+// typical cluster counts of a single track and of batches of tracks
+BENCHMARK(BM_getTruncMean)->Arg(40)->Arg(80)->Arg(152);
+BENCHMARK(BM_applyCorrections)->Arg(152)->Arg(152 * 64)->Arg(152 * 1024);
+
+BENCHMARK_MAIN();
@@ -61,9 +61,10 @@ BOOST_AUTO_TEST_CASE(IDCFourierTransformAggregator_test)
   using FtType = IDCFourierTransform<IDCFourierTransformBaseAggregator>;
   gRandom->SetSeed(0);
 
-  for (int iType = 0; iType < 2; ++iType) {
-    const bool fft = iType == 0 ? false : true;
+  for (int iType = 0; iType < 3; ++iType) { // 0: naive, 1: fftw, 2: sliding DFT
+    const bool fft = iType == 1 ? true : false;
     FtType::setFFT(fft);
+    FtType::setUseSlidingDFT(iType == 2);
     FtType::setNThreads(2);
 
     FtType idcFourierTransform{rangeIDC, nFourierCoeff};
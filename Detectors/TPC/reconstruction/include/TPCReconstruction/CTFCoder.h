@@ -17,6 +17,7 @@
 #define O2_TPC_CTFCODER_H
 
 #include <algorithm>
+#include <functional>
 #include <iterator>
 #include <string>
 #include <cassert>
@@ -161,6 +162,9 @@ class CTFCoder : public o2::ctf::CTFCoderBase
   bool getCombineColumns() const { return mCombineColumns; }
   void setCombineColumns(bool v) { mCombineColumns = v; }
 
+  void setNThreadsEncode(int n) { mNThreadsEncode = n > 1 ? n : 1; }
+  int getNThreadsEncode() const { return mNThreadsEncode; }
+
  private:
   void checkDataDictionaryConsistency(const CTFHeader& h);
 
@@ -171,6 +175,7 @@ class CTFCoder : public o2::ctf::CTFCoderBase
   void buildCoder(ctf::CTFCoderBase::OpType coderType, const CTF::container_t& ctf, CTF::Slots slot);
 
   bool mCombineColumns = false; // combine correlated columns
+  int mNThreadsEncode = 1;      // encode independent columns concurrently
 };
 
 template <typename source_T>
@@ -230,17 +235,35 @@ o2::ctf::CTFIOSize CTFCoder::encode(VEC& buff, const CompressedClusters& ccl, co
   ec->setANSHeader(mANSVersion);
 
   o2::ctf::CTFIOSize iosize;
-  auto encodeTPC = [&buff, &optField, &coders = mCoders, mfc = this->getMemMarginFactor(), &iosize](auto begin, auto end, CTF::Slots slot, size_t probabilityBits, std::vector<bool>* reject = nullptr) {
-    // at every encoding the buffer might be autoexpanded, so we don't work with fixed pointer ec
+  // deferred per-column encoding tasks, executed concurrently when multi-threaded encoding is
+  // enabled: each task encodes its column into a private container, merged into buff in slot order
+  std::vector<std::function<o2::ctf::CTFIOSize(std::vector<o2::ctf::BufferType>&)>> encTasks;
+  auto filterInput = [](auto begin, auto end, const std::vector<bool>& reject) {
+    std::vector<std::decay_t<decltype(*begin)>> tmp;
+    tmp.reserve(std::distance(begin, end));
+    for (auto i = begin; i != end; i++) {
+      if (!reject[std::distance(begin, i)]) {
+        tmp.emplace_back(*i);
+      }
+    }
+    return tmp;
+  };
+  auto encodeTPC = [&buff, &optField, &encTasks, &filterInput, &coders = mCoders, mfc = this->getMemMarginFactor(), ansVersion = mANSVersion, nThreads = mNThreadsEncode, &iosize](auto begin, auto end, CTF::Slots slot, size_t probabilityBits, std::vector<bool>* reject = nullptr) {
     const auto slotVal = static_cast<int>(slot);
-    if (reject && begin != end) {
-      std::vector<std::decay_t<decltype(*begin)>> tmp;
-      tmp.reserve(std::distance(begin, end));
-      for (auto i = begin; i != end; i++) {
-        if (!(*reject)[std::distance(begin, i)]) {
-          tmp.emplace_back(*i);
+    if (nThreads > 1) { // encode later at slot 0 of a private container, merged into buff in the order of queuing
+      encTasks.emplace_back([begin, end, probabilityBits, reject, opt = optField[slotVal], &coder = coders[slotVal], mfc, ansVersion, &filterInput](std::vector<o2::ctf::BufferType>& sbuff) -> o2::ctf::CTFIOSize {
+        CTF::create(sbuff)->setANSHeader(ansVersion);
+        if (reject && begin != end) {
+          auto tmp = filterInput(begin, end, *reject);
+          return CTF::get(sbuff.data())->encode(tmp.begin(), tmp.end(), 0, probabilityBits, opt, &sbuff, coder, mfc);
         }
-      }
+        return CTF::get(sbuff.data())->encode(begin, end, 0, probabilityBits, opt, &sbuff, coder, mfc);
+      });
+      return;
+    }
+    // at every encoding the buffer might be autoexpanded, so we don't work with fixed pointer ec
+    if (reject && begin != end) {
+      auto tmp = filterInput(begin, end, *reject);
       iosize += CTF::get(buff.data())->encode(tmp.begin(), tmp.end(), slotVal, probabilityBits, optField[slotVal], &buff, coders[slotVal], mfc);
     } else {
       iosize += CTF::get(buff.data())->encode(begin, end, slotVal, probabilityBits, optField[slotVal], &buff, coders[slotVal], mfc);
@@ -314,6 +337,21 @@ o2::ctf::CTFIOSize CTFCoder::encode(VEC& buff, const CompressedClusters& ccl, co
   encodeTPC(trigComp.deltaBC.begin(), trigComp.deltaBC.end(), CTF::BLCTrigBCInc, 0);
   encodeTPC(trigComp.triggerType.begin(), trigComp.triggerType.end(), CTF::BLCTrigType, 0);
 
+  if (!encTasks.empty()) { // multi-threaded encoding was requested, process the queued columns
+    std::vector<std::vector<o2::ctf::BufferType>> encScratch(encTasks.size());
+    std::vector<o2::ctf::CTFIOSize> encSizes(encTasks.size());
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(dynamic) num_threads(mNThreadsEncode)
+#endif
+    for (int i = 0; i < int(encTasks.size()); i++) {
+      encSizes[i] = encTasks[i](encScratch[i]);
+    }
+    for (size_t i = 0; i < encTasks.size(); i++) { // tasks were queued in slot order, so the merged output is deterministic
+      iosize += encSizes[i];
+      CTF::get(buff.data())->appendBlockFrom(*CTF::get(encScratch[i].data()), 0, &buff);
+    }
+  }
+
   CTF::get(buff.data())->print(getPrefix(), mVerbosity);
   finaliseCTFOutput<CTF>(buff);
   iosize.rawIn = iosize.ctfIn;
@@ -1079,7 +1079,18 @@ class RawReaderCRUManager
   /// process event calling mADCDataCallback to process values
   void processEvent(uint32_t eventNumber, EndReaderCallback endReader = nullptr);
 
+  /// set the number of threads used to process the CRUs of an event in parallel
+  ///
+  /// for nThreads > 1 the callback functions are invoked concurrently,
+  /// so the data consumers have to ensure thread safety
+  /// \param nThreads number of threads
+  static void setNThreads(const int nThreads) { sNThreads = std::max(nThreads, 1); }
+
+  /// \return returns the number of threads used for parallel CRU processing
+  static int getNThreads() { return sNThreads; }
+
  private:
+  inline static int sNThreads{1};                              ///< number of threads used to process the CRUs of an event
   std::vector<std::unique_ptr<RawReaderCRU>> mRawReadersCRU{}; ///< cru type raw readers
   RawReaderCRUEventSync mEventSync{};                          ///< event synchronisation
   uint32_t mDebugLevel{0};                                     ///< debug level
@@ -55,6 +55,12 @@ bool raw_processing_helpers::processZSdata(const char* data, size_t size, rdh_ut
   int zsVersion = -1;
   int timeOffset = 0;
 
+  // cache of the channel -> pad position mapping of the presently decoded FEC,
+  // the mapping lookup is by far the most expensive part of the unpacking loop
+  // below and the FEC changes only rarely within one data block
+  std::array<PadPos, zerosupp_link_based::ChannelPerTBHeader> padPositions;
+  int fecInPartitionCached = -1;
+
   while (zsdata < zsdataEnd) {
     const auto& header = zsdata->cont.header;
 
@@ -103,8 +109,8 @@ bool raw_processing_helpers::processZSdata(const char* data, size_t size, rdh_ut
       continue;
     }
 
-    const auto channelBits = zsdata->getChannelBits();
-    const uint32_t expectedWords = std::ceil(channelBits.count() * 0.1f);
+    const uint32_t channelCount = __builtin_popcountll(header.bitMaskLow) + __builtin_popcountll(uint64_t(header.bitMaskHigh));
+    const uint32_t expectedWords = std::ceil(channelCount * 0.1f);
     const uint32_t numberOfWords = zsdata->getDataWords();
     assert(expectedWords == numberOfWords);
 
@@ -151,26 +157,38 @@ bool raw_processing_helpers::processZSdata(const char* data, size_t size, rdh_ut
       fecInPartition = header.fecInPartition;
     }
 
-    std::size_t processedChannels = 0;
-    for (std::size_t ichannel = 0; ichannel < channelBits.size(); ++ichannel) {
-      if (!channelBits[ichannel]) {
-        continue;
+    // (re-)fill the mapping cache in case the FEC changed
+    if (fecInPartition != fecInPartitionCached) {
+      for (std::size_t ichannel = 0; ichannel < padPositions.size(); ++ichannel) {
+        int sampaOnFEC{}, channelOnSAMPA{};
+        Mapper::getSampaAndChannelOnFEC(cruID, ichannel, sampaOnFEC, channelOnSAMPA);
+        padPositions[ichannel] = mapper.padSecPos(cru, fecInPartition, sampaOnFEC, channelOnSAMPA).getPadPos();
       }
+      fecInPartitionCached = fecInPartition;
+    }
 
-      // adc value
-      const auto adcValue = zsdata->getADCValueFloat(processedChannels);
+    // loop over the set bits of the channel mask directly instead of testing all 80 channels
+    std::size_t processedChannels = 0;
+    const std::array<uint64_t, 2> channelMasks{header.bitMaskLow, uint64_t(header.bitMaskHigh)};
+    for (std::size_t iMask = 0; iMask < channelMasks.size(); ++iMask) {
+      uint64_t mask = channelMasks[iMask];
+      const std::size_t channelOffset = iMask * 64;
+      while (mask) {
+        const std::size_t ichannel = channelOffset + __builtin_ctzll(mask);
+        mask &= mask - 1;
+
+        // adc value
+        const auto adcValue = zsdata->getADCValueFloat(processedChannels);
 
-      // mapping to row, pad sector
-      int sampaOnFEC{}, channelOnSAMPA{};
-      Mapper::getSampaAndChannelOnFEC(cruID, ichannel, sampaOnFEC, channelOnSAMPA);
-      const auto padSecPos = mapper.padSecPos(cru, fecInPartition, sampaOnFEC, channelOnSAMPA);
-      const auto& padPos = padSecPos.getPadPos();
+        // mapping to row, pad sector
+        const auto& padPos = padPositions[ichannel];
 
-      // add digit using callback
-      fillADC(int(cruID), int(padPos.getRow()), int(padPos.getPad()), timebin, adcValue);
+        // add digit using callback
+        fillADC(int(cruID), int(padPos.getRow()), int(padPos.getPad()), timebin, adcValue);
 
-      ++processedChannels;
-      hasData = true;
+        ++processedChannels;
+        hasData = true;
+      }
     }
 
     // go to next time bin
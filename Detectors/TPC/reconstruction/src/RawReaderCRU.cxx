@@ -1244,10 +1244,20 @@ void RawReaderCRUManager::processEvent(uint32_t eventNumber, EndReaderCallback e
 {
   const auto& cruSeen = mEventSync.getCRUSeen();
 
+  // group the active CRUs by their reader, a reader must only be processed by a single thread
+  std::vector<std::vector<size_t>> crusPerReader(mRawReadersCRU.size());
+  size_t nActiveCRUs = 0;
   for (size_t iCRU = 0; iCRU < cruSeen.size(); ++iCRU) {
-    const auto readerNumber = cruSeen[iCRU];
-    if (readerNumber >= 0) {
-      auto& reader = mRawReadersCRU[readerNumber];
+    if (cruSeen[iCRU] >= 0) {
+      crusPerReader[cruSeen[iCRU]].emplace_back(iCRU);
+      ++nActiveCRUs;
+    }
+  }
+
+#pragma omp parallel for schedule(dynamic) num_threads(sNThreads)
+  for (size_t iReader = 0; iReader < crusPerReader.size(); ++iReader) {
+    auto& reader = mRawReadersCRU[iReader];
+    for (const auto iCRU : crusPerReader[iReader]) {
       if (reader->getFillADCdataMap()) {
         LOGF(warning, "Filling of ADC data map not supported in RawReaderCRUManager::processEvent, it is disabled now. use ADCDataCallback");
         reader->setFillADCdataMap(false);
@@ -1255,9 +1265,12 @@ void RawReaderCRUManager::processEvent(uint32_t eventNumber, EndReaderCallback e
       reader->setEventNumber(eventNumber);
       reader->forceCRU(iCRU);
       reader->processLinks();
-      if (endReader) {
-        endReader();
-      }
+    }
+  }
+
+  if (endReader) {
+    for (size_t iCRU = 0; iCRU < nActiveCRUs; ++iCRU) {
+      endReader();
     }
   }
 }
@@ -117,6 +117,14 @@ class HitGroup : public o2::BaseHit
 
   ~HitGroup() = default;
 
+  HitGroup(HitGroup const&) = default;
+  HitGroup& operator=(HitGroup const&) = default;
+  // the declared destructor suppresses the implicit move operations; bring
+  // them back so that growing a std::vector<HitGroup> relocates the groups
+  // instead of deep-copying their hit containers
+  HitGroup(HitGroup&&) = default;
+  HitGroup& operator=(HitGroup&&) = default;
+
   void addHit(float x, float y, float z, float time, short e)
   {
 #ifdef HIT_AOS
@@ -1006,6 +1006,9 @@ void PoissonSolver<DataT>::interp3D(Vector& matricesCurrentV, const Vector& matr
 {
   // Do restrict 2 D for each slice
   if (newPhiSlice == 2 * oldPhiSlice) {
+    // each iteration writes only the disjoint pair of fine slices (m, m+1) and reads the coarse array,
+    // so the slices can be prolongated in parallel
+#pragma omp parallel for num_threads(sNThreads)
     for (int m = 0; m < newPhiSlice; m += 2) {
       // assuming no symmetry
       int mm = m / 2;
@@ -1114,6 +1117,9 @@ void PoissonSolver<DataT>::addInterp3D(Vector& matricesCurrentV, const Vector& m
 {
   // Do restrict 2 D for each slice
   if (newPhiSlice == 2 * oldPhiSlice) {
+    // as for interp3D the pair of fine slices (m, m+1) of an iteration is disjoint from all others,
+    // so the slices can be prolongated in parallel
+#pragma omp parallel for num_threads(sNThreads)
     for (int m = 0; m < newPhiSlice; m += 2) {
       // assuming no symmetry
       int mm = m / 2;
@@ -1225,6 +1231,9 @@ void PoissonSolver<DataT>::relax3D(Vector& matricesCurrentV, const Vector& matri
     // for each slice
     for (int iPass = 1; iPass <= 2; ++iPass) {
       const int msw = (iPass % 2) ? 1 : 2;
+      // one pass updates only vertices with fixed parity of (i + j + m) and reads only vertices of the opposite parity,
+      // so the phi slices of a pass are independent and can be processed in parallel without changing the result
+#pragma omp parallel for num_threads(sNThreads)
       for (int m = 0; m < iPhi; ++m) {
         const int jsw = ((msw + m) % 2) ? 1 : 2;
         int mp1 = m + 1;
@@ -1389,8 +1398,10 @@ template <typename DataT>
 void PoissonSolver<DataT>::restrict3D(Vector& matricesCurrentCharge, const Vector& residue, const int tnRRow, const int tnZColumn, const int newPhiSlice, const int oldPhiSlice) const
 {
   if (2 * newPhiSlice == oldPhiSlice) {
-    int mm = 0;
-    for (int m = 0; m < newPhiSlice; m++, mm += 2) {
+    // each coarse slice depends only on the residue of the finer grid, so the slices can be restricted in parallel
+#pragma omp parallel for num_threads(sNThreads)
+    for (int m = 0; m < newPhiSlice; m++) {
+      const int mm = 2 * m;
       // assuming no symmetry
       int mp1 = mm + 1;
       int mm1 = mm - 1;
@@ -1437,6 +1448,7 @@ void PoissonSolver<DataT>::restrict3D(Vector& matricesCurrentCharge, const Vecto
     } // end phis
 
   } else {
+#pragma omp parallel for num_threads(sNThreads) // no change
     for (int m = 0; m < newPhiSlice; ++m) {
       restrict2D(matricesCurrentCharge, residue, tnRRow, tnZColumn, m);
     }
@@ -571,6 +571,7 @@ void SpaceCharge<DataT>::poissonSolver(const Side side, const DataT stoppingConv
   initContainer(mDensity[side], true);
   initContainer(mPotential[side], true);
   PoissonSolver<DataT>::setConvergenceError(stoppingConvergence);
+  PoissonSolver<DataT>::setNThreads(sNThreads);
   PoissonSolver<DataT> poissonSolver(mGrid3D[0]);
   poissonSolver.poissonSolver3D(mPotential[side], mDensity[side], symmetry);
 }
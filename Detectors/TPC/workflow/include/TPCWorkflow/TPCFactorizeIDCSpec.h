@@ -67,6 +67,7 @@ class TPCFactorizeIDCSpec : public o2::framework::Task
     mDumpIDCs = ic.options().get<bool>("dump-IDCs");
     mOffsetCCDB = ic.options().get<bool>("add-offset-for-CCDB-timestamp");
     mDisableIDCDelta = ic.options().get<bool>("disable-IDCDelta");
+    mStreamingIDCDelta = ic.options().get<bool>("streaming-IDCDelta");
     mCalibFileDir = ic.options().get<std::string>("output-dir");
     if (mCalibFileDir != "/dev/null") {
       mCalibFileDir = o2::utils::Str::rectifyDirectory(mCalibFileDir);
@@ -194,6 +195,7 @@ class TPCFactorizeIDCSpec : public o2::framework::Task
   bool mDumpIDCs{false};                            ///< dump IDCs to file
   bool mOffsetCCDB{false};                          ///< flag for setting and offset for CCDB timestamp
   bool mDisableIDCDelta{false};                     ///< disable the processing and storage of IDCDelta
+  bool mStreamingIDCDelta{false};                   ///< compute, compress and send the IDCDelta chunk by chunk instead of holding all chunks in memory
   dataformats::Pair<long, int> mTFInfo{};           ///< orbit reset time for CCDB time stamp writing
   bool mEnableWritingPadStatusMap{false};           ///< do not store the pad status map in the CCDB
   o2::framework::DataTakingContext mDataTakingContext{};
@@ -304,6 +306,10 @@ class TPCFactorizeIDCSpec : public o2::framework::Task
           start = timer::now();
           for (unsigned int iChunk = 0; iChunk < mIDCFactorization.getNChunks(side); ++iChunk) {
             auto startGrouping = timer::now();
+            if (mStreamingIDCDelta) {
+              // the IDCDelta was not calculated during the factorization: calculate the current chunk only, which is released again after the grouping
+              mIDCFactorization.calcIDCDelta(iChunk, side);
+            }
             mIDCGrouping.setIDCs(std::move(mIDCFactorization).getIDCDeltaUncompressed(iChunk, side), side);
             mIDCGrouping.processIDCs(mIDCFactorization.getUsePadStatusMap() ? mPadFlagsMap.get() : nullptr);
             auto stopGrouping = timer::now();
@@ -420,8 +426,8 @@ class TPCFactorizeIDCSpec : public o2::framework::Task
       mIDCFactorization.dumpLargeObjectToFile(fmt::format("{}Factorized_TF_{:02}_TS_{}.root", getCurrentType(), mTFFirst, mTimestampStart).data());
     }
 
-    const bool calcDeltas = mDumpIDCDeltaCalibData || !mDisableIDCDelta;
-    mIDCFactorization.factorizeIDCs(true, calcDeltas); // calculate DeltaIDC, 0D-IDC, 1D-IDC
+    const bool calcDeltas = (mDumpIDCDeltaCalibData || !mDisableIDCDelta) && !mStreamingIDCDelta; // in streaming mode the IDCDelta is calculated chunk by chunk when creating the CCDB objects
+    mIDCFactorization.factorizeIDCs(true, calcDeltas);                                            // calculate DeltaIDC, 0D-IDC, 1D-IDC
 
     if (mDumpIDC0) {
       LOGP(info, "dumping IDC Zero to file");
@@ -503,6 +509,7 @@ DataProcessorSpec getTPCFactorizeIDCSpec(const int lane, const std::vector<uint3
             {"dump-IDC0", VariantType::Bool, false, {"Dump IDC0 to file"}},
             {"dump-IDC1", VariantType::Bool, false, {"Dump IDC1 to file"}},
             {"disable-IDCDelta", VariantType::Bool, false, {"Disable processing of IDCDelta and storage in the CCDB"}},
+            {"streaming-IDCDelta", VariantType::Bool, false, {"Compute, compress and send the IDCDelta chunk by chunk to bound the memory usage"}},
             {"dump-IDCDelta", VariantType::Bool, false, {"Dump IDCDelta to file"}},
             {"dump-IDCDelta-calib-data", VariantType::Bool, false, {"Dump IDCDelta as calibration data to file"}},
             {"add-offset-for-CCDB-timestamp", VariantType::Bool, false, {"Add an offset of 1 hour for the validity range of the CCDB objects"}},
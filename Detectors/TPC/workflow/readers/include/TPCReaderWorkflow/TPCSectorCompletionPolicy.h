@@ -55,6 +55,13 @@ namespace tpc
 /// used for processors with TPC input and other inputs, without checking for complex multimessages on
 /// the other inputs.
 ///
+/// With config flag Config::StreamSectors (or a bool pointer controlled e.g. by a command line option),
+/// the policy consumes the sector data which is already present instead of waiting for the full set of
+/// active sectors. Sector-local consumers like QC or some calibrations are then invoked as the sectors
+/// arrive and can start early within the TF period; the data set is finally consumed when all (masked)
+/// sectors have been seen. Consumers must accumulate their results over multiple invocations per
+/// time slice when this mode is enabled.
+///
 /// Parameters:
 ///   processor name   rexexp to match a name of the processor for which the policy should be applied
 ///   input matchers   provided as an argument pack
@@ -74,6 +81,8 @@ class TPCSectorCompletionPolicy
   enum struct Config {
     // require data on all other inputs in addition to the ones checked for the sector completion
     RequireAll,
+    // consume sector data as it arrives instead of waiting for the full set of active sectors
+    StreamSectors,
   };
   TPCSectorCompletionPolicy() = delete;
   template <typename... Args>
@@ -91,7 +100,7 @@ class TPCSectorCompletionPolicy
       return std::regex_match(device.name.begin(), device.name.end(), std::regex(expression.c_str()));
     };
 
-    auto callback = [bRequireAll = mRequireAll, inputMatchers = mInputMatchers, externalInputMatchers = mExternalInputMatchers, pTpcSectorMask = mTpcSectorMask, orderCheck = mOrderCheck](framework::InputSpan const& inputs, auto const&, auto&) -> framework::CompletionPolicy::CompletionOp {
+    auto callback = [bRequireAll = mRequireAll, bStreamSectors = mStreamSectors, pStreamSectors = mStreamSectorsPtr, inputMatchers = mInputMatchers, externalInputMatchers = mExternalInputMatchers, pTpcSectorMask = mTpcSectorMask, orderCheck = mOrderCheck](framework::InputSpan const& inputs, auto const&, auto&) -> framework::CompletionPolicy::CompletionOp {
       unsigned long tpcSectorMask = pTpcSectorMask ? *pTpcSectorMask : 0xFFFFFFFFF;
       std::bitset<NSectors> validSectors = 0;
       bool haveMatchedInput = false;
@@ -168,6 +177,14 @@ class TPCSectorCompletionPolicy
       }
 
       o2::framework::CompletionPolicy::CompletionOp retVal = framework::CompletionPolicy::CompletionOp::Wait;
+      // In streaming mode the sectors which are already there are consumed right away, so that
+      // sector-local consumers can start processing without waiting for the full set. The headers
+      // of the processed parts are kept, the accumulated sector bits eventually complete the set
+      // and the data is consumed for good.
+      if ((bStreamSectors || (pStreamSectors && *pStreamSectors)) && haveMatchedInput && validSectors.any() &&
+          activeSectors != validSectors.to_ulong()) {
+        return framework::CompletionPolicy::CompletionOp::ConsumeExisting;
+      }
       // If the flag Config::RequireAll is set in the constructor arguments we require
       // data from all inputs in addition to the sector matching condition
       // To be fully correct we would need to require data from all inputs not going
@@ -223,6 +240,9 @@ class TPCSectorCompletionPolicy
         case Config::RequireAll:
           mRequireAll = true;
           break;
+        case Config::StreamSectors:
+          mStreamSectors = true;
+          break;
       }
     } else if constexpr (std::is_same_v<Type, std::vector<o2::framework::InputSpec>*>) {
       mExternalInputMatchers = arg;
@@ -230,6 +250,9 @@ class TPCSectorCompletionPolicy
       mOrderCheck = arg;
     } else if constexpr (std::is_same_v<Type, unsigned long*> || std::is_same_v<Type, const unsigned long*>) {
       mTpcSectorMask = arg;
+    } else if constexpr (std::is_same_v<Type, bool*> || std::is_same_v<Type, const bool*>) {
+      // runtime switch for the streaming mode, e.g. set from a command line option
+      mStreamSectorsPtr = arg;
     } else {
       static_assert(framework::always_static_assert_v<Type>);
     }
@@ -246,7 +269,9 @@ class TPCSectorCompletionPolicy
   // - They are all matched independently, it is not sufficient that one of them is present for all sectors
   const std::vector<framework::InputSpec>* mExternalInputMatchers = nullptr;
   const unsigned long* mTpcSectorMask = nullptr;
+  const bool* mStreamSectorsPtr = nullptr;
   bool mRequireAll = false;
+  bool mStreamSectors = false;
 };
 } // namespace tpc
 } // namespace o2
@@ -185,10 +185,10 @@ DataProcessorSpec getClusterDecoderRawSpec(bool sendMC)
           LOG(info) << "sending " << mcout.getIndexedSize()
                     << " label object(s)" << std::endl;
         }
-        // serialize the complete list of MC label containers
-        ConstMCLabelContainer labelsFlat;
+        // serialize the complete list of MC label containers directly into a
+        // DPL owned (shared memory) buffer, avoiding an intermediate flat copy
+        auto& labelsFlat = pc.outputs().make<ConstMCLabelContainer>(Output{gDataOriginTPC, DataDescription("CLNATIVEMCLBL"), fanSpec, std::move(mcHeaderStack)});
         mcout.flatten_to(labelsFlat);
-        pc.outputs().snapshot(Output{gDataOriginTPC, DataDescription("CLNATIVEMCLBL"), fanSpec, std::move(mcHeaderStack)}, labelsFlat);
       }
     };
 
@@ -56,8 +56,11 @@ class ClusterQCDevice : public Task
   uint64_t mLastCreation{0};          ///< last creation time of analysis interval
   uint32_t mRunNumber{0};             ///< run number
   int mMaxTFPerFile{-1};              ///< maximum number of TFs per file
+  uint32_t mLastSeenTF{0};            ///< TF of the last invocation, to detect repeated invocations in streaming mode
   std::string mOutputFileName;        ///< output file name
   bool mNewInterval{true};            ///< start a new interval
+  bool mHaveSeenTF{false};            ///< whether mLastSeenTF is valid
+  bool mSkipCurrentTF{false};         ///< whether the current TF is skipped (processEveryNthTF)
   qc::Clusters mClusterQC;            ///< cluster QC
 };
 
@@ -81,9 +84,20 @@ void ClusterQCDevice::init(framework::InitContext& ic)
 
 void ClusterQCDevice::run(ProcessingContext& pc)
 {
-  if (mTFCounter++ % mProcessEveryNthTF) {
-    const auto currentTF = processing_helpers::getCurrentTF(pc);
-    LOGP(info, "Skipping TF {}", currentTF);
+  // with a streaming completion policy (--streaming-sectors) the task is invoked several
+  // times per time frame, with the sector data which has arrived so far; the per-TF
+  // bookkeeping must only be done on the first invocation of each TF
+  const auto currentTF = processing_helpers::getCurrentTF(pc);
+  const bool newTF = !mHaveSeenTF || currentTF != mLastSeenTF;
+  if (newTF) {
+    mHaveSeenTF = true;
+    mLastSeenTF = currentTF;
+    mSkipCurrentTF = (mTFCounter++ % mProcessEveryNthTF) != 0;
+    if (mSkipCurrentTF) {
+      LOGP(info, "Skipping TF {}", currentTF);
+    }
+  }
+  if (mSkipCurrentTF) {
     return;
   }
 
@@ -110,9 +124,12 @@ void ClusterQCDevice::run(ProcessingContext& pc)
     }
   }
 
-  mClusterQC.endTF();
-  if ((mMaxTFPerFile > 0) && (mClusterQC.getProcessedTFs() % mMaxTFPerFile) == 0) {
-    endInterval();
+  if (newTF) {
+    // count each TF once, also when it is delivered in several sector batches
+    mClusterQC.endTF();
+    if ((mMaxTFPerFile > 0) && (mClusterQC.getProcessedTFs() % mMaxTFPerFile) == 0) {
+      endInterval();
+    }
   }
 }
 
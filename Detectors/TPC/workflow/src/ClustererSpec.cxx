@@ -134,9 +134,10 @@ DataProcessorSpec getClustererSpec(bool sendMC)
       auto outputPages = pc.outputs().make<ClusterHardwareContainer8kb>(Output{gDataOriginTPC, "CLUSTERHW", fanSpec, {*sectorHeader}}, clusterArray.size());
       std::copy(clusterArray.begin(), clusterArray.end(), outputPages.begin());
       if (DataRefUtils::isValid(mclabelref)) {
-        ConstMCLabelContainer mcflat;
-        mctruthArray.flatten_to(mcflat);
-        pc.outputs().snapshot(Output{gDataOriginTPC, "CLUSTERHWMCLBL", fanSpec, {*sectorHeader}}, mcflat);
+        // flatten directly into a DPL owned (shared memory) buffer instead of
+        // going via an intermediate flat copy which snapshot would copy again
+        auto& sharedlabels = pc.outputs().make<ConstMCLabelContainer>(Output{gDataOriginTPC, "CLUSTERHWMCLBL", fanSpec, {*sectorHeader}});
+        mctruthArray.flatten_to(sharedlabels);
       }
     };
 
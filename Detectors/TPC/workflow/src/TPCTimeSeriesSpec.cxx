@@ -46,6 +46,12 @@
 #include "ReconstructionDataFormats/MatchInfoTOF.h"
 #include "DataFormatsTOF/Cluster.h"
 
+#ifdef WITH_OPENMP
+#include <omp.h>
+#else
+static inline int omp_get_thread_num() { return 0; }
+#endif
+
 using namespace o2::globaltracking;
 using GTrackID = o2::dataformats::GlobalTrackID;
 using TrkSrc = o2::dataformats::VtxTrackIndex::Source;
@@ -385,46 +391,13 @@ class TPCTimeSeries : public Task
     using timer = std::chrono::high_resolution_clock;
     auto startTotal = timer::now();
 
-    // loop over tracks and calculate DCAs
-    if (loopEnd < nTracks) {
-      // draw random tracks
-      std::vector<size_t> ind(nTracks);
-      std::iota(ind.begin(), ind.end(), 0);
-      std::minstd_rand rng(std::time(nullptr));
-      std::shuffle(ind.begin(), ind.end(), rng);
-
-      auto myThread = [&](int iThread) {
-        for (size_t i = iThread; i < loopEnd; i += mNThreads) {
-          if (acceptTrack(tracksTPC[i])) {
-            fillDCA(tracksTPC, tracksITSTPC, vertices, i, iThread, indicesITSTPC, tracksITS, idxTPCTrackToTOFCluster, tofClusters);
-          }
-        }
-      };
-
-      std::vector<std::thread> threads(mNThreads);
-      for (int i = 0; i < mNThreads; i++) {
-        threads[i] = std::thread(myThread, i);
-      }
-
-      for (auto& th : threads) {
-        th.join();
-      }
-    } else {
-      auto myThread = [&](int iThread) {
-        for (size_t i = iThread; i < loopEnd; i += mNThreads) {
-          if (acceptTrack(tracksTPC[i])) {
-            fillDCA(tracksTPC, tracksITSTPC, vertices, i, iThread, indicesITSTPC, tracksITS, idxTPCTrackToTOFCluster, tofClusters);
-          }
-        }
-      };
-
-      std::vector<std::thread> threads(mNThreads);
-      for (int i = 0; i < mNThreads; i++) {
-        threads[i] = std::thread(myThread, i);
-      }
-
-      for (auto& th : threads) {
-        th.join();
+    // loop over tracks and calculate DCAs (the OpenMP runtime keeps its worker threads alive across TFs)
+#ifdef WITH_OPENMP
+#pragma omp parallel for num_threads(mNThreads)
+#endif
+    for (size_t i = 0; i < loopEnd; ++i) {
+      if (acceptTrack(tracksTPC[i])) {
+        fillDCA(tracksTPC, tracksITSTPC, vertices, i, omp_get_thread_num(), indicesITSTPC, tracksITS, idxTPCTrackToTOFCluster, tofClusters);
       }
     }
 
@@ -1019,6 +992,8 @@ class TPCTimeSeries : public Task
   float mMIPdEdx{50};                                                      ///< MIP dEdx position for MIP/dEdx monitoring
   std::vector<int> mNTracksWindow;                                         ///< number of tracks in time window
   std::vector<int> mNearestVtxTPC;                                         ///< nearest vertex for tpc tracks
+  std::vector<float> mTimesVtx;                                            ///< scratch buffer for the vertex times (reused across TFs)
+  std::vector<float> mTimesTracks;                                         ///< scratch buffer for the track times (reused across TFs)
   o2::tpc::VDriftHelper mTPCVDriftHelper{};                                ///< helper for v-drift
   float mVDrift{2.64};                                                     ///< v drift in mus
   float mMaxSnp{0.85};                                                     ///< max sinus phi for propagation
@@ -1479,41 +1454,33 @@ class TPCTimeSeries : public Task
     }
 
     // store timestamps of vertices. Assume vertices are already sorted in time!
-    std::vector<float> times_vtx;
+    auto& times_vtx = mTimesVtx;
+    times_vtx.clear();
     times_vtx.reserve(nVertices);
     for (const auto& vtx : vertices) {
       times_vtx.emplace_back(vtx.getTimeStamp().getTimeStamp());
     }
 
     // loop over tpc tracks and find nearest vertex
-    auto myThread = [&](int iThread) {
-      for (int i = iThread; i < nTracks; i += mNThreads) {
-        const float timeTrack = o2::tpc::ParameterElectronics::Instance().ZbinWidth * tracksTPC[i].getTime0();
-        const auto lower = std::lower_bound(times_vtx.begin(), times_vtx.end(), timeTrack);
-        int closestVtx = std::distance(times_vtx.begin(), lower);
-        // if value is out of bounds use last value
-        if (closestVtx == nVertices) {
+#ifdef WITH_OPENMP
+#pragma omp parallel for num_threads(mNThreads)
+#endif
+    for (int i = 0; i < nTracks; ++i) {
+      const float timeTrack = o2::tpc::ParameterElectronics::Instance().ZbinWidth * tracksTPC[i].getTime0();
+      const auto lower = std::lower_bound(times_vtx.begin(), times_vtx.end(), timeTrack);
+      int closestVtx = std::distance(times_vtx.begin(), lower);
+      // if value is out of bounds use last value
+      if (closestVtx == nVertices) {
+        closestVtx -= 1;
+      } else if (closestVtx > 0) {
+        // if idx > 0 check preceeding value
+        double diff1 = std::abs(timeTrack - *lower);
+        double diff2 = std::abs(timeTrack - *(lower - 1));
+        if (diff2 < diff1) {
           closestVtx -= 1;
-        } else if (closestVtx > 0) {
-          // if idx > 0 check preceeding value
-          double diff1 = std::abs(timeTrack - *lower);
-          double diff2 = std::abs(timeTrack - *(lower - 1));
-          if (diff2 < diff1) {
-            closestVtx -= 1;
-          }
         }
-        mNearestVtxTPC[i] = closestVtx;
       }
-    };
-
-    std::vector<std::thread> threads(mNThreads);
-    for (int i = 0; i < mNThreads; i++) {
-      threads[i] = std::thread(myThread, i);
-    }
-
-    // wait for the threads to finish
-    for (auto& th : threads) {
-      th.join();
+      mNearestVtxTPC[i] = closestVtx;
     }
   }
 
@@ -1538,7 +1505,8 @@ class TPCTimeSeries : public Task
     const float windowTimeBins = mTimeWindowMUS / tpcTBinMUS;                     // number of neighbouring time bins to check
 
     // create list of time bins of tracks
-    std::vector<float> times;
+    auto& times = mTimesTracks;
+    times.clear();
     const int nTracks = tracksTPC.size();
     times.reserve(nTracks);
     for (const auto& trk : tracksTPC) {
@@ -1550,24 +1518,15 @@ class TPCTimeSeries : public Task
     mNTracksWindow.resize(nTracks);
 
     // loop over tpc tracks and count number of neighouring tracks
-    auto myThread = [&](int iThread) {
-      for (int i = iThread; i < nTracks; i += mNThreads) {
-        const float t0 = tracksTPC[i].getTime0();
-        const auto upperV0 = std::upper_bound(times.begin(), times.end(), t0 + windowTimeBins);
-        const auto lowerV0 = std::lower_bound(times.begin(), times.end(), t0 - windowTimeBins);
-        const int nMult = std::distance(times.begin(), upperV0) - std::distance(times.begin(), lowerV0);
-        mNTracksWindow[i] = nMult;
-      }
-    };
-
-    std::vector<std::thread> threads(mNThreads);
-    for (int i = 0; i < mNThreads; i++) {
-      threads[i] = std::thread(myThread, i);
-    }
-
-    // wait for the threads to finish
-    for (auto& th : threads) {
-      th.join();
+#ifdef WITH_OPENMP
+#pragma omp parallel for num_threads(mNThreads)
+#endif
+    for (int i = 0; i < nTracks; ++i) {
+      const float t0 = tracksTPC[i].getTime0();
+      const auto upperV0 = std::upper_bound(times.begin(), times.end(), t0 + windowTimeBins);
+      const auto lowerV0 = std::lower_bound(times.begin(), times.end(), t0 - windowTimeBins);
+      const int nMult = std::distance(times.begin(), upperV0) - std::distance(times.begin(), lowerV0);
+      mNTracksWindow[i] = nMult;
     }
   }
 
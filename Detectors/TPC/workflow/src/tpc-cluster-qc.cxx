@@ -17,6 +17,10 @@ using namespace o2::framework;
 
 using namespace o2::framework;
 
+// switch for the streaming sector processing, the policy is created before the
+// options are parsed, so it accesses the flag through this global variable
+static bool gStreamSectors = false;
+
 // customize the completion policy
 void customize(std::vector<o2::framework::CompletionPolicy>& policies)
 {
@@ -25,6 +29,7 @@ void customize(std::vector<o2::framework::CompletionPolicy>& policies)
   // in addition we require to have input from all other routes
   policies.push_back(o2::tpc::TPCSectorCompletionPolicy("tpc-track-and-cluster-filter",
                                                         o2::tpc::TPCSectorCompletionPolicy::Config::RequireAll,
+                                                        &gStreamSectors,
                                                         InputSpec{"cluster", ConcreteDataTypeMatcher{"TPC", "CLUSTERNATIVE"}})());
 }
 
@@ -36,6 +41,7 @@ void customize(std::vector<ConfigParamSpec>& workflowOptions)
     // {"use-digit-input", VariantType::Bool, false, {"use TPC digits as input, instead of raw data"}},
     //{"data-description", VariantType::String, "TRACKS", {"Can be used to select filterd tracks, e.g. 'LASERTRACKS', 'MIPS'"}},
     //{"write-mc", VariantType::Bool, false, {"Can be used to write mc labels, e.g. 'TPCTracksMCTruth'"}},
+    {"streaming-sectors", VariantType::Bool, false, {"process sector data as it arrives instead of waiting for the full sector set"}},
   };
 
   std::swap(workflowOptions, options);
@@ -43,8 +49,9 @@ void customize(std::vector<ConfigParamSpec>& workflowOptions)
 
 #include "Framework/runDataProcessing.h"
 
-WorkflowSpec defineDataProcessing(ConfigContext const&)
+WorkflowSpec defineDataProcessing(ConfigContext const& config)
 {
   using namespace o2::tpc;
+  gStreamSectors = config.options().get<bool>("streaming-sectors");
   return WorkflowSpec{getClusterQCSpec()};
 }
@@ -45,21 +45,26 @@ class GeometryFlat : public o2::gpu::FlatObject, public GeometryBase
 #endif
   GPUd() const o2::gpu::Transform3D* getMatrixT2L(int det) const
   {
-    if (mMatrixIndirection[det] == -1) {
+    if (!mMatrixAvailable[det]) {
       return nullptr;
     }
-    return &mMatrixCache[mMatrixIndirection[det]];
-    ;
+    return &mMatrixCache[det].transform;
   }
 
   GPUd() bool chamberInGeometry(int det) const
   {
-    return (mMatrixIndirection[det] >= 0);
+    return mMatrixAvailable[det] != 0;
   }
 
  private:
-  o2::gpu::Transform3D mMatrixCache[constants::NCHAMBER];
-  short mMatrixIndirection[constants::MAXCHAMBER];
+  // One matrix per cache line, directly indexed by the detector number: the
+  // track following kernel loads exactly one aligned line per consulted
+  // chamber, without the indirection lookup and without straddling lines.
+  struct alignas(64) MatrixCacheEntry {
+    o2::gpu::Transform3D transform; // 48 bytes, padded to 64 by the alignment
+  };
+  MatrixCacheEntry mMatrixCache[constants::MAXCHAMBER];
+  unsigned char mMatrixAvailable[constants::MAXCHAMBER];
 };
 
 } // namespace trd
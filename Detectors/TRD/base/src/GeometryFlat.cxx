@@ -21,7 +21,6 @@ GeometryFlat::GeometryFlat(const Geometry& geo)
   GeometryBase& b1 = *this;
   const GeometryBase& b2 = geo;
   memcpy((void*)&b1, (void*)&b2, sizeof(b1));
-  int matrixCount = 0;
   for (int i = 0; i < MAXCHAMBER; i++) {
     if (geo.chamberInGeometry(i)) {
       double v[12];
@@ -30,10 +29,10 @@ GeometryFlat::GeometryFlat(const Geometry& geo)
       for (int k = 0; k < 12; k++) {
         f[k] = v[k];
       }
-      mMatrixCache[matrixCount] = o2::gpu::Transform3D(f);
-      mMatrixIndirection[i] = matrixCount++;
+      mMatrixCache[i].transform = o2::gpu::Transform3D(f);
+      mMatrixAvailable[i] = 1;
     } else {
-      mMatrixIndirection[i] = -1;
+      mMatrixAvailable[i] = 0;
     }
   }
 }
@@ -134,8 +134,10 @@ class CruRawReader
   // FIXME currently hcid can be overwritten from TrackletHCHeader
   bool isTrackletHCHeaderOK(const TrackletHCHeader& header, int& hcid);
 
-  // helper function to create Tracklet64 from link data
-  Tracklet64 assembleTracklet64(int format, TrackletMCMHeader& mcmHeader, TrackletMCMData& mcmData, int cpu, int hcid) const;
+  // helper function to create Tracklet64 from link data.
+  // trackletWordBase holds the already packed fields which are common to all tracklets of one MCM
+  // (format, HCID, padrow, column), hpid the PID bits from the MCM header for the given CPU
+  Tracklet64 assembleTracklet64(uint64_t trackletWordBase, bool dynamicCharges, uint32_t hpid, TrackletMCMData& mcmData) const;
 
   // important function to keep track of all errors, if possible accounted to a certain link / half-chamber ID
   // FIXME:
@@ -853,6 +853,8 @@ int CruRawReader::parseTrackletLinkData(int linkSize32, int& hcid, int& wordsRej
   int previousRow = -1;
   TrackletHCHeader hcHeader;
   TrackletMCMHeader mcmHeader;
+  uint64_t trackletWordBase = 0; // the packed fields common to all tracklets of the current MCM (format, HCID, padrow, column)
+  bool dynamicCharges = false;   // whether the DQR charge packing is used, fixed per half-chamber by the TrackletHCHeader
 
   // main loop we exit only when we reached the end of the link or have seen two tracklet end markers
   while (wordsRead < linkSize32 && state != StateFinished) {
@@ -922,6 +924,13 @@ int CruRawReader::parseTrackletLinkData(int linkSize32, int& hcid, int& wordsRej
           previousRow = mcmHeader.padrow;
         }
         ++wordsReadOK;
+        // pack the fields which are identical for all tracklets of this MCM once,
+        // so that per tracklet word only position, slope and charges remain to be unpacked
+        trackletWordBase = (((uint64_t)hcHeader.format << Tracklet64::formatbs) & Tracklet64::formatmask) |
+                           (((uint64_t)hcid << Tracklet64::hcidbs) & Tracklet64::hcidmask) |
+                           (((uint64_t)mcmHeader.padrow << Tracklet64::padrowbs) & Tracklet64::padrowmask) |
+                           (((uint64_t)mcmHeader.col << Tracklet64::colbs) & Tracklet64::colmask);
+        dynamicCharges = hcHeader.format & 0x1;
         state = StateTrackletMCMData; // tracklet words must be following, unless the HC header format indicates sending of empty MCM headers
       }
       ++wordsRead;
@@ -930,7 +939,8 @@ int CruRawReader::parseTrackletLinkData(int linkSize32, int& hcid, int& wordsRej
     else if (state == StateTrackletMCMData) {
       bool addedTracklet = false; // flag whether we actually found a tracklet
       for (int iCpu = 0; iCpu < 3; ++iCpu) {
-        if (((mcmHeader.word >> (1 + iCpu * 8)) & 0xff) == 0xff) {
+        uint32_t hpid = (mcmHeader.word >> (1 + iCpu * 8)) & 0xff;
+        if (hpid == 0xff) {
           // iCpu did not produce a tracklet.
           // Since no empty tracklet words are sent, we don't need to move to the next word.
           // Instead, we check if the next CPU is supposed to have sent a tracklet
@@ -953,7 +963,7 @@ int CruRawReader::parseTrackletLinkData(int linkSize32, int& hcid, int& wordsRej
         }
         TrackletMCMData mcmData;
         mcmData.word = currWord;
-        mEventRecords.getCurrentEventRecord().addTracklet(assembleTracklet64(hcHeader.format, mcmHeader, mcmData, iCpu, hcid));
+        mEventRecords.getCurrentEventRecord().addTracklet(assembleTracklet64(trackletWordBase, dynamicCharges, hpid, mcmData));
         ++trackletsFound;
         ++mTrackletsFound;
         addedTracklet = true;
@@ -1034,25 +1044,24 @@ int CruRawReader::parseTrackletLinkData(int linkSize32, int& hcid, int& wordsRej
   }
 }
 
-Tracklet64 CruRawReader::assembleTracklet64(int format, TrackletMCMHeader& mcmHeader, TrackletMCMData& mcmData, int cpu, int hcid) const
+Tracklet64 CruRawReader::assembleTracklet64(uint64_t trackletWordBase, bool dynamicCharges, uint32_t hpid, TrackletMCMData& mcmData) const
 {
   // TODO take care of special tracklet formats?
-  uint16_t pos = mcmData.pos;
-  uint16_t slope = mcmData.slope;
+  uint64_t pos = mcmData.pos;
+  uint64_t slope = mcmData.slope;
   // The 8-th bit of position and slope are always flipped in the FEE.
   // We flip them back while reading the raw data so that they are stored
   // without flipped bits in the CTFs
   pos ^= 0x80;
   slope ^= 0x80;
-  uint32_t hpid = (mcmHeader.word >> (1 + cpu * 8)) & 0xff;
   uint32_t lpid = mcmData.pid;
   // The combined 20 bit PID information from the MCM header and the tracklet word
   // is given by ((hpid << 12) | lpid).
   // hpid holds the upper 8 bit and lpid the lower 12 bit.
-  int q0, q1, q2;
-  if (format & 0x1) {
+  uint64_t q0, q1, q2;
+  if (dynamicCharges) {
     // DQR enabled
-    int scaleFactor = (hpid >> 6) & 0x3;
+    uint32_t scaleFactor = (hpid >> 6) & 0x3;
     q0 = (scaleFactor << 6) | (lpid & 0x3f);
     q1 = (scaleFactor << 6) | ((lpid >> 6) & 0x3f);
     q2 = (scaleFactor << 6) | (hpid & 0x3f);
@@ -1062,7 +1071,10 @@ Tracklet64 CruRawReader::assembleTracklet64(int format, TrackletMCMHeader& mcmHe
     q1 = ((hpid & 0x3) << 5) | ((lpid >> 7) & 0x1f);
     q2 = (hpid >> 2) & 0x3f;
   }
-  return Tracklet64(format, hcid, mcmHeader.padrow, mcmHeader.col, pos, slope, q0, q1, q2);
+  // format, HCID, padrow and column are already packed in the base word and the
+  // per-tracklet fields are bounded by the extraction above, so no additional masking is needed
+  return Tracklet64(trackletWordBase | (pos << Tracklet64::posbs) | (slope << Tracklet64::slopebs) |
+                    (q2 << Tracklet64::Q2bs) | (q1 << Tracklet64::Q1bs) | (q0 << Tracklet64::Q0bs));
 }
 
 void CruRawReader::dumpInputPayload() const
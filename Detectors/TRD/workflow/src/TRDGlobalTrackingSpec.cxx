@@ -58,6 +58,7 @@
 
 #include <regex>
 #include <algorithm>
+#include <future>
 #include <numeric>
 
 using namespace o2::framework;
@@ -294,26 +295,31 @@ void TRDGlobalTracking::run(ProcessingContext& pc)
   mTrackletsRaw = inputTracks.getTRDTracklets();
   mTrackletsCalib = inputTracks.getTRDCalibratedTracklets();
   mTPCTracksArray = inputTracks.getTPCTracks();
+  std::future<void> itsClusterFuture; // ITS cluster conversion runs concurrently to the seed loading and TRD tracking below
   if (GTrackID::includesDet(GTrackID::DetID::ITS, mTrkMask)) {
     // load ITS tracks and clusters needed for the refit
     mITSTracksArray = inputTracks.getITSTracks();
     mITSTrackClusIdx = inputTracks.getITSTracksClusterRefs();
     mITSABRefsArray = inputTracks.getITSABRefs();
     mITSABTrackClusIdx = inputTracks.getITSABClusterRefs();
-    const auto clusITS = inputTracks.getITSClusters();
-    const auto patterns = inputTracks.getITSClustersPatterns();
-    auto pattIt = patterns.begin();
-    mITSClustersArray.clear();
-    mITSClustersArray.reserve(clusITS.size());
+    // the converted clusters are needed only for the refit after the tracking,
+    // so the conversion can overlap with the seed loading and the tracking itself
+    itsClusterFuture = std::async(std::launch::async, [this, &inputTracks]() {
+      const auto clusITS = inputTracks.getITSClusters();
+      const auto patterns = inputTracks.getITSClustersPatterns();
+      auto pattIt = patterns.begin();
+      mITSClustersArray.clear();
+      mITSClustersArray.reserve(clusITS.size());
 #ifdef ENABLE_UPGRADES
-    if (o2::GlobalParams::Instance().withITS3) {
-      o2::its3::ioutils::convertCompactClusters(clusITS, pattIt, mITSClustersArray, mIT3Dict);
-    } else {
-      o2::its::ioutils::convertCompactClusters(clusITS, pattIt, mITSClustersArray, mITSDict);
-    }
+      if (o2::GlobalParams::Instance().withITS3) {
+        o2::its3::ioutils::convertCompactClusters(clusITS, pattIt, mITSClustersArray, mIT3Dict);
+      } else {
+        o2::its::ioutils::convertCompactClusters(clusITS, pattIt, mITSClustersArray, mITSDict);
+      }
 #else
-    o2::its::ioutils::convertCompactClusters(clusITS, pattIt, mITSClustersArray, mITSDict);
+      o2::its::ioutils::convertCompactClusters(clusITS, pattIt, mITSClustersArray, mITSDict);
 #endif
+    });
   }
 
   LOGF(info, "There are %i tracklets in total from %i trigger records", mChainTracking->mIOPtrs.nTRDTracklets, mChainTracking->mIOPtrs.nTRDTriggerRecords);
@@ -414,6 +420,9 @@ void TRDGlobalTracking::run(ProcessingContext& pc)
   // mTracker->DumpTracks();
   mChainTracking->DoTRDGPUTracking<GPUTRDTrackerKernels::o2Version>(mTracker);
   // mTracker->DumpTracks();
+  if (itsClusterFuture.valid()) {
+    itsClusterFuture.get(); // the refit of the matched tracks below needs the converted ITS clusters
+  }
 
   // finished tracking, now collect the output
   std::vector<TrackTRD> tracksOutITSTPC;
@@ -233,22 +233,39 @@ void TRDDPLTrapSimulatorTask::run(o2::framework::ProcessingContext& pc)
 
   auto timeParallelStart = std::chrono::high_resolution_clock::now();
 
+  // split each trigger record into per-half-chamber digit ranges, so that the parallelization
+  // granularity does not depend on the number of triggers per TF (a single central collision
+  // would otherwise be processed by one thread alone)
+  struct HCChunk {
+    int trigger;    // trigger record this half chamber belongs to
+    int firstDigit; // first entry in digitIdxArray
+    int lastDigit;  // last entry (exclusive)
+  };
+  std::vector<HCChunk> chunks;
+  for (size_t iTrig = 0; iTrig < triggerRecords.size(); ++iTrig) {
+    int first = triggerRecords[iTrig].getFirstDigit();
+    int last = first + triggerRecords[iTrig].getNumberOfDigits();
+    int chunkStart = first;
+    for (int iDigit = first + 1; iDigit <= last; ++iDigit) {
+      if (iDigit == last || digits[digitIdxArray[iDigit]].getHCId() != digits[digitIdxArray[chunkStart]].getHCId()) {
+        chunks.push_back({static_cast<int>(iTrig), chunkStart, iDigit});
+        chunkStart = iDigit;
+      }
+    }
+  }
+  std::vector<int> nTrackletsChunk(chunks.size());
+  std::vector<std::vector<Tracklet64>> trackletsChunk(chunks.size());
+  std::vector<std::vector<short>> digitCountsChunk(chunks.size());
+  std::vector<std::vector<int>> digitIndicesChunk(chunks.size());
+
 #ifdef WITH_OPENMP
 #pragma omp parallel for schedule(dynamic) num_threads(mNumThreads)
 #endif
-  for (size_t iTrig = 0; iTrig < triggerRecords.size(); ++iTrig) {
-    int currHCId = -1;
+  for (size_t iChunk = 0; iChunk < chunks.size(); ++iChunk) {
+    const auto& chunk = chunks[iChunk];
     std::array<TrapSimulator, NMCMHCMAX> trapSimulators{}; //the up to 64 trap simulators for a single half chamber
-    for (int iDigit = triggerRecords[iTrig].getFirstDigit(); iDigit < (triggerRecords[iTrig].getFirstDigit() + triggerRecords[iTrig].getNumberOfDigits()); ++iDigit) {
+    for (int iDigit = chunk.firstDigit; iDigit < chunk.lastDigit; ++iDigit) {
       const auto& digit = &digits[digitIdxArray[iDigit]];
-      if (currHCId < 0) {
-        currHCId = digit->getHCId();
-      }
-      if (currHCId != digit->getHCId()) {
-        // we switch to a new half chamber, process all TRAPs of the previous half chamber which contain data
-        processTRAPchips(nTracklets[iTrig], trackletsAccum[iTrig], trapSimulators, digitCountsAccum[iTrig], digitIndicesAccum[iTrig]);
-        currHCId = digit->getHCId();
-      }
       // fill the digit data into the corresponding TRAP chip
       int trapIdx = (digit->getROB() / 2) * NMCMROB + digit->getMCM();
       if (!trapSimulators[trapIdx].isDataSet()) {
@@ -264,9 +281,21 @@ void TRDDPLTrapSimulatorTask::run(o2::framework::ProcessingContext& pc)
         trapSimulators[trapIdx].setData(digit->getChannel(), digit->getADC(), digitIdxArray[iDigit]);
       }
     }
-    // take care of the TRAPs for the last half chamber
-    processTRAPchips(nTracklets[iTrig], trackletsAccum[iTrig], trapSimulators, digitCountsAccum[iTrig], digitIndicesAccum[iTrig]);
+    // process all TRAPs of this half chamber which contain data
+    processTRAPchips(nTrackletsChunk[iChunk], trackletsChunk[iChunk], trapSimulators, digitCountsChunk[iChunk], digitIndicesChunk[iChunk]);
   } // done with parallel processing
+
+  // stitch the per-half-chamber results back together in trigger record order,
+  // which reproduces the ordering of the former per-trigger processing
+  for (size_t iChunk = 0; iChunk < chunks.size(); ++iChunk) {
+    auto iTrig = chunks[iChunk].trigger;
+    nTracklets[iTrig] += nTrackletsChunk[iChunk];
+    trackletsAccum[iTrig].insert(trackletsAccum[iTrig].end(), trackletsChunk[iChunk].begin(), trackletsChunk[iChunk].end());
+    if (mUseMC) {
+      digitCountsAccum[iTrig].insert(digitCountsAccum[iTrig].end(), digitCountsChunk[iChunk].begin(), digitCountsChunk[iChunk].end());
+      digitIndicesAccum[iTrig].insert(digitIndicesAccum[iTrig].end(), digitIndicesChunk[iChunk].begin(), digitIndicesChunk[iChunk].end());
+    }
+  }
   auto parallelTime = std::chrono::high_resolution_clock::now() - timeParallelStart;
 
   // accumulate results and add MC labels
@@ -118,6 +118,10 @@ struct TrackVF {
   float cosAlp; ///< cos of alpha frame
   float sinAlp; ///< sin of alpha frame
 
+  ///< contributions of the track to the vertex normal equations for unit Tukey weight, precomputed
+  ///< once so that the accumulation over fit iterations reduces to a multiply-add with the weight
+  double cxx = 0., cxy = 0., cxz = 0., cyy = 0., cyz = 0., czz = 0., cx0 = 0., cy0 = 0., cz0 = 0.;
+
   TimeEst timeEst;
   float wgh = 0.; ///< track weight wrt current vertex seed
   float wghHisto = 0.; // weight based on track errors, used for histogramming
@@ -210,11 +214,33 @@ struct TrackVF {
     sig2ZI = syy * detI;
     sigYZI = -syz * detI;
     wghHisto = 1. / ((szz + addHZErr2) * (t_est.getTimeStampError() * t_est.getTimeStampError() + addHTErr2));
+    //
+    // aux variables for the unit-weight normal equations contributions
+    double tmpSP = sinAlp * tgP, tmpCP = cosAlp * tgP,
+           tmpSC = sinAlp + tmpCP, tmpCS = -cosAlp + tmpSP,
+           tmpCL = cosAlp * tgL, tmpSL = sinAlp * tgL,
+           tmpYXP = y - tgP * x, tmpZXL = z - tgL * x,
+           tmpCLzz = tmpCL * sig2ZI, tmpSLzz = tmpSL * sig2ZI, tmpSCyz = tmpSC * sigYZI,
+           tmpCSyz = tmpCS * sigYZI, tmpCSyy = tmpCS * sig2YI, tmpSCyy = tmpSC * sig2YI,
+           tmpSLyz = tmpSL * sigYZI, tmpCLyz = tmpCL * sigYZI;
+    //
+    // symmetric matrix equation
+    cxx = tmpCL * (tmpCLzz + tmpSCyz + tmpSCyz) + tmpSC * tmpSCyy;         // dchi^2/dx/dx
+    cxy = tmpCL * (tmpSLzz + tmpCSyz) + tmpSL * tmpSCyz + tmpSC * tmpCSyy; // dchi^2/dx/dy
+    cxz = -sinAlp * sigYZI - tmpCLzz - tmpCP * sigYZI;                     // dchi^2/dx/dz
+    cx0 = -(tmpCLyz + tmpSCyy) * tmpYXP - (tmpCLzz + tmpSCyz) * tmpZXL;    // RHS
+    //
+    cyy = tmpSL * (tmpSLzz + tmpCSyz + tmpCSyz) + tmpCS * tmpCSyy;      // dchi^2/dy/dy
+    cyz = -(tmpCSyz + tmpSLzz);                                         // dchi^2/dy/dz
+    cy0 = -tmpYXP * (tmpCSyy + tmpSLyz) - tmpZXL * (tmpCSyz + tmpSLzz); // RHS
+    //
+    czz = sig2ZI;                          // dchi^2/dz/dz
+    cz0 = tmpZXL * sig2ZI + tmpYXP * sigYZI; // RHS
   }
 
   void reportBadTrack(const o2::track::TrackParCov& src, const TimeEst& t_est, GTrackID _gid);
 
-  ClassDefNV(TrackVF, 1);
+  ClassDefNV(TrackVF, 2);
 };
 
 struct SeedHistoTZ : public o2::dataformats::FlatHisto2D_f {
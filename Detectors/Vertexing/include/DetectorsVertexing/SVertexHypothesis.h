@@ -48,6 +48,8 @@ class SVertexHypothesis
   float getMassV0Hyp() const { return PID::getMass(mPIDV0); }
   float getMassPosProng() const { return PID::getMass(mPIDPosProng); }
   float getMassNegProng() const { return PID::getMass(mPIDNegProng); }
+  float getMass2PosProng() const { return PID::getMass2(mPIDPosProng); }
+  float getMass2NegProng() const { return PID::getMass2(mPIDNegProng); }
 
   float calcMass2(float p2Pos, float p2Neg, float p2V0) const
   {
@@ -76,6 +78,14 @@ class SVertexHypothesis
     return std::abs(mass - getMassV0Hyp()) < getMarginTight(pt);
   }
 
+  bool checkMass2(float mass2, float pt, bool tight = false) const
+  { // same check on the squared mass, avoiding the square root per hypothesis;
+    // a negative mass2 from rounding is rejected like the NaN mass would be
+    float d = getMargin(pt, tight);
+    float lo = getMassV0Hyp() - d, hi = getMassV0Hyp() + d;
+    return mass2 >= 0.f && mass2 < hi * hi && (lo <= 0.f || mass2 > lo * lo);
+  }
+
   float getSigmaV0Cascade(float pt) const { return mPars[CPt] + mPars[CPt1] * pt + mPars[CPt2] * std::exp(-mPars[CPt3] * pt); }
   float getSigma(float pt) const { return mPars[SigmaM] * (1.f + mPars[CPt] * pt); }
   float getMargin(float pt, bool tight = false) const
@@ -102,9 +112,6 @@ class SVertexHypothesis
   float getMarginTight(float pt) const { return getMargin(pt, true); }
 
  private:
-  float getMass2PosProng() const { return PID::getMass2(mPIDPosProng); }
-  float getMass2NegProng() const { return PID::getMass2(mPIDNegProng); }
-
   PID mPIDV0{PID::K0};
   PID mPIDPosProng{PID::Pion};
   PID mPIDNegProng{PID::Pion};
@@ -98,7 +98,8 @@ class SVertexer
   struct TrackCand : o2::track::TrackParCov {
     GIndex gid{};
     VBracket vBracket{};
-    float minR = 0; // track lowest point r
+    o2::math_utils::CircleXYf_t circle{}; // XY circle in the lab frame, filled only when the pair prefilter is enabled
+    float minR = 0;                       // track lowest point r
     bool hasTPC = false;
     int8_t nITSclu = -1;
     bool compatibleProton = false; // dE/dx compatibility with proton hypothesis (FIXME: use better, uint8_t compat mask?)
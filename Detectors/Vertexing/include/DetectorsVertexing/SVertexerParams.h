@@ -53,6 +53,7 @@ struct SVertexerParams : public o2::conf::ConfigurableParamHelper<SVertexerParam
   bool refitWithMatCorr = false;                                        ///< refit V0 applying material corrections
   //
   int maxPVContributors = 2;              ///< max number PV contributors to allow in V0
+  float maxV0CirclesDCAXY = -1.;          ///< if positive, pre-reject pairs whose circles in the transverse plane cannot approach within this distance, before the DCA fitter
   float minDCAToPV = 0.05;                ///< min DCA to PV of single track to accept
   float minRToMeanVertex = 0.5;           ///< min radial distance of V0 from beam line (mean vertex)
   float maxDCAXYToMeanVertex = 0.2;       ///< max DCA of V0 from beam line (mean vertex) for prompt V0 candidates
@@ -38,7 +38,6 @@ class VertexTrackMatcher
   using VTIndex = o2::dataformats::VtxTrackIndex;
   using VRef = o2::dataformats::VtxTrackRef;
   using PVertex = const o2::dataformats::PrimaryVertex;
-  using TmpMap = std::vector<std::vector<VTIndex>>;
   using TimeEst = o2::dataformats::TimeStampWithError<float, float>;
   using TBracket = o2::math_utils::Bracketf_t;
 
@@ -329,7 +329,6 @@ void PVertexer::accountTrack(TrackVF& trc, VertexSeed& vtxSeed) const
     return;
   }
   wghT *= wghT;
-  float syyI(trc.sig2YI), szzI(trc.sig2ZI), syzI(trc.sigYZI);
 
   auto timeErrorFromTB = [&trc]() {
     // decide if the time error is from the time bracket rather than gaussian error
@@ -339,33 +338,18 @@ void PVertexer::accountTrack(TrackVF& trc, VertexSeed& vtxSeed) const
   //
   vtxSeed.wghSum += wghT;
   vtxSeed.wghChi2 += wghT * chi2T;
-  //
-  syyI *= wghT;
-  syzI *= wghT;
-  szzI *= wghT;
   trc.wgh = wghT;
   //
-  // aux variables
-  double tmpSP = trc.sinAlp * trc.tgP, tmpCP = trc.cosAlp * trc.tgP,
-         tmpSC = trc.sinAlp + tmpCP, tmpCS = -trc.cosAlp + tmpSP,
-         tmpCL = trc.cosAlp * trc.tgL, tmpSL = trc.sinAlp * trc.tgL,
-         tmpYXP = trc.y - trc.tgP * trc.x, tmpZXL = trc.z - trc.tgL * trc.x,
-         tmpCLzz = tmpCL * szzI, tmpSLzz = tmpSL * szzI, tmpSCyz = tmpSC * syzI,
-         tmpCSyz = tmpCS * syzI, tmpCSyy = tmpCS * syyI, tmpSCyy = tmpSC * syyI,
-         tmpSLyz = tmpSL * syzI, tmpCLyz = tmpCL * syzI;
-  //
-  // symmetric matrix equation
-  vtxSeed.cxx += tmpCL * (tmpCLzz + tmpSCyz + tmpSCyz) + tmpSC * tmpSCyy;         // dchi^2/dx/dx
-  vtxSeed.cxy += tmpCL * (tmpSLzz + tmpCSyz) + tmpSL * tmpSCyz + tmpSC * tmpCSyy; // dchi^2/dx/dy
-  vtxSeed.cxz += -trc.sinAlp * syzI - tmpCLzz - tmpCP * syzI;                     // dchi^2/dx/dz
-  vtxSeed.cx0 += -(tmpCLyz + tmpSCyy) * tmpYXP - (tmpCLzz + tmpSCyz) * tmpZXL;    // RHS
-  //
-  vtxSeed.cyy += tmpSL * (tmpSLzz + tmpCSyz + tmpCSyz) + tmpCS * tmpCSyy;      // dchi^2/dy/dy
-  vtxSeed.cyz += -(tmpCSyz + tmpSLzz);                                         // dchi^2/dy/dz
-  vtxSeed.cy0 += -tmpYXP * (tmpCSyy + tmpSLyz) - tmpZXL * (tmpCSyz + tmpSLzz); // RHS
-  //
-  vtxSeed.czz += szzI;                          // dchi^2/dz/dz
-  vtxSeed.cz0 += tmpZXL * szzI + tmpYXP * syzI; // RHS
+  // accumulate the unit-weight normal equations contributions precomputed at the pool creation
+  vtxSeed.cxx += wghT * trc.cxx;
+  vtxSeed.cxy += wghT * trc.cxy;
+  vtxSeed.cxz += wghT * trc.cxz;
+  vtxSeed.cx0 += wghT * trc.cx0;
+  vtxSeed.cyy += wghT * trc.cyy;
+  vtxSeed.cyz += wghT * trc.cyz;
+  vtxSeed.cy0 += wghT * trc.cy0;
+  vtxSeed.czz += wghT * trc.czz;
+  vtxSeed.cz0 += wghT * trc.cz0;
   //
   if (useTime) {
     float trErr2I = wghT / (trc.timeEst.getTimeStampError() * trc.timeEst.getTimeStampError());
@@ -51,6 +51,15 @@ void SVertexer::process(const o2::globaltracking::RecoContainer& recoData, o2::f
     mStrTracker->loadData(recoData);
     mStrTracker->prepareITStracks();
   }
+  const float prefilterDCAXY = mSVParams->maxV0CirclesDCAXY;
+  if (prefilterDCAXY > 0.f) { // cache the transverse-plane circles to prune pairs which cannot approach each other
+    for (int pn = 0; pn < 2; pn++) {
+      for (auto& trc : mTracksPool[pn]) {
+        float sna, csa;
+        trc.getCircleParams(mBz, trc.circle, sna, csa);
+      }
+    }
+  }
 #ifdef WITH_OPENMP
   int dynGrp = std::min(4, std::max(1, mNThreads / 2));
 #pragma omp parallel for schedule(dynamic, dynGrp) num_threads(mNThreads)
@@ -71,6 +80,14 @@ void SVertexer::process(const o2::globaltracking::RecoContainer& recoData, o2::f
       if (mSVParams->maxPVContributors < 2 && seedP.gid.isPVContributor() + seedN.gid.isPVContributor() > mSVParams->maxPVContributors) {
         continue;
       }
+      if (prefilterDCAXY > 0.f && seedP.circle.rC > 0.f && seedN.circle.rC > 0.f) { // rC==0 signals a straight track, not prefiltered
+        float dcx = seedP.circle.xC - seedN.circle.xC, dcy = seedP.circle.yC - seedN.circle.yC, c2c2 = dcx * dcx + dcy * dcy;
+        float rSum = seedP.circle.rC + seedN.circle.rC + prefilterDCAXY;
+        float rDif = std::abs(seedP.circle.rC - seedN.circle.rC) - prefilterDCAXY;
+        if (c2c2 > rSum * rSum || (rDif > 0.f && c2c2 < rDif * rDif)) { // circles cannot approach within the tolerance in XY
+          continue;
+        }
+      }
 #ifdef WITH_OPENMP
       int iThread = omp_get_thread_num();
 #else
@@ -671,9 +688,30 @@ bool SVertexer::checkV0(const TrackCand& seedP, const TrackCand& seedN, int iP,
 
   bool goodHyp = false, photonOnly = mSVParams->mTPCTrackPhotonTune && isTPConly;
   std::array<bool, NHypV0> hypCheckStatus{};
+  // the prong energies depend only on the prong mass hypothesis: evaluate each distinct
+  // mass once and share the square roots between the standard, tight lambda and 3-body checks
+  struct ProngEnergies {
+    float p2;
+    int n = 0;
+    std::array<float, NHypV0> m2{}, e{};
+    float get(float mass2)
+    {
+      for (int i = 0; i < n; i++) {
+        if (m2[i] == mass2) {
+          return e[i];
+        }
+      }
+      m2[n] = mass2;
+      return e[n++] = std::sqrt(p2 + mass2);
+    }
+  } ePosProng{p2Pos}, eNegProng{p2Neg};
+  auto v0Mass2 = [&](const SVertexHypothesis& hyp) {
+    float eV0 = ePosProng.get(hyp.getMass2PosProng()) + eNegProng.get(hyp.getMass2NegProng());
+    return eV0 * eV0 - p2V0;
+  };
   int nPID = photonOnly ? (Photon + 1) : NHypV0;
   for (int ipid = 0; (ipid < nPID) && mSVParams->checkV0Hypothesis; ipid++) {
-    if (mV0Hyps[ipid].check(p2Pos, p2Neg, p2V0, ptV0)) {
+    if (mV0Hyps[ipid].checkMass2(v0Mass2(mV0Hyps[ipid]), ptV0)) {
       goodHyp = hypCheckStatus[ipid] = true;
     }
   }
@@ -682,10 +720,10 @@ bool SVertexer::checkV0(const TrackCand& seedP, const TrackCand& seedN, int iP,
   bool usesTPCOnly = (seedP.hasTPC && !seedP.hasITS()) || (seedN.hasTPC && !seedN.hasITS());
   bool usesShortITSOnly = (!seedP.hasTPC && seedP.nITSclu < mSVParams->mITSSAminNcluCascades) || (!seedN.hasTPC && seedN.nITSclu < mSVParams->mITSSAminNcluCascades);
   if (ptV0 > mSVParams->minPtV0FromCascade && (!mSVParams->mSkipTPCOnlyCascade || !usesTPCOnly) && !usesShortITSOnly) {
-    if (mV0Hyps[Lambda].checkTight(p2Pos, p2Neg, p2V0, ptV0) && (!mSVParams->mRequireTPCforCascBaryons || seedP.hasTPC) && seedP.compatibleProton) {
+    if (mV0Hyps[Lambda].checkMass2(v0Mass2(mV0Hyps[Lambda]), ptV0, true) && (!mSVParams->mRequireTPCforCascBaryons || seedP.hasTPC) && seedP.compatibleProton) {
       goodLamForCascade = true;
     }
-    if (mV0Hyps[AntiLambda].checkTight(p2Pos, p2Neg, p2V0, ptV0) && (!mSVParams->mRequireTPCforCascBaryons || seedN.hasTPC) && seedN.compatibleProton) {
+    if (mV0Hyps[AntiLambda].checkMass2(v0Mass2(mV0Hyps[AntiLambda]), ptV0, true) && (!mSVParams->mRequireTPCforCascBaryons || seedN.hasTPC) && seedN.compatibleProton) {
       goodALamForCascade = true;
     }
   }
@@ -693,7 +731,7 @@ bool SVertexer::checkV0(const TrackCand& seedP, const TrackCand& seedN, int iP,
   // apply mass selections for 3-body decay
   bool good3bodyV0Hyp = false;
   for (int ipid = 2; ipid < 4; ipid++) {
-    float massForLambdaHyp = mV0Hyps[ipid].calcMass(p2Pos, p2Neg, p2V0);
+    float massForLambdaHyp = std::sqrt(v0Mass2(mV0Hyps[ipid]));
     if (massForLambdaHyp - mV0Hyps[ipid].getMassV0Hyp() < mV0Hyps[ipid].getMargin(ptV0)) {
       good3bodyV0Hyp = true;
       break;
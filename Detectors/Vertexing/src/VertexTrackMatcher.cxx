@@ -18,6 +18,7 @@
 #include "ITSMFTBase/DPLAlpideParam.h"
 #include <unordered_map>
 #include <numeric>
+#include <array>
 
 using namespace o2::vertexing;
 
@@ -31,8 +32,6 @@ void VertexTrackMatcher::process(const o2::globaltracking::RecoContainer& recoDa
   const auto& PVParams = o2::vertexing::PVertexerParams::Instance();
 
   int nv = vertices.size(), nv1 = nv + 1;
-  TmpMap tmpMap(nv1);
-  auto& orphans = tmpMap.back(); // in the last element we store unassigned track indices
 
   // register vertex contributors
   std::unordered_map<GIndex, bool> vcont;
@@ -40,12 +39,8 @@ void VertexTrackMatcher::process(const o2::globaltracking::RecoContainer& recoDa
   float maxVtxSpan = 0;
   for (int iv = 0; iv < nv; iv++) {
     int idMin = v2tfitRefs[iv].getFirstEntry(), idMax = idMin + v2tfitRefs[iv].getEntries();
-    auto& vtxIds = tmpMap[iv]; // global IDs of contibuting tracks
-    vtxIds.reserve(v2tfitRefs[iv].getEntries());
     for (int id = idMin; id < idMax; id++) {
-      auto gid = v2tfitIDs[id];
-      vtxIds.emplace_back(gid).setPVContributor();
-      vcont[gid] = true;
+      vcont[v2tfitIDs[id]] = true;
     }
     const auto& vtx = vertices[iv];
     const auto& vto = vtxOrdBrack.emplace_back(VtxTBracket{
@@ -61,69 +56,102 @@ void VertexTrackMatcher::process(const o2::globaltracking::RecoContainer& recoDa
 
   extractTracks(recoData, vcont); // extract all track t-brackets, excluding those tracks which contribute to vertex (already attached)
 
-  int ivStart = 0, nAssigned = 0, nAmbiguous = 0;
-  std::vector<int> vtxList; // list of vertices which match to checked track
-  for (const auto& tro : mTBrackets) {
-    vtxList.clear();
-    for (int iv = ivStart; iv < nv; iv++) {
-      const auto& vto = vtxOrdBrack[iv];
-      auto res = tro.tBracket.isOutside(vto.tBracket);
-      if (res == TBracket::Below) {                                       // vertex preceeds the track
-        if (tro.tBracket.getMin() > vto.tBracket.getMin() + maxVtxSpan) { // all following vertices will be preceeding all following tracks times
-          ivStart = iv + 1;
+  // the tracks and vertices are merged by a rolling time window, the window of each vertex
+  // closes once the track times pass its bracket; to bound the memory the associations are
+  // not accumulated in a temporary per-vertex map but the output is filled in place after
+  // a 1st (counting) pass over the same rolling window
+  auto matchTracks = [&vtxOrdBrack, maxVtxSpan, nv, this](auto&& reg) {
+    int ivStart = 0;
+    std::vector<int> vtxList; // list of vertices which match to checked track
+    for (const auto& tro : mTBrackets) {
+      vtxList.clear();
+      for (int iv = ivStart; iv < nv; iv++) {
+        const auto& vto = vtxOrdBrack[iv];
+        auto res = tro.tBracket.isOutside(vto.tBracket);
+        if (res == TBracket::Below) {                                       // vertex preceeds the track
+          if (tro.tBracket.getMin() > vto.tBracket.getMin() + maxVtxSpan) { // all following vertices will be preceeding all following tracks times
+            ivStart = iv + 1;
+          }
+          continue; // following vertex with longer span might still match this track
         }
-        continue; // following vertex with longer span might still match this track
-      }
-      if (res == TBracket::Above) { // track preceeds the vertex, so will preceed also all following vertices
-        break;
+        if (res == TBracket::Above) { // track preceeds the vertex, so will preceed also all following vertices
+          break;
+        }
+        // track matches to vertex, register
+        vtxList.push_back(vto.origID); // flag matching vertex
       }
-      // track matches to vertex, register
-      vtxList.push_back(vto.origID); // flag matching vertex
+      reg(tro.origID, vtxList);
+    }
+  };
+
+  // count the entries of every vertex (last element: orphan tracks) per source, contributors included
+  std::vector<std::array<int, GIndex::NSources>> srcCount(nv1);
+  for (int iv = 0; iv < nv; iv++) {
+    int idMin = v2tfitRefs[iv].getFirstEntry(), idMax = idMin + v2tfitRefs[iv].getEntries();
+    for (int id = idMin; id < idMax; id++) {
+      srcCount[iv][v2tfitIDs[id].getSource()]++;
     }
+  }
+  int nAssigned = 0, nAmbiguous = 0;
+  matchTracks([&srcCount, &nAssigned, &nAmbiguous, nv](GIndex gid, const std::vector<int>& vtxList) {
     if (vtxList.size()) {
       nAssigned++;
-      bool ambig = vtxList.size() > 1;
-      for (auto v : vtxList) {
-        auto& ref = tmpMap[v].emplace_back(tro.origID);
-        if (ambig) {
-          ref.setAmbiguous();
-        }
-      }
-      if (ambig) { // did track match to multiple vertices?
+      if (vtxList.size() > 1) { // did track match to multiple vertices?
         nAmbiguous++;
       }
+      for (auto v : vtxList) {
+        srcCount[v][gid.getSource()]++;
+      }
     } else {
-      orphans.emplace_back(tro.origID); // register unassigned track
+      srcCount[nv][gid.getSource()]++; // register unassigned track
     }
-  }
+  });
 
-  // build final vector of global indices
-  trackIndex.clear();
+  // convert the counts to output offsets, grouping the entries of each vertex by source
   vtxRefs.clear();
-  static size_t logCounter = 0;
-  bool logVertices = mPrescaleLogs > 0 ? (logCounter % mPrescaleLogs) == 0 : true;
+  size_t ntot = 0;
   for (int iv = 0; iv < nv1; iv++) {
-    auto& trvec = tmpMap[iv];
-    // sort entries in each vertex track indices list according to the source
-    std::sort(trvec.begin(), trvec.end(), [](VTIndex a, VTIndex b) { return a.getSource() < b.getSource(); });
-
-    auto entry0 = trackIndex.size(); // start of entries for this vertex
     auto& vr = vtxRefs.emplace_back();
     vr.setVtxID(iv < nv ? iv : -1); // flag table for unassigned tracks by VtxID = -1
-    int oldSrc = -1;
-    for (const auto gid0 : trvec) {
-      int src = gid0.getSource();
-      while (oldSrc < src) {
-        oldSrc++;
-        vr.setFirstEntryOfSource(oldSrc, trackIndex.size()); // register start of new source
-      }
-      trackIndex.push_back(gid0);
+    for (int src = 0; src < GIndex::NSources; src++) {
+      vr.setFirstEntryOfSource(src, ntot); // register start of new source
+      int cnt = srcCount[iv][src];
+      srcCount[iv][src] = ntot; // from now on the fill cursor of this source block
+      ntot += cnt;
+    }
+    vr.setEnd(ntot);
+  }
+
+  // 2nd pass: fill the final vector of global indices in place
+  trackIndex.clear();
+  trackIndex.resize(ntot);
+  for (int iv = 0; iv < nv; iv++) {
+    int idMin = v2tfitRefs[iv].getFirstEntry(), idMax = idMin + v2tfitRefs[iv].getEntries();
+    for (int id = idMin; id < idMax; id++) {
+      auto gid = v2tfitIDs[id];
+      auto& vti = trackIndex[srcCount[iv][gid.getSource()]++];
+      vti = VTIndex{gid};
+      vti.setPVContributor();
     }
-    while (++oldSrc < GIndex::NSources) {
-      vr.setFirstEntryOfSource(oldSrc, trackIndex.size());
+  }
+  matchTracks([&srcCount, &trackIndex, nv](GIndex gid, const std::vector<int>& vtxList) {
+    if (vtxList.size()) {
+      bool ambig = vtxList.size() > 1;
+      for (auto v : vtxList) {
+        auto& vti = trackIndex[srcCount[v][gid.getSource()]++];
+        vti = VTIndex{gid};
+        if (ambig) {
+          vti.setAmbiguous();
+        }
+      }
+    } else {
+      trackIndex[srcCount[nv][gid.getSource()]++] = VTIndex{gid}; // register unassigned track
     }
-    vr.setEnd(trackIndex.size());
-    if (logVertices) {
+  });
+
+  static size_t logCounter = 0;
+  if (mPrescaleLogs > 0 ? (logCounter % mPrescaleLogs) == 0 : true) {
+    for (const auto& vr : vtxRefs) {
       LOG(info) << vr;
     }
   }
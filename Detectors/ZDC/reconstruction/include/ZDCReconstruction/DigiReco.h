@@ -11,6 +11,7 @@
 
 #include <map>
 #include <deque>
+#include <vector>
 #include <gsl/span>
 #include <TFile.h>
 #include <TTree.h>
@@ -133,6 +134,12 @@ class DigiReco
     LOG(warn) << __func__ << " Configuration of TDC pile-up correction: " << (mCorrBackground ? "enabled" : "disabled");
   };
   bool getCorrBackground() { return mCorrBackground; };
+  // Number of threads used to process the independent channels (if built with OpenMP)
+  void setNThreads(int n)
+  {
+    mNThreads = n > 1 ? n : 1;
+  }
+  int getNThreads() const { return mNThreads; }
   bool inError()
   {
     return mInError;
@@ -143,6 +150,21 @@ class DigiReco
   const std::vector<o2::zdc::RecEventAux>& getReco() { return mReco; }
 
  private:
+  /// Scratch data for the interpolation of one channel over a run of consecutive
+  /// bunch crossings. Keeping it out of the data members makes the interpolation
+  /// routines re-entrant, so that independent channels can be processed concurrently
+  struct InterpolationContext {
+    int nbun;                                 /// Number of adjacent bunches
+    int nsam;                                 /// Number of acquired samples
+    int ntot;                                 /// Total number of points in the interpolated arrays
+    int nint;                                 /// Total points in the interpolation region (-1)
+    int ilast;                                /// Index of last acquired sample
+    bool inError = false;                     /// Interpolation ended in error
+    O2_ZDC_DIGIRECO_FLT firstSample;          /// First acquired sample (constant extrapolation on the left)
+    O2_ZDC_DIGIRECO_FLT lastSample;           /// Last acquired sample (constant extrapolation on the right)
+    std::vector<O2_ZDC_DIGIRECO_FLT> samples; /// Contiguous copy of the acquired samples, padded with TSL replicas of the first and last ones
+  };
+
   const ModuleConfig* mModuleConfig = nullptr;              /// Trigger/readout configuration object
   void updateOffsets(int ibun);                             /// Update offsets to process current bunch
   void lowPassFilter();                                     /// low-pass filtering of digitized data
@@ -169,8 +191,9 @@ class DigiReco
   int correctTDCSignal(int itdc, int16_t TDCVal, float TDCAmp, float& fTDCVal, float& fTDCAmp, bool isbeg, bool isend); /// Correct TDC single signal
   int correctTDCBackground(int ibc, int itdc, std::deque<DigiRecoTDC>& tdc);                                            /// TDC amplitude and time corrections due to pile-up from previous bunches
 
-  O2_ZDC_DIGIRECO_FLT getPoint(int itdc, int ibeg, int iend, int i); /// Interpolation for current TDC
-  void setPoint(int itdc, int ibeg, int iend, int i);                /// Interpolation for current TDC
+  int loadInterpolationContext(int isig, int ibeg, int iend, InterpolationContext& ctx); /// Fill the interpolation scratch data for one channel
+  O2_ZDC_DIGIRECO_FLT getPoint(InterpolationContext& ctx, int isig, int i);              /// Interpolation for one point of current channel
+  void setPoint(InterpolationContext& ctx, int isig, int ibeg, int iend, int i);         /// Store one interpolated point of current channel
 
   void assignTDC(int ibun, int ibeg, int iend, int itdc, int tdc, float amp); /// Set reconstructed TDC values
   void findSignals(int ibeg, int iend);                                       /// Find signals around main-main that satisfy condition on TDC
@@ -189,6 +212,8 @@ class DigiReco
   const RecoConfigZDC* mRecoConfigZDC = nullptr; /// CCDB configuration parameters
   int32_t mVerbosity = DbgMinimal;
   O2_ZDC_DIGIRECO_FLT mTS[NTS];                     /// Tapered sinc function
+  O2_ZDC_DIGIRECO_FLT mTSC[TSN][2 * TSL];           /// Tapered sinc taps reordered per interpolation phase (FIR form)
+  O2_ZDC_DIGIRECO_FLT mTSSum[TSN];                  /// Sum of the taps for each interpolation phase
   bool mTreeDbg = false;                            /// Write reconstructed data in debug output file
   std::unique_ptr<TFile> mDbg = nullptr;            /// Debug output file
   std::unique_ptr<TTree> mTDbg = nullptr;           /// Debug tree
@@ -212,14 +237,7 @@ class DigiReco
   float tdc_offset[NTDCChannels] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0}; /// TDC offset
   constexpr static uint16_t mMask[NTimeBinsPerBC] = {0x0001, 0x002, 0x004, 0x008, 0x0010, 0x0020, 0x0040, 0x0080, 0x0100, 0x0200, 0x0400, 0x0800};
   O2_ZDC_DIGIRECO_FLT mAlpha = 3; // Parameter of interpolation function
-  // Configuration of interpolation for current TDC
-  int mNbun;  // Number of adjacent bunches
-  int mNsam;  // Number of acquired samples
-  int mNtot;  // Total number of points in the interpolated arrays
-  int mIlast; // Index of last acquired sample
-  int mNint;  // Total points in the interpolation region (-1)
-  O2_ZDC_DIGIRECO_FLT mFirstSample;
-  O2_ZDC_DIGIRECO_FLT mLastSample;
+  int mNThreads = 1;              // Number of threads to process the independent channels (if built with OpenMP)
 };
 } // namespace zdc
 } // namespace o2
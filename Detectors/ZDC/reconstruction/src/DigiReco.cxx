@@ -9,10 +9,14 @@
 // granted to it by virtue of its status as an Intergovernmental Organization
 // or submit itself to any jurisdiction.
 
+#include <array>
 #include <TMath.h>
 #include "Framework/Logger.h"
 #include "ZDCReconstruction/DigiReco.h"
 #include "ZDCReconstruction/RecoParamZDC.h"
+#ifdef WITH_OPENMP
+#include <omp.h>
+#endif
 
 namespace o2
 {
@@ -480,6 +484,17 @@ void DigiReco::prepareInterpolation()
     mTS[n + tsi] = fs * fg;
     mTS[n - tsi] = mTS[n + tsi]; // Function is even
   }
+  // Reorder the taps per interpolation phase so that the interpolation of one
+  // point becomes a plain dot product on a contiguous array of samples
+  // Phase 0 corresponds to an acquired point and has no associated taps
+  for (int im = 1; im < TSN; im++) {
+    O2_ZDC_DIGIRECO_FLT sum = 0;
+    for (int is = TSN - im, k = 0; is < NTS; is += TSN, k++) {
+      mTSC[im][k] = mTS[is];
+      sum += mTS[is];
+    }
+    mTSSum[im] = sum;
+  }
   LOG(info) << "Interpolation numeric precision is " << sizeof(O2_ZDC_DIGIRECO_FLT);
   LOG(info) << "Interpolation alpha = " << mAlpha;
 }
@@ -719,6 +734,10 @@ void DigiReco::lowPassFilter()
   LOG(info) << __func__;
 #endif
   constexpr int MaxTimeBin = NTimeBinsPerBC - 1;
+  // Each TDC channel reads and writes its own signal only
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(dynamic) num_threads(mNThreads)
+#endif
   for (int itdc = 0; itdc < NTDCChannels; itdc++) {
     auto isig = TDCSignal[itdc];
     for (int ibc = 0; ibc < mNBC; ibc++) {
@@ -842,7 +861,13 @@ int DigiReco::reconstructTDC(int ibeg, int iend)
   // in position 0
   // In case we do full interpolation, we process also the channels that are not
   // considered in TDC list
+  // The channels are independent from each other: each one writes just its own
+  // interpolated waveform and can therefore be processed concurrently
   if (mFullInterpolation) {
+    std::array<int, NChannels> rvals{};
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(dynamic) num_threads(mNThreads)
+#endif
     for (int isig = 0; isig < NChannels; isig++) {
       int isig_tdc = TDCSignal[SignalTDC[isig]];
       if (isig == isig_tdc) {
@@ -864,9 +889,9 @@ int DigiReco::reconstructTDC(int ibeg, int iend)
           // A gap is detected
           if (istart >= 0 && (istop - istart + 1) >= mFullInterpolationMinLength) {
             // Need data for at least mFullInterpolationMinLength (two) consecutive bunch crossings
-            int rval = fullInterpolation(isig, istart, istop);
-            if (rval) {
-              return rval;
+            rvals[isig] = fullInterpolation(isig, istart, istop);
+            if (rvals[isig]) {
+              break;
             }
           }
           istart = -1;
@@ -874,11 +899,13 @@ int DigiReco::reconstructTDC(int ibeg, int iend)
         }
       }
       // Check if there are mFullInterpolationMinLength consecutive bunch crossings at the end of group
-      if (istart >= 0 && (istop - istart + 1) >= mFullInterpolationMinLength) {
-        int rval = fullInterpolation(isig, istart, istop);
-        if (rval) {
-          return rval;
-        }
+      if (rvals[isig] == 0 && istart >= 0 && (istop - istart + 1) >= mFullInterpolationMinLength) {
+        rvals[isig] = fullInterpolation(isig, istart, istop);
+      }
+    }
+    for (int isig = 0; isig < NChannels; isig++) {
+      if (rvals[isig]) {
+        return rvals[isig];
       }
     }
   }
@@ -1368,68 +1395,89 @@ int DigiReco::processTriggerExtended(int itdc, int ibeg, int iend)
   return interpolate(itdc, ibeg, iend);
 } // processTriggerExtended
 
+// Fill the interpolation scratch data for signal isig, in consecutive bunches from ibeg to iend
+int DigiReco::loadInterpolationContext(int isig, int ibeg, int iend, InterpolationContext& ctx)
+{
+  constexpr int MaxTimeBin = NTimeBinsPerBC - 1; //< number of samples per BC
+
+  ctx.nbun = iend - ibeg + 1;           // Number of adjacent bunches
+  ctx.nsam = ctx.nbun * NTimeBinsPerBC; // Number of acquired samples
+  ctx.ntot = ctx.nsam * TSN;            // Total number of points in the interpolated arrays
+  ctx.nint = (ctx.nsam - 1) * TSN;      // Total points in the interpolation region (-1)
+  ctx.ilast = ctx.ntot - TSNH;          // Index of last acquired sample
+
+  // At this level there should be no need to check if the channel is connected
+  // since a fatal should have been raised already
+  for (int ibun = ibeg; ibun <= iend; ibun++) {
+    auto ref = mReco[ibun].ref[isig];
+    if (ref == ZDCRefInitVal) {
+      LOG(error) << __func__ << " @ " << __LINE__ << " Missing information for bunch crossing " << mReco[ibun].ir.orbit << "." << mReco[ibun].ir.bc << " sig = " << isig;
+      return __LINE__;
+    }
+  }
+
+  ctx.firstSample = mReco[ibeg].data[isig][0];
+  ctx.lastSample = mReco[iend].data[isig][MaxTimeBin];
+
+  // Contiguous copy of the acquired (filtered) samples, padded on both sides
+  // with TSL replicas of the first and last samples: the FIR loop of getPoint
+  // then needs no boundary checks and can be vectorized by the compiler
+  ctx.samples.resize(ctx.nsam + 2 * TSL);
+  int kk = 0;
+  for (int ii = 0; ii < TSL; ii++) {
+    ctx.samples[kk++] = ctx.firstSample;
+  }
+  for (int ibun = ibeg; ibun <= iend; ibun++) {
+    for (int is = 0; is < NTimeBinsPerBC; is++) {
+      ctx.samples[kk++] = mReco[ibun].data[isig][is];
+    }
+  }
+  for (int ii = 0; ii < TSL; ii++) {
+    ctx.samples[kk++] = ctx.lastSample;
+  }
+  return 0;
+}
+
 // Interpolation for single point
-O2_ZDC_DIGIRECO_FLT DigiReco::getPoint(int isig, int ibeg, int iend, int i)
+O2_ZDC_DIGIRECO_FLT DigiReco::getPoint(InterpolationContext& ctx, int isig, int i)
 {
-  constexpr int nsbun = TSN * NTimeBinsPerBC; // Total number of interpolated points per bunch crossing
-  if (i >= mNtot || i < 0) {
-    LOG(error) << "Error addressing isig=" << isig << " i=" << i << " mNtot=" << mNtot;
-    mInError = true;
+  if (i >= ctx.ntot || i < 0) {
+    LOG(error) << "Error addressing isig=" << isig << " i=" << i << " ntot=" << ctx.ntot;
+    ctx.inError = true;
     return std::numeric_limits<float>::infinity();
   }
   // Constant extrapolation at the beginning and at the end of the array
   if (i < TSNH) {
     // Return value of first sample
-    return mFirstSample;
-  } else if (i >= mIlast) {
+    return ctx.firstSample;
+  } else if (i >= ctx.ilast) {
     // Return value of last sample
-    return mLastSample;
+    return ctx.lastSample;
   } else {
-    // Identification of the point to be assigned
-    int ibun = ibeg + i / nsbun;
-    // Interpolation between acquired points (N.B. from 0 to mNint)
+    // Interpolation between acquired points (N.B. from 0 to ctx.nint)
     i = i - TSNH;
     int im = i % TSN;
+    int ip = i / TSN;
     if (im == 0) {
       // This is an acquired point
-      int ip = (i / TSN) % NTimeBinsPerBC;
-      int ib = ibeg + (i / TSN) / NTimeBinsPerBC;
-      if (ib != ibun) {
-        LOG(error) << "ib=" << ib << " ibun=" << ibun;
-        mInError = true;
-        return std::numeric_limits<float>::infinity();
-      }
-      return mReco[ibun].data[isig][ip]; // Filtered point
-      // return mChData[mReco[ibun].ref[isig]].data[ip]; // Original point
+      return ctx.samples[TSL + ip]; // Filtered point
     } else {
-      // Do the actual interpolation
+      // Do the actual interpolation: dot product between the contiguous samples
+      // around the point and the taps of the current interpolation phase
+      // The padding of the sample array replaces the boundary checks
+      const O2_ZDC_DIGIRECO_FLT* yy = ctx.samples.data() + ip + 1; // sample ip - TSL + 1 is at position ip + 1 in the padded array
+      const O2_ZDC_DIGIRECO_FLT* ts = mTSC[im];
       O2_ZDC_DIGIRECO_FLT y = 0;
-      int ip = i / TSN;
-      O2_ZDC_DIGIRECO_FLT sum = 0;
-      for (int is = TSN - im, ii = ip - TSL + 1; is < NTS; is += TSN, ii++) {
-        // Default is first point in the array
-        O2_ZDC_DIGIRECO_FLT yy = mFirstSample;
-        if (ii > 0) {
-          if (ii < mNsam) {
-            int ip = ii % NTimeBinsPerBC;
-            int ib = ibeg + ii / NTimeBinsPerBC;
-            yy = mReco[ib].data[isig][ip];
-            // yy = mChData[mReco[ib].ref[isig]].data[ip];
-          } else {
-            // Last acquired point
-            yy = mLastSample;
-          }
-        }
-        sum += mTS[is];
-        y += yy * mTS[is];
+      for (int k = 0; k < 2 * TSL; k++) {
+        y += yy[k] * ts[k];
       }
-      y = y / sum;
+      y = y / mTSSum[im];
       return y;
     }
   }
 }
 
-void DigiReco::setPoint(int isig, int ibeg, int iend, int i)
+void DigiReco::setPoint(InterpolationContext& ctx, int isig, int ibeg, int iend, int i)
 {
   // This function needs to be used only if mFullInterpolation is true otherwise the
   // vectors are not allocated
@@ -1438,24 +1486,24 @@ void DigiReco::setPoint(int isig, int ibeg, int iend, int i)
     return;
   }
   constexpr int nsbun = TSN * NTimeBinsPerBC; // Total number of interpolated points per bunch crossing
-  if (i >= mNtot || i < 0) {
-    LOG(error) << "Error addressing signal isig=" << isig << " i=" << i << " mNtot=" << mNtot;
-    mInError = true;
+  if (i >= ctx.ntot || i < 0) {
+    LOG(error) << "Error addressing signal isig=" << isig << " i=" << i << " ntot=" << ctx.ntot;
+    ctx.inError = true;
     return;
   }
   // Constant extrapolation at the beginning and at the end of the array
   if (i < TSNH) {
     // Assign value of first sample
-    mReco[ibeg].inter[isig][i] = mFirstSample;
-  } else if (i >= mIlast) {
+    mReco[ibeg].inter[isig][i] = ctx.firstSample;
+  } else if (i >= ctx.ilast) {
     // Assign value of last sample
     int isam = i % nsbun;
-    mReco[iend].inter[isig][isam] = mLastSample;
+    mReco[iend].inter[isig][isam] = ctx.lastSample;
   } else {
     // Identification of the point to be assigned
     int ibun = ibeg + i / nsbun;
     int isam = i % nsbun;
-    mReco[ibun].inter[isig][isam] = getPoint(isig, ibeg, iend, i);
+    mReco[ibun].inter[isig][isam] = getPoint(ctx, isig, i);
   }
 } // setPoint
 
@@ -1471,36 +1519,22 @@ int DigiReco::fullInterpolation(int isig, int ibeg, int iend)
   // TODO: get data from preceding time frame in case there are bunches
   // with signal at the beginning of the first orbit of a time frame
 
-  constexpr int MaxTimeBin = NTimeBinsPerBC - 1; //< number of samples per BC
-
-  // Set data members for interpolation of the current channel
-  mNbun = iend - ibeg + 1;                    // Number of adjacent bunches
-  mNsam = mNbun * NTimeBinsPerBC;             // Number of acquired samples
-  mNtot = mNsam * TSN;                        // Total number of points in the interpolated arrays
-  mNint = (mNbun * NTimeBinsPerBC - 1) * TSN; // Total points in the interpolation region (-1)
-  mIlast = mNtot - TSNH;                      // Index of last acquired sample
-
-  // At this level there should be no need to check if the channel is connected
-  // since a fatal should have been raised already
-  for (int ibun = ibeg; ibun <= iend; ibun++) {
-    auto ref = mReco[ibun].ref[isig];
-    if (ref == ZDCRefInitVal) {
-      LOG(error) << __func__ << " @ " << __LINE__ << " Missing information for bunch crossing " << mReco[ibun].ir.orbit << "." << mReco[ibun].ir.bc << " sig = " << isig;
-      return __LINE__;
-    }
+  // Set scratch data for interpolation of the current channel
+  InterpolationContext ctx;
+  int rval = loadInterpolationContext(isig, ibeg, iend, ctx);
+  if (rval) {
+    return rval;
   }
 
-  mFirstSample = mReco[ibeg].data[isig][0];
-  mLastSample = mReco[iend].data[isig][MaxTimeBin];
-
   // Allocate and fill array of interpolated points
   for (int ibun = ibeg; ibun <= iend; ibun++) {
     mReco[ibun].allocate(isig);
   }
-  for (int i = 0; i < mNtot; i++) {
-    setPoint(isig, ibeg, iend, i);
+  for (int i = 0; i < ctx.ntot; i++) {
+    setPoint(ctx, isig, ibeg, iend, i);
   }
-  if (mInError) {
+  if (ctx.inError) {
+    mInError = true;
     return __LINE__;
   }
   return 0;
@@ -1521,44 +1555,27 @@ int DigiReco::interpolate(int itdc, int ibeg, int iend)
   constexpr int MaxTimeBin = NTimeBinsPerBC - 1; //< number of samples per BC
   constexpr int nsbun = TSN * NTimeBinsPerBC;    // Total number of interpolated points per bunch crossing
 
-  // Set data members for interpolation of the current TDC
-  mNbun = iend - ibeg + 1;                    // Number of adjacent bunches
-  mNsam = mNbun * NTimeBinsPerBC;             // Number of acquired samples
-  mNtot = mNsam * TSN;                        // Total number of points in the interpolated arrays
-  mNint = (mNbun * NTimeBinsPerBC - 1) * TSN; // Total points in the interpolation region (-1)
-  mIlast = mNtot - TSNH;                      // Index of last acquired sample
-
   constexpr int nsp = 5; // Number of points to be searched
 
-  // At this level there should be no need to check if the channel is connected
-  // since a fatal should have been raised already
-  for (int ibun = ibeg; ibun <= iend; ibun++) {
-    auto ref = mReco[ibun].ref[isig];
-    if (ref == ZDCRefInitVal) {
-      LOG(error) << __func__ << " @ " << __LINE__ << " Missing information for bunch crossing " << mReco[ibun].ir.orbit << "." << mReco[ibun].ir.bc << " sig = " << isig;
-      return __LINE__;
-    }
+  // Set scratch data for interpolation of the current TDC
+  InterpolationContext ctx;
+  int rval = loadInterpolationContext(isig, ibeg, iend, ctx);
+  if (rval) {
+    return rval;
   }
 
-  // auto ref_beg = mReco[ibeg].ref[isig];
-  // auto ref_end = mReco[iend].ref[isig];
-  // mFirstSample = mChData[ref_beg].data[0]; // Original points
-  // mLastSample = mChData[ref_end].data[MaxTimeBin]; // Original points
-
-  mFirstSample = mReco[ibeg].data[isig][0];
-  mLastSample = mReco[iend].data[isig][MaxTimeBin];
-
   // mFullInterpolation turns on full interpolation for debugging
   // otherwise the interpolation is performed only around actual signal
   if (mFullInterpolation) {
     for (int ibun = ibeg; ibun <= iend; ibun++) {
       mReco[ibun].allocate(isig);
     }
-    for (int i = 0; i < mNtot; i++) {
-      setPoint(isig, ibeg, iend, i);
+    for (int i = 0; i < ctx.ntot; i++) {
+      setPoint(ctx, isig, ibeg, iend, i);
     }
   }
-  if (mInError) {
+  if (ctx.inError) {
+    mInError = true;
     return __LINE__;
   }
   // Looking for a local maximum in a search zone
@@ -1571,7 +1588,7 @@ int DigiReco::interpolate(int itdc, int ibeg, int iend)
   int ip[nsp] = {-1, -1, -1, -1, -1};
   // N.B. Points at the extremes are constant therefore no local maximum
   // can occur in these two regions
-  for (int i = 0; i < mNint; i += mInterpolationStep) {
+  for (int i = 0; i < ctx.nint; i += mInterpolationStep) {
     int isam = i + TSNH;
     // Check if trigger is fired for this point
     // For the moment we don't take into account possible extensions of the search zone
@@ -1686,8 +1703,8 @@ int DigiReco::interpolate(int itdc, int ibeg, int iend)
             sbeg = 0;
             send = sbeg + TSN;
           }
-          if (send > (mNint + TSNH)) {
-            send = mNint + TSNH;
+          if (send > (ctx.nint + TSNH)) {
+            send = ctx.nint + TSNH;
             sbeg = send - TSN;
           }
           if (sbeg < 0) {
@@ -1695,7 +1712,7 @@ int DigiReco::interpolate(int itdc, int ibeg, int iend)
           }
           for (int spos = sbeg; spos < send; spos++) {
             // Perform interpolation for the searched point
-            O2_ZDC_DIGIRECO_FLT myval = getPoint(isig, ibeg, iend, spos);
+            O2_ZDC_DIGIRECO_FLT myval = getPoint(ctx, isig, spos);
             // Get local minimum of waveform
             if (myval < amp) {
               amp = myval;
@@ -1731,7 +1748,7 @@ int DigiReco::interpolate(int itdc, int ibeg, int iend)
         myval = mReco[ib_cur].inter[isig][mysam];
       } else {
         // Perform interpolation for the searched point
-        myval = getPoint(isig, ibeg, iend, isam);
+        myval = getPoint(ctx, isig, isam);
       }
       // Get local minimum of waveform
       if (myval < amp) {
@@ -1740,7 +1757,8 @@ int DigiReco::interpolate(int itdc, int ibeg, int iend)
       }
     }
   } // Loop on interpolated points
-  if (mInError) {
+  if (ctx.inError) {
+    mInError = true;
     return __LINE__;
   }
 
@@ -1756,8 +1774,8 @@ int DigiReco::interpolate(int itdc, int ibeg, int iend)
           sbeg = 0;
           send = sbeg + TSN;
         }
-        if (send > (mNint + TSNH)) {
-          send = mNint + TSNH;
+        if (send > (ctx.nint + TSNH)) {
+          send = ctx.nint + TSNH;
           sbeg = send - TSN;
         }
         if (sbeg < 0) {
@@ -1765,7 +1783,7 @@ int DigiReco::interpolate(int itdc, int ibeg, int iend)
         }
         for (int spos = sbeg; spos < send; spos++) {
           // Perform interpolation for the searched point
-          O2_ZDC_DIGIRECO_FLT myval = getPoint(isig, ibeg, iend, spos);
+          O2_ZDC_DIGIRECO_FLT myval = getPoint(ctx, isig, spos);
           // Get local minimum of waveform
           if (myval < amp) {
             amp = myval;
@@ -1786,7 +1804,8 @@ int DigiReco::interpolate(int itdc, int ibeg, int iend)
       assignTDC(ibun, ibeg, iend, itdc, tdc, amp);
     }
   }
-  if (mInError) {
+  if (ctx.inError) {
+    mInError = true;
     return __LINE__;
   }
   // TODO: add logic to assign TDC in presence of overflow
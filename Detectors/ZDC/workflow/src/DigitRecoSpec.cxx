@@ -62,6 +62,7 @@ DigitRecoSpec::DigitRecoSpec(const int verbosity, const bool debugOut,
 
 void DigitRecoSpec::init(o2::framework::InitContext& ic)
 {
+  mWorker.setNThreads(ic.options().get<int>("nthreads"));
   mMaxWave = ic.options().get<int>("max-wave");
   if (mMaxWave > 0) {
     LOG(warning) << "Limiting the number of waveforms in ourput to " << mMaxWave;
@@ -323,7 +324,8 @@ framework::DataProcessorSpec getDigitRecoSpec(const int verbosity = 0, const boo
     outputs,
     AlgorithmSpec{adaptFromTask<DigitRecoSpec>(verbosity, enableDebugOut, enableZDCTDCCorr, enableZDCEnergyParam, enableZDCTowerParam, enableBaselineParam)},
     o2::framework::Options{{"max-wave", o2::framework::VariantType::Int, 0, {"Maximum number of waveforms per TF in output"}},
-                           {"tf-fraction", o2::framework::VariantType::Double, 1.0, {"Fraction of reconstructed TFs"}}}};
+                           {"tf-fraction", o2::framework::VariantType::Double, 1.0, {"Fraction of reconstructed TFs"}},
+                           {"nthreads", o2::framework::VariantType::Int, 1, {"Number of threads to process the channels (if built with OpenMP)"}}}};
 }
 
 } // namespace zdc
@@ -36,6 +36,7 @@
 #include "DataFormatsMCH/ROFRecord.h"
 #include <EventVisualisationBase/DirectoryLoader.h>
 #include "DataFormatsMCH/Cluster.h"
+#include <algorithm>
 #include <unistd.h>
 
 using std::chrono::duration_cast;
@@ -67,6 +68,7 @@ void customize(std::vector<ConfigParamSpec>& workflowOptions)
     {"number-of_tracks", VariantType::Int, -1, {"maximum number of track stored in json file (-1 means no limit)"}},
     {"number-of_bytes", VariantType::Int, 3000000, {"number of bytes stored in time interval which stops producing new data file (-1 means no limit)"}},
     {"time-interval", VariantType::Int, 5000, {"time interval in milliseconds between stored files"}},
+    {"time-budget", VariantType::Int, 0, {"processing time budget in milliseconds per visualized time frame - the number of stored tracks is adapted to stay below it (0 means no adaptation)"}},
     {"disable-mc", VariantType::Bool, false, {"disable visualization of MC data"}},
     {"disable-write", VariantType::Bool, false, {"disable writing output files"}},
     {"display-clusters", VariantType::String, "ITS,TPC,TRD,TOF", {"comma-separated list of clusters to display"}},
@@ -126,6 +128,7 @@ void O2DPLDisplaySpec::run(ProcessingContext& pc)
     return; // skip this run - it is too often
   }
   this->mTimeStamp = currentTime; // next run AFTER period counted from last run, even if there will be not any save
+  const auto budgetStartTime = currentTime;
   o2::globaltracking::RecoContainer recoCont;
   recoCont.collectData(pc, *mDataRequest);
   updateTimeDependentParams(pc); // Make sure that this is called after the RecoContainer collect data, since some condition objects are fetched there
@@ -142,13 +145,19 @@ void O2DPLDisplaySpec::run(ProcessingContext& pc)
     }
   }
 
+  // level of detail: the track cap from the adaptive time budget can only tighten the configured limit
+  int numberOfTracks = this->mNumberOfTracks;
+  if (this->mTimeBudget.count() > 0 && this->mAdaptiveNumberOfTracks != -1 && (numberOfTracks == -1 || this->mAdaptiveNumberOfTracks < numberOfTracks)) {
+    numberOfTracks = this->mAdaptiveNumberOfTracks;
+  }
+
   EveWorkflowHelper::FilterSet enabledFilters;
 
   enabledFilters.set(EveWorkflowHelper::Filter::ITSROF, this->mFilterITSROF);
   enabledFilters.set(EveWorkflowHelper::Filter::TimeBracket, this->mFilterTime);
   enabledFilters.set(EveWorkflowHelper::Filter::EtaBracket, this->mRemoveTPCEta);
-  enabledFilters.set(EveWorkflowHelper::Filter::TotalNTracks, this->mNumberOfTracks != -1);
-  EveWorkflowHelper helper(enabledFilters, this->mNumberOfTracks, this->mTimeBracket, this->mEtaBracket, this->mPrimaryVertexMode);
+  enabledFilters.set(EveWorkflowHelper::Filter::TotalNTracks, numberOfTracks != -1);
+  EveWorkflowHelper helper(enabledFilters, numberOfTracks, this->mTimeBracket, this->mEtaBracket, this->mPrimaryVertexMode);
   helper.setRecoContainer(&recoCont);
   if (mEMCALCalibrator) {
     helper.setEMCALCellRecalibrator(mEMCALCalibrator.get());
@@ -238,6 +247,23 @@ void O2DPLDisplaySpec::run(ProcessingContext& pc)
   auto endTime = std::chrono::high_resolution_clock::now();
   LOGP(info, "Visualization of TF:{} at orbit {} took {} s.", tinfo.tfCounter, tinfo.firstTForbit, std::chrono::duration_cast<std::chrono::microseconds>(endTime - currentTime).count() * 1e-6);
 
+  if (this->mTimeBudget.count() > 0) {
+    // adapt the level of detail for the next time frame: halve the track cap when the
+    // budget was exceeded, relax it again gradually when well below the budget
+    constexpr int minAdaptiveTracks = 100;
+    const auto processingTime = std::chrono::duration_cast<std::chrono::milliseconds>(endTime - budgetStartTime);
+    if (processingTime > this->mTimeBudget) {
+      int current = this->mAdaptiveNumberOfTracks != -1 ? this->mAdaptiveNumberOfTracks : (int)helper.mTotalAcceptedDataTypes.size();
+      this->mAdaptiveNumberOfTracks = std::max(minAdaptiveTracks, current / 2);
+      LOGP(info, "Visualization took {} ms (budget {} ms), reducing the track cap to {}", processingTime.count(), this->mTimeBudget.count(), this->mAdaptiveNumberOfTracks);
+    } else if (this->mAdaptiveNumberOfTracks != -1 && 2 * processingTime < this->mTimeBudget) {
+      this->mAdaptiveNumberOfTracks += this->mAdaptiveNumberOfTracks / 4 + 1;
+      if (this->mNumberOfTracks != -1 && this->mAdaptiveNumberOfTracks >= this->mNumberOfTracks) {
+        this->mAdaptiveNumberOfTracks = -1; // back at the configured limit, no adaptation needed
+      }
+    }
+  }
+
   LOGP(info, "PVs with tracks: {}", helper.mPrimaryVertexTrackGIDs.size());
   LOGP(info, "PVs with triggers: {}", helper.mPrimaryVertexTriggerGIDs.size());
   LOGP(info, "Data files saved: {}", filesSaved);
@@ -342,6 +368,7 @@ WorkflowSpec defineDataProcessing(ConfigContext const& cfgc)
   }
 
   std::chrono::milliseconds timeInterval(cfgc.options().get<int>("time-interval"));
+  std::chrono::milliseconds timeBudget(cfgc.options().get<int>("time-budget"));
   int numberOfFiles = cfgc.options().get<int>("number-of_files");
   int numberOfTracks = cfgc.options().get<int>("number-of_tracks");
   int numberOfBytes = cfgc.options().get<int>("number-of_bytes");
@@ -457,7 +484,7 @@ WorkflowSpec defineDataProcessing(ConfigContext const& cfgc)
     "o2-eve-export",
     dataRequest->inputs,
     {},
-    AlgorithmSpec{adaptFromTask<O2DPLDisplaySpec>(disableWrite, useMC, srcTrk, srcCl, dataRequest, ggRequest, emcalCalibLoader, jsonFolder, ext, timeInterval, numberOfFiles, numberOfTracks, numberOfBytes, eveHostNameMatch, minITSTracks, minTracks, filterITSROF, filterTime, timeBracket, removeTPCEta, etaBracket, tracksSorting, onlyNthEvent, primaryVertexMode, maxPrimaryVertices, primaryVertexTriggers, primaryVertexMinZ, primaryVertexMaxZ, primaryVertexMinX, primaryVertexMaxX, primaryVertexMinY, primaryVertexMaxY, maxEMCALCellTime, minEMCALCellEnergy)}});
+    AlgorithmSpec{adaptFromTask<O2DPLDisplaySpec>(disableWrite, useMC, srcTrk, srcCl, dataRequest, ggRequest, emcalCalibLoader, jsonFolder, ext, timeInterval, timeBudget, numberOfFiles, numberOfTracks, numberOfBytes, eveHostNameMatch, minITSTracks, minTracks, filterITSROF, filterTime, timeBracket, removeTPCEta, etaBracket, tracksSorting, onlyNthEvent, primaryVertexMode, maxPrimaryVertices, primaryVertexTriggers, primaryVertexMinZ, primaryVertexMaxZ, primaryVertexMinX, primaryVertexMaxX, primaryVertexMinY, primaryVertexMaxY, maxEMCALCellTime, minEMCALCellEnergy)}});
 
   // configure dpl timer to inject correct firstTForbit: start from the 1st orbit of TF containing 1st sampled orbit
   o2::raw::HBFUtilsInitializer hbfIni(cfgc, specs);
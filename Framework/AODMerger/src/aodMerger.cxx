@@ -38,6 +38,7 @@ int main(int argc, char* argv[])
   bool skipNonExistingFiles = false;
   bool skipParentFilesList = false;
   int verbosity = 2;
+  int compression = 505;
   int exitCode = 0; // 0: success, >0: failure
 
   int option_index = 0;
@@ -48,6 +49,7 @@ int main(int argc, char* argv[])
     {"skip-non-existing-files", no_argument, nullptr, 3},
     {"skip-parent-files-list", no_argument, nullptr, 4},
     {"verbosity", required_argument, nullptr, 5},
+    {"compression", required_argument, nullptr, 7},
     {"help", no_argument, nullptr, 6},
     {nullptr, 0, nullptr, 0}};
 
@@ -67,6 +69,8 @@ int main(int argc, char* argv[])
       skipParentFilesList = true;
     } else if (c == 5) {
       verbosity = atoi(optarg);
+    } else if (c == 7) {
+      compression = atoi(optarg);
     } else if (c == 6) {
       printf("AO2D merging tool. Options: \n");
       printf("  --input <inputfile.txt>      Contains path to files to be merged. Default: %s\n", inputCollection.c_str());
@@ -75,6 +79,7 @@ int main(int argc, char* argv[])
       printf("  --skip-non-existing-files    Flag to allow skipping of non-existing files in the input list.\n");
       printf("  --skip-parent-files-list     Flag to allow skipping the merging of the parent files list.\n");
       printf("  --verbosity <flag>           Verbosity of output (default: %d).\n", verbosity);
+      printf("  --compression <setting>      ROOT compression setting of the output file (default: %d). Baskets of fast-copied trees keep their original compression.\n", compression);
       return -1;
     } else {
       return -2;
@@ -95,7 +100,7 @@ int main(int argc, char* argv[])
   std::map<std::string, int> offsets;
   std::map<std::string, int> unassignedIndexOffset;
 
-  auto outputFile = TFile::Open(outputFileName.c_str(), "RECREATE", "", 505);
+  auto outputFile = TFile::Open(outputFileName.c_str(), "RECREATE", "", compression);
   TDirectory* outputDir = nullptr;
   long currentDirSize = 0;
 
@@ -256,6 +261,7 @@ int main(int argc, char* argv[])
         auto outputTree = trees[treeName];
         // register index and connect VLA columns
         std::vector<std::pair<int*, int>> indexList;
+        std::vector<TBranch*> indexBranches;
         std::vector<char*> vlaPointers;
         std::vector<int*> indexPointers;
         TObjArray* branches = inputTree->GetListOfBranches();
@@ -286,6 +292,7 @@ int main(int argc, char* argv[])
               for (int i = 0; i < maximum; i++) {
                 indexList.push_back({reinterpret_cast<int*>(buffer + i * typeSize), offsets[getTableName(branchName, treeName)]});
               }
+              indexBranches.push_back(br);
             }
           } else if (branchName.BeginsWith("fIndexSlice")) {
             int* buffer = new int[2];
@@ -297,6 +304,7 @@ int main(int argc, char* argv[])
 
             indexList.push_back({buffer, offsets[getTableName(branchName, treeName)]});
             indexList.push_back({buffer + 1, offsets[getTableName(branchName, treeName)]});
+            indexBranches.push_back(br);
           } else if (branchName.BeginsWith("fIndex") && !branchName.EndsWith("_size")) {
             int* buffer = new int;
             *buffer = 0;
@@ -306,6 +314,7 @@ int main(int argc, char* argv[])
             outputTree->SetBranchAddress(br->GetName(), buffer);
 
             indexList.push_back({buffer, offsets[getTableName(branchName, treeName)]});
+            indexBranches.push_back(br);
           }
         }
 
@@ -317,7 +326,13 @@ int main(int argc, char* argv[])
             for (auto& index : indexList) {
               *(index.first) = 0; // Any positive number will do, in any case it will not be filled in the output. Otherwise the previous entry is used and manipulated in the following.
             }
-            inputTree->GetEntry(i);
+            if (alreadyCopied) { // entries are already in the output: only the index branches are needed to track the unassigned-index offset, skip decompressing the rest
+              for (auto* br : indexBranches) {
+                br->GetEntry(i);
+              }
+            } else {
+              inputTree->GetEntry(i);
+            }
             // shift index columns by offset
             for (const auto& idx : indexList) {
               // if negative, the index is unassigned. In this case, the different unassigned blocks have to get unique negative IDs
@@ -27,6 +27,12 @@
 #include "TObjString.h"
 #include "TMap.h"
 
+#include <arrow/io/file.h>
+#include <arrow/ipc/reader.h>
+#include <arrow/table.h>
+
+#include <filesystem>
+
 #include <uv.h>
 
 #if __has_include(<TJAlienFile.h>)
@@ -363,6 +369,63 @@ int DataInputDescriptor::findDFNumber(int file, std::string dfName)
   return it - dfList.begin();
 }
 
+// Map an Arrow-IPC-formatted companion of a given DF tree directly into
+// Arrow buffers, without copying any payload byte. The companion layout is
+// "<AO2D file>.arrow/<DF folder>/<tree name>.arrow", as produced by the IPC
+// conversion tools. Returns nullptr if no companion exists; throws on a
+// malformed companion, so that a stale conversion does not silently fall
+// back to the (much slower) TTree path.
+static std::shared_ptr<arrow::Table> mapArrowIPCTable(std::string const& rootFileName,
+                                                      std::string const& folderName,
+                                                      std::string const& treename,
+                                                      std::vector<std::string> const& colnames,
+                                                      size_t& mappedSize)
+{
+  auto ipcPath = rootFileName + ".arrow/" + folderName + "/" + treename + ".arrow";
+  if (!std::filesystem::exists(ipcPath)) {
+    return nullptr;
+  }
+  auto maybeMapped = arrow::io::MemoryMappedFile::Open(ipcPath, arrow::io::FileMode::READ);
+  if (!maybeMapped.ok()) {
+    throw std::runtime_error(fmt::format(R"(Cannot memory-map Arrow IPC file "{}": {})", ipcPath, maybeMapped.status().ToString()));
+  }
+  auto mapped = maybeMapped.ValueOrDie();
+  auto maybeReader = arrow::ipc::RecordBatchFileReader::Open(mapped);
+  if (!maybeReader.ok()) {
+    throw std::runtime_error(fmt::format(R"(Cannot read Arrow IPC file "{}": {})", ipcPath, maybeReader.status().ToString()));
+  }
+  auto reader = maybeReader.ValueOrDie();
+  std::vector<std::shared_ptr<arrow::RecordBatch>> batches;
+  batches.reserve(reader->num_record_batches());
+  for (int ib = 0; ib < reader->num_record_batches(); ++ib) {
+    auto maybeBatch = reader->ReadRecordBatch(ib);
+    if (!maybeBatch.ok()) {
+      throw std::runtime_error(fmt::format(R"(Cannot map record batch {} of "{}": {})", ib, ipcPath, maybeBatch.status().ToString()));
+    }
+    batches.emplace_back(maybeBatch.ValueOrDie());
+  }
+  auto maybeTable = arrow::Table::FromRecordBatches(reader->schema(), batches);
+  if (!maybeTable.ok()) {
+    throw std::runtime_error(fmt::format(R"(Cannot assemble table from "{}": {})", ipcPath, maybeTable.status().ToString()));
+  }
+  auto table = maybeTable.ValueOrDie();
+  if (!colnames.empty()) {
+    // Only the requested columns are kept: the buffers of the others are
+    // never touched, the kernel does not even page them in.
+    std::vector<int> indices;
+    for (auto& colname : colnames) {
+      auto index = table->schema()->GetFieldIndex(colname);
+      if (index < 0) {
+        throw std::runtime_error(fmt::format(R"(Column "{}" not found in "{}")", colname, ipcPath));
+      }
+      indices.emplace_back(index);
+    }
+    table = table->SelectColumns(indices).ValueOrDie();
+  }
+  mappedSize += static_cast<size_t>(mapped->GetSize().ValueOr(0));
+  return table;
+}
+
 bool DataInputDescriptor::readTree(DataAllocator& outputs, header::DataHeader dh, int counter, int numTF, std::string treename, size_t& totalSizeCompressed, size_t& totalSizeUncompressed)
 {
   auto ioStart = uv_hrtime();
@@ -372,6 +435,18 @@ bool DataInputDescriptor::readTree(DataAllocator& outputs, header::DataHeader dh
     return false;
   }
 
+  // Zero-copy fast path: if an Arrow-IPC companion of this DF exists, map
+  // it directly into the Arrow buffers backing the output table.
+  if (!mAlienSupport) {
+    auto ipcTable = mapArrowIPCTable(fileAndFolder.file->GetName(), fileAndFolder.folderName, treename,
+                                     getColumnNames(dh), totalSizeUncompressed);
+    if (ipcTable != nullptr) {
+      outputs.adopt(Output(dh), ipcTable);
+      mIOTime += (uv_hrtime() - ioStart);
+      return true;
+    }
+  }
+
   auto fullpath = fileAndFolder.folderName + "/" + treename;
   auto tree = (TTree*)fileAndFolder.file->Get(fullpath.c_str());
 
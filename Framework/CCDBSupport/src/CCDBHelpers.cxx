@@ -24,6 +24,10 @@
 #include <TError.h>
 #include <TMemFile.h>
 #include <functional>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <optional>
 
 O2_DECLARE_DYNAMIC_LOG(ccdb);
 
@@ -50,6 +54,12 @@ struct CCDBFetcherHelper {
     std::string url;
   };
 
+  /// Result of a background fetch of the successor of an expiring object
+  struct PrefetchedObject {
+    o2::pmr::vector<char> payload;
+    std::map<std::string, std::string> headers;
+  };
+
   std::unordered_map<std::string, CCDBCacheInfo> mapURL2UUID;
   std::unordered_map<std::string, DataAllocator::CacheId> mapURL2DPLCache;
   std::string createdNotBefore = "0";
@@ -61,22 +71,44 @@ struct CCDBFetcherHelper {
   int queryPeriodGlo = 1;
   int queryPeriodFactor = 1;
   int64_t timeToleranceMS = 5000;
+  std::string defaultHost;
+  int64_t prefetchMarginMS = 0; // start a background fetch of the successor this many ms before the validity edge, 0 = disabled
+  // Dedicated API instances for the background fetches, so that the in-flight transfers never share
+  // state with the synchronous ones. Must outlive the futures below, which join on destruction.
+  std::unordered_map<std::string, std::unique_ptr<o2::ccdb::CcdbApi>> prefetchApis;
+  std::unordered_map<std::string, std::future<PrefetchedObject>> prefetches;
 
-  o2::ccdb::CcdbApi& getAPI(const std::string& path)
+  std::string getAPIKey(const std::string& path)
   {
     // find the first = sign in the string. If present drop everything after it
     // and between it and the previous /.
     auto pos = path.find('=');
     if (pos == std::string::npos) {
       auto entry = remappings.find(path);
-      return apis[entry == remappings.end() ? "" : entry->second];
+      return entry == remappings.end() ? "" : entry->second;
     }
     auto pos2 = path.rfind('/', pos);
     if (pos2 == std::string::npos || pos2 == pos - 1 || pos2 == 0) {
       throw runtime_error_f("Malformed path %s", path.c_str());
     }
     auto entry = remappings.find(path.substr(0, pos2));
-    return apis[entry == remappings.end() ? "" : entry->second];
+    return entry == remappings.end() ? "" : entry->second;
+  }
+
+  o2::ccdb::CcdbApi& getAPI(const std::string& path)
+  {
+    return apis[getAPIKey(path)];
+  }
+
+  o2::ccdb::CcdbApi& getPrefetchAPI(const std::string& path)
+  {
+    auto key = getAPIKey(path);
+    auto& api = prefetchApis[key];
+    if (!api) {
+      api = std::make_unique<o2::ccdb::CcdbApi>();
+      api->init(key.empty() ? defaultHost : key);
+    }
+    return *api;
   }
 };
 
@@ -183,6 +215,29 @@ bool isOnlineRun(DataTakingContext const& dtc)
   return dtc.deploymentMode == DeploymentMode::OnlineAUX || dtc.deploymentMode == DeploymentMode::OnlineDDS || dtc.deploymentMode == DeploymentMode::OnlineECS;
 }
 
+// Check whether a prefetched object is valid for the given timestamp
+bool prefetchCovers(std::map<std::string, std::string> const& headers, int64_t timestamp)
+{
+  auto from = headers.find("Valid-From");
+  auto until = headers.find("Valid-Until");
+  if (from == headers.end() || until == headers.end()) {
+    return false;
+  }
+  return std::stoll(from->second) <= timestamp && timestamp < std::stoll(until->second);
+}
+
+// Return the finished background fetch for the given path, if any
+auto takeReadyPrefetch(std::shared_ptr<CCDBFetcherHelper> const& helper, std::string const& path) -> std::optional<CCDBFetcherHelper::PrefetchedObject>
+{
+  auto it = helper->prefetches.find(path);
+  if (it == helper->prefetches.end() || it->second.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+    return std::nullopt;
+  }
+  auto obj = it->second.get();
+  helper->prefetches.erase(it);
+  return obj;
+}
+
 auto populateCacheWith(std::shared_ptr<CCDBFetcherHelper> const& helper,
                        int64_t timestamp,
                        TimingInfo& timingInfo,
@@ -242,8 +297,21 @@ auto populateCacheWith(std::shared_ptr<CCDBFetcherHelper> const& helper,
 
     const auto& api = helper->getAPI(path);
     if (checkValidity && (!api.isSnapshotMode() || etag.empty())) { // in the snapshot mode the object needs to be fetched only once
-      LOGP(detail, "Loading {} for timestamp {}", path, timestamp);
-      api.loadFileToMemory(v, path, metadata, timestamp, &headers, etag, helper->createdNotAfter, helper->createdNotBefore);
+      bool usedPrefetch = false;
+      if (auto prefetched = takeReadyPrefetch(helper, path)) {
+        // A background fetch of the successor object finished: if it covers the current timestamp,
+        // swap it in instead of doing a blocking download at the validity edge.
+        if (prefetched->headers.count("Error") == 0 && prefetched->payload.size() && prefetchCovers(prefetched->headers, timestamp)) {
+          O2_SIGNPOST_EVENT_EMIT(ccdb, sid, "populateCacheWith", "Using prefetched %{public}s for timestamp %" PRIi64, path.data(), timestamp);
+          headers = std::move(prefetched->headers);
+          v.insert(v.end(), prefetched->payload.begin(), prefetched->payload.end());
+          usedPrefetch = true;
+        }
+      }
+      if (!usedPrefetch) {
+        LOGP(detail, "Loading {} for timestamp {}", path, timestamp);
+        api.loadFileToMemory(v, path, metadata, timestamp, &headers, etag, helper->createdNotAfter, helper->createdNotBefore);
+      }
       if ((headers.count("Error") != 0) || (etag.empty() && v.empty())) {
         LOGP(fatal, "Unable to find object {}/{}", path, timestamp);
         // FIXME: I should send a dummy message.
@@ -290,6 +358,24 @@ auto populateCacheWith(std::shared_ptr<CCDBFetcherHelper> const& helper,
     helper->mapURL2UUID[path].cacheHit++;
     allocator.adoptFromCache(output, cacheId, header::gSerializationMethodCCDB);
     // the outputBuffer was not used, can we destroy it?
+
+    // If the cached object expires within the prefetch margin, download the successor in the
+    // background already now, so that the TF crossing the validity edge finds it ready.
+    if (helper->prefetchMarginMS > 0 && !api.isSnapshotMode() && helper->prefetches.find(path) == helper->prefetches.end()) {
+      int64_t validUntil = helper->mapURL2UUID[path].cacheValidUntil;
+      if (validUntil > 0 && timestamp + helper->prefetchMarginMS >= validUntil) {
+        O2_SIGNPOST_EVENT_EMIT(ccdb, sid, "populateCacheWith", "Prefetching successor of %{public}s valid until %" PRIi64, path.data(), validUntil);
+        auto& prefetchApi = helper->getPrefetchAPI(path);
+        auto createdNotAfter = helper->createdNotAfter;
+        auto createdNotBefore = helper->createdNotBefore;
+        helper->prefetches[path] = std::async(std::launch::async, [&prefetchApi, path, metadata, validUntil, createdNotAfter, createdNotBefore]() {
+          CCDBFetcherHelper::PrefetchedObject obj;
+          std::string noEtag;
+          prefetchApi.loadFileToMemory(obj.payload, path, metadata, validUntil, &obj.headers, noEtag, createdNotAfter, createdNotBefore);
+          return obj;
+        });
+      }
+    }
   }
   O2_SIGNPOST_END(ccdb, sid, "populateCacheWith", "Finished populating cache with CCDB objects");
 };
@@ -305,7 +391,12 @@ AlgorithmSpec CCDBHelpers::fetchFromCCDB()
       helper->timeToleranceMS = options.get<int64_t>("condition-time-tolerance");
       helper->queryPeriodGlo = checkRate > 0 ? checkRate : std::numeric_limits<int>::max();
       helper->queryPeriodFactor = checkMult > 0 ? checkMult : 1;
+      helper->defaultHost = defHost;
+      helper->prefetchMarginMS = options.get<int64_t>("condition-prefetch-margin");
       LOGP(info, "CCDB Backend at: {}, validity check for every {} TF{}", defHost, helper->queryPeriodGlo, helper->queryPeriodFactor == 1 ? std::string{} : fmt::format(", (query for high-rate objects downscaled by {})", helper->queryPeriodFactor));
+      if (helper->prefetchMarginMS > 0) {
+        LOGP(info, "CCDB objects expiring within {} ms will be prefetched in the background", helper->prefetchMarginMS);
+      }
       LOGP(info, "Hook to enable signposts for CCDB messages at {}", (void*)&private_o2_log_ccdb->stacktrace);
       auto remapString = options.get<std::string>("condition-remap");
       ParserResult result = CCDBHelpers::parseRemappings(remapString.c_str());
@@ -26,7 +26,9 @@
 #include <arrow/array.h>
 #include <arrow/util/config.h>
 #include <gandiva/selection_vector.h>
+#include <array>
 #include <cassert>
+#include <cstring>
 #include <fmt/format.h>
 #include <gsl/span>
 #include <limits>
@@ -412,6 +414,34 @@ class ColumnIterator : ChunkingPolicy
     return *this;
   }
 
+  /// Issue a software prefetch for the cell of the (global) row pos, if it belongs
+  /// to the chunk the iterator currently points to; other rows are ignored, since
+  /// resolving their chunk would cost more than the avoided cache miss.
+  void prefetch(int64_t pos) const
+  {
+    if constexpr (!std::is_same_v<arrow_array_for_t<T>, arrow::ListArray> &&
+                  !std::is_same_v<arrow_array_for_t<T>, arrow::FixedSizeListArray>) {
+      auto const* cell = mCurrent + (pos >> SCALE_FACTOR);
+      if (pos >= mFirstIndex && cell < mLast) {
+        O2_BUILTIN_PREFETCH(cell, 0);
+      }
+    }
+  }
+
+  /// Speculatively read the value delta rows ahead of the current position, or
+  /// fallback when that row is not part of the current chunk. Used by the index
+  /// columns to learn the target of an upcoming dereference without paying the
+  /// chunk navigation.
+  T peekAhead(int64_t delta, T fallback) const
+  {
+    static_assert(!std::is_same_v<std::decay_t<T>, bool> && !std::is_same_v<arrow_array_for_t<T>, arrow::ListArray> &&
+                    !std::is_same_v<arrow_array_for_t<T>, arrow::FixedSizeListArray>,
+                  "peeking is only supported for flat arithmetic columns");
+    int64_t pos = *mCurrentPos + delta;
+    auto const* cell = mCurrent + (pos >> SCALE_FACTOR);
+    return (pos >= mFirstIndex && cell < mLast) ? *cell : fallback;
+  }
+
   // Move to the chunk which containts element pos
   ColumnIterator<T>& checkNextChunk()
   {
@@ -451,6 +481,78 @@ class ColumnIterator : ChunkingPolicy
   }
 };
 
+/// How many rows ahead of the current one the index columns peek when issuing
+/// speculative prefetches for their target table. Large enough to hide a memory
+/// load behind the processing of the rows in between, small enough to stay
+/// within the rows an analysis loop is realistically going to visit.
+constexpr int64_t PrefetchDistance = 4;
+
+/// A contiguous view over the values of a persistent column within a single
+/// Arrow chunk, together with the global row index of its first element.
+/// Since the values are guaranteed to be flat in memory, loops over the span
+/// carry no per-row chunk-boundary check and can be autovectorized.
+template <typename T>
+struct ColumnBlock {
+  gsl::span<unwrap_t<T> const> values;
+  int64_t firstRow;
+};
+
+/// Return the list of contiguous blocks backing the persistent column C of
+/// the given table, one per Arrow chunk. This is the batched counterpart of
+/// the row-by-row ColumnIterator access: selections on flat arithmetic
+/// columns (pt, eta, phi, ...) should iterate the blocks and run a plain
+/// loop on each span, which the compiler can turn into SIMD code.
+template <typename C, typename T>
+auto gatherBlocks(T const& table)
+{
+  using type = typename C::type;
+  static_assert(std::is_arithmetic_v<type> && !std::is_same_v<bool, std::decay_t<type>>,
+                "gatherBlocks is only available for flat arithmetic columns");
+  auto column = table.asArrowTable()->GetColumnByName(C::columnLabel());
+  std::vector<ColumnBlock<type>> blocks;
+  blocks.reserve(column->num_chunks());
+  int64_t firstRow = 0;
+  for (auto& chunk : column->chunks()) {
+    auto array = std::static_pointer_cast<arrow_array_for_t<type>>(chunk);
+    blocks.emplace_back(ColumnBlock<type>{{array->raw_values(), static_cast<size_t>(array->length())}, firstRow});
+    firstRow += array->length();
+  }
+  return blocks;
+}
+
+/// Copy up to N values of the persistent column C, starting at global row
+/// @a fromRow, into @a buffer, crossing chunk boundaries as needed. Returns
+/// the number of values actually gathered (less than N only at the end of
+/// the column). Meant for explicitly blocked kernels which want a fixed
+/// SIMD-friendly working set regardless of the chunk layout.
+template <size_t N, typename C, typename T>
+size_t gatherBlock(T const& table, int64_t fromRow, std::array<typename C::type, N>& buffer)
+{
+  using type = typename C::type;
+  static_assert(std::is_arithmetic_v<type> && !std::is_same_v<bool, std::decay_t<type>>,
+                "gatherBlock is only available for flat arithmetic columns");
+  auto column = table.asArrowTable()->GetColumnByName(C::columnLabel());
+  size_t gathered = 0;
+  int64_t firstRow = 0;
+  for (auto& chunk : column->chunks()) {
+    if (gathered == N) {
+      break;
+    }
+    auto length = chunk->length();
+    if (fromRow + static_cast<int64_t>(gathered) >= firstRow + length) {
+      firstRow += length;
+      continue;
+    }
+    auto array = std::static_pointer_cast<arrow_array_for_t<type>>(chunk);
+    auto offset = fromRow + static_cast<int64_t>(gathered) - firstRow;
+    auto count = std::min<int64_t>(length - offset, static_cast<int64_t>(N - gathered));
+    std::memcpy(buffer.data() + gathered, array->raw_values() + offset, count * sizeof(type));
+    gathered += count;
+    firstRow += length;
+  }
+  return gathered;
+}
+
 template <typename T, typename INHERIT>
 struct Column {
   using inherited_t = INHERIT;
@@ -1002,7 +1104,22 @@ struct RowViewCore : public IP, C... {
     doSetCurrentInternal(internal_index_columns_t{}, table);
   }
 
+  /// Issue software prefetches for the cells of all persistent columns of row pos,
+  /// without moving the view; rows outside the chunks the column iterators
+  /// currently point to are ignored. Used to warm up the cache lines of upcoming
+  /// random accesses through index columns.
+  void prefetchRow(int64_t pos) const
+  {
+    prefetchRowImpl(persistent_columns_t{}, pos);
+  }
+
  private:
+  template <typename... PC>
+  void prefetchRowImpl(framework::pack<PC...>, int64_t pos) const
+  {
+    (PC::mColumnIterator.prefetch(pos), ...);
+  }
+
   /// Helper to move to the correct chunk, if needed.
   /// FIXME: not needed?
   template <typename... PC>
@@ -1739,6 +1856,15 @@ class Table
     return it;
   }
 
+  /// Warm up the cache lines of row i (all persistent columns) ahead of an
+  /// upcoming rawIteratorAt(i), see RowViewCore::prefetchRow
+  void prefetchRow(uint64_t i) const
+  {
+    if (static_cast<int64_t>(i) < mTable->num_rows()) {
+      mBegin.prefetchRow(i);
+    }
+  }
+
   unfiltered_const_iterator begin() const
   {
     return unfiltered_const_iterator(mBegin);
@@ -2425,6 +2551,14 @@ DECLARE_SOA_ITERATOR_METADATA();
       if (O2_BUILTIN_UNLIKELY(t == nullptr)) {                                                                                                                               \
         o2::soa::dereferenceWithWrongType();                                                                                                                                 \
       }                                                                                                                                                                      \
+      if constexpr (requires { t->prefetchRow(uint64_t{}); }) {                                                                                                              \
+        /* speculatively peek at the index a few rows ahead and warm up the */                                                                                               \
+        /* cache lines of its target row while the current one is processed */                                                                                               \
+        auto aheadId = mColumnIterator.peekAhead(o2::soa::PrefetchDistance, static_cast<type>(-1));                                                                                       \
+        if (aheadId >= 0) {                                                                                                                                                  \
+          t->prefetchRow(aheadId);                                                                                                                                           \
+        }                                                                                                                                                                    \
+      }                                                                                                                                                                      \
       return t->rawIteratorAt(*mColumnIterator);                                                                                                                             \
     }                                                                                                                                                                        \
                                                                                                                                                                              \
@@ -2502,6 +2636,14 @@ DECLARE_SOA_ITERATOR_METADATA();
       if (O2_BUILTIN_UNLIKELY(t == nullptr)) {                                                                                                                     \
         o2::soa::dereferenceWithWrongType();                                                                                                                       \
       }                                                                                                                                                            \
+      if constexpr (requires { t->prefetchRow(uint64_t{}); }) {                                                                                                    \
+        /* speculatively peek at the index a few rows ahead and warm up the */                                                                                     \
+        /* cache lines of its target row while the current one is processed */                                                                                     \
+        auto aheadId = mColumnIterator.peekAhead(o2::soa::PrefetchDistance, static_cast<type>(-1));                                                                             \
+        if (aheadId >= 0) {                                                                                                                                        \
+          t->prefetchRow(aheadId);                                                                                                                                 \
+        }                                                                                                                                                          \
+      }                                                                                                                                                            \
       return t->rawIteratorAt(*mColumnIterator);                                                                                                                   \
     }                                                                                                                                                              \
                                                                                                                                                                    \
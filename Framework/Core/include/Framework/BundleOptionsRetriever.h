@@ -0,0 +1,55 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+#ifndef O2_FRAMEWORK_BUNDLEOPTIONSRETRIEVER_H_
+#define O2_FRAMEWORK_BUNDLEOPTIONSRETRIEVER_H_
+
+#include "Framework/ParamRetriever.h"
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace o2::framework
+{
+
+// Param retriever which reads the options from a pre-tokenized bundle of
+// (name, value) records produced once by the driver, so that the spawned
+// devices do not need to go through boost::program_options parsing of the
+// full option set again. The bundle is handed to the child via the
+// DPL_OPTIONS_BUNDLE environment variable.
+class BundleOptionsRetriever : public ParamRetriever
+{
+ public:
+  /// Separator between (name, value) records in the encoded bundle
+  static constexpr char RECORD_SEPARATOR = '\x1e';
+  /// Separator between name and value within a record
+  static constexpr char UNIT_SEPARATOR = '\x1f';
+  /// Environment variable used to pass the bundle to the child
+  static constexpr char const* ENV_NAME = "DPL_OPTIONS_BUNDLE";
+
+  BundleOptionsRetriever(std::string bundle)
+    : mBundle{std::move(bundle)}
+  {
+  }
+
+  /// Encode the already resolved @a options of a device into a bundle
+  /// string which can be decoded by this retriever.
+  static std::string encode(std::vector<std::pair<std::string, std::string>> const& options);
+
+  void update(std::vector<ConfigParamSpec> const& specs,
+              boost::property_tree::ptree& store,
+              boost::property_tree::ptree& provenance) override;
+
+ private:
+  std::string mBundle;
+};
+
+} // namespace o2::framework
+#endif // O2_FRAMEWORK_BUNDLEOPTIONSRETRIEVER_H_
@@ -38,6 +38,17 @@ enum struct ChannelProtocol {
   IPC
 };
 
+/// Optional lightweight compression of the payloads sent over a channel,
+/// meant for network channels which are bandwidth rather than CPU bound.
+/// Compression is applied by the DataSender of the producing device and
+/// undone transparently on the receiving side, the payload frames being
+/// self-describing.
+enum struct ChannelCompression {
+  None,
+  LZ4,
+  ZLIB
+};
+
 /// This describes an input channel. Since they are point to
 /// point connections, there is not much to say about them.
 /// Notice that this should be considered read only once it
@@ -72,6 +83,7 @@ struct OutputChannelSpec {
   size_t recvBufferSize = 1000;
   size_t sendBufferSize = 1000;
   std::string ipcPrefix = ".";
+  ChannelCompression compression = ChannelCompression::None;
 };
 
 } // namespace o2::framework
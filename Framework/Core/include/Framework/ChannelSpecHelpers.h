@@ -45,6 +45,10 @@ struct ChannelSpecHelpers {
   static char const* typeAsString(enum ChannelType type);
   /// return a ChannelMethod as a lowercase string
   static char const* methodAsString(enum ChannelMethod method);
+  /// return a ChannelCompression as a lowercase string
+  static char const* compressionAsString(enum ChannelCompression compression);
+  /// parse a ChannelCompression from its lowercase string representation
+  static enum ChannelCompression compressionFromString(std::string_view compression);
   /// @return a url associated to an InputChannelSpec
   static std::string channelUrl(InputChannelSpec const&);
   /// @return a url associated to an OutputChannelSpec
@@ -78,6 +78,9 @@ struct CommonServices {
   static ServiceSpec objectCache();
   static ServiceSpec timingInfoSpec();
   static ServiceSpec ccdbSupportSpec();
+  /// Opt-in hardware performance counter sampling per processing callback,
+  /// enabled via the DPL_PERF_COUNTERS environment variable (Linux only)
+  static ServiceSpec perfCountersSpec();
   static ServiceSpec decongestionSpec();
   static ServiceSpec asyncQueue();
   static ServiceSpec guiMetricsSpec();
@@ -59,6 +59,24 @@ struct CompletionPolicyHelpers {
   }
   static CompletionPolicy consumeWhenAnyWithAllConditions(std::string matchName);
 
+  /// Consume the record as soon as all the inputs whose binding matches @a essentialBindings
+  /// (plus all condition inputs) have arrived, without waiting for the remaining auxiliary
+  /// parts. Allows latency-critical devices to dispatch their processing while slower
+  /// auxiliary co-inputs of the same timeslice are still in flight; the device must
+  /// tolerate the auxiliary inputs being invalid.
+  static CompletionPolicy consumeWhenEssential(const char* name, CompletionPolicy::Matcher matcher, std::string essentialBindings);
+  /// as above, with the devices selected via the @a matchName regex
+  static CompletionPolicy consumeWhenEssential(std::string matchName, std::string essentialBindings);
+
+  /// Two-tier variant of consumeWhenEssential: once the inputs whose binding matches
+  /// @a essentialBindings (plus all condition inputs) have arrived, wait for the remaining
+  /// best-effort parts for at most @a bestEffortDeadlineMs milliseconds before consuming
+  /// without them. Keeps slow optional inputs from delaying products which only need the
+  /// essential set, while still patching them in when they arrive in time.
+  static CompletionPolicy consumeWhenEssentialWithDeadline(const char* name, CompletionPolicy::Matcher matcher, std::string essentialBindings, int bestEffortDeadlineMs);
+  /// as above, with the devices selected via the @a matchName regex
+  static CompletionPolicy consumeWhenEssentialWithDeadline(std::string matchName, std::string essentialBindings, int bestEffortDeadlineMs);
+
   /// When any of the parts of the record have been received, process the existing and free the associated payloads.
   /// This allows freeing things as early as possible, while still being able to wait
   /// all the parts before disposing the timeslice completely
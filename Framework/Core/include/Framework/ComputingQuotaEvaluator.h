@@ -18,6 +18,7 @@
 #include <cstdint>
 #include <functional>
 #include <array>
+#include <memory>
 #include <vector>
 #include <cstddef>
 
@@ -27,6 +28,7 @@ using uv_timer_t = struct uv_timer_s;
 namespace o2::framework
 {
 struct ServiceRegistry;
+class ComputingQuotaTokenPool;
 
 class ComputingQuotaEvaluator
 {
@@ -52,6 +54,13 @@ class ComputingQuotaEvaluator
   /// @a now the time (e.g. uv_now) when invoked.
   void updateOffers(std::vector<ComputingQuotaOffer>& offers, uint64_t now);
 
+  /// Take shared memory tokens from the node-level pool, if one is configured
+  /// (DPL_NODE_SHM_QUOTA). Without a pool the tokens are always granted, i.e.
+  /// the device keeps deciding in isolation.
+  bool acquireTokens(int64_t bytes);
+  /// Give shared memory tokens back to the node-level pool, if any.
+  void releaseTokens(int64_t bytes);
+
   /// All the available offerts
   std::array<ComputingQuotaOffer, MAX_INFLIGHT_OFFERS> mOffers;
   /// The offers which expired and need to be given back.
@@ -61,6 +70,10 @@ class ComputingQuotaEvaluator
   ComputingQuotaStats mStats;
   ServiceRegistryRef mRef;
   uv_timer_t* mTimer;
+  /// Node-level shared memory token pool, coordinating the admission of
+  /// shared memory offers between the devices of a node. Absent unless
+  /// DPL_NODE_SHM_QUOTA is set.
+  std::shared_ptr<ComputingQuotaTokenPool> mTokenPool;
 };
 
 } // namespace o2::framework
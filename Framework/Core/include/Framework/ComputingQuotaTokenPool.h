@@ -0,0 +1,57 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+#ifndef O2_COMPUTINGQUOTATOKENPOOL_H_
+#define O2_COMPUTINGQUOTATOKENPOOL_H_
+
+#include <cstdint>
+#include <string>
+
+namespace o2::framework
+{
+
+/// A node-level token bucket backed by a named POSIX shared memory segment.
+/// All devices attaching to a pool of the same name account their shared
+/// memory offers against a single budget, so that admission is coordinated
+/// between the devices of a node instead of being decided per device in
+/// isolation. The first device to attach creates and initializes the
+/// segment and unlinks it on destruction; attached devices keep their
+/// mapping until they detach.
+class ComputingQuotaTokenPool
+{
+ public:
+  /// Attach to (or create) the pool @a name with @a capacity bytes worth of
+  /// tokens. The capacity is fixed by whoever creates the segment.
+  ComputingQuotaTokenPool(std::string const& name, int64_t capacity);
+  ~ComputingQuotaTokenPool();
+
+  ComputingQuotaTokenPool(ComputingQuotaTokenPool const&) = delete;
+  ComputingQuotaTokenPool& operator=(ComputingQuotaTokenPool const&) = delete;
+
+  /// Take @a bytes worth of tokens from the pool.
+  /// @return false if the pool does not hold enough tokens (nothing is taken).
+  bool tryAcquire(int64_t bytes);
+  /// Give @a bytes worth of tokens back to the pool.
+  void release(int64_t bytes);
+  /// Tokens currently left in the pool.
+  int64_t available() const;
+  /// Whether the shared memory segment could be attached.
+  bool valid() const { return mHeader != nullptr; }
+
+ private:
+  struct Header;
+  std::string mName;
+  Header* mHeader = nullptr;
+  bool mOwner = false;
+};
+
+} // namespace o2::framework
+
+#endif // O2_COMPUTINGQUOTATOKENPOOL_H_
@@ -78,6 +78,8 @@ struct DataOutputDirector {
   void setNumberTimeFramesToMerge(int ntfmerge) { mnumberTimeFramesToMerge = ntfmerge > 0 ? ntfmerge : 1; }
   std::string getFileMode() { return mfileMode; }
   void setFileMode(std::string filemode) { mfileMode = filemode; }
+  int getCompression() { return mcompression; }
+  void setCompression(int compression) { mcompression = compression > 0 ? compression : mcompression; }
 
   // get matching DataOutputDescriptors
   std::vector<DataOutputDescriptor*> getDataOutputDescriptors(header::DataHeader dh);
@@ -112,6 +114,7 @@ struct DataOutputDirector {
   float mmaxfilesize = -1.;
   int mnumberTimeFramesToMerge = 1;
   std::string mfileMode = "RECREATE";
+  int mcompression = 505; // ZSTD, level 5
 
   std::tuple<std::string, std::string, std::string, float, int> readJsonDocument(Document* doc);
   const std::tuple<std::string, std::string, std::string, float, int> memptyanswer = std::make_tuple(std::string(""), std::string(""), std::string(""), -1., -1);
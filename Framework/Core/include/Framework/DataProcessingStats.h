@@ -65,6 +65,9 @@ enum struct ProcessingStatsId : short {
   RESOURCES_INSUFFICIENT,
   RESOURCES_SATISFACTORY,
   AVAILABLE_MANAGED_SHM_BASE = 512,
+  // base for the per-scope metric blocks of the flame scopes (see FlameScope.h);
+  // every scope uses three consecutive ids starting from here
+  FLAME_SCOPE_BASE = 1024,
 };
 
 /// Helper struct to hold statistics about the data processing happening.
@@ -78,6 +78,13 @@ struct DataProcessorSpec {
   /// put, but this is actually to be handled in the actual DeviceSpec.
   size_t inputTimeSliceId = 0;
   size_t maxInputTimeslices = 1;
+  /// How many independent completed timeslices this data processor is
+  /// willing to process concurrently, each on its own worker thread /
+  /// stream of the same device. Unlike time pipelining this does not
+  /// multiply the device (nor its shared memory footprint): the streams
+  /// share one relayer and one set of channels. The process function must
+  /// be reentrant for any value larger than 1.
+  size_t maxConcurrentStreams = 1;
 };
 
 } // namespace o2::framework
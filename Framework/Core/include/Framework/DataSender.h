@@ -11,6 +11,7 @@
 #ifndef O2_FRAMEWORK_DATASENDER_H_
 #define O2_FRAMEWORK_DATASENDER_H_
 
+#include "Framework/ChannelSpec.h"
 #include "Framework/RoutingIndices.h"
 #include "Framework/FairMQDeviceProxy.h"
 #include "Framework/ServiceRegistryRef.h"
@@ -22,6 +23,7 @@
 
 #include <cstddef>
 #include <mutex>
+#include <unordered_map>
 
 namespace o2::framework
 {
@@ -60,6 +62,8 @@ class DataSender
   std::vector<std::string> mVariablesMetricsNames;
   std::vector<bool> mPresent;
   std::vector<bool> mPresentDefaults;
+  /// per channel payload compression, from the OutputChannelSpecs of the device
+  std::unordered_map<std::string, ChannelCompression> mChannelCompression;
 
   O2_LOCKABLE_NAMED(std::recursive_mutex, mMutex, "data relayer mutex");
 };
@@ -11,6 +11,7 @@
 #ifndef FRAMEWORK_DEVICEEXECUTION_H
 #define FRAMEWORK_DEVICEEXECUTION_H
 
+#include <string>
 #include <vector>
 
 namespace o2
@@ -26,6 +27,9 @@ struct DeviceExecution {
   std::vector<char*> args;
   /// The environment to be passed to a given device
   std::vector<char*> environ;
+  /// The device options pre-tokenized by the driver, so that a forked child
+  /// can skip the boost::program_options parsing. Empty if not available.
+  std::string optionsBundle;
 };
 
 } // namespace framework
@@ -68,6 +68,9 @@ struct DeviceSpec {
   size_t inputTimesliceId;
   /// The maximum number of time pipelining for this device.
   size_t maxInputTimeslices;
+  /// How many processing streams (worker threads) this device may run
+  /// concurrently on independent completed timeslices.
+  size_t maxConcurrentStreams = 1;
   /// The completion policy to use for this device.
   CompletionPolicy completionPolicy;
   DispatchPolicy dispatchPolicy;
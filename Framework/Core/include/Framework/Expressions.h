@@ -429,6 +429,9 @@ using Projector = Filter;
 gandiva::Selection createSelection(std::shared_ptr<arrow::Table> const& table, Filter const& expression);
 /// Function for creating gandiva selection from prepared gandiva expressions tree
 gandiva::Selection createSelection(std::shared_ptr<arrow::Table> const& table, std::shared_ptr<gandiva::Filter> const& gfilter);
+/// Function to materialize only the rows passing the filter into a compacted table,
+/// to be used for skimming before the table is shipped or written out
+std::shared_ptr<arrow::Table> filterTable(std::shared_ptr<arrow::Table> const& table, Filter const& expression);
 
 struct ColumnOperationSpec;
 using Operations = std::vector<ColumnOperationSpec>;
@@ -0,0 +1,121 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+#ifndef O2_FRAMEWORK_FLAMESCOPE_H_
+#define O2_FRAMEWORK_FLAMESCOPE_H_
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace o2::framework
+{
+
+struct DataProcessingStats;
+
+/// Lightweight scoped spans ("flame scopes") for the hot path. A scope is
+/// registered once by name, every annotated region pushes a nanosecond
+/// timestamped span to a lock-free ring of its thread, and the rings are
+/// drained by the metrics flusher on the main thread, which folds the spans
+/// into the regular DPL metrics (count, total and maximum duration per
+/// scope). Spans are dropped, never blocked on, when a ring fills up faster
+/// than it is drained.
+struct FlameScopeRegistry {
+  struct Span {
+    short scopeId = -1;
+    uint64_t startNS = 0;
+    uint64_t durationNS = 0;
+  };
+
+  /// Single-producer, single-consumer ring of completed spans. The owning
+  /// thread pushes, the metrics flusher pops.
+  struct Ring {
+    static constexpr size_t SIZE = 4096; // must be a power of two
+    std::array<Span, SIZE> spans;
+    std::atomic<size_t> head{0}; // written by the owning thread
+    std::atomic<size_t> tail{0}; // written by the flusher
+
+    bool push(Span const& span)
+    {
+      auto h = head.load(std::memory_order_relaxed);
+      if (h - tail.load(std::memory_order_acquire) >= SIZE) {
+        return false; // full, the span is dropped
+      }
+      spans[h & (SIZE - 1)] = span;
+      head.store(h + 1, std::memory_order_release);
+      return true;
+    }
+  };
+
+  /// How many distinct scopes can be annotated. Each scope maps to a fixed
+  /// block of metric ids starting at ProcessingStatsId::FLAME_SCOPE_BASE.
+  static constexpr int MAX_SCOPES = 256;
+
+  static FlameScopeRegistry& instance();
+
+  /// Get the id for scope @a name, registering it on first use.
+  /// Returns -1 (spans are silently discarded) once MAX_SCOPES is exceeded.
+  short scopeId(std::string const& name);
+  /// The ring of the calling thread, created on first use.
+  Ring& ring();
+  /// Drain all rings, folding the spans into @a stats. Must be invoked from
+  /// a single thread, i.e. the one flushing the metrics.
+  void flushTo(DataProcessingStats& stats);
+
+  std::mutex mutex; // protects the registration of scopes and rings
+  std::vector<std::string> scopeNames;
+  std::vector<std::unique_ptr<Ring>> rings; // rings are kept forever, threads might go away
+  std::atomic<size_t> droppedSpans{0};
+
+ private:
+  size_t mScopesWithMetrics = 0; // scopes for which the metrics were registered already
+};
+
+/// RAII span annotating the enclosing region. The scope id should be looked
+/// up once and cached by the caller:
+///
+///   static short sid = FlameScopeRegistry::instance().scopeId("tpc-clusterer/decode");
+///   FlameScope scope(sid);
+struct FlameScope {
+  FlameScope(short scopeId)
+    : mScopeId(scopeId),
+      mStart(std::chrono::steady_clock::now())
+  {
+  }
+  ~FlameScope()
+  {
+    if (mScopeId < 0) {
+      return;
+    }
+    auto stop = std::chrono::steady_clock::now();
+    auto& registry = FlameScopeRegistry::instance();
+    FlameScopeRegistry::Span span;
+    span.scopeId = mScopeId;
+    span.startNS = std::chrono::duration_cast<std::chrono::nanoseconds>(mStart.time_since_epoch()).count();
+    span.durationNS = std::chrono::duration_cast<std::chrono::nanoseconds>(stop - mStart).count();
+    if (!registry.ring().push(span)) {
+      registry.droppedSpans.fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+  FlameScope(FlameScope const&) = delete;
+  FlameScope& operator=(FlameScope const&) = delete;
+
+  short mScopeId;
+  std::chrono::steady_clock::time_point mStart;
+};
+
+} // namespace o2::framework
+
+#endif // O2_FRAMEWORK_FLAMESCOPE_H_
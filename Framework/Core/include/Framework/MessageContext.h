@@ -258,6 +258,8 @@ class MessageContext
     template <typename ContextType, typename... Args>
     ContainerRefObject(ContextType* context, fair::mq::MessagePtr&& headerMsg, RouteIndex routeIndex, int index, Args&&... args)
       : ContextObject(std::forward<fair::mq::MessagePtr>(headerMsg), routeIndex),
+        // the creating context
+        mContext{context},
         // the transport factory
         mFactory{context->proxy().getOutputTransport(routeIndex)},
         // the memory resource takes ownership of the message
@@ -273,6 +275,12 @@ class MessageContext
       if (mResource.isValid() == false) {
         throw runtime_error_f("no memory resource for channel %d", routeIndex);
       }
+      // reserve the payload size observed on this route in earlier
+      // timeslices: growing to the final size step by step would repeatedly
+      // realloc-copy the contents inside the message memory
+      if (auto hint = context->payloadSizeHint(routeIndex); hint > 0) {
+        mData.reserve((hint + sizeof(value_type) - 1) / sizeof(value_type));
+      }
     }
     ~ContainerRefObject() override = default;
 
@@ -281,6 +289,11 @@ class MessageContext
     fair::mq::Parts finalize() final
     {
       assert(mParts.Size() == 1);
+      if (mContext != nullptr) {
+        // report the final payload size, so that the next timeslice can
+        // reserve it upfront
+        mContext->learnPayloadSize(mRouteIndex, mData.size() * sizeof(value_type));
+      }
       auto payloadMsg = o2::pmr::getMessage(std::move(mData));
       mParts.AddPart(std::move(payloadMsg));
       return ContextObject::finalize();
@@ -305,6 +318,7 @@ class MessageContext
     }
 
    private:
+    MessageContext* mContext = nullptr;             /// the creating context, to report the final payload size
     fair::mq::TransportFactory* mFactory = nullptr; /// pointer to transport factory
     AlignedMemoryResource mResource;                /// message resource
     buffer_type mData;                              /// the data buffer
@@ -486,6 +500,14 @@ class MessageContext
   fair::mq::MessagePtr createMessage(RouteIndex routeIndex, int index, size_t size);
   fair::mq::MessagePtr createMessage(RouteIndex routeIndex, int index, void* data, size_t size, fair::mq::FreeFn* ffn, void* hint);
 
+  /// payload size (in bytes) observed on the route in earlier timeslices,
+  /// 0 if nothing has been learned yet. Container-backed objects use it to
+  /// reserve their final size upfront instead of growing step by step.
+  [[nodiscard]] size_t payloadSizeHint(RouteIndex routeIndex) const;
+  /// update the learned payload size for the route, keeping a decaying
+  /// maximum so that a single large timeslice does not pin the hint forever
+  void learnPayloadSize(RouteIndex routeIndex, size_t size);
+
   /// return the headers of the 1st (from the end) matching message checking first in mMessages then in mScheduledMessages
   o2::header::DataHeader* findMessageHeader(const Output& spec);
   o2::header::Stack* findMessageHeaderStack(const Output& spec);
@@ -503,6 +525,8 @@ class MessageContext
   DispatchControl mDispatchControl;
   /// Cached messages, in case we want to reuse them.
   std::unordered_map<int64_t, std::unique_ptr<fair::mq::Message>> mMessageCache;
+  /// Learned payload sizes per route, indexed by RouteIndex::value.
+  std::vector<size_t> mPayloadSizeHints;
 };
 } // namespace o2::framework
 #endif // O2_FRAMEWORK_MESSAGECONTEXT_H_
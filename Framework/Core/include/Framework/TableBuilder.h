@@ -28,6 +28,8 @@
 #include <arrow/table.h>
 #include <arrow/builder.h>
 
+#include <gsl/span>
+
 #include <vector>
 #include <string>
 #include <memory>
@@ -222,6 +224,44 @@ struct BuilderUtils {
     }
   }
 
+  /// Direct bulk appenders used by TableBuilder::bulkPush: they take a whole
+  /// column at a time, so no per-row indirection is involved.
+  template <typename HolderType, typename T>
+  static arrow::Status bulkPush(HolderType& holder, gsl::span<T const> column)
+  {
+    if constexpr (std::is_same_v<decltype(holder.builder), std::unique_ptr<arrow::FixedSizeListBuilder>>) {
+      // fixed-size list columns take their values flattened, N per row
+      size_t numElements = static_cast<const arrow::FixedSizeListType*>(holder.builder->type().get())->list_size();
+      return appendToList<T const>(holder.builder, column.data(), column.size() / numElements);
+    } else if constexpr (std::is_same_v<T, bool>) {
+      return holder.builder->AppendValues(reinterpret_cast<uint8_t const*>(column.data()), column.size(), nullptr);
+    } else {
+      return holder.builder->AppendValues(column.data(), column.size(), nullptr);
+    }
+  }
+
+  /// Direct bulk appender for the VLA case: one std::vector per row.
+  /// Both the offsets and the values are reserved upfront, so the
+  /// per-row appends never reallocate.
+  template <typename HolderType, typename T>
+  static arrow::Status bulkPush(HolderType& holder, gsl::span<std::vector<T> const> column)
+  {
+    using ArrowType = typename detail::ConversionTraits<T>::ArrowType;
+    using ValueBuilderType = typename arrow::TypeTraits<ArrowType>::BuilderType;
+    auto vbuilder = static_cast<ValueBuilderType*>(holder.builder->value_builder());
+    size_t nValues = 0;
+    for (auto& row : column) {
+      nValues += row.size();
+    }
+    auto status = holder.builder->Reserve(column.size());
+    status &= vbuilder->Reserve(nValues);
+    for (auto& row : column) {
+      status &= holder.builder->Append();
+      status &= vbuilder->AppendValues(row.begin(), row.end());
+    }
+    return status;
+  }
+
   template <typename HolderType, typename ITERATOR>
   static arrow::Status append(HolderType& holder, std::pair<ITERATOR, ITERATOR> ip)
   {
@@ -528,6 +568,13 @@ struct TableBuilderHelpers {
     return (BuilderUtils::bulkAppendChunked(std::get<Ts::index>(holders), std::get<Ts::index>(infos)).ok() && ...);
   }
 
+  /// Appends whole columns at once, one span per column.
+  template <typename... Ts, typename SPANS>
+  static bool bulkPush(std::tuple<Ts...>& holders, SPANS&& spans)
+  {
+    return (BuilderUtils::bulkPush(std::get<Ts::index>(holders), std::get<Ts::index>(spans)).ok() && ...);
+  }
+
   /// Invokes the append method for each entry in the tuple
   template <typename... Ts>
   static bool finalize(std::vector<std::shared_ptr<arrow::Array>>& arrays, std::tuple<Ts...>& holders)
@@ -566,6 +613,27 @@ struct is_bounded_array<std::array<T, N>> : std::true_type {
 template <typename T>
 concept BulkInsertable = (std::integral<std::decay<T>> && !std::same_as<bool, std::decay_t<T>>);
 
+/// How a whole column of a given type is passed to TableBuilder::bulkPush.
+template <typename T>
+struct BulkSpan {
+  using type = gsl::span<T const>;
+};
+
+/// Fixed-size array columns take their values flattened, N per row.
+template <typename T, int N>
+struct BulkSpan<T[N]> {
+  using type = gsl::span<T const>;
+};
+
+/// VLA columns take one std::vector per row.
+template <typename T>
+struct BulkSpan<std::vector<T>> {
+  using type = gsl::span<std::vector<T> const>;
+};
+
+template <typename T>
+using bulk_span_t = typename BulkSpan<T>::type;
+
 template <typename T>
 struct InsertionTrait {
   static consteval DirectInsertion<T> policy()
@@ -804,6 +872,20 @@ class TableBuilder
     };
   }
 
+  /// Directly pushes whole columns, without going through the per-row
+  /// cursor indirection. Fixed-size array columns take their values
+  /// flattened (N per row), VLA columns take one std::vector per row.
+  /// Like the persist family this can only be called once per builder:
+  /// it fills the table in one go.
+  template <typename... ARGS, size_t NCOLUMNS = sizeof...(ARGS)>
+  bool bulkPush(std::array<char const*, NCOLUMNS> const& columnNames, bulk_span_t<ARGS> const&... columns)
+  {
+    validate();
+    mArrays.resize(NCOLUMNS);
+    makeBuilders<ARGS...>(columnNames, 0);
+    return TableBuilderHelpers::bulkPush(*(HoldersTupleIndexed<ARGS...>*)mHolders, std::forward_as_tuple(columns...));
+  }
+
   /// Reserve method to expand the columns as needed.
   template <typename... Ts>
   auto reserveArrays(std::tuple<Ts...>& holders, int s)
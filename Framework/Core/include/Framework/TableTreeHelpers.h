@@ -84,6 +84,7 @@ class ColumnToBranch
   ColumnToBranch(ColumnToBranch&& other) = delete;
   void at(const int64_t* pos);
   int fieldSize() const { return mFieldSize; }
+  int64_t payloadSize() const { return mPayloadSize; }
   char const* branchName() const { return mBranchName.c_str(); }
 
  private:
@@ -103,6 +104,7 @@ class ColumnToBranch
   std::shared_ptr<arrow::Array> mCurrentArray = nullptr;
   int64_t mChunkLength;
   int mFieldSize = 0;
+  int64_t mPayloadSize = 0;
 };
 
 class TableToTree
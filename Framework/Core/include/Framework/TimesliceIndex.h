@@ -22,6 +22,7 @@
 #include <cstdint>
 #include <vector>
 #include <algorithm>
+#include <unordered_map>
 
 namespace o2::framework
 {
@@ -114,6 +115,12 @@ class TimesliceIndex
   ///         of the messages.
   std::tuple<ActionTaken, TimesliceSlot> replaceLRUWith(data_matcher::VariableContext& newContext, TimesliceId timestamp);
 
+  /// @return the slot currently holding @a timestamp, in O(1) via the hashed
+  /// association, or an invalid slot if no (valid) association exists.
+  /// Stale associations (slot invalidated or reused for another timeslice
+  /// since) are pruned lazily by this very lookup.
+  [[nodiscard]] TimesliceSlot findSlotForTimeslice(TimesliceId timestamp);
+
   /// @return true if the device got some data.
   [[nodiscard]] bool didReceiveData() const;
   /// Set the older possible input per channel
@@ -150,6 +157,11 @@ class TimesliceIndex
   /// since last time we called getReadyToProcess()
   std::vector<bool> mDirty;
 
+  /// Hashed association from timeslice to the slot holding it, so that the
+  /// relaying hot path does not need to scan all the cachelines. Entries
+  /// are validated against the slot contents on lookup and pruned lazily.
+  std::unordered_map<uint64_t, size_t> mTimesliceToSlot;
+
   /// This is the oldest possible timeslice for any given channel
   /// The cardinality of this vector is the number of input channels
   std::vector<InputChannelInfo>& mChannels;
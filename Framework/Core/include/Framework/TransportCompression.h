@@ -0,0 +1,46 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+#ifndef O2_FRAMEWORK_TRANSPORTCOMPRESSION_H_
+#define O2_FRAMEWORK_TRANSPORTCOMPRESSION_H_
+
+#include "Framework/ChannelSpec.h"
+#include <fairmq/FwdDecls.h>
+
+namespace o2::framework
+{
+
+/// Optional payload compression for channels between the devices of a
+/// workflow, meant for network channels which are bandwidth rather than
+/// CPU bound (e.g. FLP to EPN or remote-site links).
+///
+/// A compressed payload message carries a small self-describing frame
+/// header followed by the deflated stream, and the payloadSize of the
+/// associated DataHeader is patched to the on-wire size. The receiving
+/// device detects and undoes the compression before the messages reach
+/// the DataRelayer, so neither the consumers nor the forwarding logic
+/// see any difference. Payloads which are too small or do not shrink
+/// are sent unchanged.
+struct TransportCompression {
+  /// payloads below this size are never compressed
+  static constexpr size_t MinPayloadSize = 4096;
+
+  /// Compress the payloads of a multipart message in place, using the
+  /// transport of @a channel for the replacement messages.
+  static void compressParts(fair::mq::Parts& parts, fair::mq::Channel& channel, ChannelCompression compression);
+
+  /// Detect and inflate compressed payloads of a received multipart
+  /// message in place.
+  static void decompressParts(fair::mq::Parts& parts, fair::mq::Channel& channel);
+};
+
+} // namespace o2::framework
+
+#endif // O2_FRAMEWORK_TRANSPORTCOMPRESSION_H_
@@ -0,0 +1,145 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+#include "Framework/BundleOptionsRetriever.h"
+#include "Framework/ConfigParamSpec.h"
+#include "Framework/VariantPropertyTreeHelpers.h"
+#include "Framework/VariantJSONHelpers.h"
+#include "Framework/RuntimeError.h"
+
+#include "PropertyTreeHelpers.h"
+
+#include <boost/property_tree/ptree.hpp>
+
+#include <algorithm>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace o2::framework;
+
+namespace o2::framework
+{
+
+namespace
+{
+/// Helper to get a Variant from a @a str
+template <VariantType T>
+inline Variant fromString(std::string const& str)
+{
+  std::stringstream ss;
+  ss.str(str);
+  return VariantJSONHelpers::read<T>(ss);
+}
+} // namespace
+
+std::string BundleOptionsRetriever::encode(std::vector<std::pair<std::string, std::string>> const& options)
+{
+  std::string bundle;
+  for (auto const& [name, value] : options) {
+    if (bundle.empty() == false) {
+      bundle.push_back(RECORD_SEPARATOR);
+    }
+    bundle += name;
+    bundle.push_back(UNIT_SEPARATOR);
+    bundle += value;
+  }
+  return bundle;
+}
+
+void BundleOptionsRetriever::update(std::vector<ConfigParamSpec> const& specs,
+                                    boost::property_tree::ptree& store,
+                                    boost::property_tree::ptree& provenance)
+{
+  // Decode the pre-tokenized records into a flat tree of strings. The values
+  // are the very same strings which would have ended up on the command line,
+  // so the non-scalar options need to go through the same string to branch
+  // conversion which the boost based retrievers do, while the scalar ones can
+  // be handed to the property tree directly.
+  boost::property_tree::ptree in;
+  size_t pos = 0;
+  while (pos < mBundle.size()) {
+    auto end = mBundle.find(RECORD_SEPARATOR, pos);
+    if (end == std::string::npos) {
+      end = mBundle.size();
+    }
+    auto sep = mBundle.find(UNIT_SEPARATOR, pos);
+    if (sep == std::string::npos || sep >= end) {
+      throw runtime_error_f("Malformed options bundle record at position %zu", pos);
+    }
+    std::string name = mBundle.substr(pos, sep - pos);
+    std::string value = mBundle.substr(sep + 1, end - sep - 1);
+    pos = end + 1;
+
+    auto spec = std::find_if(specs.begin(), specs.end(), [&name](ConfigParamSpec const& s) {
+      return s.name.substr(0, s.name.find(',')) == name;
+    });
+    if (spec == specs.end()) {
+      continue;
+    }
+    switch (spec->type) {
+      case VariantType::ArrayInt: {
+        auto v = fromString<VariantType::ArrayInt>(value);
+        in.put_child(name, vectorToBranch<int>(v.get<int*>(), v.size()));
+      } break;
+      case VariantType::ArrayFloat: {
+        auto v = fromString<VariantType::ArrayFloat>(value);
+        in.put_child(name, vectorToBranch<float>(v.get<float*>(), v.size()));
+      } break;
+      case VariantType::ArrayDouble: {
+        auto v = fromString<VariantType::ArrayDouble>(value);
+        in.put_child(name, vectorToBranch<double>(v.get<double*>(), v.size()));
+      } break;
+      case VariantType::ArrayString: {
+        auto v = fromString<VariantType::ArrayString>(value);
+        in.put_child(name, vectorToBranch<std::string>(v.get<std::string*>(), v.size()));
+      } break;
+      case VariantType::Array2DInt: {
+        auto v = fromString<VariantType::Array2DInt>(value);
+        in.put_child(name, array2DToBranch<int>(v.get<Array2D<int>>()));
+      } break;
+      case VariantType::Array2DFloat: {
+        auto v = fromString<VariantType::Array2DFloat>(value);
+        in.put_child(name, array2DToBranch<float>(v.get<Array2D<float>>()));
+      } break;
+      case VariantType::Array2DDouble: {
+        auto v = fromString<VariantType::Array2DDouble>(value);
+        in.put_child(name, array2DToBranch<double>(v.get<Array2D<double>>()));
+      } break;
+      case VariantType::LabeledArrayInt: {
+        auto v = fromString<VariantType::LabeledArrayInt>(value);
+        in.put_child(name, labeledArrayToBranch(v.get<LabeledArray<int>>()));
+      } break;
+      case VariantType::LabeledArrayFloat: {
+        auto v = fromString<VariantType::LabeledArrayFloat>(value);
+        in.put_child(name, labeledArrayToBranch(v.get<LabeledArray<float>>()));
+      } break;
+      case VariantType::LabeledArrayDouble: {
+        auto v = fromString<VariantType::LabeledArrayDouble>(value);
+        in.put_child(name, labeledArrayToBranch(v.get<LabeledArray<double>>()));
+      } break;
+      case VariantType::LabeledArrayString: {
+        auto v = fromString<VariantType::LabeledArrayString>(value);
+        in.put_child(name, labeledArrayToBranch(v.get<LabeledArray<std::string>>()));
+      } break;
+      case VariantType::ArrayBool:
+      case VariantType::Dict:
+        // not representable on the command line, handled by the defaults
+        break;
+      default:
+        in.put(name, value);
+        break;
+    }
+  }
+  PropertyTreeHelpers::populate(specs, store, in, provenance, "bundle");
+}
+
+} // namespace o2::framework
@@ -116,6 +116,8 @@ void OutputChannelSpecConfigParser::property(std::string_view key, std::string_v
     outputChannelSpec.recvBufferSize = std::stoi(valueStr);
   } else if (key == "sendBufSize") {
     outputChannelSpec.recvBufferSize = std::stoi(valueStr);
+  } else if (key == "compress") {
+    outputChannelSpec.compression = ChannelSpecHelpers::compressionFromString(value);
   }
 }
 
@@ -152,6 +154,33 @@ char const* ChannelSpecHelpers::methodAsString(enum ChannelMethod method)
   throw runtime_error("Unknown ChannelMethod");
 }
 
+char const* ChannelSpecHelpers::compressionAsString(enum ChannelCompression compression)
+{
+  switch (compression) {
+    case ChannelCompression::None:
+      return "none";
+    case ChannelCompression::LZ4:
+      return "lz4";
+    case ChannelCompression::ZLIB:
+      return "zlib";
+  }
+  throw runtime_error("Unknown ChannelCompression");
+}
+
+enum ChannelCompression ChannelSpecHelpers::compressionFromString(std::string_view compression)
+{
+  if (compression == "none") {
+    return ChannelCompression::None;
+  }
+  if (compression == "lz4") {
+    return ChannelCompression::LZ4;
+  }
+  if (compression == "zlib") {
+    return ChannelCompression::ZLIB;
+  }
+  throw runtime_error_f("Unknown ChannelCompression '%.*s'", (int)compression.size(), compression.data());
+}
+
 namespace
 {
 std::string composeIPCName(std::string const& prefix, std::string const& hostname, short port)
@@ -24,6 +24,7 @@
 #include "Framework/DataRelayer.h"
 #include "Framework/Signpost.h"
 #include "Framework/DataProcessingStats.h"
+#include "Framework/FlameScope.h"
 #include "Framework/DataProcessingStates.h"
 #include "Framework/TimingHelpers.h"
 #include "Framework/CommonMessageBackends.h"
@@ -69,6 +70,13 @@
 #include <cstdlib>
 #include <cstring>
 
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
 using o2::configuration::ConfigurationFactory;
 using o2::configuration::ConfigurationInterface;
 using o2::monitoring::Monitoring;
@@ -471,6 +479,103 @@ o2::framework::ServiceSpec CommonServices::tracingSpec()
     .kind = ServiceKind::Serial};
 }
 
+// Infrastructure for the opt-in hardware performance counter sampling.
+// Each entry wraps one perf event counting during the processing callbacks,
+// the accumulated values are published through the metrics channel.
+struct PerfCountersInfrastructure {
+  struct Counter {
+    char const* metricName = nullptr;
+    int fd = -1;
+    uint64_t total = 0;
+  };
+  std::array<Counter, 3> counters;
+  bool active = false;
+};
+
+// Hardware performance counter service. Opt-in via the DPL_PERF_COUNTERS
+// environment variable, since opening the counters needs a permissive
+// /proc/sys/kernel/perf_event_paranoid setting and the sampling has a small
+// per-callback cost. Instructions, cache misses and stalled backend cycles
+// are counted while the processing callback runs, aggregated per device and
+// published as monotonic perf/* metrics, so cache or NUMA related anomalies
+// in production can be spotted from the monitoring dashboards without node
+// access.
+o2::framework::ServiceSpec CommonServices::perfCountersSpec()
+{
+  return ServiceSpec{
+    .name = "perf-counters",
+    .init = [](ServiceRegistryRef, DeviceState&, fair::mq::ProgOptions&) -> ServiceHandle {
+      if (getenv("DPL_PERF_COUNTERS") == nullptr) {
+        return ServiceHandle{TypeIdHelpers::uniqueId<PerfCountersInfrastructure>(), nullptr, ServiceKind::Serial};
+      }
+#if defined(__linux__)
+      auto openCounter = [](uint64_t config) -> int {
+        perf_event_attr attr{};
+        attr.size = sizeof(attr);
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.config = config;
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        // also count the stream threads spawned later on
+        attr.inherit = 1;
+        return (int)syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+      };
+      auto* infra = new PerfCountersInfrastructure();
+      infra->counters = {{{"perf/instructions", openCounter(PERF_COUNT_HW_INSTRUCTIONS)},
+                          {"perf/cache-misses", openCounter(PERF_COUNT_HW_CACHE_MISSES)},
+                          {"perf/stalled-cycles-backend", openCounter(PERF_COUNT_HW_STALLED_CYCLES_BACKEND)}}};
+      for (auto& counter : infra->counters) {
+        infra->active |= counter.fd >= 0;
+      }
+      if (infra->active == false) {
+        LOGP(warning, "DPL_PERF_COUNTERS is set, but no hardware counter could be opened (check /proc/sys/kernel/perf_event_paranoid)");
+      }
+      return ServiceHandle{TypeIdHelpers::uniqueId<PerfCountersInfrastructure>(), infra, ServiceKind::Serial};
+#else
+      LOGP(warning, "DPL_PERF_COUNTERS is set, but hardware counters are only supported on Linux");
+      return ServiceHandle{TypeIdHelpers::uniqueId<PerfCountersInfrastructure>(), nullptr, ServiceKind::Serial};
+#endif
+    },
+    .configure = noConfiguration(),
+    .preProcessing = [](ProcessingContext&, void* service) {
+#if defined(__linux__)
+      auto* infra = reinterpret_cast<PerfCountersInfrastructure*>(service);
+      if (infra == nullptr || infra->active == false) {
+        return;
+      }
+      for (auto& counter : infra->counters) {
+        if (counter.fd < 0) {
+          continue;
+        }
+        ioctl(counter.fd, PERF_EVENT_IOC_RESET, 0);
+        ioctl(counter.fd, PERF_EVENT_IOC_ENABLE, 0);
+      }
+#endif
+    },
+    .postProcessing = [](ProcessingContext& context, void* service) {
+#if defined(__linux__)
+      auto* infra = reinterpret_cast<PerfCountersInfrastructure*>(service);
+      if (infra == nullptr || infra->active == false) {
+        return;
+      }
+      auto& monitoring = context.services().get<Monitoring>();
+      for (auto& counter : infra->counters) {
+        if (counter.fd < 0) {
+          continue;
+        }
+        ioctl(counter.fd, PERF_EVENT_IOC_DISABLE, 0);
+        uint64_t value = 0;
+        if (read(counter.fd, &value, sizeof(value)) == sizeof(value)) {
+          counter.total += value;
+          monitoring.send({(uint64_t)counter.total, counter.metricName, o2::monitoring::Verbosity::Debug});
+        }
+      }
+#endif
+    },
+    .kind = ServiceKind::Serial};
+}
+
 struct CCDBSupport {
 };
 
@@ -793,6 +898,9 @@ auto flushMetrics(ServiceRegistryRef registry, DataProcessingStats& stats) -> vo
   auto& monitoring = registry.get<Monitoring>();
   auto& relayer = registry.get<DataRelayer>();
 
+  // Fold the flame scope spans collected since the last flush into the stats
+  FlameScopeRegistry::instance().flushTo(stats);
+
   // Send all the relevant metrics for the relayer to update the GUI
   stats.flushChangedMetrics([&monitoring](DataProcessingStats::MetricSpec const& spec, int64_t timestamp, int64_t value) mutable -> void {
     // convert timestamp to a time_point
@@ -1238,7 +1346,8 @@ std::vector<ServiceSpec> CommonServices::defaultServices(std::string extraPlugin
     CommonMessageBackends::fairMQDeviceProxy(),
     dataSender(),
     objectCache(),
-    ccdbSupportSpec()};
+    ccdbSupportSpec(),
+    perfCountersSpec()};
 
   if (!DefaultsHelpers::onlineDeploymentMode() && DefaultsHelpers::deploymentMode() != DeploymentMode::FST) {
     specs.push_back(ArrowSupport::arrowBackendSpec());
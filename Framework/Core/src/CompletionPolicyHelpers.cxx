@@ -21,7 +21,9 @@
 #include "Framework/Signpost.h"
 
 #include <cassert>
+#include <chrono>
 #include <regex>
+#include <unordered_map>
 
 O2_DECLARE_DYNAMIC_LOG(completion);
 
@@ -270,6 +272,87 @@ CompletionPolicy CompletionPolicyHelpers::consumeWhenAny(std::string matchName)
   return consumeWhenAny(matcher);
 }
 
+CompletionPolicy CompletionPolicyHelpers::consumeWhenEssential(const char* name, CompletionPolicy::Matcher matcher, std::string essentialBindings)
+{
+  auto essential = std::make_shared<std::regex>(essentialBindings);
+  auto callback = [essential](InputSpan const& inputs, std::vector<InputSpec> const& specs, ServiceRegistryRef&) -> CompletionPolicy::CompletionOp {
+    assert(inputs.size() == specs.size());
+    size_t si = 0;
+    for (auto& input : inputs) {
+      auto& spec = specs[si++];
+      if (input.header != nullptr) {
+        continue;
+      }
+      // conditions and the essential inputs must all be there, the auxiliary ones may trail behind
+      if (spec.lifetime == Lifetime::Condition || std::regex_match(spec.binding, *essential)) {
+        return CompletionPolicy::CompletionOp::Wait;
+      }
+    }
+    return CompletionPolicy::CompletionOp::Consume;
+  };
+  return CompletionPolicy{name, matcher, callback};
+}
+
+CompletionPolicy CompletionPolicyHelpers::consumeWhenEssential(std::string matchName, std::string essentialBindings)
+{
+  auto matcher = [matchName](DeviceSpec const& device) -> bool {
+    return std::regex_match(device.name.begin(), device.name.end(), std::regex(matchName));
+  };
+  return consumeWhenEssential("consume-essential", matcher, essentialBindings);
+}
+
+CompletionPolicy CompletionPolicyHelpers::consumeWhenEssentialWithDeadline(const char* name, CompletionPolicy::Matcher matcher, std::string essentialBindings, int bestEffortDeadlineMs)
+{
+  auto essential = std::make_shared<std::regex>(essentialBindings);
+  // time at which the essential set of a given timeslice was first seen complete
+  auto deadlines = std::make_shared<std::unordered_map<size_t, std::chrono::steady_clock::time_point>>();
+  auto callback = [essential, deadlines, bestEffortDeadlineMs](InputSpan const& inputs, std::vector<InputSpec> const& specs, ServiceRegistryRef&) -> CompletionPolicy::CompletionOp {
+    assert(inputs.size() == specs.size());
+    size_t si = 0;
+    size_t timeslice = -1;
+    bool bestEffortMissing = false;
+    for (auto& input : inputs) {
+      auto& spec = specs[si++];
+      if (input.header != nullptr) {
+        if (timeslice == -1) {
+          auto const* dph = framework::DataRefUtils::getHeader<o2::framework::DataProcessingHeader*>(input);
+          if (dph && !TimingInfo::timesliceIsTimer(dph->startTime)) {
+            timeslice = dph->startTime;
+          }
+        }
+        continue;
+      }
+      // conditions and the essential inputs must all be there, no deadline applies to them
+      if (spec.lifetime == Lifetime::Condition || std::regex_match(spec.binding, *essential)) {
+        return CompletionPolicy::CompletionOp::Wait;
+      }
+      bestEffortMissing = true;
+    }
+    if (!bestEffortMissing) {
+      deadlines->erase(timeslice);
+      return CompletionPolicy::CompletionOp::Consume;
+    }
+    auto now = std::chrono::steady_clock::now();
+    auto [it, inserted] = deadlines->try_emplace(timeslice, now);
+    if (!inserted && now - it->second > std::chrono::milliseconds(bestEffortDeadlineMs)) {
+      deadlines->erase(it);
+      return CompletionPolicy::CompletionOp::Consume;
+    }
+    // Retry rather than Wait: the slot stays dirty, so the deadline is checked
+    // again on the next relayer pass even if no further input arrives.
+    return CompletionPolicy::CompletionOp::Retry;
+  };
+  return CompletionPolicy{name, matcher, callback};
+}
+
+CompletionPolicy CompletionPolicyHelpers::consumeWhenEssentialWithDeadline(std::string matchName, std::string essentialBindings, int bestEffortDeadlineMs)
+{
+  auto matcher = [matchName](DeviceSpec const& device) -> bool {
+    return std::regex_match(device.name.begin(), device.name.end(), std::regex(matchName));
+  };
+  return consumeWhenEssentialWithDeadline("consume-essential-deadline", matcher, essentialBindings, bestEffortDeadlineMs);
+}
+
 CompletionPolicy CompletionPolicyHelpers::consumeWhenAnyWithAllConditions(const char* name, CompletionPolicy::Matcher matcher)
 {
   auto callback = [](InputSpan const& inputs, std::vector<InputSpec> const& specs, ServiceRegistryRef&) -> CompletionPolicy::CompletionOp {
@@ -10,6 +10,7 @@
 // or submit itself to any jurisdiction.
 
 #include "Framework/ComputingQuotaEvaluator.h"
+#include "Framework/ComputingQuotaTokenPool.h"
 #include "Framework/DataProcessingStats.h"
 #include "Framework/ServiceRegistryRef.h"
 #include "Framework/DeviceState.h"
@@ -51,6 +52,16 @@ ComputingQuotaEvaluator::ComputingQuotaEvaluator(ServiceRegistryRef ref)
   // Creating a timer to check for expired offers
   mTimer = (uv_timer_t*)malloc(sizeof(uv_timer_t));
   uv_timer_init(state.loop, mTimer);
+
+  // If a node-level shared memory budget is configured, the devices of this
+  // node coordinate their shared memory offers through a common token pool.
+  if (auto* quota = getenv("DPL_NODE_SHM_QUOTA")) {
+    auto budget = strtoll(quota, nullptr, 10);
+    if (budget > 0) {
+      char const* poolName = getenv("DPL_NODE_SHM_QUOTA_NAME") ? getenv("DPL_NODE_SHM_QUOTA_NAME") : "/dpl-node-shm-quota";
+      mTokenPool = std::make_shared<ComputingQuotaTokenPool>(poolName, budget);
+    }
+  }
 }
 
 struct QuotaEvaluatorStats {
@@ -186,12 +197,36 @@ bool ComputingQuotaEvaluator::selectOffer(int task, ComputingQuotaRequest const&
   return summarizeWhatHappended(enough, stats.selectedOffers, accumulated, stats);
 }
 
+bool ComputingQuotaEvaluator::acquireTokens(int64_t bytes)
+{
+  return mTokenPool ? mTokenPool->tryAcquire(bytes) : true;
+}
+
+void ComputingQuotaEvaluator::releaseTokens(int64_t bytes)
+{
+  if (mTokenPool) {
+    mTokenPool->release(bytes);
+  }
+}
+
 void ComputingQuotaEvaluator::consume(int id, ComputingQuotaConsumer& consumer, std::function<void(ComputingQuotaOffer const& accumulatedConsumed, ComputingQuotaStats& reportConsumedOffer)>& reportConsumedOffer)
 {
+  auto heldShm = [&offers = this->mOffers]() -> int64_t {
+    int64_t total = 0;
+    for (auto& offer : offers) {
+      if (offer.valid && offer.sharedMemory > 0) {
+        total += offer.sharedMemory;
+      }
+    }
+    return total;
+  };
+  auto before = heldShm();
   // This will report how much of the offers has to be considered consumed.
   // Notice that actual memory usage might be larger, because we can over
   // allocate.
   consumer(id, mOffers, mStats, reportConsumedOffer);
+  // whatever was consumed no longer counts against the node-level budget
+  releaseTokens(before - heldShm());
 }
 
 void ComputingQuotaEvaluator::dispose(int taskId)
@@ -230,8 +265,14 @@ void ComputingQuotaEvaluator::updateOffers(std::vector<ComputingQuotaOffer>& pen
     if (storeOffer.valid == true) {
       continue;
     }
-    info.received = now;
     auto& offer = pending.back();
+    // shared memory offers have to fit in the node-level budget; if they do
+    // not, they stay pending until other devices give tokens back
+    if (offer.sharedMemory > 0 && !acquireTokens(offer.sharedMemory)) {
+      LOGP(LOGLEVEL, "Not enough node-level tokens for an offer of {}MB, keeping it pending", offer.sharedMemory / 1000000);
+      return;
+    }
+    info.received = now;
     storeOffer = offer;
     storeOffer.valid = true;
     pending.pop_back();
@@ -264,6 +305,7 @@ void ComputingQuotaEvaluator::handleExpired(std::function<void(ComputingQuotaOff
     // api.
     LOGP(LOGLEVEL, "Offer {} expired. Giving back {}MB and {} cores", ref.index, offer.sharedMemory / 1000000, offer.cpu);
     assert(offer.sharedMemory >= 0);
+    releaseTokens(offer.sharedMemory);
     mStats.totalExpiredBytes += offer.sharedMemory;
     mStats.totalExpiredOffers++;
     expirator(offer, mStats);
@@ -0,0 +1,118 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+#include "Framework/ComputingQuotaTokenPool.h"
+#include "Framework/Logger.h"
+
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace o2::framework
+{
+
+struct ComputingQuotaTokenPool::Header {
+  std::atomic<int64_t> available; // tokens (bytes) currently not acquired
+  int64_t capacity;               // tokens the pool was created with
+  std::atomic<uint32_t> state;    // 0: freshly created, 1: being initialized, 2: ready
+};
+
+ComputingQuotaTokenPool::ComputingQuotaTokenPool(std::string const& name, int64_t capacity)
+  : mName(name)
+{
+  // the creator sees a zero-filled segment (ftruncate semantics) and is
+  // responsible for putting the capacity in; everybody else waits for the
+  // header to be published
+  int fd = shm_open(mName.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+  if (fd >= 0) {
+    mOwner = true;
+  } else if (errno == EEXIST) {
+    fd = shm_open(mName.c_str(), O_RDWR, 0600);
+  }
+  if (fd < 0) {
+    LOGP(error, "Could not attach shared memory token pool {}: {}", mName, strerror(errno));
+    return;
+  }
+  if (mOwner && ftruncate(fd, sizeof(Header)) != 0) {
+    LOGP(error, "Could not size shared memory token pool {}: {}", mName, strerror(errno));
+    close(fd);
+    shm_unlink(mName.c_str());
+    mOwner = false;
+    return;
+  }
+  void* mapping = mmap(nullptr, sizeof(Header), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd);
+  if (mapping == MAP_FAILED) {
+    LOGP(error, "Could not map shared memory token pool {}: {}", mName, strerror(errno));
+    if (mOwner) {
+      shm_unlink(mName.c_str());
+      mOwner = false;
+    }
+    return;
+  }
+  mHeader = static_cast<Header*>(mapping);
+  uint32_t expected = 0;
+  if (mHeader->state.compare_exchange_strong(expected, 1)) {
+    mHeader->capacity = capacity;
+    mHeader->available.store(capacity);
+    mHeader->state.store(2);
+    LOGP(info, "Created shared memory token pool {} with {}MB", mName, capacity / 1000000);
+  } else {
+    while (mHeader->state.load() != 2) {
+      // another device is publishing the header right now
+    }
+    LOGP(info, "Attached to shared memory token pool {} with {}MB", mName, mHeader->capacity / 1000000);
+  }
+}
+
+ComputingQuotaTokenPool::~ComputingQuotaTokenPool()
+{
+  if (mHeader) {
+    munmap(mHeader, sizeof(Header));
+  }
+  if (mOwner) {
+    // attached devices keep their mapping alive; a subsequent run starts
+    // from a fresh pool rather than inheriting a stale accounting
+    shm_unlink(mName.c_str());
+  }
+}
+
+bool ComputingQuotaTokenPool::tryAcquire(int64_t bytes)
+{
+  if (!mHeader) {
+    return true;
+  }
+  auto current = mHeader->available.load();
+  do {
+    if (current < bytes) {
+      return false;
+    }
+  } while (!mHeader->available.compare_exchange_weak(current, current - bytes));
+  return true;
+}
+
+void ComputingQuotaTokenPool::release(int64_t bytes)
+{
+  if (!mHeader || bytes <= 0) {
+    return;
+  }
+  mHeader->available.fetch_add(bytes);
+}
+
+int64_t ComputingQuotaTokenPool::available() const
+{
+  return mHeader ? mHeader->available.load() : 0;
+}
+
+} // namespace o2::framework
@@ -0,0 +1,149 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+#include "CriticalPathHelpers.h"
+#include "Framework/DeviceMetricsHelper.h"
+#include "Framework/Logger.h"
+
+#include <algorithm>
+#include <functional>
+#include <numeric>
+#include <string>
+#include <unordered_map>
+
+namespace o2::framework
+{
+
+namespace
+{
+// aggregate of a metric over the run, 0 if the metric was never filled
+float metricAverage(std::string const& name, DeviceMetricsInfo const& info)
+{
+  auto idx = DeviceMetricsHelper::metricIdxByName(name, info);
+  if (idx >= info.metrics.size() || info.metrics[idx].filledMetrics == 0) {
+    return 0.f;
+  }
+  return info.average[idx];
+}
+
+float metricMax(std::string const& name, DeviceMetricsInfo const& info)
+{
+  auto idx = DeviceMetricsHelper::metricIdxByName(name, info);
+  if (idx >= info.metrics.size() || info.metrics[idx].filledMetrics == 0) {
+    return 0.f;
+  }
+  return info.max[idx];
+}
+} // namespace
+
+void CriticalPathHelpers::dumpBottleneckReport(std::vector<DeviceMetricsInfo> const& metrics,
+                                               std::vector<DeviceSpec> const& specs)
+{
+  auto ndevices = std::min(metrics.size(), specs.size());
+  if (ndevices == 0) {
+    return;
+  }
+
+  // per-device cost: the time a timeslice spends being processed by the
+  // device plus the worst time it waited for its inputs to complete
+  std::vector<float> processing(ndevices);
+  std::vector<float> waiting(ndevices);
+  for (size_t di = 0; di < ndevices; ++di) {
+    processing[di] = metricAverage("elapsed_time_ms", metrics[di]);
+    waiting[di] = metricMax("max_input_latency_ms", metrics[di]);
+  }
+
+  // reconstruct the edges of the device graph: a channel name appearing in
+  // the output channels of one device and the input channels of another
+  // connects producer to consumer
+  std::unordered_map<std::string, size_t> producerOfChannel;
+  for (size_t di = 0; di < ndevices; ++di) {
+    for (auto& channel : specs[di].outputChannels) {
+      producerOfChannel[channel.name] = di;
+    }
+  }
+  std::vector<std::vector<size_t>> upstream(ndevices);
+  std::vector<bool> hasConsumer(ndevices, false);
+  for (size_t di = 0; di < ndevices; ++di) {
+    for (auto& channel : specs[di].inputChannels) {
+      auto producer = producerOfChannel.find(channel.name);
+      if (producer != producerOfChannel.end() && producer->second != di) {
+        upstream[di].push_back(producer->second);
+        hasConsumer[producer->second] = true;
+      }
+    }
+  }
+
+  // longest (most expensive) chain ending in each device. The graph is a
+  // DAG, so a memoized walk upstream is enough; the guard protects against
+  // apparent cycles from out of band channels.
+  std::vector<float> chainCost(ndevices, -1.f);
+  std::vector<int> chainPrev(ndevices, -1);
+  std::vector<bool> visiting(ndevices, false);
+  std::function<float(size_t)> costOf = [&](size_t di) -> float {
+    if (chainCost[di] >= 0.f || visiting[di]) {
+      return std::max(chainCost[di], 0.f);
+    }
+    visiting[di] = true;
+    float best = 0.f;
+    for (auto ui : upstream[di]) {
+      auto cost = costOf(ui);
+      if (cost > best) {
+        best = cost;
+        chainPrev[di] = (int)ui;
+      }
+    }
+    visiting[di] = false;
+    chainCost[di] = best + processing[di] + waiting[di];
+    return chainCost[di];
+  };
+
+  size_t worstSink = 0;
+  float worstCost = 0.f;
+  for (size_t di = 0; di < ndevices; ++di) {
+    auto cost = costOf(di);
+    // the critical chain must end in a sink of the topology
+    if (hasConsumer[di] == false && cost > worstCost) {
+      worstCost = cost;
+      worstSink = di;
+    }
+  }
+  if (worstCost <= 0.f) {
+    // no timing metrics were collected, nothing to report
+    return;
+  }
+
+  LOGP(info, "### Bottleneck report (averaged over the run):");
+  std::vector<size_t> ranked(ndevices);
+  std::iota(ranked.begin(), ranked.end(), 0);
+  std::stable_sort(ranked.begin(), ranked.end(), [&](size_t a, size_t b) {
+    return processing[a] + waiting[a] > processing[b] + waiting[b];
+  });
+  for (size_t ri = 0; ri < std::min(ranked.size(), (size_t)5); ++ri) {
+    auto di = ranked[ri];
+    if (processing[di] + waiting[di] <= 0.f) {
+      break;
+    }
+    LOGP(info, " - {}: {:.1f} ms processing, {:.1f} ms peak input latency", specs[di].name, processing[di], waiting[di]);
+  }
+
+  std::vector<size_t> chain;
+  for (int di = (int)worstSink; di >= 0; di = chainPrev[di]) {
+    chain.push_back(di);
+  }
+  std::string rendered;
+  for (auto it = chain.rbegin(); it != chain.rend(); ++it) {
+    rendered += fmt::format("{}{} ({:.1f} ms)", rendered.empty() ? "" : " -> ", specs[*it].name, processing[*it] + waiting[*it]);
+  }
+  LOGP(info, "### Critical chain, {:.1f} ms in total: {}", worstCost, rendered);
+}
+
+} // namespace o2::framework
@@ -0,0 +1,36 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+#ifndef O2_FRAMEWORK_CRITICALPATHHELPERS_H_
+#define O2_FRAMEWORK_CRITICALPATHHELPERS_H_
+
+#include "Framework/DeviceMetricsInfo.h"
+#include "Framework/DeviceSpec.h"
+
+#include <vector>
+
+namespace o2::framework
+{
+
+struct CriticalPathHelpers {
+  /// Print a ranked bottleneck report for the device graph: the devices
+  /// sorted by how much they delayed completion (processing time and input
+  /// latency, aggregated over the run) and the critical chain, i.e. the most
+  /// expensive path from a source to a sink of the topology.
+  /// @a metrics the per-device metrics collected by the driver
+  /// @a specs the DeviceSpecs the metrics refer to, in the same order
+  static void dumpBottleneckReport(std::vector<DeviceMetricsInfo> const& metrics,
+                                   std::vector<DeviceSpec> const& specs);
+};
+
+} // namespace o2::framework
+
+#endif // O2_FRAMEWORK_CRITICALPATHHELPERS_H_
@@ -40,8 +40,11 @@ void DPLMonitoringBackend::addGlobalTag(std::string_view name, std::string_view
 
 void DPLMonitoringBackend::send(std::vector<o2::monitoring::Metric>&& metrics)
 {
-  for (auto& m : metrics) {
-    send(m);
+  // Batched path used when flushing the buffered metrics: accumulate
+  // everything in the driver client and wake up the main thread only once,
+  // rather than once per metric.
+  for (size_t mi = 0; mi < metrics.size(); ++mi) {
+    send(metrics[mi], mi == metrics.size() - 1);
   }
 }
 
@@ -53,6 +56,11 @@ inline unsigned long convertTimestamp(const std::chrono::time_point<std::chrono:
 }
 
 void DPLMonitoringBackend::send(o2::monitoring::Metric const& metric)
+{
+  send(metric, true);
+}
+
+void DPLMonitoringBackend::send(o2::monitoring::Metric const& metric, bool flush)
 {
   std::array<char, 4096> buffer;
   auto mStream = fmt::format_to(buffer.begin(), "[METRIC] {}", metric.getName());
@@ -84,7 +92,7 @@ void DPLMonitoringBackend::send(o2::monitoring::Metric const& metric)
     throw runtime_error_f("Metric too long");
   }
   buffer[size] = '\0';
-  mRegistry.get<framework::DriverClient>().tell(buffer.data(), size);
+  mRegistry.get<framework::DriverClient>().tell(buffer.data(), size, flush);
 }
 
 } // namespace o2::framework
@@ -34,7 +34,8 @@ class DPLMonitoringBackend final : public o2::monitoring::Backend
   /// \param metric           reference to metric object
   void send(const o2::monitoring::Metric& metric) override;
 
-  /// Prints vector of metrics
+  /// Prints vector of metrics, waking up the driver client only once
+  /// for the whole batch
   /// \@param metrics  vector of metrics
   void send(std::vector<o2::monitoring::Metric>&& metrics) override;
 
@@ -44,6 +45,9 @@ class DPLMonitoringBackend final : public o2::monitoring::Backend
   void addGlobalTag(std::string_view name, std::string_view value) override;
 
  private:
+  /// Prints metric, requesting a flush of the driver client only if @a flush is set
+  void send(o2::monitoring::Metric const& metric, bool flush);
+
   std::string mTagString;    ///< Global tagset (common for each metric)
   const std::string mPrefix; ///< Metric prefix
   ServiceRegistryRef mRegistry;
@@ -351,6 +351,16 @@ std::tuple<std::string, std::string, std::string, float, int> DataOutputDirector
     }
   }
 
+  itemName = "compression";
+  if (dodirItem.HasMember(itemName)) {
+    if (dodirItem[itemName].IsNumber()) {
+      setCompression(dodirItem[itemName].GetInt());
+    } else {
+      LOGP(error, "Check the JSON document! Item \"{}\" must be a number!", itemName);
+      return memptyanswer;
+    }
+  }
+
   itemName = "OutputDescriptors";
   if (dodirItem.HasMember(itemName)) {
     if (!dodirItem[itemName].IsArray()) {
@@ -488,7 +498,7 @@ FileAndFolder DataOutputDirector::getFileFolder(DataOutputDescriptor* dodesc, ui
       auto fn = resdirname + "/" + mfilenameBases[ind] + ".root";
       delete mfilePtrs[ind];
       mParentMaps[ind]->Clear();
-      mfilePtrs[ind] = TFile::Open(fn.c_str(), mfileMode.c_str(), "", 505);
+      mfilePtrs[ind] = TFile::Open(fn.c_str(), mfileMode.c_str(), "", mcompression);
     }
     fileAndFolder.file = mfilePtrs[ind];
 
@@ -566,6 +576,7 @@ void DataOutputDirector::printOut()
   LOGP(info, "  Output directory     : {}", mresultDirectory);
   LOGP(info, "  Default file name    : {}", mfilenameBase);
   LOGP(info, "  Maximum file size    : {} megabytes", mmaxfilesize);
+  LOGP(info, "  Compression          : {}", mcompression);
   LOGP(info, "  Number of files      : {}", mfilenameBases.size());
 
   LOGP(info, "  DataOutputDescriptors: {}", mDataOutputDescriptors.size());
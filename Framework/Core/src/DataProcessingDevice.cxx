@@ -24,6 +24,7 @@
 #include "Framework/DomainInfoHeader.h"
 #include "Framework/DriverClient.h"
 #include "Framework/EndOfStreamContext.h"
+#include "Framework/BundleOptionsRetriever.h"
 #include "Framework/FairOptionsRetriever.h"
 #include "ConfigurationOptionsRetriever.h"
 #include "Framework/FairMQDeviceProxy.h"
@@ -36,6 +37,7 @@
 #endif
 #include "Framework/Signpost.h"
 #include "Framework/TimingHelpers.h"
+#include "Framework/TransportCompression.h"
 #include "Framework/SourceInfoHeader.h"
 #include "Framework/Logger.h"
 #include "Framework/DriverClient.h"
@@ -211,11 +213,17 @@ DataProcessingDevice::DataProcessingDevice(RunningDeviceRef running, ServiceRegi
   // 99 is to execute DPL callbacks last
   this->SubscribeToStateChange("99-dpl", stateWatcher);
 
-  // One task for now.
-  mStreams.resize(1);
-  mHandles.resize(1);
-
   ServiceRegistryRef ref{mServiceRegistry};
+  // One task per declared concurrent stream, so that independent completed
+  // timeslices can be dispatched to separate worker threads of the same
+  // device. The default (1) keeps the single processing loop behaviour.
+  // DPL_THREADPOOL_SIZE can raise the number of streams from the outside.
+  size_t nStreams = std::max<size_t>(1UL, getRunningDevice(mRunningDevice, ref).maxConcurrentStreams);
+  if (auto* poolSize = getenv("DPL_THREADPOOL_SIZE")) {
+    nStreams = std::max<size_t>(nStreams, std::stoul(poolSize));
+  }
+  mStreams.resize(nStreams);
+  mHandles.resize(nStreams);
   mAwakeHandle = (uv_async_t*)malloc(sizeof(uv_async_t));
   auto& state = ref.get<DeviceState>();
   assert(state.loop);
@@ -404,7 +412,14 @@ void DataProcessingDevice::Init()
   auto configStore = DeviceConfigurationHelpers::getConfiguration(mServiceRegistry, spec.name.c_str(), spec.options);
   if (configStore == nullptr) {
     std::vector<std::unique_ptr<ParamRetriever>> retrievers;
-    retrievers.emplace_back(std::make_unique<FairOptionsRetriever>(GetConfig()));
+    // If the driver pre-tokenized our options at spawn time, use the bundle
+    // directly and skip the round-trip through the boost parsed command line.
+    char const* optionsBundle = getenv(BundleOptionsRetriever::ENV_NAME);
+    if (optionsBundle != nullptr && *optionsBundle != '\0') {
+      retrievers.emplace_back(std::make_unique<BundleOptionsRetriever>(optionsBundle));
+    } else {
+      retrievers.emplace_back(std::make_unique<FairOptionsRetriever>(GetConfig()));
+    }
     configStore = std::make_unique<ConfigParamStore>(spec.options, std::move(retrievers));
     configStore->preload();
     configStore->activate();
@@ -554,6 +569,12 @@ void on_signal_callback(uv_signal_t* handle, int signum)
   // Find the first empty offer and have 1GB of shared memory there
   for (auto& offer : quotaEvaluator.mOffers) {
     if (offer.valid == false) {
+      // when a node-level budget is configured, the self-granted offer has to
+      // fit in it as well, otherwise we wait for the next signal
+      if (!quotaEvaluator.acquireTokens(1000000000)) {
+        O2_SIGNPOST_END(device, sid, "signal_state", "Not enough node-level tokens for a new offer.");
+        return;
+      }
       offer.cpu = 0;
       offer.memory = 0;
       offer.sharedMemory = 1000000000;
@@ -672,16 +693,21 @@ static auto forwardInputs = [](ServiceRegistryRef registry, TimesliceSlot slot,
         continue;
       }
 
-      // In case of more than one forward route, we need to copy the message.
-      // This will eventually use the same mamory if running with the same backend.
-      if (cachedForwardingChoices.size() > 1) {
-        copy = true;
-      }
+      // In case of more than one forward route, we need to copy the message
+      // for the extra routes. For reference-counting transports (shmem,
+      // zeromq) the copy shares the payload memory, only the envelope is new.
+      // Do not clobber the copy argument: the fan-out of this message must
+      // not force copies for the remaining messages of the set.
+      bool copyThis = copy || cachedForwardingChoices.size() > 1;
       auto* dh = o2::header::get<DataHeader*>(header->GetData());
       auto* dph = o2::header::get<DataProcessingHeader*>(header->GetData());
 
-      if (copy) {
-        for (auto& cachedForwardingChoice : cachedForwardingChoices) {
+      if (copyThis) {
+        // When we own the messages (consume) and copying is only forced by the
+        // fan-out, the last route takes the originals, saving one copy.
+        size_t nCopies = (!copy && consume) ? cachedForwardingChoices.size() - 1 : cachedForwardingChoices.size();
+        for (size_t ci = 0; ci < nCopies; ++ci) {
+          auto& cachedForwardingChoice = cachedForwardingChoices[ci];
           auto&& newHeader = header->GetTransport()->CreateMessage();
           O2_SIGNPOST_EVENT_EMIT(forwarding, sid, "forwardInputs", "Forwarding a copy of %{public}s to route %d.",
                                  fmt::format("{}/{}/{}@timeslice:{} tfCounter:{}", dh->dataOrigin, dh->dataDescription, dh->subSpecification, dph->startTime, dh->tfCounter).c_str(), cachedForwardingChoice.value);
@@ -694,6 +720,14 @@ static auto forwardInputs = [](ServiceRegistryRef registry, TimesliceSlot slot,
             forwardedParts[cachedForwardingChoice.value].AddPart(std::move(newPayload));
           }
         }
+        if (nCopies != cachedForwardingChoices.size()) {
+          O2_SIGNPOST_EVENT_EMIT(forwarding, sid, "forwardInputs", "Forwarding %{public}s to route %d.",
+                                 fmt::format("{}/{}/{}@timeslice:{} tfCounter:{}", dh->dataOrigin, dh->dataDescription, dh->subSpecification, dph->startTime, dh->tfCounter).c_str(), cachedForwardingChoices.back().value);
+          forwardedParts[cachedForwardingChoices.back().value].AddPart(std::move(messageSet.header(pi)));
+          for (size_t payloadIndex = 0; payloadIndex < messageSet.getNumberOfPayloads(pi); ++payloadIndex) {
+            forwardedParts[cachedForwardingChoices.back().value].AddPart(std::move(messageSet.payload(pi, payloadIndex)));
+          }
+        }
       } else {
         O2_SIGNPOST_EVENT_EMIT(forwarding, sid, "forwardInputs", "Forwarding %{public}s to route %d.",
                                fmt::format("{}/{}/{}@timeslice:{} tfCounter:{}", dh->dataOrigin, dh->dataDescription, dh->subSpecification, dph->startTime, dh->tfCounter).c_str(), cachedForwardingChoices.back().value);
@@ -1275,9 +1309,9 @@ void DataProcessingDevice::Run()
   O2_SIGNPOST_ID_FROM_POINTER(lid, device, state.loop);
   O2_SIGNPOST_START(device, lid, "device_state", "First iteration of the device loop");
 
-  bool dplEnableMultithreding = getenv("DPL_THREADPOOL_SIZE") != nullptr;
+  bool dplEnableMultithreding = getenv("DPL_THREADPOOL_SIZE") != nullptr || mStreams.size() > 1;
   if (dplEnableMultithreding) {
-    setenv("UV_THREADPOOL_SIZE", "1", 1);
+    setenv("UV_THREADPOOL_SIZE", std::to_string(mStreams.size()).c_str(), 1);
   }
 
   while (state.transitionHandling != TransitionHandlingState::Expired) {
@@ -1816,6 +1850,12 @@ void DataProcessingDevice::handleData(ServiceRegistryRef ref, InputChannelInfo&
   // the category.
   O2_SIGNPOST_ID_FROM_POINTER(cid, device, &info);
 
+  // Payloads compressed by the DataSender of the producing device (see
+  // ChannelCompression) are inflated before anything looks at them.
+  if (info.channel) {
+    TransportCompression::decompressParts(info.parts, *info.channel);
+  }
+
   // This is how we validate inputs. I.e. we try to enforce the O2 Data model
   // and we do a few stats. We bind parts as a lambda captured variable, rather
   // than an input, because we do not want the outer loop actually be exposed
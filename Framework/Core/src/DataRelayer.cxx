@@ -509,19 +509,32 @@ DataRelayer::RelayChoice
   auto& index = mTimesliceIndex;
 
   bool needsCleaning = false;
+  // Fast path: the hashed association in the TimesliceIndex usually knows
+  // already which slot holds this timeslice, sparing the scan over all the
+  // cachelines below.
+  if (auto candidate = index.findSlotForTimeslice(TimesliceId{dph->startTime});
+      TimesliceSlot::isValid(candidate) && isSlotInLane(candidate) && index.isValid(candidate)) {
+    std::tie(input, timeslice) = getInputTimeslice(index.getVariablesForSlot(candidate));
+    if (input != INVALID_INPUT) {
+      slot = candidate;
+    }
+  }
+
   // First look for matching slots which already have some
   // partial match.
-  for (size_t ci = 0; ci < index.size(); ++ci) {
-    slot = TimesliceSlot{ci};
-    if (!isSlotInLane(slot)) {
-      continue;
-    }
-    if (index.isValid(slot) == false) {
-      continue;
-    }
-    std::tie(input, timeslice) = getInputTimeslice(index.getVariablesForSlot(slot));
-    if (input != INVALID_INPUT) {
-      break;
+  if (input == INVALID_INPUT) {
+    for (size_t ci = 0; ci < index.size(); ++ci) {
+      slot = TimesliceSlot{ci};
+      if (!isSlotInLane(slot)) {
+        continue;
+      }
+      if (index.isValid(slot) == false) {
+        continue;
+      }
+      std::tie(input, timeslice) = getInputTimeslice(index.getVariablesForSlot(slot));
+      if (input != INVALID_INPUT) {
+        break;
+      }
     }
   }
 
@@ -10,6 +10,8 @@
 // or submit itself to any jurisdiction.
 
 #include "Framework/DataSender.h"
+#include "Framework/ChannelSpecHelpers.h"
+#include "Framework/TransportCompression.h"
 #include "Framework/ServiceRegistry.h"
 #include "Framework/RawDeviceService.h"
 #include "Framework/OutputRoute.h"
@@ -90,6 +92,13 @@ DataSender::DataSender(ServiceRegistryRef registry)
     LOGP(detail, "Disabling the Lifetime::timeframe check because the completion policy is not the default one");
     mPresentDefaults.resize(0);
   }
+
+  for (auto& channel : mSpec.outputChannels) {
+    if (channel.compression != ChannelCompression::None) {
+      mChannelCompression[channel.name] = channel.compression;
+      LOGP(detail, "Payloads sent over channel {} will be compressed ({})", channel.name, ChannelSpecHelpers::compressionAsString(channel.compression));
+    }
+  }
 }
 
 std::unique_ptr<fair::mq::Message> DataSender::create(RouteIndex routeIndex)
@@ -107,6 +116,12 @@ void DataSender::send(fair::mq::Parts& parts, ChannelIndex channelIndex)
   auto& dataProcessorContext = mRegistry.get<DataProcessorContext>();
   dataProcessorContext.preSendingMessagesCallbacks(mRegistry, parts, channelIndex);
   auto& info = mProxy.getOutputChannelInfo(channelIndex);
+  if (!mChannelCompression.empty()) {
+    auto compression = mChannelCompression.find(info.name);
+    if (compression != mChannelCompression.end()) {
+      TransportCompression::compressParts(parts, info.channel, compression->second);
+    }
+  }
   info.policy->send(parts, channelIndex, mRegistry);
 }
 
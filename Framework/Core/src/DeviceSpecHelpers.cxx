@@ -18,6 +18,7 @@
 #include <cstring>
 #include <unordered_set>
 #include <vector>
+#include "Framework/BundleOptionsRetriever.h"
 #include "Framework/ChannelConfigurationPolicy.h"
 #include "Framework/ChannelMatching.h"
 #include "Framework/ConfigParamsHelper.h"
@@ -549,6 +550,7 @@ void DeviceSpecHelpers::processOutEdgeActions(ConfigContext const& configContext
       .nSlots = processor.nSlots,
       .inputTimesliceId = edge.producerTimeIndex,
       .maxInputTimeslices = processor.maxInputTimeslices,
+      .maxConcurrentStreams = processor.maxConcurrentStreams,
       .resource = {acceptedOffer},
       .labels = processor.labels,
       .metadata = processor.metadata});
@@ -875,6 +877,7 @@ void DeviceSpecHelpers::processInEdgeActions(std::vector<DeviceSpec>& devices,
       .nSlots = processor.nSlots,
       .inputTimesliceId = edge.timeIndex,
       .maxInputTimeslices = processor.maxInputTimeslices,
+      .maxConcurrentStreams = processor.maxConcurrentStreams,
       .resource = {acceptedOffer},
       .labels = processor.labels,
       .metadata = processor.metadata};
@@ -1691,6 +1694,32 @@ void DeviceSpecHelpers::prepareArguments(bool defaultQuiet, bool defaultStopped,
     // execvp wants a NULL terminated list.
     execution.args.push_back(nullptr);
 
+    // Pre-tokenize the resolved device options so that a forked child can
+    // populate its ConfigParamStore directly, without re-parsing the full
+    // option set via boost::program_options. Only the options of the spec are
+    // bundled, the FairMQ / system ones are still parsed from the command
+    // line. Oversized bundles are dropped, the child then simply falls back
+    // to command line parsing.
+    std::vector<std::pair<std::string, std::string>> resolvedOptions;
+    for (auto const& opt : spec.options) {
+      std::string key = opt.name.substr(0, opt.name.find(','));
+      auto entry = uniqueDeviceArgs.find("--" + key);
+      if (entry == uniqueDeviceArgs.end()) {
+        continue;
+      }
+      if (opt.type == VariantType::Bool) {
+        // zero-token flag, its mere presence on the command line means true
+        resolvedOptions.emplace_back(key, "true");
+      } else {
+        // a single blank is the placeholder for a zero-length parameter
+        resolvedOptions.emplace_back(key, entry->second == " " ? "" : entry->second);
+      }
+    }
+    execution.optionsBundle = BundleOptionsRetriever::encode(resolvedOptions);
+    if (execution.optionsBundle.size() > 65536) {
+      execution.optionsBundle.clear();
+    }
+
     for (auto& env : tmpEnv) {
       execution.environ.emplace_back(strdup(env.c_str()));
     }
@@ -13,9 +13,11 @@
 #include "Framework/RuntimeError.h"
 #include "Framework/VariantHelpers.h"
 #include "arrow/table.h"
+#include <arrow/compute/api_vector.h>
 #include "gandiva/tree_expr_builder.h"
 #include <algorithm>
 #include <iostream>
+#include <mutex>
 #include <set>
 #include <stack>
 #include <unordered_map>
@@ -430,6 +432,38 @@ Operations createOperations(Filter const& expression)
   return OperationSpecs;
 }
 
+namespace
+{
+/// Compiled filters and projectors are cached keyed on the textual form of
+/// the expression plus the schema, so that the (expensive) Gandiva/LLVM
+/// compilation happens once per workflow rather than once per dataframe.
+/// The same few expressions are evaluated over thousands of dataframes in
+/// one analysis train run, so the cache stays small and is never pruned.
+std::mutex gKernelCacheMutex;
+std::unordered_map<std::string, std::shared_ptr<gandiva::Filter>> gFilterCache;
+std::unordered_map<std::string, std::shared_ptr<gandiva::Projector>> gProjectorCache;
+
+std::string kernelCacheKey(gandiva::SchemaPtr const& Schema, std::string const& expression)
+{
+  return expression + "|" + Schema->ToString();
+}
+
+/// Selections already evaluated on a still-alive table, shared between
+/// subscriptions which apply the same filter to the same table (common
+/// track-quality cuts repeated across process functions). The kernel cache
+/// above canonicalizes identical expressions to the same Filter instance,
+/// so pointer identity is sufficient to detect the overlap. Entries are
+/// keyed on a weak table reference and pruned once the dataframe (and with
+/// it the table) is gone.
+struct SelectionCacheEntry {
+  gandiva::Filter const* filter;
+  std::weak_ptr<arrow::Table> table;
+  gandiva::Selection selection;
+};
+std::mutex gSelectionCacheMutex;
+std::vector<SelectionCacheEntry> gSelectionCache;
+} // namespace
+
 gandiva::ConditionPtr makeCondition(gandiva::NodePtr node)
 {
   return gandiva::TreeExprBuilder::MakeCondition(std::move(node));
@@ -443,19 +477,20 @@ gandiva::ExpressionPtr makeExpression(gandiva::NodePtr node, gandiva::FieldPtr r
 std::shared_ptr<gandiva::Filter>
   createFilter(gandiva::SchemaPtr const& Schema, Operations const& opSpecs)
 {
-  std::shared_ptr<gandiva::Filter> filter;
-  auto s = gandiva::Filter::Make(Schema,
-                                 makeCondition(createExpressionTree(opSpecs, Schema)),
-                                 &filter);
-  if (!s.ok()) {
-    throw runtime_error_f("Failed to create filter: %s", s.ToString().c_str());
-  }
-  return filter;
+  return createFilter(Schema, makeCondition(createExpressionTree(opSpecs, Schema)));
 }
 
 std::shared_ptr<gandiva::Filter>
   createFilter(gandiva::SchemaPtr const& Schema, gandiva::ConditionPtr condition)
 {
+  auto key = kernelCacheKey(Schema, condition->ToString());
+  {
+    std::lock_guard<std::mutex> lock(gKernelCacheMutex);
+    auto cached = gFilterCache.find(key);
+    if (cached != gFilterCache.end()) {
+      return cached->second;
+    }
+  }
   std::shared_ptr<gandiva::Filter> filter;
   auto s = gandiva::Filter::Make(Schema,
                                  std::move(condition),
@@ -463,19 +498,32 @@ std::shared_ptr<gandiva::Filter>
   if (!s.ok()) {
     throw runtime_error_f("Failed to create filter: %s", s.ToString().c_str());
   }
+  std::lock_guard<std::mutex> lock(gKernelCacheMutex);
+  gFilterCache.emplace(std::move(key), filter);
   return filter;
 }
 
 std::shared_ptr<gandiva::Projector>
   createProjector(gandiva::SchemaPtr const& Schema, Operations const& opSpecs, gandiva::FieldPtr result)
 {
+  auto expression = makeExpression(createExpressionTree(opSpecs, Schema), std::move(result));
+  auto key = kernelCacheKey(Schema, expression->ToString());
+  {
+    std::lock_guard<std::mutex> lock(gKernelCacheMutex);
+    auto cached = gProjectorCache.find(key);
+    if (cached != gProjectorCache.end()) {
+      return cached->second;
+    }
+  }
   std::shared_ptr<gandiva::Projector> projector;
   auto s = gandiva::Projector::Make(Schema,
-                                    {makeExpression(createExpressionTree(opSpecs, Schema), std::move(result))},
+                                    {std::move(expression)},
                                     &projector);
   if (!s.ok()) {
     throw runtime_error_f("Failed to create projector: %s", s.ToString().c_str());
   }
+  std::lock_guard<std::mutex> lock(gKernelCacheMutex);
+  gProjectorCache.emplace(std::move(key), projector);
   return projector;
 }
 
@@ -500,12 +548,26 @@ std::shared_ptr<gandiva::Projector> createProjectorHelper(size_t nColumns, expre
         fields[ci]));
   }
 
+  std::string allExpressions;
+  for (auto& expression : expressions) {
+    allExpressions += expression->ToString() + ";";
+  }
+  auto key = kernelCacheKey(schema, allExpressions);
+  {
+    std::lock_guard<std::mutex> lock(gKernelCacheMutex);
+    auto cached = gProjectorCache.find(key);
+    if (cached != gProjectorCache.end()) {
+      return cached->second;
+    }
+  }
   std::shared_ptr<gandiva::Projector> projector;
   auto s = gandiva::Projector::Make(
     schema,
     expressions,
     &projector);
   if (s.ok()) {
+    std::lock_guard<std::mutex> lock(gKernelCacheMutex);
+    gProjectorCache.emplace(std::move(key), projector);
     return projector;
   }
   throw o2::framework::runtime_error_f("Failed to create projector: %s", s.ToString().c_str());
@@ -513,6 +575,15 @@ std::shared_ptr<gandiva::Projector> createProjectorHelper(size_t nColumns, expre
 
 gandiva::Selection createSelection(std::shared_ptr<arrow::Table> const& table, std::shared_ptr<gandiva::Filter> const& gfilter)
 {
+  {
+    std::lock_guard<std::mutex> lock(gSelectionCacheMutex);
+    std::erase_if(gSelectionCache, [](auto const& entry) { return entry.table.expired(); });
+    for (auto const& entry : gSelectionCache) {
+      if (entry.filter == gfilter.get() && entry.table.lock() == table) {
+        return entry.selection;
+      }
+    }
+  }
   gandiva::Selection selection;
   auto s = gandiva::SelectionVector::MakeInt64(table->num_rows(),
                                                arrow::default_memory_pool(),
@@ -539,6 +610,8 @@ gandiva::Selection createSelection(std::shared_ptr<arrow::Table> const& table, s
     }
   }
 
+  std::lock_guard<std::mutex> lock(gSelectionCacheMutex);
+  gSelectionCache.push_back({gfilter.get(), table, selection});
   return selection;
 }
 
@@ -548,6 +621,20 @@ gandiva::Selection createSelection(std::shared_ptr<arrow::Table> const& table,
   return createSelection(table, createFilter(table->schema(), createOperations(std::move(expression))));
 }
 
+std::shared_ptr<arrow::Table> filterTable(std::shared_ptr<arrow::Table> const& table,
+                                          Filter const& expression)
+{
+  auto selection = createSelection(table, expression);
+  if (selection->GetNumSlots() == static_cast<uint64_t>(table->num_rows())) {
+    return table; // all rows pass, no need to copy
+  }
+  auto result = arrow::compute::CallFunction("take", {arrow::Datum{table}, arrow::Datum{selection->ToArray()}});
+  if (!result.ok()) {
+    throw runtime_error_f("Cannot apply selection to table %s", result.status().ToString().c_str());
+  }
+  return result->table();
+}
+
 auto createProjection(std::shared_ptr<arrow::Table> const& table, std::shared_ptr<gandiva::Projector> const& gprojector)
 {
   arrow::TableBatchReader reader(*table);
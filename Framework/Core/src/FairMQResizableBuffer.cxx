@@ -99,7 +99,9 @@ Status FairMQOutputStream::Reserve(int64_t nbytes)
   // This may be because it helps match the allocator's allocation buckets
   // more exactly.  Or perhaps it hits a sweet spot in jemalloc.
   int64_t new_capacity = std::max(kBufferMinimumSize, capacity_);
-  new_capacity = position_ + nbytes;
+  while (position_ + nbytes > new_capacity) {
+    new_capacity *= 2;
+  }
   if (new_capacity > capacity_) {
     RETURN_NOT_OK(buffer_->Resize(new_capacity));
     capacity_ = new_capacity;
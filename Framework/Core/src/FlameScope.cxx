@@ -0,0 +1,100 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+#include "Framework/FlameScope.h"
+#include "Framework/DataProcessingStats.h"
+#include "Framework/Logger.h"
+
+#include <fmt/format.h>
+
+namespace o2::framework
+{
+
+FlameScopeRegistry& FlameScopeRegistry::instance()
+{
+  static FlameScopeRegistry registry;
+  return registry;
+}
+
+short FlameScopeRegistry::scopeId(std::string const& name)
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  for (size_t si = 0; si < scopeNames.size(); ++si) {
+    if (scopeNames[si] == name) {
+      return (short)si;
+    }
+  }
+  if (scopeNames.size() >= MAX_SCOPES) {
+    LOGP(warning, "Too many flame scopes, {} will not be accounted", name);
+    return -1;
+  }
+  scopeNames.push_back(name);
+  return (short)(scopeNames.size() - 1);
+}
+
+FlameScopeRegistry::Ring& FlameScopeRegistry::ring()
+{
+  static thread_local Ring* threadRing = nullptr;
+  if (threadRing == nullptr) {
+    std::lock_guard<std::mutex> lock(mutex);
+    rings.push_back(std::make_unique<Ring>());
+    threadRing = rings.back().get();
+  }
+  return *threadRing;
+}
+
+void FlameScopeRegistry::flushTo(DataProcessingStats& stats)
+{
+  // registrations are rare, so the lock is effectively uncontended and in
+  // any case never taken by a thread pushing spans
+  std::lock_guard<std::mutex> lock(mutex);
+  // each scope owns a block of three metrics: count and total duration are
+  // cumulative, the maximum is monotonic
+  for (size_t si = mScopesWithMetrics; si < scopeNames.size(); ++si) {
+    int base = (int)ProcessingStatsId::FLAME_SCOPE_BASE + 3 * si;
+    for (auto const& [slot, suffix] : {std::pair{0, "count"}, {1, "total_ns"}, {2, "max_ns"}}) {
+      stats.registerMetric(DataProcessingStats::MetricSpec{.name = fmt::format("flame/{}/{}", scopeNames[si], suffix),
+                                                           .metricId = base + slot,
+                                                           .kind = DataProcessingStats::Kind::UInt64,
+                                                           .scope = DataProcessingStats::Scope::DPL,
+                                                           .minPublishInterval = 1000,
+                                                           .maxRefreshLatency = 1000});
+    }
+  }
+  mScopesWithMetrics = scopeNames.size();
+
+  std::array<int64_t, MAX_SCOPES> counts{};
+  std::array<int64_t, MAX_SCOPES> totals{};
+  std::array<int64_t, MAX_SCOPES> maxima{};
+  for (auto& ring : rings) {
+    auto tail = ring->tail.load(std::memory_order_relaxed);
+    auto head = ring->head.load(std::memory_order_acquire);
+    for (; tail != head; ++tail) {
+      auto& span = ring->spans[tail & (Ring::SIZE - 1)];
+      counts[span.scopeId]++;
+      totals[span.scopeId] += span.durationNS;
+      maxima[span.scopeId] = std::max(maxima[span.scopeId], (int64_t)span.durationNS);
+    }
+    ring->tail.store(tail, std::memory_order_release);
+  }
+
+  for (size_t si = 0; si < mScopesWithMetrics; ++si) {
+    if (counts[si] == 0) {
+      continue;
+    }
+    auto base = (unsigned short)((int)ProcessingStatsId::FLAME_SCOPE_BASE + 3 * si);
+    stats.updateStats({base, DataProcessingStats::Op::Add, counts[si]});
+    stats.updateStats({(unsigned short)(base + 1), DataProcessingStats::Op::Add, totals[si]});
+    stats.updateStats({(unsigned short)(base + 2), DataProcessingStats::Op::Max, maxima[si]});
+  }
+}
+
+} // namespace o2::framework
@@ -29,6 +29,29 @@ fair::mq::MessagePtr MessageContext::createMessage(RouteIndex routeIndex, int in
   return transport->CreateMessage(data, size, ffn, hint);
 }
 
+size_t MessageContext::payloadSizeHint(RouteIndex routeIndex) const
+{
+  if (routeIndex.value < 0 || (size_t)routeIndex.value >= mPayloadSizeHints.size()) {
+    return 0;
+  }
+  return mPayloadSizeHints[routeIndex.value];
+}
+
+void MessageContext::learnPayloadSize(RouteIndex routeIndex, size_t size)
+{
+  if (routeIndex.value < 0) {
+    return;
+  }
+  if ((size_t)routeIndex.value >= mPayloadSizeHints.size()) {
+    mPayloadSizeHints.resize(routeIndex.value + 1, 0);
+  }
+  auto& hint = mPayloadSizeHints[routeIndex.value];
+  // Decaying maximum: follow growth immediately, but let the hint shrink
+  // over time so that one oversized timeslice does not keep all the
+  // following ones overallocated.
+  hint = std::max(size, hint - hint / 8);
+}
+
 o2::header::DataHeader* MessageContext::findMessageHeader(const Output& spec)
 {
   for (auto it = mMessages.rbegin(); it != mMessages.rend(); ++it) {
@@ -16,6 +16,8 @@
 #include <arrow/util/key_value_metadata.h>
 #include <TBufferFile.h>
 
+#include <algorithm>
+#include <limits>
 #include <utility>
 namespace TableTreeHelpers
 {
@@ -322,15 +324,22 @@ ColumnToBranch::ColumnToBranch(TTree* tree, std::shared_ptr<arrow::ChunkedArray>
       mElementType = basicROOTTypeFromArrow(arrowType->id());
       leafList = mBranchName + "[" + mBranchName + TableTreeHelpers::sizeBranchSuffix + "]" + mElementType.suffix;
       sizeLeafList = mBranchName + TableTreeHelpers::sizeBranchSuffix + "/I";
-      // Notice that this could be replaced by a better guess of the
-      // average size of the list elements, but this is not trivial.
       mFieldSize = arrowType->byte_width();
+      // the actual number of elements is known from the list offsets, so the
+      // payload size can be computed exactly instead of guessing the average
+      // list length
+      for (auto& chunk : column->chunks()) {
+        mPayloadSize += std::static_pointer_cast<arrow::ListArray>(chunk)->values()->length() * (int64_t)mFieldSize;
+      }
       break;
     default:
       mElementType = basicROOTTypeFromArrow(arrowType->id());
       leafList = mBranchName + mElementType.suffix;
       break;
   }
+  if (mPayloadSize == 0) {
+    mPayloadSize = (int64_t)mFieldSize * column->length();
+  }
   if (!sizeLeafList.empty()) {
     mSizeBranch = tree->GetBranch((mBranchName + TableTreeHelpers::sizeBranchSuffix).c_str());
     if (mSizeBranch == nullptr) {
@@ -454,8 +463,8 @@ std::shared_ptr<TTree> TableToTree::process()
   }
 
   for (auto& reader : mColumnReaders) {
-    int idealBasketSize = 1024 + reader->fieldSize() * mRows; // minimal additional size needed, otherwise we get 2 baskets
-    int basketSize = std::max(32000, idealBasketSize);        // keep a minimum value
+    int64_t idealBasketSize = 1024 + reader->payloadSize(); // minimal additional size needed, otherwise we get 2 baskets
+    int basketSize = (int)std::clamp(idealBasketSize, (int64_t)32000, (int64_t)std::numeric_limits<int>::max());
     mTree->SetBasketSize(reader->branchName(), basketSize);
   }
 
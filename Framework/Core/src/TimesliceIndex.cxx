@@ -36,10 +36,26 @@ void TimesliceIndex::associate(TimesliceId timestamp, TimesliceSlot slot)
   mVariables[slot.index].put({0, static_cast<uint64_t>(timestamp.value)});
   mVariables[slot.index].commit();
   mDirty[slot.index] = true;
+  mTimesliceToSlot[timestamp.value] = slot.index;
   O2_SIGNPOST_ID_GENERATE(tid, timeslice_index);
   O2_SIGNPOST_EVENT_EMIT(timeslice_index, tid, "associate", "Associating timestamp %zu to slot %zu", timestamp.value, slot.index);
 }
 
+TimesliceSlot TimesliceIndex::findSlotForTimeslice(TimesliceId timestamp)
+{
+  auto entry = mTimesliceToSlot.find(timestamp.value);
+  if (entry == mTimesliceToSlot.end()) {
+    return TimesliceSlot{TimesliceSlot::INVALID};
+  }
+  TimesliceSlot slot{entry->second};
+  auto current = std::get_if<uint64_t>(&mVariables[slot.index].get(0));
+  if (current == nullptr || *current != timestamp.value) {
+    mTimesliceToSlot.erase(entry);
+    return TimesliceSlot{TimesliceSlot::INVALID};
+  }
+  return slot;
+}
+
 TimesliceSlot TimesliceIndex::findOldestSlot(TimesliceId timestamp) const
 {
   size_t lane = timestamp.value % mMaxLanes;
@@ -71,6 +87,7 @@ std::tuple<TimesliceIndex::ActionTaken, TimesliceSlot> TimesliceIndex::replaceLR
   O2_SIGNPOST_ID_GENERATE(tid, timeslice_index);
   if (TimesliceIndex::isValid(oldestSlot) == false) {
     mVariables[oldestSlot.index] = newContext;
+    mTimesliceToSlot[timestamp.value] = oldestSlot.index;
     auto debugTimestamp = std::get_if<uint64_t>(&mVariables[oldestSlot.index].get(0));
     O2_SIGNPOST_EVENT_EMIT(timeslice_index, tid, "replaceLRUWith", "slot %zu timeslice %zu (%" PRIu64 ")", oldestSlot.index, timestamp.value, *debugTimestamp);
     return std::make_tuple(ActionTaken::ReplaceUnused, oldestSlot);
@@ -78,6 +95,7 @@ std::tuple<TimesliceIndex::ActionTaken, TimesliceSlot> TimesliceIndex::replaceLR
   auto oldTimestamp = std::get_if<uint64_t>(&mVariables[oldestSlot.index].get(0));
   if (oldTimestamp == nullptr) {
     mVariables[oldestSlot.index] = newContext;
+    mTimesliceToSlot[timestamp.value] = oldestSlot.index;
     auto debugTimestamp = std::get_if<uint64_t>(&mVariables[oldestSlot.index].get(0));
     O2_SIGNPOST_EVENT_EMIT(timeslice_index, tid, "replaceLRUWith", "slot %zu timeslice %zu (%" PRIu64 ")", oldestSlot.index, timestamp.value, *debugTimestamp);
     return std::make_tuple(ActionTaken::ReplaceUnused, oldestSlot);
@@ -92,6 +110,7 @@ std::tuple<TimesliceIndex::ActionTaken, TimesliceSlot> TimesliceIndex::replaceLR
     switch (mBackpressurePolicy) {
       case BackpressureOp::DropAncient: {
         mVariables[oldestSlot.index] = newContext;
+        mTimesliceToSlot[timestamp.value] = oldestSlot.index;
         auto debugTimestamp = std::get_if<uint64_t>(&mVariables[oldestSlot.index].get(0));
         O2_SIGNPOST_EVENT_EMIT(timeslice_index, tid, "replaceLRUWith", "slot %zu timeslice %zu (%" PRIu64 ")", oldestSlot.index, timestamp.value, *debugTimestamp);
         return std::make_tuple(ActionTaken::ReplaceObsolete, oldestSlot);
@@ -105,6 +124,7 @@ std::tuple<TimesliceIndex::ActionTaken, TimesliceSlot> TimesliceIndex::replaceLR
     switch (mBackpressurePolicy) {
       case BackpressureOp::DropRecent: {
         mVariables[oldestSlot.index] = newContext;
+        mTimesliceToSlot[timestamp.value] = oldestSlot.index;
         auto debugTimestamp = std::get_if<uint64_t>(&mVariables[oldestSlot.index].get(0));
         O2_SIGNPOST_EVENT_EMIT(timeslice_index, tid, "replaceLRUWith", "slot %zu timeslice %zu (%" PRIu64 ")", oldestSlot.index, timestamp.value, *debugTimestamp);
         return std::make_tuple(ActionTaken::ReplaceObsolete, oldestSlot);
@@ -249,6 +269,7 @@ auto TimesliceIndex::reset() -> void
   for (auto& channel : mChannels) {
     channel.oldestForChannel = {0};
   }
+  mTimesliceToSlot.clear();
 }
 
 } // namespace o2::framework
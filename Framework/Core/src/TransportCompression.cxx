@@ -0,0 +1,158 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+#include "Framework/TransportCompression.h"
+#include "Framework/Logger.h"
+#include "Headers/DataHeader.h"
+#include <fairmq/Channel.h>
+#include <fairmq/Parts.h>
+#include <Compression.h>
+#include <RZip.h>
+#include <cstring>
+#include <vector>
+
+namespace o2::framework
+{
+
+namespace
+{
+// frame prepended to a compressed payload message. The magic makes the
+// payload self-describing for the receiving side, an accidental collision
+// with real data needs 16 matching bytes (the unused field is zeroed).
+struct CompressedPayloadFrame {
+  static constexpr char Magic[8] = {'O', '2', 'C', 'P', 'R', 'S', '0', '1'};
+  char magic[8];
+  uint64_t uncompressedSize = 0;
+};
+
+// RZip processes at most this many bytes per block (24 bit block sizes)
+constexpr size_t MaxBlockSize = 0xffffff;
+
+ROOT::RCompressionSetting::EAlgorithm::EValues toRootAlgorithm(ChannelCompression compression)
+{
+  switch (compression) {
+    case ChannelCompression::LZ4:
+      return ROOT::RCompressionSetting::EAlgorithm::kLZ4;
+    case ChannelCompression::ZLIB:
+      return ROOT::RCompressionSetting::EAlgorithm::kZLIB;
+    default:
+      return ROOT::RCompressionSetting::EAlgorithm::kUseGlobal;
+  }
+}
+
+// deflate src into a frame-prefixed buffer, empty result if the payload does not shrink
+std::vector<char> compressBuffer(char const* src, size_t size, ChannelCompression compression)
+{
+  std::vector<char> result(sizeof(CompressedPayloadFrame));
+  auto algorithm = toRootAlgorithm(compression);
+  size_t consumed = 0;
+  while (consumed < size) {
+    int blockSize = static_cast<int>(std::min(size - consumed, MaxBlockSize));
+    size_t tgtOffset = result.size();
+    result.resize(tgtOffset + blockSize);
+    int tgtSize = blockSize;
+    int written = 0;
+    R__zipMultipleAlgorithm(1, &blockSize, const_cast<char*>(src) + consumed, &tgtSize, result.data() + tgtOffset, &written, algorithm);
+    if (written <= 0 || written >= blockSize) {
+      // incompressible block, send the payload unchanged
+      return {};
+    }
+    result.resize(tgtOffset + written);
+    consumed += blockSize;
+  }
+  if (result.size() >= size) {
+    return {};
+  }
+  auto* frame = reinterpret_cast<CompressedPayloadFrame*>(result.data());
+  memcpy(frame->magic, CompressedPayloadFrame::Magic, sizeof(frame->magic));
+  frame->uncompressedSize = size;
+  return result;
+}
+
+bool isCompressed(fair::mq::Message const& msg)
+{
+  return msg.GetSize() > sizeof(CompressedPayloadFrame) &&
+         memcmp(msg.GetData(), CompressedPayloadFrame::Magic, sizeof(CompressedPayloadFrame::Magic)) == 0;
+}
+} // namespace
+
+void TransportCompression::compressParts(fair::mq::Parts& parts, fair::mq::Channel& channel, ChannelCompression compression)
+{
+  if (compression == ChannelCompression::None) {
+    return;
+  }
+  for (size_t pi = 0; pi + 1 < parts.Size(); pi += 2) {
+    auto* dh = const_cast<o2::header::DataHeader*>(o2::header::get<o2::header::DataHeader*>(parts.At(pi)->GetData()));
+    if (!dh) {
+      continue;
+    }
+    // split payload sequences are left alone, their accounting is per sequence
+    if (dh->splitPayloadParts > 1) {
+      pi += (dh->splitPayloadParts == dh->splitPayloadIndex) ? dh->splitPayloadParts - 1 : dh->splitPayloadParts * 2 - 2;
+      continue;
+    }
+    auto& payload = parts.At(pi + 1);
+    if (payload->GetSize() < MinPayloadSize) {
+      continue;
+    }
+    auto compressed = compressBuffer(reinterpret_cast<char const*>(payload->GetData()), payload->GetSize(), compression);
+    if (compressed.empty()) {
+      continue;
+    }
+    auto msg = channel.NewMessage(compressed.size());
+    memcpy(msg->GetData(), compressed.data(), compressed.size());
+    payload = std::move(msg);
+    dh->payloadSize = compressed.size();
+  }
+}
+
+void TransportCompression::decompressParts(fair::mq::Parts& parts, fair::mq::Channel& channel)
+{
+  for (size_t pi = 0; pi + 1 < parts.Size(); pi++) {
+    auto* dh = const_cast<o2::header::DataHeader*>(o2::header::get<o2::header::DataHeader*>(parts.At(pi)->GetData()));
+    if (!dh || !isCompressed(*parts.At(pi + 1))) {
+      continue;
+    }
+    auto& payload = parts.At(pi + 1);
+    auto const* frame = reinterpret_cast<CompressedPayloadFrame const*>(payload->GetData());
+    auto msg = channel.NewMessage(frame->uncompressedSize);
+    auto* src = reinterpret_cast<unsigned char*>(payload->GetData()) + sizeof(CompressedPayloadFrame);
+    auto* srcEnd = reinterpret_cast<unsigned char*>(payload->GetData()) + payload->GetSize();
+    auto* tgt = reinterpret_cast<unsigned char*>(msg->GetData());
+    size_t inflated = 0;
+    while (src < srcEnd) {
+      int srcSize = 0;
+      int tgtSize = 0;
+      if (R__unzip_header(&srcSize, src, &tgtSize) != 0 || inflated + tgtSize > frame->uncompressedSize) {
+        LOGP(error, "Corrupted compressed payload for {}/{}/{}, keeping it as is", dh->dataOrigin.str, dh->dataDescription.str, dh->subSpecification);
+        inflated = 0;
+        break;
+      }
+      int written = 0;
+      R__unzip(&srcSize, src, &tgtSize, tgt + inflated, &written);
+      if (written != tgtSize) {
+        LOGP(error, "Failed to inflate compressed payload for {}/{}/{}, keeping it as is", dh->dataOrigin.str, dh->dataDescription.str, dh->subSpecification);
+        inflated = 0;
+        break;
+      }
+      inflated += written;
+      src += srcSize;
+    }
+    if (inflated != frame->uncompressedSize) {
+      continue;
+    }
+    payload = std::move(msg);
+    dh->payloadSize = frame->uncompressedSize;
+    pi++; // the inflated payload cannot be a header
+  }
+}
+
+} // namespace o2::framework
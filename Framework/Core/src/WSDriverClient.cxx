@@ -267,6 +267,22 @@ void WSDriverClient::tell(const char* msg, size_t s, bool flush)
   // have metrics to push
   std::lock_guard<std::mutex> lock(mClientMutex);
   encode_websocket_frames(mBacklog, msg, s, WebSocketOpCode::Binary, 0);
+  // If the driver cannot be reached the backlog grows without bounds, e.g.
+  // for very long lasting connection attempts. Since messages are mostly
+  // periodic metrics, drop the oldest pages rather than accumulating
+  // forever. Frames never span two pages, so the stream stays valid.
+  constexpr size_t maxBacklogPages = 512; // 32MB of 64kB pages
+  if (mBacklog.size() > maxBacklogPages) {
+    size_t excess = mBacklog.size() - maxBacklogPages;
+    for (size_t i = 0; i < excess; ++i) {
+      free(mBacklog[i].base);
+    }
+    mBacklog.erase(mBacklog.begin(), mBacklog.begin() + excess);
+    mDroppedPages += excess;
+    if ((mDroppedPages & (mDroppedPages - 1)) == 0) { // log with exponential backoff
+      LOGP(warning, "Driver client backlog full, dropped {} pages of messages so far.", mDroppedPages);
+    }
+  }
   if (flush) {
     this->awake();
   }
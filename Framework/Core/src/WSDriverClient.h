@@ -56,6 +56,8 @@ class WSDriverClient : public DriverClient
   std::mutex mClientMutex;
   ServiceRegistryRef mRegistry;
   std::vector<uv_buf_t> mBacklog;
+  // Number of backlog pages dropped because the driver could not be reached.
+  size_t mDroppedPages = 0;
   uv_async_t* mAwakeMainThread = nullptr;
   uv_connect_t* mConnection = nullptr;
   std::unique_ptr<WSDPLClient> mClient;
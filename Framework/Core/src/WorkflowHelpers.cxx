@@ -176,6 +176,7 @@ void WorkflowHelpers::injectServiceDevices(WorkflowSpec& workflow, ConfigContext
                 {"condition-tf-per-query", VariantType::Int, defaultConditionQueryRate(), {"check condition validity per requested number of TFs, fetch only once if <=0"}},
                 {"condition-tf-per-query-multiplier", VariantType::Int, defaultConditionQueryRateMultiplier(), {"check conditions once per this amount of nominal checks"}},
                 {"condition-time-tolerance", VariantType::Int64, 5000ll, {"prefer creation time if its difference to orbit-derived time exceeds threshold (ms), impose if <0"}},
+                {"condition-prefetch-margin", VariantType::Int64, 0ll, {"fetch the successor of a CCDB object in the background this many ms before its validity expires, 0 = disabled"}},
                 {"orbit-offset-enumeration", VariantType::Int64, 0ll, {"initial value for the orbit"}},
                 {"orbit-multiplier-enumeration", VariantType::Int64, 0ll, {"multiplier to get the orbit from the counter"}},
                 {"start-value-enumeration", VariantType::Int64, 0ll, {"initial value for the enumeration"}},
@@ -809,13 +810,31 @@ void WorkflowHelpers::constructGraph(const WorkflowSpec& workflow,
   // parallel pipeline and add an edge for each.
   enumerateAvailableOutputs();
 
+  // Precompute the concrete (origin, description) of every output once.
+  // Matching an input against the thousands of outputs of a big workflow
+  // dominates the graph construction time, and for the vast majority of the
+  // (input, output) pairs a cheap comparison of origin / description is
+  // enough to reject the pair without going through the full matcher.
+  std::vector<ConcreteDataTypeMatcher> outputTypes;
+  outputTypes.reserve(constOutputs.size());
+  for (auto& output : constOutputs) {
+    outputTypes.push_back(DataSpecUtils::asConcreteDataTypeMatcher(output));
+  }
+
   std::vector<bool> matches(constOutputs.size());
   for (size_t consumer = 0; consumer < workflow.size(); ++consumer) {
     O2_SIGNPOST_ID_GENERATE(sid, workflow_helpers);
     O2_SIGNPOST_START(workflow_helpers, sid, "input matching", "Matching inputs of consumer [%zu] %{}s public", consumer, workflow[consumer].name.c_str());
     for (size_t input = 0; input < workflow[consumer].inputs.size(); ++input) {
       forwards.clear();
+      auto inputOrigin = DataSpecUtils::getOptionalOrigin(workflow[consumer].inputs[input]);
+      auto inputDescription = DataSpecUtils::getOptionalDescription(workflow[consumer].inputs[input]);
       for (size_t i = 0; i < constOutputs.size(); i++) {
+        if ((inputOrigin.has_value() && outputTypes[i].origin != *inputOrigin) ||
+            (inputDescription.has_value() && outputTypes[i].description != *inputDescription)) {
+          matches[i] = false;
+          continue;
+        }
         matches[i] = DataSpecUtils::match(workflow[consumer].inputs[input], constOutputs[i]);
         if (matches[i]) {
           O2_SIGNPOST_EVENT_EMIT(workflow_helpers, sid, "output", "Input %{public}s matches %{public}s",
@@ -1047,6 +1066,12 @@ std::shared_ptr<DataOutputDirector> WorkflowHelpers::getDataOutputDirector(Confi
       ntfmerge = ntfm;
     }
   }
+  if (options.isSet("aod-writer-compression")) {
+    auto compression = options.get<int>("aod-writer-compression");
+    if (compression > 0) {
+      dod->setCompression(compression);
+    }
+  }
   // parse the keepString
   if (options.isSet("aod-writer-keep")) {
     auto keepString = options.get<std::string>("aod-writer-keep");
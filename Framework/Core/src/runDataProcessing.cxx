@@ -11,6 +11,7 @@
 #define BOOST_BIND_GLOBAL_PLACEHOLDERS
 #include <stdexcept>
 #include "Framework/BoostOptionsRetriever.h"
+#include "Framework/BundleOptionsRetriever.h"
 #include "Framework/BacktraceHelpers.h"
 #include "Framework/CallbacksPolicy.h"
 #include "Framework/ChannelConfigurationPolicy.h"
@@ -83,6 +84,7 @@
 #include <Configuration/ConfigurationInterface.h>
 #include <Configuration/ConfigurationFactory.h>
 #include <Monitoring/MonitoringFactory.h>
+#include "CriticalPathHelpers.h"
 #include "ResourcesMonitoringHelper.h"
 
 #include <fairmq/Device.h>
@@ -747,6 +749,9 @@ void spawnDevice(uv_loop_t* loop,
     for (auto& env : execution.environ) {
       putenv(strdup(DeviceSpecHelpers::reworkTimeslicePlaceholder(env, spec).data()));
     }
+    if (execution.optionsBundle.empty() == false) {
+      setenv(BundleOptionsRetriever::ENV_NAME, execution.optionsBundle.c_str(), 1);
+    }
     execvp(execution.args[0], execution.args.data());
   } else {
     O2_SIGNPOST_ID_GENERATE(sid, driver);
@@ -1241,6 +1246,7 @@ std::vector<std::regex> getDumpableMetrics()
   dumpableMetrics.emplace_back("^total-timeframes.*");
   dumpableMetrics.emplace_back("^device_state.*");
   dumpableMetrics.emplace_back("^total_wall_time_ms$");
+  dumpableMetrics.emplace_back("^perf/.*");
   return dumpableMetrics;
 }
 
@@ -1275,6 +1281,7 @@ void dumpRunSummary(DriverServerContext& context, DriverInfo const& driverInfo,
       LOGP(info, "   - Last error: {}", info.lastError);
     }
   }
+  CriticalPathHelpers::dumpBottleneckReport(*context.metrics, specs);
   for (auto& summary : *context.summaryCallbacks) {
     summary(ServiceMetricsInfo{*context.metrics, *context.specs, *context.infos, context.driver->metrics, driverInfo});
   }
@@ -2026,6 +2033,7 @@ int runStateMachine(DataProcessorSpecs const& workflow,
             "--aod-writer-resfile",
             "--aod-writer-resmode",
             "--aod-writer-maxfilesize",
+            "--aod-writer-compression",
             "--aod-writer-keep",
             "--aod-parent-access-level",
             "--aod-parent-base-path-replacement",
@@ -1357,3 +1357,47 @@ TEST_CASE("TestCombinedGetter")
     ++count;
   }
 }
+
+TEST_CASE("TestGatherBlocks")
+{
+  TableBuilder b1;
+  auto w1 = b1.cursor<o2::aod::Points>();
+  for (auto i = 0; i < 10; ++i) {
+    w1(0, i, i + 10);
+  }
+  auto t1 = b1.finalize();
+  TableBuilder b2;
+  auto w2 = b2.cursor<o2::aod::Points>();
+  for (auto i = 10; i < 16; ++i) {
+    w2(0, i, i + 10);
+  }
+  auto t2 = b2.finalize();
+  o2::aod::Points points{ArrowHelpers::concatTables({t1, t2})};
+
+  auto blocks = gatherBlocks<o2::aod::test::X>(points);
+  REQUIRE(blocks.size() == 2);
+  REQUIRE(blocks[0].firstRow == 0);
+  REQUIRE(blocks[0].values.size() == 10);
+  REQUIRE(blocks[1].firstRow == 10);
+  REQUIRE(blocks[1].values.size() == 6);
+  auto row = 0;
+  for (auto const& block : blocks) {
+    for (auto value : block.values) {
+      REQUIRE(value == row++);
+    }
+  }
+
+  // A fixed-size gather crossing the chunk boundary
+  std::array<int, 8> buffer;
+  auto gathered = gatherBlock<8, o2::aod::test::X>(points, 6, buffer);
+  REQUIRE(gathered == 8);
+  for (auto i = 0u; i < gathered; ++i) {
+    REQUIRE(buffer[i] == 6 + (int)i);
+  }
+  // A gather truncated by the end of the column
+  gathered = gatherBlock<8, o2::aod::test::X>(points, 12, buffer);
+  REQUIRE(gathered == 4);
+  for (auto i = 0u; i < gathered; ++i) {
+    REQUIRE(buffer[i] == 12 + (int)i);
+  }
+}
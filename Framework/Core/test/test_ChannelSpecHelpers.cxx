@@ -113,4 +113,14 @@ TEST_CASE("TestChannelParser")
   REQUIRE(p5.specs.back().hostname == "@some_ipc_file_8080");
   REQUIRE(p5.specs.back().port == 0);
   REQUIRE(p5.specs.back().protocol == ChannelProtocol::IPC);
+
+  // Check the case for a channel with payload compression
+  OutputChannelSpecConfigParser p6;
+  ChannelSpecHelpers::parseChannelConfig("name=foo,method=connect,type=sub,compress=lz4", p6);
+  REQUIRE(p6.specs.size() == 1);
+  REQUIRE(p6.specs.back().compression == ChannelCompression::LZ4);
+  OutputChannelSpecConfigParser p7;
+  ChannelSpecHelpers::parseChannelConfig("name=foo,compress=zlib", p7);
+  REQUIRE(p7.specs.back().compression == ChannelCompression::ZLIB);
+  REQUIRE(p.specs.back().compression == ChannelCompression::None);
 }
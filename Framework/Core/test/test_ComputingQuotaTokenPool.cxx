@@ -0,0 +1,42 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+#include <catch_amalgamated.hpp>
+#include "Framework/ComputingQuotaTokenPool.h"
+
+using namespace o2::framework;
+
+TEST_CASE("TestComputingQuotaTokenPool")
+{
+  ComputingQuotaTokenPool pool("/dpl-test-token-pool", 1000);
+  REQUIRE(pool.valid());
+  REQUIRE(pool.available() == 1000);
+  REQUIRE(pool.tryAcquire(600));
+  REQUIRE(pool.available() == 400);
+  // not enough tokens left, nothing must be taken
+  REQUIRE(pool.tryAcquire(600) == false);
+  REQUIRE(pool.available() == 400);
+
+  // a second attachment accounts against the same budget and
+  // keeps the capacity of the creator
+  {
+    ComputingQuotaTokenPool other("/dpl-test-token-pool", 5000);
+    REQUIRE(other.valid());
+    REQUIRE(other.available() == 400);
+    REQUIRE(other.tryAcquire(400));
+    REQUIRE(pool.available() == 0);
+    other.release(100);
+  }
+  REQUIRE(pool.available() == 100);
+
+  pool.release(900);
+  REQUIRE(pool.available() == 1000);
+}
@@ -54,7 +54,9 @@ TEST_CASE("TestDataOutputDirector")
   dh = DataHeader(DataDescription{"DUE"},
                   DataOrigin{"AOD"},
                   DataHeader::SubSpecificationType{0});
-  std::string jsonString(R"({"OutputDirector": {"resfile": "defresults", "resfilemode": "RECREATE", "ntfmerge": 10, "OutputDescriptors": [{"table": "AOD/UNO/0", "columns": ["fEta1","fMom1"], "treename": "uno", "filename": "unoresults"}, {"table": "AOD/DUE/0", "columns": ["fPhi2"], "treename": "due"}]}})");
+  std::string jsonString(R"({"OutputDirector": {"resfile": "defresults", "resfilemode": "RECREATE", "ntfmerge": 10, "compression": 404, "OutputDescriptors": [{"table": "AOD/UNO/0", "columns": ["fEta1","fMom1"], "treename": "uno", "filename": "unoresults"}, {"table": "AOD/DUE/0", "columns": ["fPhi2"], "treename": "due"}]}})");
+
+  REQUIRE(dod.getCompression() == 505);
 
   dod.reset();
   std::tie(rdn, dfn, fmode, mfs, ntf) = dod.readJsonString(jsonString);
@@ -64,6 +66,7 @@ TEST_CASE("TestDataOutputDirector")
   REQUIRE(dfn == std::string("defresults"));
   REQUIRE(fmode == std::string("RECREATE"));
   REQUIRE(ntf == 10);
+  REQUIRE(dod.getCompression() == 404);
 
   REQUIRE(ds[0]->tablename == std::string("DUE"));
   REQUIRE(ds[0]->treename == std::string("due"));
@@ -11,6 +11,7 @@
 
 #include "Framework/Configurable.h"
 #include "Framework/ExpressionHelpers.h"
+#include "Framework/TableBuilder.h"
 #include "Framework/AnalysisDataModel.h"
 #include "Framework/AODReaderHelpers.h"
 #include <catch_amalgamated.hpp>
@@ -283,3 +284,24 @@ TEST_CASE("TestConditionalExpressions")
   auto gandiva_filter2 = createFilter(schema2, gandiva_condition2);
   REQUIRE(gandiva_tree2->ToString() == "bool greater_than((float) fSigned1Pt, (const float) 0 raw(0)) && if (bool less_than(float absf((float) fEta), (const float) 1 raw(3f800000)) && if (bool less_than((float) fPt, (const float) 1 raw(3f800000))) { bool greater_than((float) fPhi, (const float) 1.5708 raw(3fc90fdb)) } else { bool less_than((float) fPhi, (const float) 1.5708 raw(3fc90fdb)) }) { bool greater_than(float absf((float) fX), (const float) 1 raw(3f800000)) } else { bool greater_than(float absf((float) fY), (const float) 1 raw(3f800000)) }");
 }
+
+TEST_CASE("TestFilterTable")
+{
+  TableBuilder builder;
+  auto rowWriter = builder.persist<float, float>({"fPt", "fEta"});
+  rowWriter(0, 0.5f, 0.2f);
+  rowWriter(0, 1.5f, -0.9f);
+  rowWriter(0, 2.5f, 1.2f);
+  rowWriter(0, 3.5f, -0.1f);
+  auto table = builder.finalize();
+
+  auto skimmed = filterTable(table, (o2::aod::track::pt > 1.f) && (nabs(o2::aod::track::eta) < 1.f));
+  REQUIRE(skimmed->num_rows() == 2);
+  auto pts = std::static_pointer_cast<arrow::FloatArray>(skimmed->GetColumnByName("fPt")->chunk(0));
+  REQUIRE(pts->Value(0) == 1.5f);
+  REQUIRE(pts->Value(1) == 3.5f);
+
+  // a filter passing all rows returns the original table
+  auto all = filterTable(table, o2::aod::track::pt > 0.f);
+  REQUIRE(all.get() == table.get());
+}
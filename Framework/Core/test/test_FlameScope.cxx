@@ -0,0 +1,51 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+#include <catch_amalgamated.hpp>
+#include "Framework/FlameScope.h"
+#include "Framework/DataProcessingStats.h"
+#include "Framework/TimingHelpers.h"
+#include <uv.h>
+
+using namespace o2::framework;
+
+TEST_CASE("TestFlameScope")
+{
+  auto& registry = FlameScopeRegistry::instance();
+  auto id = registry.scopeId("test/scope");
+  REQUIRE(id >= 0);
+  // the id of a scope is stable
+  REQUIRE(registry.scopeId("test/scope") == id);
+  REQUIRE(registry.scopeId("test/other") != id);
+
+  {
+    FlameScope scope(id);
+  }
+  {
+    FlameScope scope(id);
+  }
+
+  DataProcessingStats stats(TimingHelpers::defaultRealtimeBaseConfigurator(0, uv_default_loop()),
+                            TimingHelpers::defaultCPUTimeConfigurator(uv_default_loop()));
+  registry.flushTo(stats);
+  stats.processCommandQueue();
+
+  int base = (int)ProcessingStatsId::FLAME_SCOPE_BASE + 3 * id;
+  REQUIRE(stats.metricsNames[base] == "flame/test/scope/count");
+  REQUIRE(stats.metrics[base] == 2);
+  REQUIRE(stats.metrics[base + 1] > 0);                      // some time was spent
+  REQUIRE(stats.metrics[base + 2] <= stats.metrics[base + 1]); // max cannot exceed the total
+
+  // a second flush without new spans must not change the counters
+  registry.flushTo(stats);
+  stats.processCommandQueue();
+  REQUIRE(stats.metrics[base] == 2);
+}
@@ -190,6 +190,38 @@ TEST_CASE("TestTableBuilderBulk")
   }
 }
 
+TEST_CASE("TestTableBuilderBulkPush")
+{
+  using namespace o2::framework;
+  TableBuilder builder;
+  int x[] = {0, 1, 2, 3};
+  float p[] = {0.f, 1.f, 10.f, 11.f, 20.f, 21.f, 30.f, 31.f};
+  std::vector<std::vector<int>> v = {{}, {1}, {2, 2}, {3, 3, 3}};
+
+  REQUIRE(builder.bulkPush<int, float[2], std::vector<int>>({"x", "p", "v"}, x, p, v));
+
+  auto table = builder.finalize();
+  REQUIRE(table->num_columns() == 3);
+  REQUIRE(table->num_rows() == 4);
+  REQUIRE(table->schema()->field(0)->name() == "x");
+  REQUIRE(table->schema()->field(1)->name() == "p");
+  REQUIRE(table->schema()->field(2)->name() == "v");
+  REQUIRE(table->schema()->field(0)->type()->id() == arrow::int32()->id());
+  REQUIRE(table->schema()->field(1)->type()->id() == arrow::fixed_size_list(arrow::float32(), 2)->id());
+  REQUIRE(table->schema()->field(2)->type()->id() == arrow::list(arrow::int32())->id());
+
+  auto xs = std::dynamic_pointer_cast<arrow::NumericArray<arrow::Int32Type>>(table->column(0)->chunk(0));
+  auto ps = std::dynamic_pointer_cast<arrow::FixedSizeListArray>(table->column(1)->chunk(0));
+  auto vs = std::dynamic_pointer_cast<arrow::ListArray>(table->column(2)->chunk(0));
+  auto pValues = std::dynamic_pointer_cast<arrow::NumericArray<arrow::FloatType>>(ps->values());
+  for (size_t i = 0; i < 4; ++i) {
+    REQUIRE(xs->Value(i) == i);
+    REQUIRE(pValues->Value(2 * i) == 10.f * i);
+    REQUIRE(pValues->Value(2 * i + 1) == 10.f * i + 1.f);
+    REQUIRE(vs->value_length(i) == i);
+  }
+}
+
 TEST_CASE("TestTableBuilderMore")
 {
   using namespace o2::framework;
@@ -0,0 +1,70 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+#include "Framework/BundleOptionsRetriever.h"
+#include "Framework/ParamRetriever.h"
+#include "Framework/ConfigParamStore.h"
+#include <catch_amalgamated.hpp>
+
+using namespace o2::framework;
+
+TEST_CASE("TestBundleRoundtrip")
+{
+  std::vector<ConfigParamSpec> specs{
+    ConfigParamSpec{"anInt", VariantType::Int, 1, {"an int option"}},
+    ConfigParamSpec{"aFloat", VariantType::Float, 2.0f, {"a float option"}},
+    ConfigParamSpec{"aString", VariantType::String, "foo", {"a string option"}},
+    ConfigParamSpec{"aBool", VariantType::Bool, false, {"a bool option"}},
+    ConfigParamSpec{"aDefaulted", VariantType::Int, 42, {"an option not in the bundle"}}};
+
+  auto bundle = BundleOptionsRetriever::encode({{"anInt", "123"},
+                                                {"aFloat", "1.5"},
+                                                {"aString", "bar"},
+                                                {"aBool", "true"},
+                                                {"notInSchema", "ignored"}});
+  std::vector<std::unique_ptr<ParamRetriever>> retrievers;
+  retrievers.emplace_back(std::make_unique<BundleOptionsRetriever>(bundle));
+
+  ConfigParamStore store{specs, std::move(retrievers)};
+  store.preload();
+  store.activate();
+
+  CHECK(store.store().get<int>("anInt") == 123);
+  CHECK(store.store().get<float>("aFloat") == 1.5f);
+  CHECK(store.store().get<std::string>("aString") == "bar");
+  CHECK(store.store().get<bool>("aBool") == true);
+  // options missing from the bundle keep their default
+  CHECK(store.store().get<int>("aDefaulted") == 42);
+  CHECK(store.provenance("anInt") == "bundle");
+  CHECK(store.provenance("aDefaulted") == "default");
+}
+
+TEST_CASE("TestBundleArrays")
+{
+  std::vector<int> defaults{1, 2};
+  std::vector<ConfigParamSpec> specs{
+    ConfigParamSpec{"anArray", VariantType::ArrayInt, defaults, {"an array option"}}};
+
+  auto bundle = BundleOptionsRetriever::encode({{"anArray", "[3, 4, 5]"}});
+  std::vector<std::unique_ptr<ParamRetriever>> retrievers;
+  retrievers.emplace_back(std::make_unique<BundleOptionsRetriever>(bundle));
+
+  ConfigParamStore store{specs, std::move(retrievers)};
+  store.preload();
+  store.activate();
+
+  auto branch = store.store().get_child("anArray");
+  std::vector<int> values;
+  for (auto& entry : branch) {
+    values.push_back(entry.second.get_value<int>());
+  }
+  CHECK(values == std::vector<int>{3, 4, 5});
+}
@@ -27,6 +27,7 @@
 #include <TTree.h>
 #include <TBranch.h>
 #include <TClass.h>
+#include <TEnv.h>
 #include <vector>
 #include <string>
 #include <stdexcept> // std::runtime_error
@@ -94,6 +95,7 @@ struct DefaultKey {
 /// before the first branch definition.
 ///    - number of entries \a n (\c int)
 ///    - publishing mode, \ref PublishingMode
+///    - read-ahead configuration, \ref ReadAhead
 ///
 /// \par Integration into DPL:
 /// The class defines the functor operator which takes the DPL ProcessingContext
@@ -156,6 +158,16 @@ class GenericRootTreeReader
     Loop,
   };
 
+  /// Read-ahead configuration. With a non-zero cache size, the TTreeCache of the input is
+  /// enabled with this size and ROOT's asynchronous prefetching is switched on, so the
+  /// baskets of upcoming entries are fetched and staged by a helper thread while the
+  /// current entry is being processed. By default all caching is off and reads are fully
+  /// synchronous, which is preferable for local files but leaves the device waiting on
+  /// high-latency (e.g. EOS-backed) storage.
+  struct ReadAhead {
+    size_t cacheSize = 0; ///< TTreeCache size in bytes, 0 keeps caching disabled
+  };
+
   /// A struct holding a callback to specialize publishing based on branch name. This might be useful
   /// when the read data needs to be transformed before publishing.
   /// The hook gets the following input:
@@ -396,8 +408,16 @@ class GenericRootTreeReader
                         Args&&... args)       // file names, followed by branch info
     : mInput(treename)
   {
-    mInput.SetCacheSize(0);
     parseConstructorArgs<0>(std::forward<Args>(args)...);
+    if (mReadAhead.cacheSize > 0) {
+      // the asynchronous prefetching is picked up when the files of the chain are opened,
+      // i.e. it has to be enabled before the first entry is read
+      gEnv->SetValue("TFile.AsyncPrefetching", 1);
+      mInput.SetCacheSize(mReadAhead.cacheSize);
+      mInput.AddBranchToCache("*", true);
+    } else {
+      mInput.SetCacheSize(0);
+    }
     mBranchConfiguration->setup(mInput, mPublishHook);
   }
 
@@ -507,6 +527,8 @@ class GenericRootTreeReader
       mMaxEntries = def;
     } else if constexpr (std::is_same<U, PublishingMode>::value) {
       mPublishingMode = def;
+    } else if constexpr (std::is_same<U, ReadAhead>::value) {
+      mReadAhead = def;
     } else if constexpr (std::is_same<U, SpecialPublishHook*>::value) {
       mPublishHook = def;
     } else if constexpr (is_specialization_v<U, BranchDefinition>) {
@@ -550,6 +572,8 @@ class GenericRootTreeReader
   int mMaxEntries = -1;
   /// publishing mode
   PublishingMode mPublishingMode = PublishingMode::Single;
+  /// read-ahead configuration
+  ReadAhead mReadAhead;
   /// special user hook
   SpecialPublishHook* mPublishHook = nullptr;
 };
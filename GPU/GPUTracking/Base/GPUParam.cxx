@@ -179,10 +179,11 @@ void GPUParam::UpdateRun3ClusterErrors(const float* yErrorParam, const float* zE
     const float* param = yz ? zErrorParam : yErrorParam;
     for (int rowType = 0; rowType < 4; rowType++) {
       constexpr int regionMap[4] = {0, 4, 6, 8};
-      ParamErrors[yz][rowType][0] = param[0] * param[0];
-      ParamErrors[yz][rowType][1] = param[1] * param[1] * tpcGeometry.PadHeightByRegion(regionMap[rowType]);
-      ParamErrors[yz][rowType][2] = param[2] * param[2] / tpcGeometry.TPCLength() / tpcGeometry.PadHeightByRegion(regionMap[rowType]);
-      ParamErrors[yz][rowType][3] = param[3] * param[3] * rec.tpc.clusterErrorOccupancyScaler * rec.tpc.clusterErrorOccupancyScaler;
+      const float corr = yz ? rec.tpc.clusterError2CorrectionZ : rec.tpc.clusterError2CorrectionY; // bake the correction factor into the coefficients, saves one multiplication per cluster per fit iteration
+      ParamErrors[yz][rowType][0] = param[0] * param[0] * corr;
+      ParamErrors[yz][rowType][1] = param[1] * param[1] * tpcGeometry.PadHeightByRegion(regionMap[rowType]) * corr;
+      ParamErrors[yz][rowType][2] = param[2] * param[2] / tpcGeometry.TPCLength() / tpcGeometry.PadHeightByRegion(regionMap[rowType]) * corr;
+      ParamErrors[yz][rowType][3] = param[3] * param[3] * rec.tpc.clusterErrorOccupancyScaler * rec.tpc.clusterErrorOccupancyScaler * corr;
     }
   }
 #endif
@@ -429,6 +429,10 @@ int GPUReconstruction::InitPhaseAfterDevice()
 
   WriteConstantParams(); // First initialization, if the user doesn't use RunChains
 
+  if (InitKernelLaunchTuning()) {
+    return 1;
+  }
+
   mInitialized = true;
   return 0;
 }
@@ -950,9 +954,16 @@ int GPUReconstruction::registerMemoryForGPU(const void* ptr, size_t size)
   if (mProcessingSettings.noGPUMemoryRegistration) {
     return 0;
   }
+  const auto& pos = mRegisteredMemoryPtrs.find(ptr);
+  if (pos != mRegisteredMemoryPtrs.end()) {
+    if (pos->second == size) {
+      return 0; // buffer is already registered with identical extent, keep the cached registration
+    }
+    unregisterMemoryForGPU(ptr); // same buffer with different extent, registration must be renewed
+  }
   int retVal = registerMemoryForGPU_internal(ptr, size);
   if (retVal == 0) {
-    mRegisteredMemoryPtrs.emplace(ptr);
+    mRegisteredMemoryPtrs.emplace(ptr, size);
   }
   return retVal;
 }
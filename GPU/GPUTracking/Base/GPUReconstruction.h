@@ -242,6 +242,7 @@ class GPUReconstruction
   virtual int InitDevice() = 0;
   int InitPhasePermanentMemory();
   int InitPhaseAfterDevice();
+  virtual int InitKernelLaunchTuning() { return 0; }
   void WriteConstantParams();
   virtual int ExitDevice() = 0;
   virtual size_t WriteToConstantMemory(size_t offset, const void* src, size_t size, int stream = -1, gpu_reconstruction_kernels::deviceEvent* ev = nullptr) = 0;
@@ -328,7 +329,7 @@ class GPUReconstruction
   void* mVolatileMemoryStart = nullptr;     // Ptr to beginning of temporary volatile memory allocation, nullptr if uninitialized
   size_t mDeviceMemoryUsedMax = 0;          //
 
-  std::unordered_set<const void*> mRegisteredMemoryPtrs; // List of pointers registered for GPU
+  std::unordered_map<const void*, size_t> mRegisteredMemoryPtrs; // Cache of pointers registered for GPU with their extent, repeated registrations of an identical buffer are no-ops
 
   GPUReconstruction* mMaster = nullptr;    // Ptr to a GPUReconstruction object serving as master, sharing GPU memory, events, etc.
   std::vector<GPUReconstruction*> mSlaves; // Ptr to slave GPUReconstructions
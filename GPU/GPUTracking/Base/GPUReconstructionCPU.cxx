@@ -32,6 +32,9 @@
 #include "GPUConstantMem.h"
 #include "GPUMemorySizeScalers.h"
 #include <atomic>
+#include <filesystem>
+#include <fstream>
+#include <tuple>
 
 #define GPUCA_LOGGING_PRINTF
 #include "GPULogging.h"
@@ -208,6 +211,115 @@ int GPUReconstructionCPU::ExitDevice()
   return 0;
 }
 
+std::string GPUReconstructionCPU::GetKernelLaunchTuningFile() const
+{
+  std::string device = mDeviceName;
+  for (auto& c : device) {
+    if (c == ' ' || c == '/') {
+      c = '_';
+    }
+  }
+  return mProcessingSettings.tuneKernelLaunchFolder + "/" + device + ".txt";
+}
+
+int GPUReconstructionCPU::InitKernelLaunchTuning()
+{
+  if (mProcessingSettings.tuneKernelLaunch == 0 || !IsGPU()) {
+    return 0;
+  }
+  if (mProcessingSettings.tuneKernelLaunch == 2) {
+    if (mProcessingSettings.debugLevel < 1) {
+      GPUError("Kernel launch parameter sweep requires debugLevel >= 1 for per-kernel timing");
+      return 1;
+    }
+    for (unsigned int t = std::max(mWarpSize * 2, 64u); t <= (unsigned int)GPUCA_MAX_THREADS; t *= 2) {
+      mKernelLaunchSweep.candidates.emplace_back(t, 1);
+      mKernelLaunchSweep.candidates.emplace_back(t, 2);
+    }
+    mKernelLaunchSweep.active = true;
+    GPUInfo("Sweeping %d kernel launch parameter candidates on %s (one per run, output %s)", (int)mKernelLaunchSweep.candidates.size(), mDeviceName.c_str(), GetKernelLaunchTuningFile().c_str());
+    return 0;
+  }
+  std::ifstream in(GetKernelLaunchTuningFile());
+  if (in.fail()) {
+    GPUInfo("No tuned kernel launch parameters for %s (%s), keeping the compiled defaults", mDeviceName.c_str(), GetKernelLaunchTuningFile().c_str());
+    return 0;
+  }
+  std::string name;
+  int nThreads, blockFactor;
+  while (in >> name >> nThreads >> blockFactor) {
+    mKernelLaunchTuning[name] = krnlProperties(nThreads, blockFactor);
+  }
+  GPUInfo("Loaded tuned launch parameters for %d kernels from %s", (int)mKernelLaunchTuning.size(), GetKernelLaunchTuningFile().c_str());
+  return 0;
+}
+
+void GPUReconstructionCPU::overrideKernelLaunchParameters(const char* name, krnlProperties& prop)
+{
+  const krnlProperties* o;
+  if (mKernelLaunchSweep.active) {
+    o = &mKernelLaunchSweep.candidates[mKernelLaunchSweep.candidate];
+  } else {
+    const auto it = mKernelLaunchTuning.find(name);
+    if (it == mKernelLaunchTuning.end()) {
+      return;
+    }
+    o = &it->second;
+  }
+  if (prop.forceBlocks) {
+    return; // Kernels with a fixed grid must keep their geometry
+  }
+  prop.nThreads = std::min(prop.nThreads, o->nThreads); // The compiled launch bounds are an upper limit, tuning can only lower the thread count
+  prop.minBlocks *= o->minBlocks;
+}
+
+void GPUReconstructionCPU::KernelLaunchTuningSweepStep()
+{
+  auto& sweep = mKernelLaunchSweep;
+  for (unsigned int i = 0; i < mTimers.size(); i++) {
+    if (mTimers[i] == nullptr || mTimers[i]->type != 0) {
+      continue;
+    }
+    double total = 0.;
+    for (int j = 0; j < mTimers[i]->num; j++) {
+      total += mTimers[i]->timer[j].GetElapsedTime();
+    }
+    auto& slots = sweep.timings[mTimers[i]->name];
+    slots.resize(sweep.candidates.size(), 0.);
+    slots[sweep.candidate] += total - sweep.lastTotal[mTimers[i]->name];
+    sweep.lastTotal[mTimers[i]->name] = mProcessingSettings.resetTimers ? 0. : total; // Timers are reset in the statistics output below
+  }
+  if (++sweep.candidate == sweep.candidates.size()) {
+    sweep.candidate = 0;
+    sweep.passes++;
+    StoreKernelLaunchTuning();
+  }
+}
+
+void GPUReconstructionCPU::StoreKernelLaunchTuning()
+{
+  std::filesystem::create_directories(mProcessingSettings.tuneKernelLaunchFolder);
+  const std::string file = GetKernelLaunchTuningFile();
+  std::ofstream out(file);
+  if (out.fail()) {
+    GPUError("Cannot open %s for kernel launch tuning output", file.c_str());
+    return;
+  }
+  for (const auto& [name, times] : mKernelLaunchSweep.timings) {
+    unsigned int best = 0;
+    for (unsigned int i = 1; i < times.size(); i++) {
+      if (times[i] != 0. && (times[best] == 0. || times[i] < times[best])) {
+        best = i;
+      }
+    }
+    if (times[best] == 0.) {
+      continue; // Kernel did not run during the sweep
+    }
+    out << name << " " << mKernelLaunchSweep.candidates[best].nThreads << " " << mKernelLaunchSweep.candidates[best].minBlocks << "\n";
+  }
+  GPUInfo("Stored best kernel launch parameters after %u sweep passes to %s", mKernelLaunchSweep.passes, file.c_str());
+}
+
 int GPUReconstructionCPU::RunChains()
 {
   mMemoryScalers->temporaryFactor = 1.;
@@ -238,6 +350,10 @@ int GPUReconstructionCPU::RunChains()
   }
   timerTotal.Stop();
 
+  if (mKernelLaunchSweep.active) {
+    KernelLaunchTuningSweepStep();
+  }
+
   mStatWallTime = (timerTotal.GetElapsedTime() * 1000000. / mStatNEvents);
   std::string nEventReport;
   if (GetProcessingSettings().debugLevel >= 0 && mStatNEvents > 1) {
@@ -246,6 +362,8 @@ int GPUReconstructionCPU::RunChains()
   if (GetProcessingSettings().debugLevel >= 1) {
     double kernelTotal = 0;
     std::vector<double> kernelStepTimes(GPUDataTypes::N_RECO_STEPS);
+    const bool jsonOut = !GetProcessingSettings().timingJsonFile.empty();
+    std::vector<std::tuple<std::string, char, unsigned int, double, unsigned long>> jsonTimers; // name, type, count, time per event (us), bytes per event
 
     for (unsigned int i = 0; i < mTimers.size(); i++) {
       double time = 0;
@@ -272,6 +390,9 @@ int GPUReconstructionCPU::RunChains()
         snprintf(bandwidth, 256, " (%6.3f GB/s - %'14lu bytes)", mTimers[i]->memSize / time * 1e-9, (unsigned long)(mTimers[i]->memSize / mStatNEvents));
       }
       printf("Execution Time: Task (%c %8ux): %50s Time: %'10d us%s\n", type, mTimers[i]->count, mTimers[i]->name.c_str(), (int)(time * 1000000 / mStatNEvents), bandwidth);
+      if (jsonOut) {
+        jsonTimers.emplace_back(mTimers[i]->name, type, mTimers[i]->count, time * 1000000 / mStatNEvents, mStatNEvents ? mTimers[i]->memSize / mStatNEvents : 0);
+      }
       if (mProcessingSettings.resetTimers) {
         mTimers[i]->count = 0;
         mTimers[i]->memSize = 0;
@@ -306,6 +427,27 @@ int GPUReconstructionCPU::RunChains()
     mStatKernelTime = kernelTotal * 1000000 / mStatNEvents;
     printf("Execution Time: Total   : %50s Time: %'10d us%s\n", "Total Kernel", (int)mStatKernelTime, nEventReport.c_str());
     printf("Execution Time: Total   : %50s Time: %'10d us%s\n", "Total Wall", (int)mStatWallTime, nEventReport.c_str());
+    if (jsonOut) {
+      std::ofstream json(GetProcessingSettings().timingJsonFile);
+      if (json.fail()) {
+        GPUError("Cannot open %s for timing JSON output", GetProcessingSettings().timingJsonFile.c_str());
+      } else {
+        json << "{\n  \"nEvents\": " << mStatNEvents << ",\n  \"totalKernelTimeUS\": " << mStatKernelTime << ",\n  \"totalWallTimeUS\": " << mStatWallTime << ",\n  \"tasks\": [";
+        for (unsigned int i = 0; i < jsonTimers.size(); i++) {
+          auto& [name, type, count, timeUS, bytes] = jsonTimers[i];
+          json << (i ? "," : "") << "\n    {\"name\": \"" << name << "\", \"type\": \"" << type << "\", \"count\": " << count << ", \"timeUS\": " << timeUS << ", \"bytesPerEvent\": " << bytes << "}";
+        }
+        json << "\n  ],\n  \"steps\": [";
+        bool first = true;
+        for (int i = 0; i < GPUDataTypes::N_RECO_STEPS; i++) {
+          if (kernelStepTimes[i] != 0.) {
+            json << (first ? "" : ",") << "\n    {\"name\": \"" << GPUDataTypes::RECO_STEP_NAMES[i] << "\", \"timeUS\": " << kernelStepTimes[i] * 1000000 / mStatNEvents << "}";
+            first = false;
+          }
+        }
+        json << "\n  ]\n}\n";
+      }
+    }
   } else if (GetProcessingSettings().debugLevel >= 0) {
     GPUInfo("Total Wall Time: %d us%s", (int)mStatWallTime, nEventReport.c_str());
   }
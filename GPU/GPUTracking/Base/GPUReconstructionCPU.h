@@ -21,6 +21,7 @@
 #include <stdexcept>
 #include "utils/timer.h"
 #include <vector>
+#include <unordered_map>
 
 #include "GPUGeneralKernels.h"
 #include "GPUReconstructionKernelIncludes.h"
@@ -140,6 +141,12 @@ class GPUReconstructionCPU : public GPUReconstructionKernels<GPUReconstructionCP
   int ExitDevice() override;
   int GetThread();
 
+  int InitKernelLaunchTuning() override;
+  std::string GetKernelLaunchTuningFile() const;
+  void StoreKernelLaunchTuning();
+  void KernelLaunchTuningSweepStep();
+  void overrideKernelLaunchParameters(const char* name, gpu_reconstruction_kernels::krnlProperties& prop);
+
   virtual int PrepareTextures() { return 0; }
   virtual int DoStuckProtection(int stream, deviceEvent event) { return 0; }
 
@@ -151,6 +158,18 @@ class GPUReconstructionCPU : public GPUReconstructionKernels<GPUReconstructionCP
   unsigned int mThreadCount = 1;
   unsigned int mWarpSize = 1;
 
+  struct kernelLaunchSweep {
+    bool active = false;
+    unsigned int candidate = 0; // Candidate measured during the current run
+    unsigned int passes = 0;    // How often the full candidate list was measured
+    std::vector<gpu_reconstruction_kernels::krnlProperties> candidates;
+    std::unordered_map<std::string, std::vector<double>> timings; // Accumulated kernel time per candidate
+    std::unordered_map<std::string, double> lastTotal;            // Cumulative timer value at the previous sweep step
+  };
+
+  std::unordered_map<std::string, gpu_reconstruction_kernels::krnlProperties> mKernelLaunchTuning; // Tuned launch parameters per kernel (nThreads absolute, minBlocks as factor on the default)
+  kernelLaunchSweep mKernelLaunchSweep;
+
   struct timerMeta {
     std::unique_ptr<HighResTimer[]> timer;
     std::string name;
@@ -203,6 +222,9 @@ inline int GPUReconstructionCPU::runKernel(krnlSetup&& setup, Args&&... args)
   unsigned int& nBlocks = setup.x.nBlocks;
   const unsigned int stream = setup.x.stream;
   auto prop = getKernelProperties<S, I>();
+  if (!cpuFallback && (mKernelLaunchSweep.active || !mKernelLaunchTuning.empty())) {
+    overrideKernelLaunchParameters(GetKernelName<S, I>(), prop);
+  }
   const int autoThreads = cpuFallback ? 1 : prop.nThreads;
   const int autoBlocks = cpuFallback ? 1 : (prop.forceBlocks ? prop.forceBlocks : (prop.minBlocks * mBlockCount));
   if (nBlocks == (unsigned int)-1) {
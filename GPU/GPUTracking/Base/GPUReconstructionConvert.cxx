@@ -1119,7 +1119,7 @@ inline unsigned int zsEncoderRun<T>::run(std::vector<zsPage>* buffer, std::vecto
   (void)(rawcru + rawendpoint); // avoid compiler warning
   encodeBitsFactor = (1 << (encodeBits - 10));
 
-  std::sort(tmpBuffer.begin(), tmpBuffer.end(), [this](const o2::tpc::Digit a, const o2::tpc::Digit b) { return sort(a, b); });
+  std::sort(tmpBuffer.begin(), tmpBuffer.end(), [this](const o2::tpc::Digit& a, const o2::tpc::Digit& b) { return sort(a, b); });
   for (unsigned int k = 0; k <= tmpBuffer.size();) {
     bool mustWritePage = false, mustWriteSubPage = false;
     if (needAnotherPage) {
@@ -1395,8 +1395,18 @@ void GPUReconstructionConvert::RunZSEncoder(const S& in, std::unique_ptr<unsigne
 
   if (outBuffer) {
     outBuffer->reset(new unsigned long long int[totalPages * TPCZSHDR::TPC_ZS_PAGE_SIZE / sizeof(unsigned long long int)]);
+    // Compute the per-sector offsets in the interleaved output upfront, so that the copies can run in parallel, the assembly is purely memcpy-bound for large timeframes
+    unsigned long long int sectorOffset[NSLICES];
     unsigned long long int offset = 0;
     for (unsigned int i = 0; i < NSLICES; i++) {
+      sectorOffset[i] = offset;
+      for (unsigned int j = 0; j < GPUTrackingInOutZS::NENDPOINTS; j++) {
+        offset += buffer[i][j].size() * TPCZSHDR::TPC_ZS_PAGE_SIZE;
+      }
+    }
+    GPUCA_OPENMP(parallel for)
+    for (unsigned int i = 0; i < NSLICES; i++) {
+      unsigned long long int offset = sectorOffset[i];
       for (unsigned int j = 0; j < GPUTrackingInOutZS::NENDPOINTS; j++) {
         memcpy((char*)outBuffer->get() + offset, buffer[i][j].data(), buffer[i][j].size() * TPCZSHDR::TPC_ZS_PAGE_SIZE);
         offset += buffer[i][j].size() * TPCZSHDR::TPC_ZS_PAGE_SIZE;
@@ -313,7 +313,7 @@ int GPUReconstructionDeviceBase::unregisterMemoryForGPU_internal(const void* ptr
 void GPUReconstructionDeviceBase::unregisterRemainingRegisteredMemory()
 {
   for (auto& ptr : mRegisteredMemoryPtrs) {
-    unregisterMemoryForGPU_internal(ptr);
+    unregisterMemoryForGPU_internal(ptr.first);
   }
   mRegisteredMemoryPtrs.clear();
 }
@@ -550,7 +550,7 @@
   #define GPUCA_COMP_GATHER_KERNEL 0
   #endif
   #ifndef GPUCA_COMP_GATHER_MODE
-  #define GPUCA_COMP_GATHER_MODE 2
+  #define GPUCA_COMP_GATHER_MODE 3
   #endif
 #else
   #define GPUCA_NEIGHBOURS_FINDER_MAX_NNEIGHUP 0
@@ -37,6 +37,7 @@ BeginNamespace(gpu)
 // There must be no bool in here, use char, as sizeof(bool) is compiler dependent and fails on GPUs!!!!!!
 BeginSubConfig(GPUSettingsRecTPC, tpc, configStandalone.rec, "RECTPC", 0, "Reconstruction settings", rec_tpc)
 AddOptionRTC(rejectQPtB5, float, 1.f / GPUCA_MIN_TRACK_PTB5_REJECT_DEFAULT, "", 0, "QPt threshold to reject clusters of TPC tracks (Inverse Pt, scaled to B=0.5T!!!)")
+AddOptionRTC(trackFitTriageQPtB5, float, 0.f, "", 0, "QPt threshold (Inverse Pt, scaled to B=0.5T) above which the final merger fit is downgraded to a reduced fast fit (fewer passes, Bz-only propagation, no material corrections), 0 = all tracks get the full fit")
 AddOptionRTC(hitPickUpFactor, float, 1.f, "", 0, "multiplier for the combined cluster+track error during track following")
 AddOptionRTC(hitSearchArea2, float, 2.f, "", 0, "square of maximum search road of hits during seeding")
 AddOptionRTC(neighboursSearchArea, float, 3.f, "", 0, "area in cm for the search of neighbours, for z only used if searchWindowDZDR = 0")
@@ -232,6 +233,7 @@ AddOption(deterministicGPUReconstruction, int, -1, "", 0, "Make CPU and GPU debu
 AddOption(showOutputStat, bool, false, "", 0, "Print some track output statistics")
 AddOption(runCompressionStatistics, bool, false, "compressionStat", 0, "Run statistics and verification for cluster compression")
 AddOption(resetTimers, signed char, 1, "", 0, "Reset timers every event")
+AddOption(timingJsonFile, std::string, "", "", 0, "Write per-kernel / per-step timing statistics as JSON to this file (requires debugLevel >= 1)")
 AddOption(deviceTimers, bool, true, "", 0, "Use device timers instead of host-based time measurement")
 AddOption(keepAllMemory, bool, false, "", 0, "Allocate all memory on both device and host, and do not reuse")
 AddOption(keepDisplayMemory, bool, false, "", 0, "Like keepAllMemory, but only for memory required for event display")
@@ -263,6 +265,7 @@ AddOption(tpcCompressionGatherModeKernel, signed char, -1, "", 0, "TPC Compresse
 AddOption(tpccfGatherKernel, bool, true, "", 0, "Use a kernel instead of the DMA engine to gather the clusters")
 AddOption(doublePipeline, bool, false, "", 0, "Double pipeline mode")
 AddOption(doublePipelineClusterizer, bool, true, "", 0, "Include the input data of the clusterizer in the double-pipeline")
+AddOption(pipelineDepth, int, 2, "", 0, "Number of timeframes in flight in double pipeline mode (number of processing contexts created by the O2 interface)")
 AddOption(prefetchTPCpageScan, signed char, 0, "", 0, "Prefetch Data for TPC page scan in CPU cache")
 AddOption(runMC, bool, false, "", 0, "Process MC labels")
 AddOption(runQA, int, 0, "qa", 'q', "Enable tracking QA (negative number to provide bitmask for QA tasks)", message("Running QA: %s"), def(1))
@@ -285,6 +288,8 @@ AddOption(tpcSingleSector, int, -1, "", 0, "Restrict TPC processing to a single
 AddOption(tpcDownscaledEdx, unsigned char, 0, "", 0, "If != 0, downscale dEdx processing (if enabled) to x %")
 AddOption(tpcMaxAttachedClustersPerSectorRow, unsigned int, 51000, "", 0, "Maximum number of TPC attached clusters which can be decoded per SectorRow")
 AddOption(tpcUseOldCPUDecoding, bool, false, "", 0, "Enable old CPU-based TPC decoding")
+AddOption(tuneKernelLaunch, int, 0, "", 0, "Kernel launch parameter tuning (0 = off, 1 = load tuned launch parameters for the current GPU model if available, 2 = sweep launch parameters over the processed time frames and store the best per-kernel configuration, requires debugLevel >= 1)")
+AddOption(tuneKernelLaunchFolder, std::string, "./launchtuning/", "", 0, "Folder in which tuned kernel launch parameters are stored per GPU model")
 AddOption(RTCcacheFolder, std::string, "./rtccache/", "", 0, "Folder in which the cache file is stored")
 AddOption(RTCprependCommand, std::string, "", "", 0, "Prepend RTC compilation commands by this string")
 AddOption(RTCoverrideArchitecture, std::string, "", "", 0, "Override arhcitecture part of RTC compilation command line")
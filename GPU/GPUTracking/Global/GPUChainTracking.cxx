@@ -461,7 +461,54 @@ void GPUChainTracking::UpdateGPUCalibObjects(int stream, const GPUCalibObjectsCo
     mFlatObjectsShadow.mCalibObjects.o2Propagator->setMatLUT(mFlatObjectsShadow.mCalibObjects.matLUT);
   }
 #endif
-  TransferMemoryResourceLinkToGPU(RecoStep::NoRecoStep, mFlatObjectsShadow.mMemoryResFlat, stream);
+  if (ptrMask == nullptr) {
+    TransferMemoryResourceLinkToGPU(RecoStep::NoRecoStep, mFlatObjectsShadow.mMemoryResFlat, stream);
+  } else {
+    // Only some objects changed and the flat memory layout is unchanged: upload just the
+    // affected structs and flat buffers instead of the full flat resource, which also
+    // contains the large transform maps. The untouched device ranges still hold the
+    // content of the previous upload.
+    auto copyObjectToGPU = [&](const auto* shadowPtr, auto* devicePtr, size_t size) {
+      GPUMemCpy(RecoStep::NoRecoStep, (void*)devicePtr, (const void*)shadowPtr, size, stream, true);
+    };
+    if (processors()->calibObjects.fastTransform && ptrMask->fastTransform) {
+      copyObjectToGPU(mFlatObjectsShadow.mCalibObjects.fastTransform, mFlatObjectsDevice.mCalibObjects.fastTransform, sizeof(*processors()->calibObjects.fastTransform));
+      copyObjectToGPU(mFlatObjectsShadow.mTpcTransformBuffer, mFlatObjectsDevice.mTpcTransformBuffer, processors()->calibObjects.fastTransform->getFlatBufferSize());
+    }
+    if (processors()->calibObjects.fastTransformMShape && ptrMask->fastTransformMShape) {
+      copyObjectToGPU(mFlatObjectsShadow.mCalibObjects.fastTransformMShape, mFlatObjectsDevice.mCalibObjects.fastTransformMShape, sizeof(*processors()->calibObjects.fastTransformMShape));
+      copyObjectToGPU(mFlatObjectsShadow.mTpcTransformMShapeBuffer, mFlatObjectsDevice.mTpcTransformMShapeBuffer, processors()->calibObjects.fastTransformMShape->getFlatBufferSize());
+    }
+    if (processors()->calibObjects.fastTransformRef && ptrMask->fastTransformRef) {
+      copyObjectToGPU(mFlatObjectsShadow.mCalibObjects.fastTransformRef, mFlatObjectsDevice.mCalibObjects.fastTransformRef, sizeof(*processors()->calibObjects.fastTransformRef));
+      copyObjectToGPU(mFlatObjectsShadow.mTpcTransformRefBuffer, mFlatObjectsDevice.mTpcTransformRefBuffer, processors()->calibObjects.fastTransformRef->getFlatBufferSize());
+    }
+    if (processors()->calibObjects.fastTransformHelper && ptrMask->fastTransformHelper) {
+      copyObjectToGPU(mFlatObjectsShadow.mCalibObjects.fastTransformHelper, mFlatObjectsDevice.mCalibObjects.fastTransformHelper, sizeof(*processors()->calibObjects.fastTransformHelper));
+    }
+#ifdef GPUCA_HAVE_O2HEADERS
+    if (processors()->calibObjects.dEdxCalibContainer && ptrMask->dEdxCalibContainer) {
+      copyObjectToGPU(mFlatObjectsShadow.mCalibObjects.dEdxCalibContainer, mFlatObjectsDevice.mCalibObjects.dEdxCalibContainer, sizeof(*processors()->calibObjects.dEdxCalibContainer));
+      copyObjectToGPU(mFlatObjectsShadow.mdEdxSplinesBuffer, mFlatObjectsDevice.mdEdxSplinesBuffer, processors()->calibObjects.dEdxCalibContainer->getFlatBufferSize());
+    }
+    if (processors()->calibObjects.matLUT && ptrMask->matLUT) {
+      copyObjectToGPU(mFlatObjectsShadow.mCalibObjects.matLUT, mFlatObjectsDevice.mCalibObjects.matLUT, sizeof(*processors()->calibObjects.matLUT));
+      copyObjectToGPU(mFlatObjectsShadow.mMatLUTBuffer, mFlatObjectsDevice.mMatLUTBuffer, processors()->calibObjects.matLUT->getFlatBufferSize());
+    }
+    if (processors()->calibObjects.trdGeometry && ptrMask->trdGeometry) {
+      copyObjectToGPU(mFlatObjectsShadow.mCalibObjects.trdGeometry, mFlatObjectsDevice.mCalibObjects.trdGeometry, sizeof(*processors()->calibObjects.trdGeometry));
+    }
+    if (processors()->calibObjects.tpcPadGain && ptrMask->tpcPadGain) {
+      copyObjectToGPU(mFlatObjectsShadow.mCalibObjects.tpcPadGain, mFlatObjectsDevice.mCalibObjects.tpcPadGain, sizeof(*processors()->calibObjects.tpcPadGain));
+    }
+    if (processors()->calibObjects.tpcZSLinkMapping && ptrMask->tpcZSLinkMapping) {
+      copyObjectToGPU(mFlatObjectsShadow.mCalibObjects.tpcZSLinkMapping, mFlatObjectsDevice.mCalibObjects.tpcZSLinkMapping, sizeof(*processors()->calibObjects.tpcZSLinkMapping));
+    }
+    if (processors()->calibObjects.o2Propagator && ptrMask->o2Propagator) {
+      copyObjectToGPU(mFlatObjectsShadow.mCalibObjects.o2Propagator, mFlatObjectsDevice.mCalibObjects.o2Propagator, sizeof(*processors()->calibObjects.o2Propagator));
+    }
+#endif
+  }
   memcpy((void*)&processorsShadow()->calibObjects, (void*)&mFlatObjectsDevice.mCalibObjects, sizeof(mFlatObjectsDevice.mCalibObjects));
 }
 
@@ -23,6 +23,7 @@
 #include "GPUParam.inc"
 #include "GPUQA.h"
 #include "GPUOutputControl.h"
+#include <algorithm>
 #include <iostream>
 #include <fstream>
 #include <thread>
@@ -56,7 +57,7 @@ int GPUO2Interface::Initialize(const GPUO2InterfaceConfiguration& config)
     return (1);
   }
   mConfig.reset(new GPUO2InterfaceConfiguration(config));
-  mNContexts = mConfig->configProcessing.doublePipeline ? 2 : 1;
+  mNContexts = mConfig->configProcessing.doublePipeline ? std::max(2, mConfig->configProcessing.pipelineDepth) : 1;
   mCtx.reset(new GPUO2Interface_processingContext[mNContexts]);
   if (mConfig->configWorkflow.inputs.isSet(GPUDataTypes::InOutType::TPCRaw)) {
     mConfig->configGRP.needsClusterer = 1;
@@ -2089,20 +2089,21 @@ GPUd() void GPUTPCGMMerger::Finalize1(int nBlocks, int nThreads, int iBlock, int
     if (!trk.OK() || trk.NClusters() == 0) {
       continue;
     }
-    unsigned char goodLeg = mClusters[trk.FirstClusterRef() + trk.NClusters() - 1].leg;
+    const unsigned int firstRef = trk.FirstClusterRef();
+    const unsigned char goodLeg = mClusters[firstRef + trk.NClusters() - 1].leg;
+    const unsigned int weightBase = mTrackOrderAttach[i] | attachAttached;
     for (unsigned int j = 0; j < trk.NClusters(); j++) {
-      int id = mClusters[trk.FirstClusterRef() + j].num;
-      unsigned int weight = mTrackOrderAttach[i] | attachAttached;
-      unsigned char clusterState = mClusters[trk.FirstClusterRef() + j].state;
-      if (!(clusterState & GPUTPCGMMergedTrackHit::flagReject)) {
+      const GPUTPCGMMergedTrackHit& hit = mClusters[firstRef + j]; // load the hit once instead of re-reading num/state/leg from global memory
+      unsigned int weight = weightBase;
+      if (!(hit.state & GPUTPCGMMergedTrackHit::flagReject)) {
         weight |= attachGood;
-      } else if (clusterState & GPUTPCGMMergedTrackHit::flagNotFit) {
+      } else if (hit.state & GPUTPCGMMergedTrackHit::flagNotFit) {
         weight |= attachHighIncl;
       }
-      if (mClusters[trk.FirstClusterRef() + j].leg == goodLeg) {
+      if (hit.leg == goodLeg) {
         weight |= attachGoodLeg;
       }
-      CAMath::AtomicMax(&mClusterAttachment[id], weight);
+      CAMath::AtomicMax(&mClusterAttachment[hit.num], weight);
     }
   }
 }
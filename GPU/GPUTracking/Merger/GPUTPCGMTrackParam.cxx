@@ -80,7 +80,11 @@ GPUd() bool GPUTPCGMTrackParam::Fit(GPUTPCGMMerger* GPUrestrict() merger, int iT
     }
   }
 
-  const int nWays = param.rec.tpc.nWays;
+  // Seed-quality triage: the q/pt estimated during the slice tracking serves as cheap classifier, soft debris
+  // tracks above the threshold get a reduced fast fit, the full multi-pass fit is reserved for the tracks above
+  // the corresponding pt. A failed reduced fit is retried with the full fit via the retryRefit mechanism.
+  const bool fastFit = param.rec.tpc.trackFitTriageQPtB5 > 0.f && attempt == 0 && CAMath::Abs(mP[4]) * param.qptB5Scaler > param.rec.tpc.trackFitTriageQPtB5;
+  const int nWays = fastFit ? ((param.rec.tpc.nWaysOuter && outerParam) ? CAMath::Min(2, (int)param.rec.tpc.nWays) : 1) : param.rec.tpc.nWays;
   const int maxN = N;
   int ihitStart = 0;
   float covYYUpd = 0.f;
@@ -113,8 +117,8 @@ GPUd() bool GPUTPCGMTrackParam::Fit(GPUTPCGMMerger* GPUrestrict() merger, int iT
     ResetCovariance();
     prop.SetSeedingErrors(!(refit && attempt == 0));
     prop.SetFitInProjections(param.rec.fitInProjections == -1 ? (iWay != 0) : param.rec.fitInProjections);
-    prop.SetPropagateBzOnly(param.rec.fitPropagateBzOnly > iWay);
-    prop.SetMatLUT((param.rec.useMatLUT && iWay == nWays - 1) ? merger->GetConstantMem()->calibObjects.matLUT : nullptr);
+    prop.SetPropagateBzOnly(fastFit || param.rec.fitPropagateBzOnly > iWay);
+    prop.SetMatLUT((param.rec.useMatLUT && !fastFit && iWay == nWays - 1) ? merger->GetConstantMem()->calibObjects.matLUT : nullptr);
     prop.SetTrack(this, iWay ? prop.GetAlpha() : Alpha);
     ConstrainSinPhi(prop.GetFitInProjections() ? 0.95f : GPUCA_MAX_SIN_PHI_LOW);
     CADEBUG(printf("Fitting track %d way %d (sector %d, alpha %f)\n", iTrk, iWay, CAMath::Float2IntRn(prop.GetAlpha() / kSectAngle) + (mP[1] < 0 ? 18 : 0), prop.GetAlpha()));
@@ -298,6 +302,8 @@ GPUd() bool GPUTPCGMTrackParam::Fit(GPUTPCGMMerger* GPUrestrict() merger, int iT
       CADEBUG(printf("\n"));
 
       int retVal;
+      ClusterNative clNative; // register copy of the cluster charge / time data, loaded once for the update and reused by the dE/dx accumulation
+      bool clNativeValid = false;
       float threshold = 3.f + (lastUpdateX >= 0 ? (CAMath::Abs(mX - lastUpdateX) / 2) : 0.f);
       if (mNDF > 5 && (CAMath::Abs(yy - mP[0]) > threshold || CAMath::Abs(zz - mP[1]) > threshold)) {
         retVal = GPUTPCGMPropagator::updateErrorClusterRejected;
@@ -326,9 +332,14 @@ GPUd() bool GPUTPCGMTrackParam::Fit(GPUTPCGMMerger* GPUrestrict() merger, int iT
         if (merger->Param().rec.tpc.rejectEdgeClustersInTrackFit && uncorrectedY > -1e6f && merger->Param().rejectEdgeClusterByY(uncorrectedY, cluster.row, CAMath::Sqrt(mC[0]))) { // uncorrectedY > -1e6f implies allowModification
           retVal = GPUTPCGMPropagator::updateErrorEdgeCluster;
         } else {
-          const float time = merger->GetConstantMem()->ioPtrs.clustersNative ? merger->GetConstantMem()->ioPtrs.clustersNative->clustersLinear[cluster.num].getTime() : -1.f;
-          const float invSqrtCharge = merger->GetConstantMem()->ioPtrs.clustersNative ? CAMath::InvSqrt(merger->GetConstantMem()->ioPtrs.clustersNative->clustersLinear[cluster.num].qMax) : 0.f;
-          const float invCharge = merger->GetConstantMem()->ioPtrs.clustersNative ? (1.f / merger->GetConstantMem()->ioPtrs.clustersNative->clustersLinear[cluster.num].qMax) : 0.f;
+          float time = -1.f, invSqrtCharge = 0.f, invCharge = 0.f;
+          if (merger->GetConstantMem()->ioPtrs.clustersNative) {
+            clNative = merger->GetConstantMem()->ioPtrs.clustersNative->clustersLinear[cluster.num];
+            clNativeValid = true;
+            time = clNative.getTime();
+            invSqrtCharge = CAMath::InvSqrt(clNative.qMax);
+            invCharge = 1.f / clNative.qMax;
+          }
           float invAvgCharge = (sumInvSqrtCharge += invSqrtCharge) / ++nAvgCharge;
           invAvgCharge *= invAvgCharge;
           retVal = prop.Update(yy, zz, cluster.row, param, clusterState, rejectChi2, &interpolation.hit[ihit], refit, cluster.slice, time, invAvgCharge, invCharge GPUCA_DEBUG_STREAMER_CHECK(, &debugVals));
@@ -363,22 +374,17 @@ GPUd() bool GPUTPCGMTrackParam::Fit(GPUTPCGMMerger* GPUrestrict() merger, int iT
           prop.SetTrack(this, prop.GetAlpha());
         }
         if (merger->Param().par.dodEdx && iWay == nWays - 1 && cluster.leg == clusters[maxN - 1].leg && !(clusterState & GPUTPCGMMergedTrackHit::flagEdge)) {
-          float qtot = 0, qmax = 0, pad = 0, relTime = 0;
-          const int clusterCount = (ihit - ihitMergeFirst) * wayDirection + 1;
-          for (int iTmp = ihitMergeFirst; iTmp != ihit + wayDirection; iTmp += wayDirection) {
-            if (merger->GetConstantMem()->ioPtrs.clustersNative == nullptr) {
-              qtot += clustersXYZ[ihit].amp;
-            } else {
-              const ClusterNative& cl = merger->GetConstantMem()->ioPtrs.clustersNative->clustersLinear[cluster.num];
-              qtot += cl.qTot;
-              qmax = CAMath::Max<float>(qmax, cl.qMax);
-              pad += cl.getPad();
-              relTime += cl.getTime();
-            }
+          float qtot, qmax, pad, relTime;
+          if (clNativeValid) {
+            // the charge and time were already loaded for the track update, carry them in registers instead of re-reading the cluster from global memory
+            qtot = clNative.qTot;
+            qmax = clNative.qMax;
+            pad = clNative.getPad();
+            relTime = clNative.getTime();
+          } else {
+            qtot = clustersXYZ[ihit].amp;
+            qmax = pad = relTime = 0;
           }
-          qtot /= clusterCount;
-          pad /= clusterCount;
-          relTime /= clusterCount;
           relTime = relTime - CAMath::Round(relTime);
           dEdx.fillCluster(qtot, qmax, cluster.row, cluster.slice, mP[2], mP[3], param, merger->GetConstantMem()->calibObjects, zz, pad, relTime);
         }
@@ -0,0 +1,63 @@
+#!/usr/bin/env python3
+# Compare a per-kernel timing JSON produced by the standalone benchmark
+# (--timingJsonFile, requires --debug 1) against a stored baseline and
+# report kernels / reco steps that regressed beyond a relative tolerance.
+#
+# Usage: checkTimingRegression.py baseline.json current.json [--tolerance 0.05] [--min-time-us 100]
+# Exit code is non-zero if any regression above tolerance was found.
+
+import argparse
+import json
+import sys
+
+
+def load(filename, key):
+    with open(filename) as f:
+        data = json.load(f)
+    return data, {entry["name"]: entry["timeUS"] for entry in data[key]}
+
+
+def compare(baseline, current, what, tolerance, mintime):
+    regressions = 0
+    for name, base in sorted(baseline.items()):
+        if name not in current or base < mintime:
+            continue
+        cur = current[name]
+        rel = (cur - base) / base if base > 0 else 0.0
+        if rel > tolerance:
+            print(f"REGRESSION {what} {name}: {base:.0f} us -> {cur:.0f} us ({rel * 100.0:+.1f}%)")
+            regressions += 1
+        elif rel < -tolerance:
+            print(f"improved   {what} {name}: {base:.0f} us -> {cur:.0f} us ({rel * 100.0:+.1f}%)")
+    return regressions
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Check per-kernel timing regressions against a baseline")
+    parser.add_argument("baseline")
+    parser.add_argument("current")
+    parser.add_argument("--tolerance", type=float, default=0.05, help="relative tolerance (default 0.05)")
+    parser.add_argument("--min-time-us", type=float, default=100.0, help="ignore tasks below this baseline time (default 100 us)")
+    args = parser.parse_args()
+
+    baseData, baseTasks = load(args.baseline, "tasks")
+    curData, curTasks = load(args.current, "tasks")
+    baseSteps = {entry["name"]: entry["timeUS"] for entry in baseData["steps"]}
+    curSteps = {entry["name"]: entry["timeUS"] for entry in curData["steps"]}
+
+    regressions = compare(baseTasks, curTasks, "task", args.tolerance, args.min_time_us)
+    regressions += compare(baseSteps, curSteps, "step", args.tolerance, args.min_time_us)
+
+    for total in ("totalKernelTimeUS", "totalWallTimeUS"):
+        base, cur = baseData[total], curData[total]
+        rel = (cur - base) / base if base > 0 else 0.0
+        marker = "REGRESSION" if rel > args.tolerance else "ok        "
+        print(f"{marker} {total}: {base:.0f} us -> {cur:.0f} us ({rel * 100.0:+.1f}%)")
+        if rel > args.tolerance:
+            regressions += 1
+
+    return 1 if regressions else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
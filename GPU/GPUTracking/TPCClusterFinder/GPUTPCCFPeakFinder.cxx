@@ -40,10 +40,29 @@ GPUdii() bool GPUTPCCFPeakFinder::isPeak(
   ChargePos* posBcast,
   PackedCharge* buf)
 {
-  ushort ll = get_local_id(0);
-
   bool belowThreshold = (q <= calib.tpc.cfQMaxCutoff);
 
+#if !defined(GPUCA_GPUCODE)
+  // On the CPU there is no shared memory to stage neighbors in, so the
+  // cooperative partition/blockLoad sequence below is pure overhead. Read the
+  // eight inner neighbors directly instead; the comparisons are identical, so
+  // the result is bit-exact, and the simple loop autovectorizes.
+  if (belowThreshold) {
+    return false;
+  }
+
+  q = PackedCharge(q).unpack();
+
+  bool peak = true;
+  for (ushort i = 0; i < N; i++) {
+    Charge other = chargeMap[pos.delta(cfconsts::InnerNeighbors[i])].unpack();
+    peak = peak && ((i < N / 2) ? (other <= q) : (other < q));
+  }
+
+  return peak;
+#else
+  ushort ll = get_local_id(0);
+
   ushort lookForPeaks;
   ushort partId = CfUtils::partition<SCRATCH_PAD_WORK_GROUP_SIZE>(
     smem,
@@ -88,6 +107,7 @@ GPUdii() bool GPUTPCCFPeakFinder::isPeak(
   peak = peak && buf[idx + 7].unpack() < q;
 
   return peak;
+#endif
 }
 
 GPUd() void GPUTPCCFPeakFinder::findPeaksImpl(int nBlocks, int nThreads, int iBlock, int iThread, GPUSharedMemory& smem,
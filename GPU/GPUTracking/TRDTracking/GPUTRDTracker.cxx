@@ -36,6 +36,7 @@ class GPUTPCGMPolynomialField;
 #ifdef WITH_OPENMP
 #include <omp.h>
 #endif // WITH_OPENMP
+#include <algorithm>
 #include <chrono>
 #include <vector>
 #ifdef GPUCA_ALIROOT_LIB
@@ -98,11 +99,12 @@ void* GPUTRDTracker_t<TRDTRK, PROP>::SetPointersTracks(void* base)
   //--------------------------------------------------------------------
   computePointerWithAlignment(base, mTracks, mNMaxTracks);
   computePointerWithAlignment(base, mTrackAttribs, mNMaxTracks);
+  computePointerWithAlignment(base, mTrackOrder, mNMaxTracks);
   return base;
 }
 
 template <class TRDTRK, class PROP>
-GPUTRDTracker_t<TRDTRK, PROP>::GPUTRDTracker_t() : mR(nullptr), mIsInitialized(false), mGenerateSpacePoints(false), mProcessPerTimeFrame(false), mNAngleHistogramBins(25), mAngleHistogramRange(50), mMemoryPermanent(-1), mMemoryTracklets(-1), mMemoryTracks(-1), mNMaxCollisions(0), mNMaxTracks(0), mNMaxSpacePoints(0), mTracks(nullptr), mTrackAttribs(nullptr), mNCandidates(1), mNTracks(0), mNEvents(0), mMaxThreads(100), mTrackletIndexArray(nullptr), mHypothesis(nullptr), mCandidates(nullptr), mSpacePoints(nullptr), mGeo(nullptr), mRPhiA2(0), mRPhiB(0), mRPhiC2(0), mDyA2(0), mDyB(0), mDyC2(0), mAngleToDyA(0), mAngleToDyB(0), mAngleToDyC(0), mDebugOutput(false), mMaxEta(0.84f), mRoadZ(18.f), mZCorrCoefNRC(1.4f), mTPCVdrift(2.58f), mTPCTDriftOffset(0.f), mDebug(new GPUTRDTrackerDebug<TRDTRK>())
+GPUTRDTracker_t<TRDTRK, PROP>::GPUTRDTracker_t() : mR(nullptr), mIsInitialized(false), mGenerateSpacePoints(false), mProcessPerTimeFrame(false), mNAngleHistogramBins(25), mAngleHistogramRange(50), mMemoryPermanent(-1), mMemoryTracklets(-1), mMemoryTracks(-1), mNMaxCollisions(0), mNMaxTracks(0), mNMaxSpacePoints(0), mTracks(nullptr), mTrackAttribs(nullptr), mTrackOrder(nullptr), mNCandidates(1), mNTracks(0), mNEvents(0), mMaxThreads(100), mTrackletIndexArray(nullptr), mHypothesis(nullptr), mCandidates(nullptr), mSpacePoints(nullptr), mGeo(nullptr), mRPhiA2(0), mRPhiB(0), mRPhiC2(0), mDyA2(0), mDyB(0), mDyC2(0), mAngleToDyA(0), mAngleToDyB(0), mAngleToDyC(0), mDebugOutput(false), mMaxEta(0.84f), mRoadZ(18.f), mZCorrCoefNRC(1.4f), mTPCVdrift(2.58f), mTPCTDriftOffset(0.f), mDebug(new GPUTRDTrackerDebug<TRDTRK>())
 {
   //--------------------------------------------------------------------
   // Default constructor
@@ -249,6 +251,19 @@ void GPUTRDTracker_t<TRDTRK, PROP>::PrepareTracking(GPUChainTracking* chainTrack
   if (mGenerateSpacePoints) {
     chainTracking->mIOPtrs.trdSpacePoints = mSpacePoints;
   }
+  // sort the track processing order by transverse momentum:
+  // the width of the tracklet search road and with it the number of hypotheses
+  // spawned per layer scales with 1/pt, so grouping tracks of similar pt lets
+  // the threads of a GPU warp (and the chunks of the OpenMP loop on the CPU)
+  // work on similar candidate counts instead of diverging on the input order
+  for (int iTrk = 0; iTrk < mNTracks; ++iTrk) {
+    mTrackOrder[iTrk] = iTrk;
+  }
+  std::sort(mTrackOrder, mTrackOrder + mNTracks, [this](int lhs, int rhs) {
+    float ptLhs = mTracks[lhs].getPt();
+    float ptRhs = mTracks[rhs].getPt();
+    return (ptLhs != ptRhs) ? ptLhs < ptRhs : lhs < rhs;
+  });
   mNEvents++;
 }
 
@@ -391,6 +406,7 @@ GPUd() void GPUTRDTracker_t<TRDTRK, PROP>::DoTrackingThread(int iTrk, int thread
   //--------------------------------------------------------------------
   // perform the tracking for one track (must be threadsafe)
   //--------------------------------------------------------------------
+  iTrk = mTrackOrder[iTrk];   // remap to the pt-sorted processing order to reduce the workload imbalance between neighbouring threads
   int collisionIds[20] = {0}; // due to the dead time there will never exist more possible TRD triggers for a single track
   int nCollisionIds = 1;      // initialize with 1 for AliRoot compatibility
   if (mProcessPerTimeFrame) {
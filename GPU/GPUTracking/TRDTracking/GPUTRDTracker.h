@@ -172,6 +172,7 @@ class GPUTRDTracker_t : public GPUProcessor
   int mNMaxSpacePoints;                    // max number of space points hold by the tracker (per event)
   TRDTRK* mTracks;                         // array of trd-updated tracks
   HelperTrackAttributes* mTrackAttribs;    // array with additional (transient) track attributes
+  int* mTrackOrder;                        // processing order of the input tracks, grouping tracks with similar expected workload (filled in PrepareTracking)
   int mNCandidates;                        // max. track hypothesis per layer
   int mNTracks;                            // number of TPC tracks to be matched
   int mNEvents;                            // number of processed events
@@ -750,7 +750,27 @@ void GPURecoWorkflowSpec::run(ProcessingContext& pc)
   };
 
   setOutputAllocator("COMPCLUSTERSFLAT", mSpecConfig.outputCompClustersFlat, outputRegions.compressedClusters, std::make_tuple(gDataOriginTPC, (DataDescription) "COMPCLUSTERSFLAT", 0));
-  setOutputAllocator("CLUSTERNATIVE", mClusterOutputIds.size() > 0, outputRegions.clustersNative, std::make_tuple(gDataOriginTPC, mSpecConfig.sendClustersPerSector ? (DataDescription) "CLUSTERNATIVETMP" : (DataDescription) "CLUSTERNATIVE", NSectors, clusterOutputSectorHeader), sizeof(o2::tpc::ClusterCountIndex));
+  std::vector<outputDataType> clusterNativeStagingBuffer;
+  if (mClusterOutputIds.size() > 0 && mSpecConfig.sendClustersPerSector) {
+    // Per-sector shipping copies the clusters into per-sector messages below anyway,
+    // so stage the contiguous GPU output in a plain host buffer instead of writing it
+    // to a full-size shm message that would only be discarded afterwards.
+    auto& buffer = outputBuffers[outputRegions.getIndex(outputRegions.clustersNative)];
+    if (mConfParam->allocateOutputOnTheFly) {
+      outputRegions.clustersNative.allocator = [&clusterNativeStagingBuffer, &buffer](size_t size) -> void* {
+        clusterNativeStagingBuffer.resize(size + sizeof(o2::tpc::ClusterCountIndex));
+        buffer.second = clusterNativeStagingBuffer.data();
+        return clusterNativeStagingBuffer.data() + sizeof(o2::tpc::ClusterCountIndex);
+      };
+    } else {
+      clusterNativeStagingBuffer.resize(mConfParam->outputBufferSize);
+      buffer.second = clusterNativeStagingBuffer.data();
+      outputRegions.clustersNative.ptrBase = clusterNativeStagingBuffer.data() + sizeof(o2::tpc::ClusterCountIndex);
+      outputRegions.clustersNative.size = clusterNativeStagingBuffer.size() - sizeof(o2::tpc::ClusterCountIndex);
+    }
+  } else {
+    setOutputAllocator("CLUSTERNATIVE", mClusterOutputIds.size() > 0, outputRegions.clustersNative, std::make_tuple(gDataOriginTPC, (DataDescription) "CLUSTERNATIVE", NSectors, clusterOutputSectorHeader), sizeof(o2::tpc::ClusterCountIndex));
+  }
   setOutputAllocator("CLSHAREDMAP", mSpecConfig.outputSharedClusterMap, outputRegions.sharedClusterMap, std::make_tuple(gDataOriginTPC, (DataDescription) "CLSHAREDMAP", 0));
   setOutputAllocator("TPCOCCUPANCYMAP", mSpecConfig.outputSharedClusterMap, outputRegions.tpcOccupancyMap, std::make_tuple(gDataOriginTPC, (DataDescription) "TPCOCCUPANCYMAP", 0));
   setOutputAllocator("TRACKS", mSpecConfig.outputTracks, outputRegions.tpcTracksO2, std::make_tuple(gDataOriginTPC, (DataDescription) "TRACKS", 0));
@@ -1205,7 +1225,6 @@ Outputs GPURecoWorkflowSpec::outputs()
       mClusterOutputIds.emplace_back(sector);
     }
     if (mSpecConfig.sendClustersPerSector) {
-      outputSpecs.emplace_back(gDataOriginTPC, "CLUSTERNATIVETMP", NSectors, Lifetime::Timeframe); // Dummy buffer the TPC tracker writes the inital linear clusters to
       for (const auto sector : mTPCSectors) {
         outputSpecs.emplace_back(gDataOriginTPC, "CLUSTERNATIVE", sector, Lifetime::Timeframe);
       }
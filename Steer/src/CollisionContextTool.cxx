@@ -53,6 +53,7 @@ struct Options {
   bool genVertices = false;         // whether to assign vertices to collisions
   std::string configKeyValues = ""; // string to init config key values
   long timestamp = -1;              // timestamp for CCDB queries
+  std::string fromExisting = "";    // reuse the collision structure of an existing context, rebased to this timeframe slot
 };
 
 enum class InteractionLockMode {
@@ -198,6 +199,10 @@ bool parseOptions(int argc, char* argv[], Options& optvalues)
     "timeframeID", bpo::value<int>(&optvalues.tfid)->default_value(0), "Timeframe id of the first timeframe int this context. Allows to generate contexts for different start orbits")(
     "first-orbit", bpo::value<uint32_t>(&optvalues.firstOrbit)->default_value(0), "First orbit in the run (HBFUtils.firstOrbit)")(
     "maxCollsPerTF", bpo::value<int>(&optvalues.maxCollsPerTF)->default_value(-1), "Maximal number of MC collisions to put into one timeframe. By default no constraint.")(
+    "from-existing", bpo::value<std::string>(&optvalues.fromExisting)->default_value(""),
+    "Take the collision structure from an existing context file instead of sampling it; "
+    "the context is merely rebased to the orbit of the given timeframeID/first-orbit. "
+    "Allows to produce the context once per campaign and reuse it in all jobs.")(
     "noEmptyTF", bpo::bool_switch(&optvalues.noEmptyTF), "Enforce to have at least one collision")("configKeyValues", bpo::value<std::string>(&optvalues.configKeyValues)->default_value(""), "Semicolon separated key=value strings (e.g.: 'TPC.gasDensity=1;...')")("with-vertices", "Assign vertices to collisions.")("timestamp", bpo::value<long>(&optvalues.timestamp)->default_value(-1L), "Timestamp for CCDB queries / anchoring");
 
   options.add_options()("help,h", "Produce help message.");
@@ -243,6 +248,24 @@ int main(int argc, char* argv[])
   // init random generator
   gRandom->SetSeed(options.seed);
 
+  if (!options.fromExisting.empty()) {
+    // the expensive sampling (kinematics lookup, interaction sampling, vertex assignment)
+    // was already done when the referenced context was produced; this job only relocates
+    // the collision structure to its own timeframe slot
+    auto context = o2::steer::DigitizationContext::loadFromFile(options.fromExisting);
+    if (!context) {
+      LOG(error) << "Could not read collision context from " << options.fromExisting;
+      exit(1);
+    }
+    context->rebaseOrbits(options.firstOrbit + options.tfid * options.orbitsPerTF);
+    context->finalizeTimeframeStructure(options.tfid * options.orbitsPerTF, options.orbitsPerTF);
+    if (options.printContext) {
+      context->printCollisionSummary(context->isQEDProvided());
+    }
+    context->saveToFile(options.outfilename);
+    return 0;
+  }
+
   std::vector<InteractionSpec> ispecs;
   // building the interaction spec
   for (auto& i : options.interactionRates) {
@@ -417,6 +440,9 @@ int main(int argc, char* argv[])
   }
   digicontext.setNCollisions(collisions.size());
   digicontext.setMaxNumberParts(maxParts);
+  // record the orbit the sampling was based on; needed to rebase the context
+  // when it is reused for a different timeframe slot
+  digicontext.setFirstOrbitForSampling(options.firstOrbit + options.tfid * options.orbitsPerTF);
   // merge bunch filling info
   for (int i = 1; i < bunchFillings.size(); ++i) {
     bunchFillings[0].mergeWith(bunchFillings[i]);
@@ -70,9 +70,9 @@ void MCKinematicsReader::loadTracksForSourceAndEvent(int source, int event) cons
       std::vector<MCTrack>* loadtracks = nullptr;
       br->SetAddress(&loadtracks);
       br->GetEntry(event);
-      mTracks[source][event] = new std::vector<o2::MCTrack>;
-      *mTracks[source][event] = *loadtracks;
-      delete loadtracks;
+      br->ResetAddress();
+      // adopt the deserialized vector directly instead of deep-copying it
+      mTracks[source][event] = loadtracks;
     }
   }
 }
@@ -180,11 +180,17 @@ bool O2MCApplicationBase::MisalignGeometry()
 
   // apply alignment for included detectors AFTER exporting ideal geometry
   auto& aligner = o2::base::Aligner::Instance();
-  aligner.applyAlignment(confref.getTimestamp());
-
-  // export aligned geometry into different file
   auto alignedgeomfile = o2::base::NameConf::getAlignedGeomFileName(confref.getOutPrefix());
-  gGeoManager->Export(alignedgeomfile.c_str());
+  if (aligner.isAlignmentRequested()) {
+    aligner.applyAlignment(confref.getTimestamp());
+
+    // export aligned geometry into different file
+    gGeoManager->Export(alignedgeomfile.c_str());
+  } else {
+    // without alignment the aligned geometry is identical to the ideal one,
+    // so copy the file just exported instead of running a second TGeo export
+    std::filesystem::copy_file(geomfile, alignedgeomfile, std::filesystem::copy_options::overwrite_existing);
+  }
 
   // return original return value of misalignment procedure
   return true;
@@ -0,0 +1,148 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+/* Local Variables:  */
+/* mode: c++         */
+/* End:              */
+
+#ifndef STATICHUFFMANCODEC_H
+#define STATICHUFFMANCODEC_H
+
+/// @file   StaticHuffmanCodec.h
+/// @author Matthias Richter
+/// @since  2026-09-01
+/// @brief  Huffman encoding from compile time generated code tables
+
+#include <cstdint>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace o2
+{
+namespace data_compression
+{
+
+/**
+ * @class CodecStaticHuffman
+ * @brief Huffman encoder operating on a compile time constant code table
+ *
+ * For distributions which are stable over runs, the Huffman table does not
+ * need to be built from the probability model at runtime; it can be generated
+ * once from a recorded snapshot with generateHuffmanTableSource and compiled
+ * in. The encoding step is then a plain array lookup without tree walk and
+ * without data dependent branches.
+ *
+ * The class implements the codec concept of the DataDeflater (see
+ * CodecIdentity) and can be used as its second template parameter. The table
+ * type is expected to provide:
+ *   static constexpr int64_t MinSymbol;          // symbol mapped to index 0
+ *   static constexpr std::size_t Size;           // number of symbols
+ *   static constexpr std::size_t MaxCodeLength;  // longest code in bits
+ *   static constexpr uint64_t Codes[Size];       // codes, valid LSBs
+ *   static constexpr uint8_t Lengths[Size];      // code lengths in bits
+ */
+template <typename TableT>
+class CodecStaticHuffman
+{
+ public:
+  using table_type = TableT;
+  using code_type = uint64_t;
+  static const std::size_t sMaxLength = TableT::MaxCodeLength;
+
+  CodecStaticHuffman() = default;
+  ~CodecStaticHuffman() = default;
+
+  template <typename ValueType, typename WriterType>
+  int write(ValueType v, WriterType writer)
+  {
+    const auto index = static_cast<int64_t>(v) - TableT::MinSymbol;
+    if (index < 0 || index >= static_cast<int64_t>(TableT::Size) || TableT::Lengths[index] == 0) {
+      // a zero length indicates a symbol which was not part of the recorded
+      // probability snapshot the table was generated from
+      std::string msg = "symbol ";
+      msg += std::to_string(v);
+      msg += " not covered by the static Huffman table";
+      throw std::range_error(msg);
+    }
+    return writer(TableT::Codes[index], TableT::Lengths[index]);
+  }
+};
+
+/**
+ * @brief Generate C++ source of the code table of a trained Huffman model
+ *
+ * Writes a struct definition fulfilling the table concept of
+ * CodecStaticHuffman to the output stream. The model must have assigned
+ * codes, i.e. GenerateHuffmanTree has been called or a configuration was
+ * loaded. Symbols of the alphabet which have no code assigned get zero
+ * length entries and are rejected by the codec at encoding time.
+ *
+ * The emitted struct is meant to be placed in a header of the package using
+ * it, next to the recorded probability snapshot it was generated from.
+ *
+ * @return number of symbols with a valid code, -1 on error
+ */
+template <typename ModelT>
+int generateHuffmanTableSource(std::ostream& out, const std::string& tableName, const ModelT& model)
+{
+  typename ModelT::alphabet_type alphabet;
+  const std::size_t size = alphabet.getIndexRange() + 1;
+  std::vector<uint64_t> codes(size, 0);
+  std::vector<uint16_t> lengths(size, 0);
+  std::size_t maxLength = 0;
+  int validCodes = 0;
+  for (auto symbol : alphabet) {
+    uint16_t codeLength = 0;
+    auto code = model.Encode(symbol, codeLength);
+    if (codeLength == 0) {
+      continue;
+    }
+    if (codeLength > 64 || codeLength > code.size()) {
+      std::cerr << "code length " << codeLength << " of symbol " << symbol
+                << " exceeds the 64 bit table representation" << std::endl;
+      return -1;
+    }
+    auto index = ModelT::alphabet_type::getIndex(symbol);
+    codes[index] = code.to_ullong();
+    lengths[index] = codeLength;
+    if (maxLength < codeLength) {
+      maxLength = codeLength;
+    }
+    ++validCodes;
+  }
+
+  out << "// Huffman code table '" << tableName << "' generated from a recorded" << std::endl;
+  out << "// probability snapshot of alphabet '" << alphabet.getName() << "', do not edit" << std::endl;
+  out << "struct " << tableName << " {" << std::endl;
+  out << "  static constexpr int64_t MinSymbol = " << static_cast<int64_t>(ModelT::alphabet_type::getSymbol(0)) << ";" << std::endl;
+  out << "  static constexpr std::size_t Size = " << size << ";" << std::endl;
+  out << "  static constexpr std::size_t MaxCodeLength = " << maxLength << ";" << std::endl;
+  out << "  static constexpr uint64_t Codes[" << size << "] = {";
+  for (std::size_t i = 0; i < size; i++) {
+    out << (i > 0 ? ", " : "") << "0x" << std::hex << codes[i] << std::dec;
+  }
+  out << "};" << std::endl;
+  out << "  static constexpr uint8_t Lengths[" << size << "] = {";
+  for (std::size_t i = 0; i < size; i++) {
+    out << (i > 0 ? ", " : "") << lengths[i];
+  }
+  out << "};" << std::endl;
+  out << "};" << std::endl;
+
+  return validCodes;
+}
+
+} // namespace data_compression
+} // namespace o2
+
+#endif
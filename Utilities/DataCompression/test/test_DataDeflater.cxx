@@ -38,6 +38,7 @@
 #include <thread>
 #include <stdexcept> // exeptions, runtime_error
 #include "../include/DataCompression/DataDeflater.h"
+#include "../include/DataCompression/StaticHuffmanCodec.h"
 #include "../include/DataCompression/TruncatedPrecisionConverter.h"
 #include "DataGenerator.h"
 #include "Fifo.h"
@@ -132,6 +133,45 @@ BOOST_AUTO_TEST_CASE(test_DataDeflaterCodec)
   compare(data, bitwidth, targetBuffer);
 }
 
+// a code table as generateHuffmanTableSource would emit it, see
+// StaticHuffmanCodec.h for the concept
+struct TestHuffmanTable {
+  static constexpr int64_t MinSymbol = 0;
+  static constexpr std::size_t Size = 4;
+  static constexpr std::size_t MaxCodeLength = 3;
+  static constexpr uint64_t Codes[4] = {0x0, 0x2, 0x6, 0x7};
+  static constexpr uint8_t Lengths[4] = {1, 2, 3, 3};
+};
+
+BOOST_AUTO_TEST_CASE(test_DataDeflaterStaticHuffman)
+{
+  using Codec = o2dc::CodecStaticHuffman<TestHuffmanTable>;
+  using TestDataDeflater = o2dc::DataDeflater<uint8_t, Codec>;
+  using target_type = TestDataDeflater::target_type;
+  TestDataDeflater deflater;
+
+  std::vector<target_type> targetBuffer;
+  auto writerfct = [&](const target_type& value) -> bool {
+    targetBuffer.emplace_back(value);
+    return true;
+  };
+
+  std::array<uint8_t, 8> data = {0, 1, 2, 3, 3, 2, 1, 0};
+  for (auto c : data) {
+    deflater.write(c, writerfct);
+  }
+  // symbols outside of the table must be refused
+  BOOST_CHECK_THROW(deflater.write(static_cast<uint8_t>(7), writerfct), std::range_error);
+  deflater.close(writerfct);
+
+  // expected bit sequence: 0 10 110 111 111 110 10 0, MSB first in every byte
+  const std::vector<target_type> expected = {0x5b, 0xfd, 0x00};
+  BOOST_REQUIRE(targetBuffer.size() == expected.size());
+  for (std::size_t i = 0; i < expected.size(); i++) {
+    BOOST_CHECK_EQUAL(targetBuffer[i], expected[i]);
+  }
+}
+
 // define a simple parameter model to mask a data value
 template <int NBits>
 class ParameterModelBitMask
@@ -28,6 +28,7 @@
 #include <stdexcept> // exeptions, runtime_error
 #include "../include/DataCompression/dc_primitives.h"
 #include "../include/DataCompression/HuffmanCodec.h"
+#include "../include/DataCompression/StaticHuffmanCodec.h"
 #include "CommonUtils/StringUtils.h"
 #include "DataGenerator.h"
 #include "Fifo.h"
@@ -226,5 +227,19 @@ BOOST_AUTO_TEST_CASE(test_HuffmanCodec_configuration)
   checkRandom(codec, dg);
 }
 
+BOOST_AUTO_TEST_CASE(test_HuffmanCodec_statictable)
+{
+  auto setup = setupCodec();
+  auto const& huffmanmodel = setup.first.getCodingModel();
+
+  std::stringstream tableSource;
+  auto validCodes = generateHuffmanTableSource(tableSource, "TestTable", huffmanmodel);
+  // the alphabet [-7, 10] has 18 symbols, all with assigned codes
+  BOOST_CHECK_EQUAL(validCodes, 18);
+  BOOST_CHECK(tableSource.str().find("struct TestTable") != std::string::npos);
+  BOOST_CHECK(tableSource.str().find("MinSymbol = -7") != std::string::npos);
+  std::cout << tableSource.str();
+}
+
 } // namespace data_compression
 } // namespace o2
@@ -76,6 +76,12 @@ class DataSamplingPolicy
   const framework::OutputSpec* match(const framework::ConcreteDataMatcher& input) const;
   /// \brief Returns true if user-defined conditions of sampling are fulfilled.
   bool decide(const o2::framework::DataRef&);
+  /// \brief Scales down the effective sampling rate (0.0 - 1.0 of the nominal one).
+  ///
+  /// Used by the Dispatcher to throttle the sampled stream when downstream
+  /// consumers cannot keep up, without touching the configured conditions.
+  void setThrottling(double factor);
+  double getThrottling() const;
   /// \brief Returns Output for given InputSpec to pass data forward.
   framework::Output prepareOutput(const framework::ConcreteDataMatcher& input, framework::Lifetime lifetime = framework::Lifetime::Timeframe) const;
 
@@ -86,6 +92,7 @@ class DataSamplingPolicy
   std::string getFairMQOutputChannelName() const;
   uint32_t getTotalAcceptedMessages() const;
   uint32_t getTotalEvaluatedMessages() const;
+  uint32_t getTotalThrottledMessages() const;
   bool isActive() const;
 
   static header::DataOrigin createPolicyDataOrigin();
@@ -97,10 +104,13 @@ class DataSamplingPolicy
   PathMap mPaths;
   std::vector<std::unique_ptr<DataSamplingCondition>> mConditions;
   std::string mFairMQOutputChannel;
+  double mThrottlingFactor = 1.0;
+  double mThrottlingCredit = 0.0;
 
   // stats
   uint32_t mTotalAcceptedMessages = 0;
   uint32_t mTotalEvaluatedMessages = 0;
+  uint32_t mTotalThrottledMessages = 0;
 };
 
 } // namespace o2::utilities
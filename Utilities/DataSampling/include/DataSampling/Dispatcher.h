@@ -67,6 +67,7 @@ class Dispatcher : public framework::Task
   DataSamplingHeader prepareDataSamplingHeader(const DataSamplingPolicy& policy);
   header::Stack extractAdditionalHeaders(const char* inputHeaderStack) const;
   void reportStats(monitoring::Monitoring& monitoring) const;
+  void updateThrottling(framework::ProcessingContext& ctx);
   void send(framework::DataAllocator& dataAllocator, const framework::DataRef& inputData, const framework::Output& output) const;
 
   std::string mName;
@@ -74,6 +75,10 @@ class Dispatcher : public framework::Task
   std::string mReconfigurationSource;
   // policies should be shared between all pipeline threads
   std::vector<std::shared_ptr<DataSamplingPolicy>> mPolicies;
+  // adaptive throttling of the sampling rates based on the observed backpressure
+  bool mAdaptiveThrottling = false;
+  int mThrottlingPendingInputsThreshold = 4;
+  double mThrottlingFactor = 1.0;
 };
 
 } // namespace o2::utilities
@@ -23,6 +23,8 @@
 
 #include <boost/property_tree/ptree.hpp>
 
+#include <algorithm>
+
 using namespace o2::framework;
 
 namespace o2::utilities
@@ -119,12 +121,34 @@ bool DataSamplingPolicy::decide(const o2::framework::DataRef& dataRef)
                                 return condition->decide(dataRef);
                               });
 
+  if (decision && mThrottlingFactor < 1.0) {
+    // deterministic decimation - we let through mThrottlingFactor of the messages
+    // which the conditions accepted, evenly spread over time
+    mThrottlingCredit += mThrottlingFactor;
+    if (mThrottlingCredit >= 1.0) {
+      mThrottlingCredit -= 1.0;
+    } else {
+      decision = false;
+      mTotalThrottledMessages++;
+    }
+  }
+
   mTotalAcceptedMessages += decision;
   mTotalEvaluatedMessages++;
 
   return decision;
 }
 
+void DataSamplingPolicy::setThrottling(double factor)
+{
+  mThrottlingFactor = std::clamp(factor, 0.0, 1.0);
+}
+
+double DataSamplingPolicy::getThrottling() const
+{
+  return mThrottlingFactor;
+}
+
 Output DataSamplingPolicy::prepareOutput(const ConcreteDataMatcher& input, Lifetime lifetime) const
 {
   auto result = mPaths.find(input);
@@ -167,6 +191,10 @@ uint32_t DataSamplingPolicy::getTotalEvaluatedMessages() const
 {
   return mTotalEvaluatedMessages;
 }
+uint32_t DataSamplingPolicy::getTotalThrottledMessages() const
+{
+  return mTotalThrottledMessages;
+}
 
 bool DataSamplingPolicy::isActive() const
 {
@@ -26,6 +26,9 @@
 #include "Framework/FairMQDeviceProxy.h"
 #include "Framework/DataProcessingHelpers.h"
 #include "Framework/DataRelayer.h"
+#include "Framework/DataProcessingStats.h"
+
+#include <algorithm>
 
 #include <Configuration/ConfigurationInterface.h>
 #include <Configuration/ConfigurationFactory.h>
@@ -75,6 +78,9 @@ void Dispatcher::init(InitContext& ctx)
 
   auto& spec = ctx.services().get<const DeviceSpec>();
   mDeviceID.runtimeInit(spec.id.substr(0, DataSamplingHeader::deviceIDTypeSize).c_str());
+
+  mAdaptiveThrottling = ctx.options().get<bool>("adaptive-throttling");
+  mThrottlingPendingInputsThreshold = ctx.options().get<int>("throttling-pending-inputs-threshold");
 }
 
 void Dispatcher::run(ProcessingContext& ctx)
@@ -123,6 +129,9 @@ void Dispatcher::run(ProcessingContext& ctx)
   }
 
   if (ctx.inputs().isValid("timer-stats")) {
+    if (mAdaptiveThrottling) {
+      updateThrottling(ctx);
+    }
     reportStats(ctx.services().get<Monitoring>());
   }
   auto& relayer = ctx.services().get<DataRelayer>();
@@ -134,14 +143,44 @@ void Dispatcher::reportStats(Monitoring& monitoring) const
 {
   uint64_t dispatcherTotalEvaluatedMessages = 0;
   uint64_t dispatcherTotalAcceptedMessages = 0;
+  uint64_t dispatcherTotalThrottledMessages = 0;
 
   for (const auto& policy : mPolicies) {
     dispatcherTotalEvaluatedMessages += policy->getTotalEvaluatedMessages();
     dispatcherTotalAcceptedMessages += policy->getTotalAcceptedMessages();
+    dispatcherTotalThrottledMessages += policy->getTotalThrottledMessages();
   }
 
   monitoring.send(Metric{dispatcherTotalEvaluatedMessages, "Dispatcher_messages_evaluated", Verbosity::Prod}.addTag(tags::Key::Subsystem, tags::Value::DataSampling));
   monitoring.send(Metric{dispatcherTotalAcceptedMessages, "Dispatcher_messages_passed", Verbosity::Prod}.addTag(tags::Key::Subsystem, tags::Value::DataSampling));
+  monitoring.send(Metric{dispatcherTotalThrottledMessages, "Dispatcher_messages_throttled", Verbosity::Prod}.addTag(tags::Key::Subsystem, tags::Value::DataSampling));
+}
+
+void Dispatcher::updateThrottling(ProcessingContext& ctx)
+{
+  // AIMD control loop: when our input queue builds up, i.e. the sampled stream
+  // cannot be pushed downstream fast enough, the sampling rates are halved.
+  // Once the queue drains, they are additively restored to the nominal values.
+  const auto& stats = ctx.services().get<DataProcessingStats>();
+  const auto pendingInputs = stats.metrics[static_cast<short>(ProcessingStatsId::PENDING_INPUTS)];
+
+  constexpr double minThrottlingFactor = 1. / 1024;
+  double factor = mThrottlingFactor;
+  if (pendingInputs > mThrottlingPendingInputsThreshold) {
+    factor = std::max(0.5 * factor, minThrottlingFactor);
+  } else if (factor < 1.0) {
+    factor = std::min(factor + 0.1, 1.0);
+  }
+
+  if (factor != mThrottlingFactor) {
+    LOG(info) << "Changing the sampling throttling factor from " << mThrottlingFactor << " to " << factor
+              << " (pending inputs: " << pendingInputs << ")";
+    mThrottlingFactor = factor;
+    for (auto& policy : mPolicies) {
+      policy->setThrottling(factor);
+    }
+  }
+  ctx.services().get<Monitoring>().send(Metric{mThrottlingFactor, "Dispatcher_throttling_factor", Verbosity::Prod}.addTag(tags::Key::Subsystem, tags::Value::DataSampling));
 }
 
 DataSamplingHeader Dispatcher::prepareDataSamplingHeader(const DataSamplingPolicy& policy)
@@ -234,7 +273,9 @@ Outputs Dispatcher::getOutputSpecs()
 }
 framework::Options Dispatcher::getOptions()
 {
-  return {{"period-timer-stats", framework::VariantType::Int, 10 * 1000000, {"Dispatcher's stats timer period"}}};
+  return {{"period-timer-stats", framework::VariantType::Int, 10 * 1000000, {"Dispatcher's stats timer period"}},
+          {"adaptive-throttling", framework::VariantType::Bool, false, {"Adjust the sampling rates dynamically to the observed backpressure"}},
+          {"throttling-pending-inputs-threshold", framework::VariantType::Int, 4, {"Number of pending inputs above which the sampling rates are reduced"}}};
 }
 
 size_t Dispatcher::numberOfPolicies()
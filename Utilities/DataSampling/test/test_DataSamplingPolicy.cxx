@@ -139,3 +139,37 @@ BOOST_AUTO_TEST_CASE(DataSamplingPolicyStaticMethods)
   BOOST_CHECK(DataSamplingPolicy::createPolicyDataDescription("asdfasdfasdfasdf", 0) == DataDescription("asdfasdfasdfas0"));
   BOOST_CHECK(DataSamplingPolicy::createPolicyDataDescription("asdfasdfasdfasdf", 10) == DataDescription("asdfasdfasdfas10"));
 }
+
+BOOST_AUTO_TEST_CASE(DataSamplingPolicyThrottling)
+{
+  DataSamplingPolicy policy("my_policy");
+  DataRef dr{nullptr, nullptr, nullptr};
+
+  // with no conditions and no throttling everything is accepted
+  for (int i = 0; i < 10; i++) {
+    BOOST_CHECK(policy.decide(dr));
+  }
+  BOOST_CHECK_EQUAL(policy.getTotalAcceptedMessages(), 10);
+  BOOST_CHECK_EQUAL(policy.getTotalThrottledMessages(), 0);
+
+  // a throttling factor scales down the effective sampling rate
+  policy.setThrottling(0.25);
+  BOOST_CHECK_EQUAL(policy.getThrottling(), 0.25);
+  for (int i = 0; i < 100; i++) {
+    policy.decide(dr);
+  }
+  BOOST_CHECK_EQUAL(policy.getTotalAcceptedMessages(), 10 + 25);
+  BOOST_CHECK_EQUAL(policy.getTotalThrottledMessages(), 75);
+
+  // back to the nominal rate
+  policy.setThrottling(1.0);
+  for (int i = 0; i < 10; i++) {
+    BOOST_CHECK(policy.decide(dr));
+  }
+
+  // out-of-range factors are clamped
+  policy.setThrottling(1.5);
+  BOOST_CHECK_EQUAL(policy.getThrottling(), 1.0);
+  policy.setThrottling(-1.0);
+  BOOST_CHECK_EQUAL(policy.getThrottling(), 0.0);
+}
@@ -0,0 +1,126 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+#ifndef O2_SHARDEDHISTOGRAM_H
+#define O2_SHARDEDHISTOGRAM_H
+
+/// \file ShardedHistogram.h
+/// \brief Sharded histogram accumulation for concurrent filling without locks
+///
+/// \author Piotr Konopka, piotr.jan.konopka@cern.ch
+
+#include <TH1.h>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace o2::mergers
+{
+
+/// \brief A histogram which can be filled from several threads without locking.
+///
+/// Each filling thread accumulates into its own private shard (a clone of the
+/// prototype histogram), so the hot path of fill() involves no atomics and no
+/// mutexes - a lock is taken only the first time a given thread touches a given
+/// instance, to register the new shard. On publication createMerged() combines
+/// the shards into a single plain histogram, which then flows through the usual
+/// Mergers machinery (see algorithm::merge) unchanged.
+///
+/// Fills which are concurrent with createMerged() may or may not be included in
+/// the produced snapshot, which is the same guarantee a sampled monitoring
+/// histogram gives anyway. reset() must not run concurrently with fills.
+/// Filling threads must not outlive the object.
+class ShardedHistogram
+{
+ public:
+  /// \param prototype the binning and naming to be used by all shards
+  ShardedHistogram(const TH1& prototype)
+    : mInstanceId(nextInstanceId()), mPrototype(cloneDetached(prototype))
+  {
+  }
+
+  ShardedHistogram(const ShardedHistogram&) = delete;
+  ShardedHistogram& operator=(const ShardedHistogram&) = delete;
+
+  /// returns the shard owned by the calling thread, creating it on first use.
+  /// The reference allows arbitrary (also multi-dimensional) filling, the caller
+  /// must not share it with other threads.
+  TH1& shard()
+  {
+    thread_local std::unordered_map<size_t, TH1*> cache;
+    if (auto it = cache.find(mInstanceId); it != cache.end()) {
+      return *it->second;
+    }
+    std::lock_guard<std::mutex> lock(mShardsMutex);
+    mShards.emplace_back(cloneDetached(*mPrototype));
+    cache[mInstanceId] = mShards.back().get();
+    return *mShards.back();
+  }
+
+  /// fills the shard of the calling thread, lock-free after the first call
+  void fill(double x, double w = 1.)
+  {
+    shard().Fill(x, w);
+  }
+
+  /// combines all shards into a standalone histogram, ready to be published
+  std::unique_ptr<TH1> createMerged() const
+  {
+    std::lock_guard<std::mutex> lock(mShardsMutex);
+    auto merged = cloneDetached(*mPrototype);
+    for (const auto& shard : mShards) {
+      merged->Add(shard.get());
+    }
+    return merged;
+  }
+
+  /// clears the contents of all shards, e.g. after publishing a delta.
+  /// The shards stay registered, so filling threads keep their lock-free path.
+  void reset()
+  {
+    std::lock_guard<std::mutex> lock(mShardsMutex);
+    for (auto& shard : mShards) {
+      shard->Reset();
+    }
+  }
+
+  /// number of threads which filled this histogram so far
+  size_t getNShards() const
+  {
+    std::lock_guard<std::mutex> lock(mShardsMutex);
+    return mShards.size();
+  }
+
+ private:
+  static size_t nextInstanceId()
+  {
+    static std::atomic<size_t> id{0};
+    return ++id;
+  }
+
+  static std::unique_ptr<TH1> cloneDetached(const TH1& histo)
+  {
+    auto clone = std::unique_ptr<TH1>(static_cast<TH1*>(histo.Clone()));
+    clone->SetDirectory(nullptr); // shards are not to be managed by any file
+    return clone;
+  }
+
+  size_t mInstanceId;                        ///< key of the per-thread shard lookup, unique process-wide
+  std::unique_ptr<TH1> mPrototype;           ///< empty histogram defining binning and naming
+  mutable std::mutex mShardsMutex;           ///< protects shard registration and merging, not filling
+  std::vector<std::unique_ptr<TH1>> mShards; ///< one accumulation histogram per filling thread
+};
+
+} // namespace o2::mergers
+
+#endif // O2_SHARDEDHISTOGRAM_H
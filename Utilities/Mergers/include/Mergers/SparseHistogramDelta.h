@@ -0,0 +1,155 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+#ifndef O2_SPARSEHISTOGRAMDELTA_H
+#define O2_SPARSEHISTOGRAMDELTA_H
+
+/// \file SparseHistogramDelta.h
+/// \brief A sparse, bandwidth-saving representation of a histogram difference
+///
+/// \author Piotr Konopka, piotr.jan.konopka@cern.ch
+
+#include <TH1.h>
+#include <TNamed.h>
+#include <TProfile.h>
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "Mergers/MergeInterface.h"
+
+namespace o2::mergers
+{
+
+/// \brief Sparse representation of a histogram difference.
+///
+/// Producers running with InputObjectsTimespan::LastDifference can encode the
+/// difference accumulated since the last publication into this object instead
+/// of shipping the full histogram: only the non-empty bins of the difference
+/// are serialized, which for slowly changing histograms is a small fraction of
+/// the binning. Mergers apply such deltas incrementally onto the full target
+/// histogram (see algorithm::merge), intermediate layers combine deltas with
+/// each other through the MergeInterface. Entries and statistics moments are
+/// carried along, so applying a delta is equivalent to TH1::Add of the full
+/// difference. Profile histograms are not supported.
+class SparseHistogramDelta : public TNamed, public MergeInterface
+{
+ public:
+  SparseHistogramDelta() = default;
+
+  /// encodes the non-empty bins of the (difference) histogram
+  SparseHistogramDelta(const TH1& delta) : TNamed(delta.GetName(), delta.GetTitle())
+  {
+    if (delta.InheritsFrom(TProfile::Class())) {
+      throw std::runtime_error(std::string("Cannot encode the profile histogram '") + delta.GetName() + "' as a sparse delta");
+    }
+    mNCells = delta.GetNcells();
+    mEntries = delta.GetEntries();
+    Double_t stats[TH1::kNstat] = {0};
+    delta.GetStats(stats);
+    mStats.assign(stats, stats + TH1::kNstat);
+    const bool withSumw2 = delta.GetSumw2N() > 0;
+    for (int bin = 0; bin < mNCells; bin++) {
+      const double content = delta.GetBinContent(bin);
+      const double error2 = withSumw2 ? delta.GetSumw2()->At(bin) : 0.;
+      if (content != 0. || error2 != 0.) {
+        mBins.push_back(bin);
+        mContents.push_back(content);
+        if (withSumw2) {
+          mSumw2.push_back(error2);
+        }
+      }
+    }
+  }
+
+  ~SparseHistogramDelta() override = default;
+
+  /// adds the recorded bins to a full histogram with compatible binning
+  void applyTo(TH1* target) const
+  {
+    if (target->GetNcells() != mNCells) {
+      throw std::runtime_error(std::string("The sparse delta '") + GetName() + "' does not match the binning of the target '" + target->GetName() + "'");
+    }
+    if (!mSumw2.empty() && target->GetSumw2N() == 0) {
+      target->Sumw2();
+    }
+    const bool withSumw2 = target->GetSumw2N() > 0;
+    for (size_t i = 0; i < mBins.size(); i++) {
+      target->AddBinContent(mBins[i], mContents[i]);
+      if (withSumw2) {
+        // without an explicit Sumw2 the squared error of a bin equals its content
+        (*target->GetSumw2())[mBins[i]] += mSumw2.empty() ? mContents[i] : mSumw2[i];
+      }
+    }
+    Double_t stats[TH1::kNstat] = {0};
+    target->GetStats(stats);
+    for (size_t i = 0; i < mStats.size() && i < static_cast<size_t>(TH1::kNstat); i++) {
+      stats[i] += mStats[i];
+    }
+    target->PutStats(stats);
+    target->SetEntries(target->GetEntries() + mEntries);
+  }
+
+  /// combines two deltas, e.g. in an intermediate layer of the merger topology
+  void merge(MergeInterface* const other) override
+  {
+    auto otherDelta = dynamic_cast<SparseHistogramDelta const*>(other);
+    if (otherDelta == nullptr) {
+      throw std::runtime_error(std::string("An attempt to merge the sparse delta '") + GetName() + "' with an incompatible object");
+    }
+    if (otherDelta->mNCells != mNCells) {
+      throw std::runtime_error(std::string("The sparse deltas '") + GetName() + "' and '" + otherDelta->GetName() + "' have incompatible binning");
+    }
+    const bool anySumw2 = !mSumw2.empty() || !otherDelta->mSumw2.empty();
+    if (anySumw2 && mSumw2.empty()) {
+      mSumw2 = mContents;
+    }
+    for (size_t i = 0; i < otherDelta->mBins.size(); i++) {
+      const int bin = otherDelta->mBins[i];
+      const double content = otherDelta->mContents[i];
+      const double error2 = otherDelta->mSumw2.empty() ? content : otherDelta->mSumw2[i];
+      auto it = std::lower_bound(mBins.begin(), mBins.end(), bin);
+      const size_t pos = it - mBins.begin();
+      if (it != mBins.end() && *it == bin) {
+        mContents[pos] += content;
+        if (anySumw2) {
+          mSumw2[pos] += error2;
+        }
+      } else {
+        mBins.insert(it, bin);
+        mContents.insert(mContents.begin() + pos, content);
+        if (anySumw2) {
+          mSumw2.insert(mSumw2.begin() + pos, error2);
+        }
+      }
+    }
+    mEntries += otherDelta->mEntries;
+    for (size_t i = 0; i < otherDelta->mStats.size() && i < mStats.size(); i++) {
+      mStats[i] += otherDelta->mStats[i];
+    }
+  }
+
+  size_t getNStoredBins() const { return mBins.size(); }
+
+ private:
+  int mNCells = 0;           ///< total number of cells of the original histogram
+  double mEntries = 0.;      ///< number of entries of the difference
+  std::vector<double> mStats;    ///< statistics moments of the difference (TH1::GetStats)
+  std::vector<int> mBins;        ///< global bin numbers of the non-empty bins, ascending
+  std::vector<double> mContents; ///< contents of the stored bins
+  std::vector<double> mSumw2;    ///< sum of squared weights of the stored bins, empty if Sumw2 was off
+
+  ClassDefOverride(SparseHistogramDelta, 1);
+};
+
+} // namespace o2::mergers
+
+#endif // O2_SPARSEHISTOGRAMDELTA_H
@@ -19,6 +19,7 @@
 #include "Framework/Logger.h"
 #include "Mergers/MergeInterface.h"
 #include "Mergers/ObjectStore.h"
+#include "Mergers/SparseHistogramDelta.h"
 
 #include <TEfficiency.h>
 #include <TGraph.h>
@@ -56,6 +57,15 @@ void merge(TObject* const target, TObject* const other)
   }
   // fixme: should we check if names match?
 
+  // A sparse delta shipped by a producer is applied onto the full target histogram.
+  // Merging deltas with each other (in intermediate layers) is handled by the MergeInterface branch below.
+  if (auto sparseDelta = dynamic_cast<SparseHistogramDelta*>(other)) {
+    if (auto targetTH1 = dynamic_cast<TH1*>(target)) {
+      sparseDelta->applyTo(targetTH1);
+      return;
+    }
+  }
+
   // We expect that both objects follow the same structure, but we allow to add missing objects to TCollections.
   // First we check if an object contains a MergeInterface, as it should overlap default Merge() methods of TObject.
   if (auto custom = dynamic_cast<MergeInterface*>(target)) {
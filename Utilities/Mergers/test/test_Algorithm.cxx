@@ -27,6 +27,7 @@
 #include "Mergers/CustomMergeableTObject.h"
 #include "Mergers/CustomMergeableObject.h"
 #include "Mergers/ObjectStore.h"
+#include "Mergers/SparseHistogramDelta.h"
 
 #include <TObjArray.h>
 #include <TObjString.h>
@@ -352,6 +353,52 @@ BOOST_AUTO_TEST_CASE(AverageHisto)
   delete other;
 }
 
+BOOST_AUTO_TEST_CASE(SparseDelta)
+{
+  // applying a sparse delta should be equivalent to adding the full difference histogram
+  TH1F* target = new TH1F("histo 1", "histo 1", bins, min, max);
+  target->Fill(5);
+  target->Fill(5);
+
+  TH1F* difference = new TH1F("histo 2", "histo 2", bins, min, max);
+  difference->Fill(2);
+  difference->Fill(5);
+  difference->Fill(11); // overflow
+
+  TH1F* reference = static_cast<TH1F*>(target->Clone("reference"));
+  reference->Add(difference);
+
+  auto* delta = new SparseHistogramDelta(*difference);
+  BOOST_CHECK_EQUAL(delta->getNStoredBins(), 3);
+  BOOST_CHECK_NO_THROW(algorithm::merge(target, delta));
+
+  for (int bin = 0; bin < reference->GetNcells(); bin++) {
+    BOOST_CHECK_EQUAL(target->GetBinContent(bin), reference->GetBinContent(bin));
+  }
+  BOOST_CHECK_EQUAL(target->GetEntries(), reference->GetEntries());
+  BOOST_CHECK_CLOSE(target->GetMean(), reference->GetMean(), 0.001);
+
+  // a delta with incompatible binning should be refused
+  TH1F* incompatible = new TH1F("histo 3", "histo 3", bins + 1, min, max);
+  SparseHistogramDelta incompatibleDelta(*incompatible);
+  BOOST_CHECK_THROW(algorithm::merge(target, &incompatibleDelta), std::runtime_error);
+
+  // deltas merged with each other should accumulate, as in an intermediate merger layer
+  auto* delta2 = new SparseHistogramDelta(*difference);
+  BOOST_CHECK_NO_THROW(algorithm::merge(delta, delta2));
+  reference->Add(difference);
+  BOOST_CHECK_NO_THROW(algorithm::merge(target, delta));
+  BOOST_CHECK_EQUAL(target->GetBinContent(target->FindBin(2)), reference->GetBinContent(reference->FindBin(2)) + 1);
+  BOOST_CHECK_EQUAL(target->GetEntries(), reference->GetEntries() + 3);
+
+  delete delta2;
+  delete delta;
+  delete incompatible;
+  delete reference;
+  delete difference;
+  delete target;
+}
+
 BOOST_AUTO_TEST_SUITE(VectorOfHistos)
 
 gsl::span<float> to_span(std::shared_ptr<TH1F>& histo)
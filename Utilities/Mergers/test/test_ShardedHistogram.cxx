@@ -0,0 +1,109 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+/// \file test_ShardedHistogram.cxx
+/// \brief A unit test of the sharded histogram accumulation
+///
+/// \author Piotr Konopka, piotr.jan.konopka@cern.ch
+
+#define BOOST_TEST_MODULE Test Utilities ShardedHistogram
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+
+#include <boost/test/unit_test.hpp>
+
+#include "Mergers/ShardedHistogram.h"
+
+#include <TH1.h>
+#include <TH2.h>
+#include <thread>
+#include <vector>
+
+using namespace o2::mergers;
+
+BOOST_AUTO_TEST_CASE(SingleThread)
+{
+  TH1F prototype("histo", "histo", 10, 0, 10);
+  ShardedHistogram histo(prototype);
+
+  histo.fill(2);
+  histo.fill(5);
+  histo.fill(5, 2.);
+
+  BOOST_CHECK_EQUAL(histo.getNShards(), 1);
+  auto merged = histo.createMerged();
+  BOOST_CHECK_EQUAL(merged->GetBinContent(merged->FindBin(2)), 1);
+  BOOST_CHECK_EQUAL(merged->GetBinContent(merged->FindBin(5)), 3);
+  BOOST_CHECK_EQUAL(merged->GetEntries(), 3);
+
+  histo.reset();
+  merged = histo.createMerged();
+  BOOST_CHECK_EQUAL(merged->GetEntries(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(MultiThread)
+{
+  constexpr size_t nThreads = 4;
+  constexpr size_t fillsPerThread = 10000;
+
+  TH1F prototype("histo", "histo", 10, 0, 10);
+  ShardedHistogram histo(prototype);
+
+  std::vector<std::thread> threads;
+  for (size_t t = 0; t < nThreads; t++) {
+    threads.emplace_back([&histo, t]() {
+      for (size_t i = 0; i < fillsPerThread; i++) {
+        histo.fill((t + i) % 10);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  BOOST_CHECK_EQUAL(histo.getNShards(), nThreads);
+  auto merged = histo.createMerged();
+  BOOST_CHECK_EQUAL(merged->GetEntries(), nThreads * fillsPerThread);
+  for (int bin = 1; bin <= 10; bin++) {
+    BOOST_CHECK_EQUAL(merged->GetBinContent(bin), nThreads * fillsPerThread / 10);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(MultiDimensional)
+{
+  // multi-dimensional histograms are filled through the shard reference
+  TH2F prototype("histo2d", "histo2d", 10, 0, 10, 10, 0, 10);
+  ShardedHistogram histo(prototype);
+
+  static_cast<TH2&>(histo.shard()).Fill(2., 3.);
+  static_cast<TH2&>(histo.shard()).Fill(2., 3.);
+
+  auto merged = histo.createMerged();
+  auto merged2d = dynamic_cast<TH2*>(merged.get());
+  BOOST_REQUIRE(merged2d != nullptr);
+  BOOST_CHECK_EQUAL(merged2d->GetBinContent(merged2d->FindBin(2., 3.)), 2);
+}
+
+BOOST_AUTO_TEST_CASE(TwoInstances)
+{
+  // shards of different instances must not be mixed up within one thread
+  TH1F prototype("histo", "histo", 10, 0, 10);
+  ShardedHistogram histoA(prototype);
+  ShardedHistogram histoB(prototype);
+
+  histoA.fill(2);
+  histoB.fill(7);
+
+  BOOST_CHECK_EQUAL(histoA.createMerged()->GetBinContent(3), 1);
+  BOOST_CHECK_EQUAL(histoA.createMerged()->GetBinContent(8), 0);
+  BOOST_CHECK_EQUAL(histoB.createMerged()->GetBinContent(8), 1);
+  BOOST_CHECK_EQUAL(histoB.createMerged()->GetBinContent(3), 0);
+}
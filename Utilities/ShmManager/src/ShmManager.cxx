@@ -24,6 +24,7 @@
 #include <csignal>
 
 #include <chrono>
+#include <filesystem>
 #include <map>
 #include <mutex>
 #include <string>
@@ -56,6 +57,36 @@ void resetContentHandler(int /* signal */)
   gResetContent = 1;
 }
 
+// set the NUMA policy for subsequent allocations:
+// -2 process default, -1 interleave over all nodes, >=0 bind to the given node
+void setMemPolicy(int numaid)
+{
+#if !defined(__MACH__) && !defined(__APPLE__)
+  if (numaid == -2) {
+    LOG(info) << "Setting memory allocation to process default";
+    syscall(SYS_set_mempolicy, MPOL_DEFAULT, nullptr, 0);
+  } else if (numaid == -1) {
+    LOG(info) << "Setting memory allocation to NUMA interleaving";
+    unsigned long nodemask = 0xffffff;
+    syscall(SYS_set_mempolicy, MPOL_INTERLEAVE, &nodemask, sizeof(nodemask) * 8);
+  } else {
+    LOG(info) << "Setting memory allocation to NUMA id " << numaid;
+    unsigned long nodemask = 1 << numaid;
+    syscall(SYS_set_mempolicy, MPOL_BIND, &nodemask, sizeof(nodemask) * 8);
+  }
+#endif
+}
+
+// number of NUMA nodes as reported by the kernel
+int numberOfNumaNodes()
+{
+  int n = 0;
+  while (std::filesystem::exists("/sys/devices/system/node/node" + std::to_string(n))) {
+    n++;
+  }
+  return n > 0 ? n : 1;
+}
+
 struct ShmManager {
   ShmManager(uint64_t _shmId, const vector<string>& _segments, const vector<string>& _regions, uint64_t _refcount_segment_size, bool zero = true)
     : shmId(fair::mq::shmem::makeShmIdStr(_shmId))
@@ -73,6 +104,22 @@ struct ShmManager {
     LOG(info) << "Shared memory is ready for use.";
   }
 
+  void AddSegment(uint16_t id, uint64_t size, bool zero)
+  {
+    segmentCfgs.emplace_back(fair::mq::shmem::SegmentConfig{id, size, "rbtree_best_fit"});
+
+    auto ret = segments.emplace(id, fair::mq::shmem::Segment(shmId, id, size, fair::mq::shmem::rbTreeBestFit));
+    fair::mq::shmem::Segment& segment = ret.first->second;
+    LOG(info) << "Created segment " << id << " of size " << segment.GetSize() << ", starting at " << segment.GetData() << ". Locking...";
+    segment.Lock();
+    LOG(info) << "Done.";
+    if (zero) {
+      LOG(info) << "Zeroing...";
+      segment.Zero();
+      LOG(info) << "Done.";
+    }
+  }
+
   void AddSegments(const vector<string>& _segments, bool zero)
   {
     for (const auto& s : _segments) {
@@ -85,34 +132,50 @@ struct ShmManager {
       }
       uint16_t id = stoi(conf.at(0));
       uint64_t size = stoull(conf.at(1));
-      segmentCfgs.emplace_back(fair::mq::shmem::SegmentConfig{id, size, "rbtree_best_fit"});
-
-#if !defined(__MACH__) && !defined(__APPLE__)
       int numaid = stoi(conf.at(2));
-      if (numaid == -2) {
-        LOG(info) << "Setting memory allocation to process default";
-        syscall(SYS_set_mempolicy, MPOL_DEFAULT, nullptr, 0);
-      } else if (numaid == -1) {
-        LOG(info) << "Setting memory allocation to NUMA interleaving";
-        unsigned long nodemask = 0xffffff;
-        syscall(SYS_set_mempolicy, MPOL_INTERLEAVE, &nodemask, sizeof(nodemask) * 8);
+
+      if (numaid == -3) {
+        // one segment per NUMA node, each bound to its node, with consecutive
+        // ids starting at the configured one. Devices are expected to use the
+        // segment local to the socket they are pinned to.
+        int nNodes = numberOfNumaNodes();
+        if (nNodes < 2) {
+          LOG(info) << "Single NUMA node detected, falling back to interleaving for segment " << id;
+          setMemPolicy(-1);
+          AddSegment(id, size, zero);
+        } else {
+          LOG(info) << "Splitting segment " << id << " over " << nNodes << " NUMA nodes";
+          for (int node = 0; node < nNodes; node++) {
+            setMemPolicy(node);
+            AddSegment(id + node, size / nNodes, zero);
+          }
+        }
       } else {
-        LOG(info) << "Setting memory allocation to NUMA id " << numaid;
-        unsigned long nodemask = 1 << numaid;
-        syscall(SYS_set_mempolicy, MPOL_BIND, &nodemask, sizeof(nodemask) * 8);
+        setMemPolicy(numaid);
+        AddSegment(id, size, zero);
       }
-#endif
+    }
+  }
 
-      auto ret = segments.emplace(id, fair::mq::shmem::Segment(shmId, id, size, fair::mq::shmem::rbTreeBestFit));
-      fair::mq::shmem::Segment& segment = ret.first->second;
-      LOG(info) << "Created segment " << id << " of size " << segment.GetSize() << ", starting at " << segment.GetData() << ". Locking...";
-      segment.Lock();
+  void AddRegion(uint16_t id, uint64_t size, uint64_t _refcount_segment_size, bool zero)
+  {
+    fair::mq::RegionConfig cfg;
+    cfg.id = id;
+    cfg.size = size;
+    if (_refcount_segment_size != 1) {
+      cfg.rcSegmentSize = _refcount_segment_size;
+    }
+    regionCfgs.push_back(cfg);
+
+    auto ret = regions.emplace(id, make_unique<fair::mq::shmem::UnmanagedRegion>(shmId, cfg));
+    fair::mq::shmem::UnmanagedRegion& region = *(ret.first->second);
+    LOG(info) << "Created unamanged region " << id << " of size " << region.GetSize() << ", starting at " << region.GetData() << ". Locking...";
+    region.Lock();
+    LOG(info) << "Done.";
+    if (zero) {
+      LOG(info) << "Zeroing...";
+      region.Zero();
       LOG(info) << "Done.";
-      if (zero) {
-        LOG(info) << "Zeroing...";
-        segment.Zero();
-        LOG(info) << "Done.";
-      }
     }
   }
 
@@ -128,39 +191,25 @@ struct ShmManager {
       }
       uint16_t id = stoi(conf.at(0));
       uint64_t size = stoull(conf.at(1));
-      fair::mq::RegionConfig cfg;
-      cfg.id = id;
-      cfg.size = size;
-      if (_refcount_segment_size != 1) {
-        cfg.rcSegmentSize = _refcount_segment_size;
-      }
-      regionCfgs.push_back(cfg);
-
-#if !defined(__MACH__) && !defined(__APPLE__)
       int numaid = stoi(conf.at(2));
-      if (numaid == -2) {
-        LOG(info) << "Setting memory allocation to process default";
-        syscall(SYS_set_mempolicy, MPOL_DEFAULT, nullptr, 0);
-      } else if (numaid == -1) {
-        LOG(info) << "Setting memory allocation to NUMA interleaving";
-        unsigned long nodemask = 0xffffff;
-        syscall(SYS_set_mempolicy, MPOL_INTERLEAVE, &nodemask, sizeof(nodemask) * 8);
-      } else {
-        LOG(info) << "Setting memory allocation to NUMA id " << numaid;
-        unsigned long nodemask = 1 << numaid;
-        syscall(SYS_set_mempolicy, MPOL_BIND, &nodemask, sizeof(nodemask) * 8);
-      }
-#endif
 
-      auto ret = regions.emplace(id, make_unique<fair::mq::shmem::UnmanagedRegion>(shmId, cfg));
-      fair::mq::shmem::UnmanagedRegion& region = *(ret.first->second);
-      LOG(info) << "Created unamanged region " << id << " of size " << region.GetSize() << ", starting at " << region.GetData() << ". Locking...";
-      region.Lock();
-      LOG(info) << "Done.";
-      if (zero) {
-        LOG(info) << "Zeroing...";
-        region.Zero();
-        LOG(info) << "Done.";
+      if (numaid == -3) {
+        // as for the segments: one region per NUMA node with consecutive ids
+        int nNodes = numberOfNumaNodes();
+        if (nNodes < 2) {
+          LOG(info) << "Single NUMA node detected, falling back to interleaving for region " << id;
+          setMemPolicy(-1);
+          AddRegion(id, size, _refcount_segment_size, zero);
+        } else {
+          LOG(info) << "Splitting region " << id << " over " << nNodes << " NUMA nodes";
+          for (int node = 0; node < nNodes; node++) {
+            setMemPolicy(node);
+            AddRegion(id + node, size / nNodes, _refcount_segment_size, zero);
+          }
+        }
+      } else {
+        setMemPolicy(numaid);
+        AddRegion(id, size, _refcount_segment_size, zero);
       }
     }
   }
@@ -227,7 +276,7 @@ int main(int argc, char** argv)
     options_description desc("Options");
     desc.add_options()(
       "shmid", value<uint64_t>(&shmId)->required(), "Shm id")(
-      "segments", value<vector<string>>(&segments)->multitoken()->composing(), "Segments, as <id>,<size>,<numaid> <id>,<size>,<numaid> <id>,<size>,<numaid> ... (numaid: -2 disabled, -1 interleave, >=0 node)")(
+      "segments", value<vector<string>>(&segments)->multitoken()->composing(), "Segments, as <id>,<size>,<numaid> <id>,<size>,<numaid> <id>,<size>,<numaid> ... (numaid: -3 one segment per NUMA node (consecutive ids, size split evenly), -2 disabled, -1 interleave, >=0 node)")(
       "regions", value<vector<string>>(&regions)->multitoken()->composing(), "Regions, as <id>,<size> <id>,<size>,<numaid> <id>,<size>,<numaid> ...")(
       "nozero", value<bool>(&nozero)->default_value(false)->implicit_value(true), "Do not zero segments after initialization")(
       "check-presence", value<bool>(&checkPresence)->default_value(true)->implicit_value(true), "Check periodically if configured segments/regions are still present, and cleanup and leave if they are not")(
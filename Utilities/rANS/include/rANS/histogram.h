@@ -25,5 +25,6 @@
 #include "rANS/internal/containers/SparseHistogram.h"
 #include "rANS/internal/containers/RenormedHistogram.h"
 #include "rANS/internal/transform/renorm.h"
+#include "rANS/internal/transform/reuse.h"
 
 #endif /* RANS_HISTOGRAM_H_ */
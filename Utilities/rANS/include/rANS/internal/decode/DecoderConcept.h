@@ -16,6 +16,9 @@
 #ifndef RANS_INTERNAL_DECODE_DECODER_CONCEPT_H_
 #define RANS_INTERNAL_DECODE_DECODER_CONCEPT_H_
 
+#include <array>
+#include <utility>
+
 #include <fairlogger/Logger.h>
 #include <gsl/span>
 #include <stdexcept>
@@ -52,76 +55,112 @@ class DecoderConcept
   template <typename stream_IT, typename source_IT, typename literals_IT = std::nullptr_t, std::enable_if_t<utils::isCompatibleIter_v<typename symbolTable_T::source_type, source_IT>, bool> = true>
   void process(stream_IT inputEnd, source_IT outputBegin, size_t messageLength, size_t nStreams, literals_IT literalsEnd = nullptr) const
   {
-    {
+    if (messageLength == 0) {
+      LOG(warning) << "Empty message passed to decoder, skipping decode process";
+      return;
+    }
 
-      if (messageLength == 0) {
-        LOG(warning) << "Empty message passed to decoder, skipping decode process";
-        return;
-      }
+    if (!(nStreams > 1 && internal::isPow2(nStreams))) {
+      throw DecodingError(fmt::format("Invalid number of decoder streams {}", nStreams));
+    }
 
-      if (!(nStreams > 1 && internal::isPow2(nStreams))) {
-        throw DecodingError(fmt::format("Invalid number of decoder streams {}", nStreams));
-      }
+    // the number of interleaved states is a small power of two fixed by the encoder preset;
+    // dispatching to a compile-time stream count keeps the states in a stack array and lets the
+    // compiler fully unroll the interleaved loop instead of iterating over a heap-allocated vector
+    switch (nStreams) {
+      case 2:
+        processImpl<2>(inputEnd, outputBegin, messageLength, nStreams, literalsEnd);
+        break;
+      case 4:
+        processImpl<4>(inputEnd, outputBegin, messageLength, nStreams, literalsEnd);
+        break;
+      case 8:
+        processImpl<8>(inputEnd, outputBegin, messageLength, nStreams, literalsEnd);
+        break;
+      case 16:
+        processImpl<16>(inputEnd, outputBegin, messageLength, nStreams, literalsEnd);
+        break;
+      default:
+        processImpl<0>(inputEnd, outputBegin, messageLength, nStreams, literalsEnd);
+        break;
+    }
+  }
+
+  template <typename literals_IT = std::nullptr_t>
+  inline void process(gsl::span<const stream_type> inputStream, gsl::span<source_type> outputStream, size_t messageLength, size_t nStreams, literals_IT literalsEnd = nullptr) const
+  {
+    process(inputStream.data() + inputStream.size(), outputStream.data(), nStreams, literalsEnd);
+  };
+
+ private:
+  template <size_t... Idx>
+  inline auto makeDecoderArray(std::index_sequence<Idx...>) const
+  {
+    return std::array<coder_type, sizeof...(Idx)>{(static_cast<void>(Idx), coder_type{this->mSymbolTable.getPrecision()})...};
+  }
 
-      stream_IT inputIter = inputEnd;
-      --inputIter;
-      source_IT outputIter = outputBegin;
-      literals_IT literalsIter = literalsEnd;
-
-      auto lookupSymbol = [&literalsIter, this](uint32_t cumulativeFrequency) -> value_type {
-        if constexpr (!std::is_null_pointer_v<literals_IT>) {
-          if (this->mSymbolTable.isEscapeSymbol(cumulativeFrequency)) {
-            return value_type{*(--literalsIter), this->mSymbolTable.getEscapeSymbol()};
-          } else {
-            return this->mSymbolTable[cumulativeFrequency];
-          }
+  // nStreams_V == 0 selects the generic variant with a runtime number of states
+  template <size_t nStreams_V, typename stream_IT, typename source_IT, typename literals_IT>
+  void processImpl(stream_IT inputEnd, source_IT outputBegin, size_t messageLength, size_t nStreams, literals_IT literalsEnd) const
+  {
+    stream_IT inputIter = inputEnd;
+    --inputIter;
+    source_IT outputIter = outputBegin;
+    literals_IT literalsIter = literalsEnd;
+
+    auto lookupSymbol = [&literalsIter, this](uint32_t cumulativeFrequency) -> value_type {
+      if constexpr (!std::is_null_pointer_v<literals_IT>) {
+        if (this->mSymbolTable.isEscapeSymbol(cumulativeFrequency)) {
+          return value_type{*(--literalsIter), this->mSymbolTable.getEscapeSymbol()};
         } else {
           return this->mSymbolTable[cumulativeFrequency];
         }
-      };
+      } else {
+        return this->mSymbolTable[cumulativeFrequency];
+      }
+    };
 
-      auto decode = [&, this](coder_type& decoder) {
-        const auto cumul = decoder.get();
-        const value_type symbol = lookupSymbol(cumul);
+    auto decode = [&, this](coder_type& decoder) {
+      const auto cumul = decoder.get();
+      const value_type symbol = lookupSymbol(cumul);
 #ifdef RANS_LOG_PROCESSED_DATA
-        arrayLogger << symbol.first;
+      arrayLogger << symbol.first;
 #endif
-        return std::make_tuple(symbol.first, decoder.advanceSymbol(inputIter, symbol.second));
-      };
-
-      std::vector<coder_type> decoders{nStreams, coder_type{this->mSymbolTable.getPrecision()}};
-      for (auto& decoder : decoders) {
-        inputIter = decoder.init(inputIter);
+      return std::make_tuple(symbol.first, decoder.advanceSymbol(inputIter, symbol.second));
+    };
+
+    auto decoders = [&]() {
+      if constexpr (nStreams_V != 0) {
+        return makeDecoderArray(std::make_index_sequence<nStreams_V>{});
+      } else {
+        return std::vector<coder_type>{nStreams, coder_type{this->mSymbolTable.getPrecision()}};
       }
+    }();
+    for (auto& decoder : decoders) {
+      inputIter = decoder.init(inputIter);
+    }
 
-      const size_t nLoops = messageLength / nStreams;
-      const size_t nLoopRemainder = messageLength % nStreams;
+    const size_t nLoops = messageLength / decoders.size();
+    const size_t nLoopRemainder = messageLength % decoders.size();
 
-      for (size_t i = 0; i < nLoops; ++i) {
+    for (size_t i = 0; i < nLoops; ++i) {
 #if defined(RANS_OPENMP)
 #pragma omp unroll partial(2)
 #endif
-        for (auto& decoder : decoders) {
-          std::tie(*outputIter++, inputIter) = decode(decoder);
-        }
+      for (auto& decoder : decoders) {
+        std::tie(*outputIter++, inputIter) = decode(decoder);
       }
+    }
 
-      for (size_t i = 0; i < nLoopRemainder; ++i) {
-        std::tie(*outputIter++, inputIter) = decode(decoders[i]);
-      }
+    for (size_t i = 0; i < nLoopRemainder; ++i) {
+      std::tie(*outputIter++, inputIter) = decode(decoders[i]);
+    }
 
 #ifdef RANS_LOG_PROCESSED_DATA
-      LOG(info) << "decoderOutput:" << arrayLogger;
+    LOG(info) << "decoderOutput:" << arrayLogger;
 #endif
-    }
   }
 
-  template <typename literals_IT = std::nullptr_t>
-  inline void process(gsl::span<const stream_type> inputStream, gsl::span<source_type> outputStream, size_t messageLength, size_t nStreams, literals_IT literalsEnd = nullptr) const
-  {
-    process(inputStream.data() + inputStream.size(), outputStream.data(), nStreams, literalsEnd);
-  };
-
  protected:
   symbolTable_type mSymbolTable{};
 
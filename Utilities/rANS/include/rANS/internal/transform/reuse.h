@@ -0,0 +1,106 @@
+// Copyright 2019-2023 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+/// @file   reuse.h
+/// @author Michael Lettrich
+/// @brief  Amortize dictionary renorming over consecutive messages with similar symbol distributions.
+
+#ifndef RANS_INTERNAL_TRANSFORM_REUSE_H_
+#define RANS_INTERNAL_TRANSFORM_REUSE_H_
+
+#include <cmath>
+#include <cstdint>
+
+#include "rANS/internal/containers/DenseHistogram.h"
+#include "rANS/internal/containers/RenormedHistogram.h"
+#include "rANS/internal/metrics/Metrics.h"
+#include "rANS/internal/transform/algorithm.h"
+#include "rANS/internal/transform/renorm.h"
+
+namespace o2::rans
+{
+
+/// compute the total variation distance in [0,1] between the distribution of a freshly built
+/// histogram and the one frozen into a previously renormed histogram. 0 means identical
+/// distributions, 1 means disjoint ones.
+template <typename source_T>
+[[nodiscard]] double computeDistributionShift(const DenseHistogram<source_T>& fresh, const RenormedDenseHistogram<source_T>& reference)
+{
+  if (fresh.empty() || reference.empty()) {
+    return 1.0;
+  }
+  const double pNorm = 1.0 / static_cast<double>(fresh.getNumSamples());
+  const double qNorm = 1.0 / static_cast<double>(reference.getNumSamples());
+  const int64_t refMin = static_cast<int64_t>(reference.getOffset());
+  const int64_t refMax = refMin + static_cast<int64_t>(reference.size()) - 1;
+
+  double sumAbsDiff = 0.;
+  double refMassCovered = 0.;
+  internal::forEachIndexValue(fresh, [&](source_T sourceSymbol, uint32_t frequency) {
+    if (frequency == 0) {
+      return;
+    }
+    const int64_t index = static_cast<int64_t>(sourceSymbol);
+    const double q = (index >= refMin && index <= refMax) ? static_cast<double>(reference[sourceSymbol]) * qNorm : 0.;
+    refMassCovered += q;
+    sumAbsDiff += std::abs(static_cast<double>(frequency) * pNorm - q);
+  });
+  // reference mass sitting on symbols the fresh message does not use has shifted away as well
+  sumAbsDiff += std::max(0., 1. - refMassCovered);
+  return 0.5 * sumAbsDiff;
+};
+
+/// Caches the renormed histogram of the previous message and hands it out again for subsequent
+/// messages (e.g. consecutive timeframes of the same CTF column) as long as the distribution
+/// shift stays below a threshold, turning the per-message dictionary construction into a
+/// comparison-only fast path. The cached dictionary always keeps an incompressible symbol, so
+/// symbols the reused dictionary does not cover are still encodable as literals.
+template <typename source_T>
+class RenormCache
+{
+ public:
+  using source_type = source_T;
+  using histogram_type = DenseHistogram<source_type>;
+  using renormedHistogram_type = RenormedDenseHistogram<source_type>;
+
+  RenormCache() = default;
+  explicit RenormCache(double threshold) : mThreshold{threshold} {};
+
+  /// renorm the histogram, reusing the previously built dictionary if the total variation
+  /// distance between both distributions is below the threshold
+  const renormedHistogram_type& renorm(histogram_type histogram, Metrics<source_type>& metrics)
+  {
+    mReused = !mRenormed.empty() && computeDistributionShift(histogram, mRenormed) < mThreshold;
+    if (!mReused) {
+      mRenormed = o2::rans::renorm(std::move(histogram), metrics, RenormingPolicy::ForceIncompressible);
+    }
+    return mRenormed;
+  };
+
+  [[nodiscard]] inline bool wasReused() const noexcept { return mReused; };
+
+  [[nodiscard]] inline double getThreshold() const noexcept { return mThreshold; };
+
+  inline void reset()
+  {
+    mRenormed = renormedHistogram_type{};
+    mReused = false;
+  };
+
+ private:
+  renormedHistogram_type mRenormed{};
+  double mThreshold{0.05};
+  bool mReused{false};
+};
+
+} // namespace o2::rans
+
+#endif /* RANS_INTERNAL_TRANSFORM_REUSE_H_ */
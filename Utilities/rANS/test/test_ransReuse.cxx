@@ -0,0 +1,124 @@
+// Copyright 2019-2023 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+/// @file   test_ransReuse.cxx
+/// @author Michael Lettrich
+/// @brief  test renormed dictionary reuse across messages with similar symbol distributions
+
+#define BOOST_TEST_MODULE Utility test
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+
+#undef NDEBUG
+#include <cassert>
+
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include "rANS/histogram.h"
+#include "rANS/factory.h"
+
+using namespace o2::rans;
+
+using source_type = uint8_t;
+
+namespace
+{
+std::vector<source_type> makeMessage(std::initializer_list<std::pair<source_type, size_t>> symbolCounts)
+{
+  std::vector<source_type> message;
+  for (const auto& [symbol, count] : symbolCounts) {
+    message.insert(message.end(), count, symbol);
+  }
+  return message;
+}
+} // namespace
+
+BOOST_AUTO_TEST_CASE(test_distributionShift)
+{
+  const auto message = makeMessage({{1, 40}, {2, 30}, {3, 20}, {4, 10}});
+  auto histogram = makeDenseHistogram::fromSamples(message.begin(), message.end());
+  Metrics<source_type> metrics{histogram};
+  const auto renormed = renorm(histogram, metrics, RenormingPolicy::ForceIncompressible);
+
+  // identical distributions differ only by renorming rounding
+  auto sameHistogram = makeDenseHistogram::fromSamples(message.begin(), message.end());
+  BOOST_CHECK_SMALL(computeDistributionShift(sameHistogram, renormed), 1e-3);
+
+  // disjoint alphabets are maximally distant
+  const auto disjointMessage = makeMessage({{100, 50}, {101, 50}});
+  auto disjointHistogram = makeDenseHistogram::fromSamples(disjointMessage.begin(), disjointMessage.end());
+  BOOST_CHECK_CLOSE(computeDistributionShift(disjointHistogram, renormed), 1.0, 1e-3);
+
+  // an empty histogram can never reuse a dictionary
+  DenseHistogram<source_type> emptyHistogram{};
+  BOOST_CHECK_EQUAL(computeDistributionShift(emptyHistogram, renormed), 1.0);
+}
+
+BOOST_AUTO_TEST_CASE(test_renormCacheReuse)
+{
+  RenormCache<source_type> cache{0.05};
+
+  const auto message = makeMessage({{1, 400}, {2, 300}, {3, 200}, {4, 100}});
+  Metrics<source_type> metrics{makeDenseHistogram::fromSamples(message.begin(), message.end())};
+  cache.renorm(makeDenseHistogram::fromSamples(message.begin(), message.end()), metrics);
+  BOOST_CHECK_EQUAL(cache.wasReused(), false);
+
+  // a slightly perturbed message reuses the cached dictionary
+  const auto similarMessage = makeMessage({{1, 395}, {2, 305}, {3, 198}, {4, 102}});
+  Metrics<source_type> similarMetrics{makeDenseHistogram::fromSamples(similarMessage.begin(), similarMessage.end())};
+  cache.renorm(makeDenseHistogram::fromSamples(similarMessage.begin(), similarMessage.end()), similarMetrics);
+  BOOST_CHECK_EQUAL(cache.wasReused(), true);
+
+  // a strongly shifted distribution forces a rebuild
+  const auto shiftedMessage = makeMessage({{1, 100}, {2, 100}, {3, 100}, {4, 700}});
+  Metrics<source_type> shiftedMetrics{makeDenseHistogram::fromSamples(shiftedMessage.begin(), shiftedMessage.end())};
+  cache.renorm(makeDenseHistogram::fromSamples(shiftedMessage.begin(), shiftedMessage.end()), shiftedMetrics);
+  BOOST_CHECK_EQUAL(cache.wasReused(), false);
+
+  cache.reset();
+  Metrics<source_type> resetMetrics{makeDenseHistogram::fromSamples(message.begin(), message.end())};
+  cache.renorm(makeDenseHistogram::fromSamples(message.begin(), message.end()), resetMetrics);
+  BOOST_CHECK_EQUAL(cache.wasReused(), false);
+}
+
+BOOST_AUTO_TEST_CASE(test_encodeDecodeWithReusedDictionary)
+{
+  RenormCache<source_type> cache{0.05};
+
+  const auto firstMessage = makeMessage({{1, 400}, {2, 300}, {3, 200}, {4, 100}});
+  Metrics<source_type> firstMetrics{makeDenseHistogram::fromSamples(firstMessage.begin(), firstMessage.end())};
+  cache.renorm(makeDenseHistogram::fromSamples(firstMessage.begin(), firstMessage.end()), firstMetrics);
+  BOOST_CHECK_EQUAL(cache.wasReused(), false);
+
+  // the second message contains symbol 5 which the cached dictionary does not cover;
+  // it must round-trip as a literal via the incompressible symbol
+  auto secondMessage = makeMessage({{1, 398}, {2, 300}, {3, 200}, {4, 100}});
+  secondMessage.push_back(5);
+  secondMessage.push_back(5);
+  Metrics<source_type> secondMetrics{makeDenseHistogram::fromSamples(secondMessage.begin(), secondMessage.end())};
+  const auto& renormed = cache.renorm(makeDenseHistogram::fromSamples(secondMessage.begin(), secondMessage.end()), secondMetrics);
+  BOOST_CHECK_EQUAL(cache.wasReused(), true);
+  BOOST_CHECK(renormed.hasIncompressibleSymbol());
+
+  const auto encoder = makeDenseEncoder<>::fromRenormed(renormed);
+  const auto decoder = makeDecoder<>::fromRenormed(renormed);
+
+  std::vector<uint32_t> encodeBuffer(secondMessage.size() + 256, 0);
+  std::vector<source_type> literals(secondMessage.size());
+  auto [encodeBufferEnd, literalBufferEnd] = encoder.process(secondMessage.begin(), secondMessage.end(), encodeBuffer.begin(), literals.begin());
+
+  std::vector<source_type> decodeBuffer(secondMessage.size());
+  decoder.process(encodeBufferEnd, decodeBuffer.begin(), secondMessage.size(), encoder.getNStreams(), literalBufferEnd);
+
+  BOOST_CHECK_EQUAL_COLLECTIONS(decodeBuffer.begin(), decodeBuffer.end(), secondMessage.begin(), secondMessage.end());
+}
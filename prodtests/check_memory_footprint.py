@@ -0,0 +1,119 @@
+#!/usr/bin/env python3
+
+# Compare the per-device memory metrics of a DPL resources-monitoring dump
+# (performanceMetrics.json, written when a workflow runs with
+# --resources-monitoring <sec>) against a stored baseline and fail on
+# regressions beyond a configurable threshold.
+#
+# For every device (and the driver) the summary contains the peak of each
+# numeric metric matching the metric filter (by default the memory / shm /
+# byte-counter metrics), and for cumulative *-delta metrics additionally the
+# average rate per second. Baselines are plain JSON files with the same
+# structure, so they can be inspected and updated by hand if needed.
+#
+# Used by memory_footprint_test.sh, but can also be run standalone on any
+# performanceMetrics.json.
+
+import argparse
+import json
+import os
+import re
+import sys
+
+
+def load_summary(metricsfile, metricfilter):
+    """Reduce a performanceMetrics.json to {device: {metric: value}}"""
+    with open(metricsfile) as f:
+        dump = json.load(f)
+    matcher = re.compile(metricfilter)
+    summary = {}
+    for device, metrics in dump.items():
+        devsummary = {}
+        for name, points in metrics.items():
+            if not matcher.search(name):
+                continue
+            try:
+                values = [float(p["value"]) for p in points]
+                timestamps = [float(p["timestamp"]) for p in points]
+            except (ValueError, KeyError, TypeError):
+                continue  # string metric or malformed node
+            if not values:
+                continue
+            devsummary[name + ".peak"] = max(values)
+            if name.endswith("-delta") and len(timestamps) > 1:
+                elapsed = (timestamps[-1] - timestamps[0]) / 1000.0
+                if elapsed > 0:
+                    devsummary[name + ".rate/s"] = sum(values) / elapsed
+        if devsummary:
+            summary[device] = devsummary
+    return summary
+
+
+def compare(baseline, current, threshold, minabs):
+    """Return the list of (device, metric, base, cur) regressions"""
+    regressions = []
+    for device, metrics in baseline.items():
+        if device not in current:
+            print(f"INFO: device {device} in baseline but not in current run")
+            continue
+        for name, base in metrics.items():
+            cur = current[device].get(name)
+            if cur is None:
+                print(f"INFO: metric {device}/{name} in baseline but not in current run")
+                continue
+            if cur > base * (1.0 + threshold / 100.0) and cur - base > minabs:
+                regressions.append((device, name, base, cur))
+    for device in current:
+        if device not in baseline:
+            print(f"INFO: new device {device} not covered by baseline")
+    return regressions
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Check DPL memory metrics against a baseline")
+    parser.add_argument("metricsfile", help="performanceMetrics.json produced with --resources-monitoring")
+    parser.add_argument("--baseline", help="baseline JSON file to compare against / to write")
+    parser.add_argument("--update-baseline", action="store_true",
+                        help="write the summary of this run as new baseline instead of comparing")
+    parser.add_argument("--threshold", type=float, default=10.0,
+                        help="relative growth in percent tolerated per metric (default: %(default)s)")
+    parser.add_argument("--min-abs-delta", type=float, default=0.0,
+                        help="ignore regressions with an absolute growth below this value")
+    parser.add_argument("--metric-filter", default=r"(?i)(memory|rss|pss|set-size|shm|bytes)",
+                        help="regex selecting the metrics to summarize (default: %(default)s)")
+    parser.add_argument("--label", default="", help="label to prefix report lines with (e.g. the stage name)")
+    args = parser.parse_args()
+
+    label = f"[{args.label}] " if args.label else ""
+    current = load_summary(args.metricsfile, args.metric_filter)
+    if not current:
+        print(f"{label}ERROR: no matching metrics found in {args.metricsfile}, "
+              "was the workflow run with --resources-monitoring?")
+        return 1
+
+    if not args.baseline:
+        for device in sorted(current):
+            for name, value in sorted(current[device].items()):
+                print(f"{label}{device}/{name} = {value:.2f}")
+        return 0
+
+    if args.update_baseline or not os.path.exists(args.baseline):
+        with open(args.baseline, "w") as f:
+            json.dump(current, f, indent=2, sort_keys=True)
+        print(f"{label}baseline {args.baseline} written from {args.metricsfile}")
+        return 0
+
+    with open(args.baseline) as f:
+        baseline = json.load(f)
+    regressions = compare(baseline, current, args.threshold, args.min_abs_delta)
+    for device, name, base, cur in regressions:
+        print(f"{label}REGRESSION: {device}/{name}: {base:.2f} -> {cur:.2f} "
+              f"(+{(cur / base - 1.0) * 100.0:.1f}%, threshold {args.threshold}%)")
+    if regressions:
+        return 1
+    print(f"{label}all metrics within {args.threshold}% of {args.baseline}")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
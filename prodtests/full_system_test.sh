@@ -285,6 +285,10 @@ for STAGE in $STAGES; do
   # --- record interesting metrics to monitor ----
   # boolean flag indicating if workflow completed successfully at all
   RC=$?
+
+  # preserve the resources-monitoring dump of this stage (written when running
+  # with --resources-monitoring) before the next stage overwrites it
+  [[ -f performanceMetrics.json ]] && mv performanceMetrics.json performanceMetrics_${STAGE}.json
   SUCCESS=0
   [[ -f "${logfile}_done" ]] && [[ "$RC" = 0 ]] && SUCCESS=1
   echo "success_${STAGE},${TAG} value=${SUCCESS}" >> ${METRICFILE}
@@ -0,0 +1,78 @@
+#!/bin/bash
+#
+# Memory-footprint regression test for the standard workflows:
+# runs the full system test (simulation + sync / async reconstruction stages)
+# with DPL resources monitoring enabled and compares the per-device memory
+# metrics (peak RSS, shm usage, allocation counters) of each stage against
+# stored baselines, failing if any metric grew beyond the threshold.
+#
+# Baselines are plain JSON files (one per stage) kept in MEM_BASELINE_DIR.
+# On the first run (or with MEM_UPDATE_BASELINES=1) they are (re)created from
+# the current run instead of compared, so bootstrapping a new reference
+# machine is just running the test once.
+#
+# Relevant environment variables (on top of those of full_system_test.sh):
+# - BEAMTYPE: pp or PbPb (default pp, to keep the canned input small)
+# - NEvents / NTIMEFRAMES: size of the canned input (defaults 10 / 1)
+# - MEM_MONITORING_INTERVAL: resources-monitoring sampling interval in seconds
+# - MEM_BASELINE_DIR: where the baseline JSON files live
+# - MEM_THRESHOLD: tolerated relative growth per metric in percent
+# - MEM_UPDATE_BASELINES: set to 1 to rewrite the baselines from this run
+
+if [ "0$O2_ROOT" == "0" ]; then
+  echo Missing O2sim environment
+  exit 1
+fi
+
+MYDIR="$(dirname $(realpath $0))"
+
+BEAMTYPE=${BEAMTYPE:-pp}
+NEvents=${NEvents:-10}
+NTIMEFRAMES=${NTIMEFRAMES:-1}
+MEM_MONITORING_INTERVAL=${MEM_MONITORING_INTERVAL:-2}
+MEM_BASELINE_DIR=${MEM_BASELINE_DIR:-$PWD/memory-baselines}
+MEM_THRESHOLD=${MEM_THRESHOLD:-10}
+MEM_UPDATE_BASELINES=${MEM_UPDATE_BASELINES:-0}
+
+export BEAMTYPE NEvents NTIMEFRAMES
+# -b is what full_system_test.sh uses by default, the resources-monitoring
+# option makes each o2-dpl-run driver dump performanceMetrics.json on exit,
+# which full_system_test.sh preserves per stage
+export GLOBALDPLOPT="-b --resources-monitoring ${MEM_MONITORING_INTERVAL}"
+
+${MYDIR}/full_system_test.sh
+RC=$?
+if [[ $RC != 0 ]]; then
+  echo "full_system_test.sh failed with exit code $RC, not checking memory baselines" 1>&2
+  exit $RC
+fi
+
+mkdir -p ${MEM_BASELINE_DIR}
+
+UPDATEOPT=
+[[ $MEM_UPDATE_BASELINES == "1" ]] && UPDATEOPT="--update-baseline"
+
+FAILURES=0
+FOUND=0
+for METRICSFILE in performanceMetrics_*.json; do
+  [[ -f $METRICSFILE ]] || continue
+  FOUND=1
+  STAGE=${METRICSFILE#performanceMetrics_}
+  STAGE=${STAGE%.json}
+  ${MYDIR}/check_memory_footprint.py ${METRICSFILE} \
+    --baseline ${MEM_BASELINE_DIR}/memory_baseline_${BEAMTYPE}_${STAGE}.json \
+    --threshold ${MEM_THRESHOLD} --label "${BEAMTYPE}/${STAGE}" ${UPDATEOPT}
+  [[ $? != 0 ]] && FAILURES=$((FAILURES + 1))
+done
+
+if [[ $FOUND == 0 ]]; then
+  echo "No performanceMetrics_*.json found, resources monitoring did not run" 1>&2
+  exit 1
+fi
+
+if [[ $FAILURES != 0 ]]; then
+  echo "Memory footprint regression detected in $FAILURES stage(s)" 1>&2
+  exit 1
+fi
+echo "Memory footprint within baselines"
+exit 0
@@ -514,9 +514,18 @@ class O2PrimaryServerDevice final : public fair::mq::Device
         mNeedNewEvent = false;
         mPartCounter = 0;
         mEventCounter++;
+        // take over the generated event, so that the generator thread can
+        // already produce the next one while this one is being served to the
+        // transport workers (previously generation only restarted once the
+        // last chunk had been handed out)
+        mServingPrimaries = mStack->getPrimaries();
+        mServingHeader = mEventHeader;
+        if (mEventCounter < mMaxEvents) {
+          mGeneratorThread = std::thread(&O2PrimaryServerDevice::generateEvent, this);
+        }
       }
 
-      auto& prims = mStack->getPrimaries();
+      auto& prims = mServingPrimaries;
       auto numberofparts = (int)std::ceil(prims.size() / (1. * mChunkGranularity));
       // number of parts should be at least 1 (even if empty)
       numberofparts = std::max(1, numberofparts);
@@ -534,7 +543,7 @@ class O2PrimaryServerDevice final : public fair::mq::Device
       const uint64_t drawnSeed = (uint64_t)(static_cast<double>(std::numeric_limits<uint32_t>::max()) * mSeedGenerator.Rndm());
       i.seed = mUseFixedChunkSeed ? mFixedChunkSeed : drawnSeed;
       i.index = m.mParticles.size();
-      i.mMCEventHeader = mEventHeader;
+      i.mMCEventHeader = mServingHeader;
       m.mSubEventInfo = i;
 
       int endindex = prims.size() - mPartCounter * mChunkGranularity;
@@ -563,11 +572,9 @@ class O2PrimaryServerDevice final : public fair::mq::Device
 
       mPartCounter++;
       if (mPartCounter == numberofparts) {
+        // the next event is already being generated concurrently; just flag
+        // that the next request needs to pick it up
         mNeedNewEvent = true;
-        // start generation of a new event
-        if (mEventCounter < mMaxEvents) {
-          mGeneratorThread = std::thread(&O2PrimaryServerDevice::generateEvent, this);
-        }
       }
 
       TMessage* tmsg = new TMessage(kMESS_OBJECT);
@@ -651,6 +658,8 @@ class O2PrimaryServerDevice final : public fair::mq::Device
   o2::eventgen::PrimaryGenerator* mPrimGen = nullptr;               // the current primary generator
   o2::dataformats::MCEventHeader mEventHeader;
   o2::data::Stack* mStack = nullptr; // the stack which is filled (pointer since constructor to be called only init method)
+  std::vector<TParticle> mServingPrimaries;          // primaries of the event currently served (decoupled from the stack receiving the next event)
+  o2::dataformats::MCEventHeader mServingHeader;     // header of the event currently served
   int mChunkGranularity = 500;       // how many primaries to send to a worker
   int mPartCounter = 0;
   bool mNeedNewEvent = true;